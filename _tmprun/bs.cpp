@@ -0,0 +1,11 @@
+#include "src/catapult/cache_core/AccountStateCache.h"
+#include "plugins/txes/mosaic/src/cache/MosaicCache.h"
+#include "plugins/txes/namespace/src/cache/NamespaceCache.h"
+#include "src/catapult/cache_core/BlockDifficultyCache.h"
+namespace catapult { namespace cache {
+	void g(const CacheConfiguration& config) {
+		AccountStateCache a(config, AccountStateCacheTypes::Options());
+		MosaicCache m(config);
+		NamespaceCache n(config, NamespaceCacheTypes::Options());
+	}
+}}
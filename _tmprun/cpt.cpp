@@ -0,0 +1,14 @@
+#include "catapult/cache/CachePatriciaTree.h"
+#include "catapult/cache/SingleSetCacheTypesAdapter.h"
+#include "catapult/cache/CacheConfiguration.h"
+#include "catapult/tree/BasePatriciaTree.h"
+#include "tests/catapult/cache/test/PatriciaTreeTestUtils.h"
+namespace catapult { namespace cache {
+	using T = tree::BasePatriciaTree<SerializerPlainKeyEncoder<test::MemoryPatriciaTreeSimpleSerializer>, PatriciaTreeRdbDataSource>;
+	void f(CacheDatabase& db, const CacheConfiguration& config) {
+		CachePatriciaTree<T> tree(true, db, 1, config.PatriciaTreeNodeCacheOptions, config.PatriciaTreeNumRetainedRoots);
+		tree.commit();
+		auto s = tree.garbageStatistics();
+		(void)s;
+	}
+}}
@@ -19,14 +19,26 @@
 **/
 
 #include "src/FileBlockChainStorage.h"
+#include "src/StateChangeLog.h"
+#include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/extensions/LocalNodeBootstrapper.h"
+#include "catapult/subscribers/StateChangeSubscriber.h"
 
 namespace catapult { namespace filechain {
 
 	namespace {
 		void RegisterExtension(extensions::LocalNodeBootstrapper& bootstrapper) {
+			const auto& config = bootstrapper.config();
+
+			// state changes are only logged when state is saved in files (and not in the cache database)
+			std::shared_ptr<StateChangeLog> pStateChangeLog;
+			if (0 != config.Node.StateChangeLogFlushInterval && !config.Node.ShouldUseCacheDatabaseStorage) {
+				pStateChangeLog = std::make_shared<StateChangeLog>(config.User.DataDirectory, config.Node.StateChangeLogFlushInterval);
+				bootstrapper.subscriptionManager().addStateChangeSubscriber(CreateStateChangeLogSubscriber(pStateChangeLog));
+			}
+
 			// register storage
-			bootstrapper.extensionManager().setBlockChainStorage(CreateFileBlockChainStorage());
+			bootstrapper.extensionManager().setBlockChainStorage(CreateFileBlockChainStorage(pStateChangeLog));
 		}
 	}
 }}
@@ -21,6 +21,7 @@
 #include "FileBlockChainStorage.h"
 #include "LocalNodeStateStorage.h"
 #include "MultiBlockLoader.h"
+#include "StateChangeLog.h"
 #include "catapult/cache/SupplementalData.h"
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
@@ -37,13 +38,29 @@ namespace catapult { namespace filechain {
 			CATAPULT_LOG(info) << "loaded block chain from " << source << " (height = " << height << ", score = " << score << ")";
 		}
 
+		StateStorageOptions CreateStateStorageOptions(const config::NodeConfiguration& config) {
+			StateStorageOptions options;
+			options.NumThreads = config.NumStateStorageThreads;
+			options.BufferSize = config.StateStorageBufferSize.bytes();
+			return options;
+		}
+
 		class FileBlockChainStorage : public extensions::BlockChainStorage {
+		public:
+			explicit FileBlockChainStorage(const std::shared_ptr<StateChangeLog>& pStateChangeLog)
+					: m_pStateChangeLog(pStateChangeLog)
+			{}
+
 		public:
 			void loadFromStorage(const extensions::LocalNodeStateRef& stateRef, const plugins::PluginManager& pluginManager) override {
 				cache::SupplementalData supplementalData;
 				bool isStateLoaded = false;
 				try {
-					isStateLoaded = LoadState(stateRef.Config.User.DataDirectory, stateRef.Cache, supplementalData);
+					isStateLoaded = LoadState(
+							stateRef.Config.User.DataDirectory,
+							stateRef.Cache,
+							supplementalData,
+							CreateStateStorageOptions(stateRef.Config.Node));
 				} catch (...) {
 					CATAPULT_LOG(error) << "error when loading state, remove state directories and start again";
 					throw;
@@ -54,10 +71,16 @@ namespace catapult { namespace filechain {
 				if (!isStateLoaded) {
 					loadCompleteBlockChainFromStorage(stateRef, pluginManager);
 					LogChainStats("block storage", storageHeight, stateRef.Score.get());
+					startStateChangeLog(stateRef, true);
 					return;
 				}
 
-				// otherwise, use loaded state
+				// otherwise, use loaded state with all logged changes applied
+				auto areAllChangesApplied = ApplyStateChangeLog(
+						stateRef.Config.User.DataDirectory,
+						stateRef.Storage,
+						stateRef.Cache,
+						supplementalData);
 				stateRef.Score += supplementalData.ChainScore;
 				stateRef.State = supplementalData.State;
 
@@ -65,14 +88,27 @@ namespace catapult { namespace filechain {
 				LogChainStats("state", cacheHeight, stateRef.Score.get());
 
 				// if there are any additional storage blocks, load them too
-				if (storageHeight <= cacheHeight)
+				if (storageHeight <= cacheHeight) {
+					startStateChangeLog(stateRef, !areAllChangesApplied);
 					return;
+				}
 
 				loadPartialBlockChainFromStorage(stateRef, pluginManager, cacheHeight + Height(1));
 				LogChainStats("state and block storage", storageHeight, stateRef.Score.get());
+				startStateChangeLog(stateRef, true);
 			}
 
 		private:
+			void startStateChangeLog(const extensions::LocalNodeStateRef& stateRef, bool requiresBaseState) {
+				if (!m_pStateChangeLog || !m_pStateChangeLog->start(stateRef.Cache, stateRef.Storage))
+					return;
+
+				// logged changes are relative to the saved state, so save a new base state when the loaded state
+				// contains changes that are not logged (e.g. blocks loaded from storage)
+				if (requiresBaseState)
+					saveState(stateRef.Config, stateRef.Cache, { stateRef.State, stateRef.Score.get() });
+			}
+
 			void loadCompleteBlockChainFromStorage(
 					const extensions::LocalNodeStateRef& stateRef,
 					const plugins::PluginManager& pluginManager) {
@@ -140,18 +176,41 @@ namespace catapult { namespace filechain {
 					const plugins::PluginManager& pluginManager,
 					const extensions::LocalNodeStateRef& stateRef,
 					Height startHeight) {
-				auto score = LoadBlockChain(observerFactory, pluginManager, stateRef, startHeight);
+				BlockChainLoadOptions options;
+				options.MaxPrefetchBlocks = stateRef.Config.Node.BlockLoadPrefetchSize;
+				options.StateHashInterval = stateRef.Config.Node.BlockLoadStateHashInterval;
+
+				auto score = LoadBlockChain(observerFactory, pluginManager, stateRef, startHeight, options);
 				stateRef.Score += score;
 			}
 
 		public:
 			void saveToStorage(const extensions::LocalNodeStateConstRef& stateRef) override {
-				SaveState(stateRef.Config.User.DataDirectory, stateRef.Cache, { stateRef.State, stateRef.Score.get() });
+				saveState(stateRef.Config, stateRef.Cache, { stateRef.State, stateRef.Score.get() });
+			}
+
+		private:
+			void saveState(
+					const config::LocalNodeConfiguration& config,
+					const cache::CatapultCache& cache,
+					const cache::SupplementalData& supplementalData) {
+				// buffered changes are contained in the saved state
+				if (m_pStateChangeLog)
+					m_pStateChangeLog->reset();
+
+				SaveState(config.User.DataDirectory, cache, supplementalData, CreateStateStorageOptions(config.Node));
 			}
+
+		private:
+			std::shared_ptr<StateChangeLog> m_pStateChangeLog;
 		};
 	}
 
 	std::unique_ptr<extensions::BlockChainStorage> CreateFileBlockChainStorage() {
-		return std::make_unique<FileBlockChainStorage>();
+		return CreateFileBlockChainStorage(nullptr);
+	}
+
+	std::unique_ptr<extensions::BlockChainStorage> CreateFileBlockChainStorage(const std::shared_ptr<StateChangeLog>& pStateChangeLog) {
+		return std::make_unique<FileBlockChainStorage>(pStateChangeLog);
 	}
 }}
@@ -19,12 +19,16 @@
 **/
 
 #include "LocalNodeStateStorage.h"
+#include "StateChangeLog.h"
 #include "catapult/cache/CacheStorageAdapter.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/SupplementalData.h"
 #include "catapult/cache/SupplementalDataStorage.h"
 #include "catapult/io/BufferedFileStream.h"
 #include "catapult/io/FileLock.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include "catapult/utils/SpinLock.h"
 #include "catapult/utils/StackLogger.h"
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem.hpp>
@@ -46,15 +50,23 @@ namespace catapult { namespace filechain {
 			return path.generic_string();
 		}
 
-		void LoadCache(const std::string& baseDirectory, const std::string& filename, cache::CacheStorage& cacheStorage) {
+		void LoadCache(
+				const std::string& baseDirectory,
+				const std::string& filename,
+				size_t bufferSize,
+				cache::CacheStorage& cacheStorage) {
 			auto path = GetStatePath(baseDirectory, filename);
-			io::BufferedInputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Only));
+			io::BufferedInputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Only), bufferSize);
 			cacheStorage.loadAll(file, Default_Loader_Batch_Size);
 		}
 
-		void SaveCache(const std::string& baseDirectory, const std::string& filename, const cache::CacheStorage& cacheStorage) {
+		void SaveCache(
+				const std::string& baseDirectory,
+				const std::string& filename,
+				size_t bufferSize,
+				const cache::CacheStorage& cacheStorage) {
 			auto path = GetStatePath(baseDirectory, filename);
-			io::BufferedOutputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Write));
+			io::BufferedOutputFileStream file(io::RawFile(path.c_str(), io::OpenMode::Read_Write), bufferSize);
 			cacheStorage.saveAll(file);
 		}
 
@@ -66,9 +78,56 @@ namespace catapult { namespace filechain {
 		std::string GetStorageFilename(const cache::CacheStorage& storage) {
 			return storage.name() + ".dat";
 		}
+
+		template<typename TStorages, typename TAction>
+		void ForEachStorage(TStorages& storages, uint32_t numThreads, const char* operationName, TAction action) {
+			auto processStorage = [operationName, action](auto& pStorage) {
+				utils::StackTimer stopwatch;
+				action(*pStorage);
+				CATAPULT_LOG(info) << operationName << " " << pStorage->name() << " in " << stopwatch.millis() << "ms";
+			};
+
+			numThreads = std::min(numThreads, static_cast<uint32_t>(storages.size()));
+			if (numThreads <= 1) {
+				for (auto& pStorage : storages)
+					processStorage(pStorage);
+
+				return;
+			}
+
+			// sub-caches are independent, so process their storages concurrently and rethrow the first error after all have completed
+			std::exception_ptr pException;
+			utils::SpinLock exceptionLock;
+			auto pPool = thread::CreateIoServiceThreadPool(numThreads, "state storage");
+			pPool->start();
+			thread::WorkStealingParallelFor(pPool->service(), storages, numThreads, [&](auto& pStorage, auto) {
+				try {
+					processStorage(pStorage);
+					return true;
+				} catch (...) {
+					utils::SpinLockGuard guard(exceptionLock);
+					if (!pException)
+						pException = std::current_exception();
+
+					return false;
+				}
+			}).get();
+			pPool->join();
+
+			if (pException)
+				std::rethrow_exception(pException);
+		}
 	}
 
 	bool LoadState(const std::string& dataDirectory, cache::CatapultCache& cache, cache::SupplementalData& supplementalData) {
+		return LoadState(dataDirectory, cache, supplementalData, StateStorageOptions());
+	}
+
+	bool LoadState(
+			const std::string& dataDirectory,
+			cache::CatapultCache& cache,
+			cache::SupplementalData& supplementalData,
+			const StateStorageOptions& options) {
 		auto lockFilePath = GetStatePath(dataDirectory, State_Lock_Filename);
 		io::FileLock stateLock(lockFilePath);
 		if (!stateLock.try_lock()) {
@@ -81,8 +140,10 @@ namespace catapult { namespace filechain {
 
 		utils::StackLogger stopwatch("load state", utils::LogLevel::Warning);
 
-		for (const auto& pStorage : cache.storages())
-			LoadCache(dataDirectory, GetStorageFilename(*pStorage), *pStorage);
+		auto storages = cache.storages();
+		ForEachStorage(storages, options.NumThreads, "loaded", [&dataDirectory, bufferSize = options.BufferSize](auto& storage) {
+			LoadCache(dataDirectory, GetStorageFilename(storage), bufferSize, storage);
+		});
 
 		Height chainHeight;
 		{
@@ -109,10 +170,19 @@ namespace catapult { namespace filechain {
 	}
 
 	void SaveState(const std::string& dataDirectory, const cache::CatapultCache& cache, const cache::SupplementalData& supplementalData) {
+		SaveState(dataDirectory, cache, supplementalData, StateStorageOptions());
+	}
+
+	void SaveState(
+			const std::string& dataDirectory,
+			const cache::CatapultCache& cache,
+			const cache::SupplementalData& supplementalData,
+			const StateStorageOptions& options) {
 		// 1. if the previous SaveState crashed, an orphaned lock file will be present, which would have caused LoadState to be bypassed
 		//    and instead triggered a rebuild of the cache by reloading all blocks
-		// 2. in the current SaveState, delete any existing lock file (state is not written incrementally) and create a new one
-		// 3. if successful, the lock file will be deleted and the next LoadState will load directly from the saved state
+		// 2. in the current SaveState, delete any existing lock file (full state is written) and create a new one
+		// 3. delete the state change log because all logged changes are contained in the saved state
+		// 4. if successful, the lock file will be deleted and the next LoadState will load directly from the saved state
 		auto lockFilePath = GetStatePath(dataDirectory, State_Lock_Filename);
 		io::FileLock stateLock(lockFilePath);
 		if (TryRemoveLockFile(lockFilePath))
@@ -120,8 +190,14 @@ namespace catapult { namespace filechain {
 		else
 			CATAPULT_LOG(warning) << "lock file could not be removed and must be removed manually";
 
-		for (const auto& pStorage : cache.storages())
-			SaveCache(dataDirectory, GetStorageFilename(*pStorage), *pStorage);
+		RemoveStateChangeLog(dataDirectory);
+
+		utils::StackLogger stopwatch("save state", utils::LogLevel::Warning);
+
+		auto storages = cache.storages();
+		ForEachStorage(storages, options.NumThreads, "saved", [&dataDirectory, bufferSize = options.BufferSize](const auto& storage) {
+			SaveCache(dataDirectory, GetStorageFilename(storage), bufferSize, storage);
+		});
 
 		{
 			auto path = GetStatePath(dataDirectory, Supplemental_Data_Filename);
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/io/BufferedFileStream.h"
 #include <string>
 
 namespace catapult {
@@ -30,10 +31,43 @@ namespace catapult {
 
 namespace catapult { namespace filechain {
 
+	/// Options for loading and saving state.
+	struct StateStorageOptions {
+	public:
+		/// Creates default options that load and save sub-cache storages serially using default sized buffers.
+		StateStorageOptions()
+				: NumThreads(1)
+				, BufferSize(io::Default_Stream_Buffer_Size)
+		{}
+
+	public:
+		/// Maximum number of sub-cache storages that are loaded or saved concurrently.
+		uint32_t NumThreads;
+
+		/// Size of the buffer used when reading or writing a sub-cache storage file.
+		size_t BufferSize;
+	};
+
 	/// Save catapult \a cache state along with \a supplementalData into state directory inside \a dataDirectory.
 	void SaveState(const std::string& dataDirectory, const cache::CatapultCache& cache, const cache::SupplementalData& supplementalData);
 
+	/// Save catapult \a cache state along with \a supplementalData into state directory inside \a dataDirectory
+	/// according to \a options.
+	void SaveState(
+			const std::string& dataDirectory,
+			const cache::CatapultCache& cache,
+			const cache::SupplementalData& supplementalData,
+			const StateStorageOptions& options);
+
 	/// Load catapult \a cache state and \a supplementalData from state directory inside \a dataDirectory.
 	/// Returns \c true if data has been loaded, \c false if there was nothing to load.
 	bool LoadState(const std::string& dataDirectory, cache::CatapultCache& cache, cache::SupplementalData& supplementalData);
+
+	/// Load catapult \a cache state and \a supplementalData from state directory inside \a dataDirectory according to \a options.
+	/// Returns \c true if data has been loaded, \c false if there was nothing to load.
+	bool LoadState(
+			const std::string& dataDirectory,
+			cache::CatapultCache& cache,
+			cache::SupplementalData& supplementalData,
+			const StateStorageOptions& options);
 }}
@@ -30,7 +30,12 @@
 #include "catapult/model/Elements.h"
 #include "catapult/observers/NotificationObserverAdapter.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/IoServiceThreadPool.h"
 #include "catapult/utils/StackLogger.h"
+#include <boost/asio.hpp>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 
 namespace catapult { namespace filechain {
 
@@ -103,6 +108,87 @@ namespace catapult { namespace filechain {
 		};
 	}
 
+	namespace {
+		constexpr uint32_t Max_Prefetch_Threads = 4;
+
+		// reads block elements from storage on background threads ahead of their consumption
+		// (block elements are returned in height order and at most maxPrefetchBlocks are loaded but not yet consumed)
+		class BlockElementPrefetcher {
+		public:
+			BlockElementPrefetcher(const io::BlockStorageView& storage, Height startHeight, Height endHeight, uint32_t maxPrefetchBlocks)
+					: m_storage(storage)
+					, m_endHeight(endHeight)
+					, m_nextLoadHeight(startHeight)
+					, m_nextTakeHeight(startHeight)
+					, m_pPool(thread::CreateIoServiceThreadPool(std::min(Max_Prefetch_Threads, maxPrefetchBlocks), "block prefetch")) {
+				m_pPool->start();
+
+				std::lock_guard<std::mutex> lock(m_mutex);
+				for (auto i = 0u; i < maxPrefetchBlocks; ++i)
+					queueNextLoad();
+			}
+
+			~BlockElementPrefetcher() {
+				// wait for all outstanding loads because they access the storage view
+				m_pPool->join();
+			}
+
+		public:
+			std::shared_ptr<const model::BlockElement> next() {
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this]() { return m_pException || m_blockElements.cend() != m_blockElements.find(m_nextTakeHeight); });
+				if (m_pException)
+					std::rethrow_exception(m_pException);
+
+				auto iter = m_blockElements.find(m_nextTakeHeight);
+				auto pBlockElement = iter->second;
+				m_blockElements.erase(iter);
+				m_nextTakeHeight = m_nextTakeHeight + Height(1);
+
+				queueNextLoad();
+				return pBlockElement;
+			}
+
+		private:
+			void queueNextLoad() {
+				if (m_nextLoadHeight > m_endHeight)
+					return;
+
+				m_pPool->service().post([this, height = m_nextLoadHeight]() { load(height); });
+				m_nextLoadHeight = m_nextLoadHeight + Height(1);
+			}
+
+			void load(Height height) {
+				std::shared_ptr<const model::BlockElement> pBlockElement;
+				std::exception_ptr pException;
+				try {
+					pBlockElement = m_storage.loadBlockElement(height);
+				} catch (...) {
+					pException = std::current_exception();
+				}
+
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (pException)
+					m_pException = pException;
+				else
+					m_blockElements.emplace(height, pBlockElement);
+
+				m_condition.notify_all();
+			}
+
+		private:
+			const io::BlockStorageView& m_storage;
+			Height m_endHeight;
+			Height m_nextLoadHeight;
+			Height m_nextTakeHeight;
+			std::map<Height, std::shared_ptr<const model::BlockElement>> m_blockElements;
+			std::exception_ptr m_pException;
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+			std::unique_ptr<thread::IoServiceThreadPool> m_pPool;
+		};
+	}
+
 	class BlockChainLoader {
 	private:
 		using NotifyProgressFunc = consumer<Height, Height>;
@@ -112,11 +198,13 @@ namespace catapult { namespace filechain {
 				const BlockDependentNotificationObserverFactory& observerFactory,
 				const plugins::PluginManager& pluginManager,
 				const extensions::LocalNodeStateRef& stateRef,
-				Height startHeight)
+				Height startHeight,
+				const BlockChainLoadOptions& options)
 				: m_observerFactory(observerFactory)
 				, m_pluginManager(pluginManager)
 				, m_stateRef(stateRef)
 				, m_startHeight(startHeight)
+				, m_options(options)
 		{}
 
 	public:
@@ -129,15 +217,28 @@ namespace catapult { namespace filechain {
 			model::ChainScore score;
 			Hash256 stateHash;
 			auto chainHeight = storage.chainHeight();
-			while (chainHeight >= height) {
-				auto pBlockElement = storage.loadBlockElement(height);
-				score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
+			std::unique_ptr<BlockElementPrefetcher> pPrefetcher;
+			if (0 != m_options.MaxPrefetchBlocks && chainHeight >= height)
+				pPrefetcher = std::make_unique<BlockElementPrefetcher>(storage, height, chainHeight, m_options.MaxPrefetchBlocks);
 
-				stateHash = execute(*pBlockElement);
-				notifyProgress(height, chainHeight);
-
-				pParentBlockElement = std::move(pBlockElement);
-				height = height + Height(1);
+			auto stateHashInterval = std::max<uint32_t>(1, m_options.StateHashInterval);
+			while (chainHeight >= height) {
+				// execute up to stateHashInterval blocks in a single delta so that the patricia trees are only updated once
+				auto cacheDelta = m_stateRef.Cache.createDelta();
+				auto batchEndHeight = std::min(chainHeight, height + Height(stateHashInterval - 1));
+				for (; batchEndHeight >= height; height = height + Height(1)) {
+					auto pBlockElement = pPrefetcher ? pPrefetcher->next() : storage.loadBlockElement(height);
+					score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
+
+					execute(*pBlockElement, cacheDelta);
+					notifyProgress(height, chainHeight);
+
+					pParentBlockElement = std::move(pBlockElement);
+				}
+
+				// populate patricia tree delta
+				stateHash = cacheDelta.calculateStateHash(batchEndHeight).StateHash;
+				m_stateRef.Cache.commit(batchEndHeight);
 			}
 
 			CATAPULT_LOG(info) << "cache state hash at height " << chainHeight << " : " << utils::HexFormat(stateHash);
@@ -145,8 +246,7 @@ namespace catapult { namespace filechain {
 		}
 
 	private:
-		Hash256 execute(const model::BlockElement& blockElement) const {
-			auto cacheDelta = m_stateRef.Cache.createDelta();
+		void execute(const model::BlockElement& blockElement, cache::CatapultCacheDelta& cacheDelta) const {
 			auto observerState = observers::ObserverState(cacheDelta, m_stateRef.State);
 
 			auto readOnlyCache = cacheDelta.toReadOnly();
@@ -155,12 +255,6 @@ namespace catapult { namespace filechain {
 			const auto& block = blockElement.Block;
 			observers::NotificationObserverAdapter observer(m_observerFactory(block), m_pluginManager.createNotificationPublisher());
 			chain::ExecuteBlock(blockElement, { observer, resolverContext, observerState });
-
-			// populate patricia tree delta
-			auto stateHash = cacheDelta.calculateStateHash(block.Height).StateHash;
-
-			m_stateRef.Cache.commit(block.Height);
-			return stateHash;
 		}
 
 	private:
@@ -168,6 +262,7 @@ namespace catapult { namespace filechain {
 		const plugins::PluginManager& m_pluginManager;
 		const extensions::LocalNodeStateRef& m_stateRef;
 		Height m_startHeight;
+		BlockChainLoadOptions m_options;
 	};
 
 	model::ChainScore LoadBlockChain(
@@ -175,7 +270,16 @@ namespace catapult { namespace filechain {
 			const plugins::PluginManager& pluginManager,
 			const extensions::LocalNodeStateRef& stateRef,
 			Height startHeight) {
-		BlockChainLoader loader(observerFactory, pluginManager, stateRef, startHeight);
+		return LoadBlockChain(observerFactory, pluginManager, stateRef, startHeight, BlockChainLoadOptions());
+	}
+
+	model::ChainScore LoadBlockChain(
+			const BlockDependentNotificationObserverFactory& observerFactory,
+			const plugins::PluginManager& pluginManager,
+			const extensions::LocalNodeStateRef& stateRef,
+			Height startHeight,
+			const BlockChainLoadOptions& options) {
+		BlockChainLoader loader(observerFactory, pluginManager, stateRef, startHeight, options);
 
 		utils::StackLogger logger("load block chain", utils::LogLevel::Warning);
 		utils::StackTimer stopwatch;
@@ -50,6 +50,24 @@ namespace catapult { namespace filechain {
 			const NotificationObserverFactory& transientObserverFactory,
 			const NotificationObserverFactory& permanentObserverFactory);
 
+	/// Options for loading a block chain from storage.
+	struct BlockChainLoadOptions {
+	public:
+		/// Creates default options that load blocks serially and calculate the state hash after every block.
+		BlockChainLoadOptions()
+				: MaxPrefetchBlocks(0)
+				, StateHashInterval(1)
+		{}
+
+	public:
+		/// Maximum number of blocks that are read from storage ahead of execution (\c 0 disables prefetching).
+		uint32_t MaxPrefetchBlocks;
+
+		/// Number of blocks that are executed between state hash calculations and cache commits.
+		/// \note The state hash is always calculated after the last block.
+		uint32_t StateHashInterval;
+	};
+
 	/// Loads a block chain from storage using the supplied observer factory (\a observerFactory) and plugin manager (\a pluginManager)
 	/// and updating \a stateRef starting with the block at \a startHeight.
 	model::ChainScore LoadBlockChain(
@@ -57,4 +75,13 @@ namespace catapult { namespace filechain {
 			const plugins::PluginManager& pluginManager,
 			const extensions::LocalNodeStateRef& stateRef,
 			Height startHeight);
+
+	/// Loads a block chain from storage using the supplied observer factory (\a observerFactory) and plugin manager (\a pluginManager)
+	/// and updating \a stateRef starting with the block at \a startHeight according to \a options.
+	model::ChainScore LoadBlockChain(
+			const BlockDependentNotificationObserverFactory& observerFactory,
+			const plugins::PluginManager& pluginManager,
+			const extensions::LocalNodeStateRef& stateRef,
+			Height startHeight,
+			const BlockChainLoadOptions& options);
 }}
@@ -0,0 +1,246 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "StateChangeLog.h"
+#include "catapult/cache/CacheChangesStorage.h"
+#include "catapult/cache/CacheStorage.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/SupplementalData.h"
+#include "catapult/cache/SupplementalDataStorage.h"
+#include "catapult/consumers/StateChangeInfo.h"
+#include "catapult/io/BlockStorageCache.h"
+#include "catapult/io/BufferInputStreamAdapter.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/io/RawFile.h"
+#include "catapult/io/StringOutputStream.h"
+#include "catapult/subscribers/StateChangeSubscriber.h"
+#include "catapult/utils/StackLogger.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace filechain {
+
+	namespace {
+		constexpr auto State_Change_Log_Filename = "changes.log";
+
+		// each logged change is composed of:
+		// 1. hash of the block at the change height (used to detect changes from a different fork)
+		// 2. supplemental data (catapult state, chain score and height)
+		// 3. changes of all sub-caches
+		std::string GetStateChangeLogPath(const std::string& dataDirectory) {
+			boost::filesystem::path path = dataDirectory;
+			path /= "state";
+			path /= State_Change_Log_Filename;
+			return path.generic_string();
+		}
+
+		bool TryLoadBlockHash(const io::BlockStorageCache& storage, Height height, Hash256& blockHash) {
+			auto hashes = storage.view().loadHashesFrom(height, 1);
+			if (0 == hashes.size())
+				return false;
+
+			blockHash = *hashes.cbegin();
+			return true;
+		}
+
+		bool AreAllSubCachesSupported(
+				const cache::CatapultCache& cache,
+				const std::vector<std::unique_ptr<const cache::CacheChangesStorage>>& changesStorages) {
+			return cache.storages().size() == changesStorages.size();
+		}
+
+		class StateChangeLogSubscriber : public subscribers::StateChangeSubscriber {
+		public:
+			explicit StateChangeLogSubscriber(const std::shared_ptr<StateChangeLog>& pStateChangeLog)
+					: m_pStateChangeLog(pStateChangeLog)
+			{}
+
+		public:
+			void notifyScoreChange(const model::ChainScore& chainScore) override {
+				m_chainScore = chainScore;
+			}
+
+			void notifyStateChange(const consumers::StateChangeInfo& stateChangeInfo) override {
+				m_pStateChangeLog->append(stateChangeInfo, m_chainScore);
+			}
+
+		private:
+			std::shared_ptr<StateChangeLog> m_pStateChangeLog;
+			model::ChainScore m_chainScore;
+		};
+	}
+
+	StateChangeLog::StateChangeLog(const std::string& dataDirectory, uint32_t flushInterval)
+			: m_logFilePath(GetStateChangeLogPath(dataDirectory))
+			, m_flushInterval(flushInterval)
+			, m_pStorage(nullptr)
+	{}
+
+	StateChangeLog::~StateChangeLog() = default;
+
+	bool StateChangeLog::isStarted() const {
+		utils::SpinLockGuard guard(m_lock);
+		return !!m_pStorage;
+	}
+
+	bool StateChangeLog::start(const cache::CatapultCache& cache, const io::BlockStorageCache& storage) {
+		auto changesStorages = cache.changesStorages();
+		if (!AreAllSubCachesSupported(cache, changesStorages)) {
+			CATAPULT_LOG(warning) << "state change log is disabled because not all sub-caches support saving changes";
+			return false;
+		}
+
+		boost::filesystem::create_directories(boost::filesystem::path(m_logFilePath).parent_path());
+
+		utils::SpinLockGuard guard(m_lock);
+		m_changesStorages = std::move(changesStorages);
+		m_pStorage = &storage;
+		return true;
+	}
+
+	void StateChangeLog::append(const consumers::StateChangeInfo& changeInfo, const model::ChainScore& chainScore) {
+		utils::SpinLockGuard guard(m_lock);
+		if (!m_pStorage)
+			return;
+
+		// changes are relative to the previous change, so stop logging when a change cannot be logged
+		Hash256 blockHash;
+		if (!TryLoadBlockHash(*m_pStorage, changeInfo.Height, blockHash)) {
+			CATAPULT_LOG(warning) << "stopping state change log because block at " << changeInfo.Height << " is not in storage";
+			flushUnlocked();
+			m_pStorage = nullptr;
+			return;
+		}
+
+		io::StringOutputStream output(Hash256_Size);
+		io::Write(output, blockHash);
+
+		cache::SupplementalData supplementalData;
+		supplementalData.State = changeInfo.State;
+		supplementalData.ChainScore = chainScore;
+		cache::SaveSupplementalData(supplementalData, changeInfo.Height, output);
+
+		for (const auto& pChangesStorage : m_changesStorages)
+			pChangesStorage->saveAll(changeInfo.CacheDelta, output);
+
+		m_pendingChanges.push_back(output.str());
+		if (m_pendingChanges.size() >= m_flushInterval)
+			flushUnlocked();
+	}
+
+	void StateChangeLog::flush() {
+		utils::SpinLockGuard guard(m_lock);
+		flushUnlocked();
+	}
+
+	void StateChangeLog::reset() {
+		utils::SpinLockGuard guard(m_lock);
+		m_pendingChanges.clear();
+	}
+
+	void StateChangeLog::flushUnlocked() {
+		if (m_pendingChanges.empty())
+			return;
+
+		io::RawFile file(m_logFilePath, io::OpenMode::Read_Append);
+		file.seek(file.size());
+		for (const auto& change : m_pendingChanges) {
+			io::Write64(file, change.size());
+			file.write({ reinterpret_cast<const uint8_t*>(change.data()), change.size() });
+		}
+
+		m_pendingChanges.clear();
+	}
+
+	std::unique_ptr<subscribers::StateChangeSubscriber> CreateStateChangeLogSubscriber(const std::shared_ptr<StateChangeLog>& pStateChangeLog) {
+		return std::make_unique<StateChangeLogSubscriber>(pStateChangeLog);
+	}
+
+	bool ApplyStateChangeLog(
+			const std::string& dataDirectory,
+			const io::BlockStorageCache& storage,
+			cache::CatapultCache& cache,
+			cache::SupplementalData& supplementalData) {
+		auto logFilePath = GetStateChangeLogPath(dataDirectory);
+		if (!boost::filesystem::exists(logFilePath))
+			return true;
+
+		auto changesStorages = cache.changesStorages();
+		if (!AreAllSubCachesSupported(cache, changesStorages)) {
+			CATAPULT_LOG(warning) << "state change log cannot be applied because not all sub-caches support loading changes";
+			return false;
+		}
+
+		utils::StackLogger stopwatch("apply state change log", utils::LogLevel::Warning);
+
+		io::RawFile file(logFilePath, io::OpenMode::Read_Only);
+		auto numAppliedChanges = 0u;
+		auto areAllChangesApplied = false;
+		while (true) {
+			if (file.position() == file.size()) {
+				areAllChangesApplied = true;
+				break;
+			}
+
+			// a partially written change indicates an unclean shutdown during flush, so ignore it
+			if (file.size() - file.position() < sizeof(uint64_t))
+				break;
+
+			auto changeSize = io::Read64(file);
+			if (file.size() - file.position() < changeSize)
+				break;
+
+			std::vector<uint8_t> change(changeSize);
+			file.read(change);
+			io::BufferInputStreamAdapter<std::vector<uint8_t>> input(change);
+
+			Hash256 blockHash;
+			io::Read(input, blockHash);
+
+			cache::SupplementalData changeSupplementalData;
+			Height changeHeight;
+			cache::LoadSupplementalData(input, changeSupplementalData, changeHeight);
+
+			// stop at the first change from a different fork; the remaining blocks will be loaded from storage
+			Hash256 storageBlockHash;
+			if (!TryLoadBlockHash(storage, changeHeight, storageBlockHash) || blockHash != storageBlockHash)
+				break;
+
+			{
+				auto cacheDelta = cache.createDelta();
+				for (const auto& pChangesStorage : changesStorages)
+					pChangesStorage->loadAll(input, cacheDelta);
+
+				cache.commit(changeHeight);
+			}
+
+			supplementalData = changeSupplementalData;
+			++numAppliedChanges;
+		}
+
+		CATAPULT_LOG(info)
+				<< "applied " << numAppliedChanges << " state changes"
+				<< (areAllChangesApplied ? "" : " (remaining changes were ignored)");
+		return areAllChangesApplied;
+	}
+
+	void RemoveStateChangeLog(const std::string& dataDirectory) {
+		boost::filesystem::remove(GetStateChangeLogPath(dataDirectory));
+	}
+}}
@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/SpinLock.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace catapult {
+	namespace cache {
+		class CacheChangesStorage;
+		class CatapultCache;
+		struct SupplementalData;
+	}
+	namespace consumers { struct StateChangeInfo; }
+	namespace io { class BlockStorageCache; }
+	namespace model { class ChainScore; }
+	namespace subscribers { class StateChangeSubscriber; }
+}
+
+namespace catapult { namespace filechain {
+
+	/// Log of state changes that are applied on top of the state saved by SaveState.
+	/// \note Each logged change contains only the sub-cache entries that were changed since the previous logged change.
+	class StateChangeLog {
+	public:
+		/// Creates a log inside \a dataDirectory that buffers \a flushInterval changes before appending them.
+		StateChangeLog(const std::string& dataDirectory, uint32_t flushInterval);
+
+		/// Destroys the log.
+		~StateChangeLog();
+
+	public:
+		/// Returns \c true if changes are being logged.
+		bool isStarted() const;
+
+		/// Starts logging changes to \a cache, which is built from blocks in \a storage.
+		/// Returns \c false if not all sub-caches support saving and loading changes.
+		bool start(const cache::CatapultCache& cache, const io::BlockStorageCache& storage);
+
+		/// Appends the state changes in \a changeInfo resulting in \a chainScore.
+		void append(const consumers::StateChangeInfo& changeInfo, const model::ChainScore& chainScore);
+
+		/// Appends all buffered changes to the log file.
+		void flush();
+
+		/// Discards all buffered changes.
+		/// \note This should be called when the state is saved because the saved state already contains them.
+		void reset();
+
+	private:
+		void flushUnlocked();
+
+	private:
+		std::string m_logFilePath;
+		uint32_t m_flushInterval;
+		const io::BlockStorageCache* m_pStorage;
+		std::vector<std::unique_ptr<const cache::CacheChangesStorage>> m_changesStorages;
+		std::vector<std::string> m_pendingChanges;
+		mutable utils::SpinLock m_lock;
+	};
+
+	/// Creates a state change subscriber that appends all state changes to \a pStateChangeLog.
+	std::unique_ptr<subscribers::StateChangeSubscriber> CreateStateChangeLogSubscriber(const std::shared_ptr<StateChangeLog>& pStateChangeLog);
+
+	/// Applies state changes logged inside \a dataDirectory to \a cache and \a supplementalData.
+	/// Only changes that are consistent with the blocks in \a storage are applied.
+	/// Returns \c true if all logged changes have been applied.
+	bool ApplyStateChangeLog(
+			const std::string& dataDirectory,
+			const io::BlockStorageCache& storage,
+			cache::CatapultCache& cache,
+			cache::SupplementalData& supplementalData);
+
+	/// Removes the state change log inside \a dataDirectory.
+	void RemoveStateChangeLog(const std::string& dataDirectory);
+}}
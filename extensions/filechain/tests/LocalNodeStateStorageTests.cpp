@@ -78,7 +78,17 @@ namespace catapult { namespace filechain {
 			EXPECT_EQ(expectedView.sub<cache::BlockDifficultyCache>().size(), actualView.sub<cache::BlockDifficultyCache>().size());
 		}
 
-		cache::SupplementalData SaveState(const std::string& dataDirectory, cache::CatapultCache& cache) {
+		StateStorageOptions CreateParallelOptions() {
+			StateStorageOptions options;
+			options.NumThreads = 4;
+			options.BufferSize = 1024 * 1024;
+			return options;
+		}
+
+		cache::SupplementalData SaveState(
+				const std::string& dataDirectory,
+				cache::CatapultCache& cache,
+				const StateStorageOptions& options = StateStorageOptions()) {
 			cache::SupplementalData supplementalData;
 			{
 				auto delta = cache.createDelta();
@@ -93,7 +103,7 @@ namespace catapult { namespace filechain {
 			supplementalData.ChainScore = model::ChainScore(0x1234567890ABCDEF, 0xFEDCBA0987654321);
 			supplementalData.State.LastRecalculationHeight = model::ImportanceHeight(12345);
 			supplementalData.State.NumTotalTransactions = 7654321;
-			filechain::SaveState(dataDirectory, cache, supplementalData);
+			filechain::SaveState(dataDirectory, cache, supplementalData, options);
 			return supplementalData;
 		}
 	}
@@ -118,6 +128,54 @@ namespace catapult { namespace filechain {
 		EXPECT_EQ(Height(54321), cache.createView().height());
 	}
 
+	namespace {
+		void AssertCanSaveAndLoadState(const StateStorageOptions& saveOptions, const StateStorageOptions& loadOptions) {
+			// Arrange: seed and save the cache state
+			test::TempDirectoryGuard tempDir;
+			auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+			auto originalSupplementalData = SaveState(tempDir.name(), originalCache, saveOptions);
+
+			// Act: load the cache
+			auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+			cache::SupplementalData supplementalData;
+			auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData, loadOptions);
+
+			// Assert:
+			EXPECT_TRUE(isStateLoaded);
+			AssertSubCaches(originalCache, cache);
+			EXPECT_EQ(originalSupplementalData.ChainScore, supplementalData.ChainScore);
+			EXPECT_EQ(originalSupplementalData.State.LastRecalculationHeight, supplementalData.State.LastRecalculationHeight);
+			EXPECT_EQ(originalSupplementalData.State.NumTotalTransactions, supplementalData.State.NumTotalTransactions);
+			EXPECT_EQ(Height(54321), cache.createView().height());
+		}
+	}
+
+	TEST(TEST_CLASS, CanSaveAndLoadStateInParallel) {
+		// Assert:
+		AssertCanSaveAndLoadState(CreateParallelOptions(), CreateParallelOptions());
+	}
+
+	TEST(TEST_CLASS, CanLoadStateSavedWithDifferentOptions) {
+		// Assert: neither thread count nor buffer size affects the saved files
+		AssertCanSaveAndLoadState(CreateParallelOptions(), StateStorageOptions());
+		AssertCanSaveAndLoadState(StateStorageOptions(), CreateParallelOptions());
+	}
+
+	TEST(TEST_CLASS, LoadStateInParallelPropagatesSubCacheLoadError) {
+		// Arrange: seed and save the cache state and remove a single sub-cache file
+		test::TempDirectoryGuard tempDir;
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		SaveState(tempDir.name(), originalCache, CreateParallelOptions());
+
+		auto subCachePath = boost::filesystem::path(tempDir.name()) / "state" / "BlockDifficultyCache.dat";
+		ASSERT_TRUE(boost::filesystem::remove(subCachePath));
+
+		// Act + Assert:
+		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		cache::SupplementalData supplementalData;
+		EXPECT_THROW(LoadState(tempDir.name(), cache, supplementalData, CreateParallelOptions()), catapult_file_io_error);
+	}
+
 	namespace {
 		template<typename TAction>
 		void AssertLoadStateFailure(const std::string& dataDirectory, TAction corruptSavedState) {
@@ -194,4 +252,23 @@ namespace catapult { namespace filechain {
 		EXPECT_EQ(originalSupplementalData.State.NumTotalTransactions, supplementalData.State.NumTotalTransactions);
 		EXPECT_EQ(Height(54321), cache.createView().height());
 	}
+
+	TEST(TEST_CLASS, SaveStateRemovesStateChangeLog) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+
+		// - simulate a state change log
+		auto changeLogPath = boost::filesystem::path(tempDir.name()) / "state" / "changes.log";
+		ASSERT_TRUE(boost::filesystem::create_directory(boost::filesystem::path(tempDir.name()) / "state"));
+		{
+			std::ofstream changeLogStream(changeLogPath.generic_string());
+		}
+
+		// Act: seed and save the cache state
+		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		SaveState(tempDir.name(), originalCache);
+
+		// Assert: all logged changes are contained in the saved state, so the log should have been removed
+		EXPECT_FALSE(boost::filesystem::exists(changeLogPath));
+	}
 }}
@@ -189,13 +189,17 @@ namespace catapult { namespace filechain {
 				}
 			}
 
-			model::ChainScore load(Height startHeight) {
+			Height cacheHeight() const {
+				return m_state.cref().Cache.createView().height();
+			}
+
+			model::ChainScore load(Height startHeight, const BlockChainLoadOptions& options = BlockChainLoadOptions()) {
 				auto observerFactory = [this](const auto& block) {
 					this->m_factoryHeights.push_back(block.Height);
 					return std::make_unique<MockBlockHeightCapturingNotificationObserver>(this->m_observerBlockHeights);
 				};
 
-				return LoadBlockChain(observerFactory, m_pluginManager, m_state.ref(), startHeight);
+				return LoadBlockChain(observerFactory, m_pluginManager, m_state.ref(), startHeight, options);
 			}
 
 		private:
@@ -279,6 +283,70 @@ namespace catapult { namespace filechain {
 		EXPECT_EQ(expectedHeights, context.factoryHeights());
 	}
 
+	namespace {
+		BlockChainLoadOptions CreateLoadOptions(uint32_t maxPrefetchBlocks, uint32_t stateHashInterval) {
+			BlockChainLoadOptions options;
+			options.MaxPrefetchBlocks = maxPrefetchBlocks;
+			options.StateHashInterval = stateHashInterval;
+			return options;
+		}
+
+		void AssertCanLoadBlockChain(Height startHeight, Height chainHeight, const BlockChainLoadOptions& options) {
+			// Arrange:
+			LoadBlockChainTestContext context;
+			context.setStorageChainHeight(chainHeight);
+
+			// Act:
+			auto score = context.load(startHeight, options);
+
+			// Assert:
+			std::vector<Height> expectedHeights;
+			for (auto height = startHeight; height <= chainHeight; height = height + Height(1))
+				expectedHeights.push_back(height);
+
+			auto expectedScore = CalculateExpectedScore(chainHeight.unwrap());
+			if (Height(2) != startHeight)
+				expectedScore -= CalculateExpectedScore(startHeight.unwrap() - 1);
+
+			EXPECT_EQ(model::ChainScore(expectedScore), score);
+			EXPECT_EQ(expectedHeights, context.observerBlockHeights());
+			EXPECT_EQ(expectedHeights, context.factoryHeights());
+			EXPECT_EQ(chainHeight, context.cacheHeight());
+		}
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsZeroBlocksWhenStorageHeightIsOne_Prefetching) {
+		// Arrange:
+		LoadBlockChainTestContext context;
+
+		// Act:
+		auto score = context.load(Height(2), CreateLoadOptions(5, 3));
+
+		// Assert:
+		EXPECT_EQ(model::ChainScore(), score);
+		EXPECT_EQ(0u, context.observerBlockHeights().size());
+		EXPECT_EQ(0u, context.factoryHeights().size());
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultipleBlocksWhenPrefetchingIsEnabled) {
+		AssertCanLoadBlockChain(Height(2), Height(20), CreateLoadOptions(1, 1));
+		AssertCanLoadBlockChain(Height(2), Height(20), CreateLoadOptions(3, 1));
+		AssertCanLoadBlockChain(Height(2), Height(20), CreateLoadOptions(100, 1));
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultipleBlocksWhenStateHashIntervalIsGreaterThanOne) {
+		// Assert: interval zero is treated as one and the last (partial) batch is always committed
+		AssertCanLoadBlockChain(Height(2), Height(20), CreateLoadOptions(0, 0));
+		AssertCanLoadBlockChain(Height(2), Height(20), CreateLoadOptions(0, 4));
+		AssertCanLoadBlockChain(Height(2), Height(20), CreateLoadOptions(0, 19));
+		AssertCanLoadBlockChain(Height(2), Height(20), CreateLoadOptions(0, 50));
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultipleBlocksStartingAtArbitraryHeightWhenPrefetchingAndStateHashIntervalAreEnabled) {
+		AssertCanLoadBlockChain(Height(4), Height(7), CreateLoadOptions(2, 3));
+		AssertCanLoadBlockChain(Height(5), Height(20), CreateLoadOptions(4, 5));
+	}
+
 	// endregion
 
 	// region LoadBlockChain - state enabled
@@ -316,7 +384,7 @@ namespace catapult { namespace filechain {
 		}
 
 		template<typename TAction>
-		void ExecuteWithStorage(io::BlockStorageCache& storage, TAction action) {
+		void ExecuteWithStorage(io::BlockStorageCache& storage, const BlockChainLoadOptions& options, TAction action) {
 			// Arrange:
 			test::TempDirectoryGuard tempDataDirectory;
 			auto config = test::CreateStateHashEnabledLocalNodeConfiguration(tempDataDirectory.name());
@@ -333,18 +401,18 @@ namespace catapult { namespace filechain {
 			ExecuteNemesis(stateRef, *pPluginManager);
 
 			// Act:
-			LoadBlockChain(observerFactory, *pPluginManager, stateRef, Height(2));
+			LoadBlockChain(observerFactory, *pPluginManager, stateRef, Height(2), options);
 
 			action(stateRef.Cache, *pPluginManager);
 		}
 
-		void RunLoadBlockChainTest(io::BlockStorageCache& storage, size_t maxHeight) {
+		void RunLoadBlockChainTest(io::BlockStorageCache& storage, size_t maxHeight, const BlockChainLoadOptions& options) {
 			// Arrange: create one additional block to simplify test, blocks[0].height = 2
 			auto blocks = CreateBlocks(maxHeight + 1);
 
 			// - calculate expected state hash after loading first two blocks (1, 2)
 			Hash256 expectedHash;
-			ExecuteWithStorage(storage, [&expectedHash, &block = *blocks[0] ](auto& cache, const auto& pluginManager) {
+			ExecuteWithStorage(storage, options, [&expectedHash, &block = *blocks[0] ](auto& cache, const auto& pluginManager) {
 				auto cacheDetachedDelta = cache.createDetachableDelta().detach();
 				auto pCacheDelta = cacheDetachedDelta.lock();
 
@@ -361,7 +429,7 @@ namespace catapult { namespace filechain {
 
 				// - load whole chain and verify hash
 				const auto& nextBlock = *blocks[height - 1];
-				ExecuteWithStorage(storage, [&expectedHash, &nextBlock](auto& cache, const auto& pluginManager) {
+				ExecuteWithStorage(storage, options, [&expectedHash, &nextBlock](auto& cache, const auto& pluginManager) {
 					// Assert:
 					// - retrieve state hash calculated when loading chain
 					auto hashInfo = cache.createView().calculateStateHash();
@@ -383,7 +451,15 @@ namespace catapult { namespace filechain {
 		io::BlockStorageCache storage(std::make_unique<mocks::MockMemoryBlockStorage>());
 
 		// Act + Assert:
-		RunLoadBlockChainTest(storage, 7);
+		RunLoadBlockChainTest(storage, 7, BlockChainLoadOptions());
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultipleBlocks_StateHashEnabled_PrefetchingAndStateHashInterval) {
+		// Arrange:
+		io::BlockStorageCache storage(std::make_unique<mocks::MockMemoryBlockStorage>());
+
+		// Act + Assert: state hash after loading all blocks is independent of the number of blocks per state hash calculation
+		RunLoadBlockChainTest(storage, 7, CreateLoadOptions(3, 4));
 	}
 
 	// endregion
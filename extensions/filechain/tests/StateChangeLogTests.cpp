@@ -0,0 +1,384 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "filechain/src/StateChangeLog.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/SupplementalData.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/BlockDifficultyCache.h"
+#include "catapult/consumers/StateChangeInfo.h"
+#include "catapult/io/BlockStorageCache.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/subscribers/StateChangeSubscriber.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/cache/SimpleCache.h"
+#include "tests/test/core/mocks/MockMemoryBlockStorage.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace filechain {
+
+#define TEST_CLASS StateChangeLogTests
+
+	namespace {
+		constexpr uint32_t Num_Storage_Blocks = 5;
+
+		cache::CatapultCache CreateCache() {
+			return test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		}
+
+		std::string GetLogFilePath(const std::string& dataDirectory) {
+			return (boost::filesystem::path(dataDirectory) / "state" / "changes.log").generic_string();
+		}
+
+		class TestContext {
+		public:
+			explicit TestContext(uint32_t flushInterval)
+					: m_cache(CreateCache())
+					, m_pStorage(mocks::CreateMemoryBlockStorageCache(Num_Storage_Blocks))
+					, m_pLog(std::make_shared<StateChangeLog>(m_tempDir.name(), flushInterval))
+			{}
+
+		public:
+			std::string dataDirectory() const {
+				return m_tempDir.name();
+			}
+
+			const cache::CatapultCache& cache() const {
+				return m_cache;
+			}
+
+			io::BlockStorageCache& storage() {
+				return *m_pStorage;
+			}
+
+			StateChangeLog& log() {
+				return *m_pLog;
+			}
+
+			const std::shared_ptr<StateChangeLog>& pLog() {
+				return m_pLog;
+			}
+
+			const std::vector<Address>& addresses() const {
+				return m_addresses;
+			}
+
+		public:
+			bool start() {
+				return m_pLog->start(m_cache, *m_pStorage);
+			}
+
+			// adds an account and block difficulty info at height and optionally removes the oldest account
+			void change(Height height, bool shouldRemove = false) {
+				change(height, shouldRemove, [this, height](const auto& changeInfo) {
+					m_pLog->append(changeInfo, model::ChainScore(height.unwrap()));
+				});
+			}
+
+			template<typename TNotify>
+			void change(Height height, bool shouldRemove, TNotify notify) {
+				auto delta = m_cache.createDelta();
+				auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+				m_addresses.push_back(test::GenerateRandomAddress());
+				accountStateCacheDelta.addAccount(m_addresses.back(), height);
+				if (shouldRemove) {
+					auto addressIter = m_addresses.cbegin();
+					accountStateCacheDelta.queueRemove(*addressIter, accountStateCacheDelta.find(*addressIter).get().AddressHeight);
+					accountStateCacheDelta.commitRemovals();
+					m_addresses.erase(addressIter);
+				}
+
+				delta.sub<cache::BlockDifficultyCache>().insert(height, Timestamp(height.unwrap() * 10), Difficulty(height.unwrap() * 100));
+
+				state::CatapultState catapultState;
+				catapultState.NumTotalTransactions = height.unwrap() * 1000;
+				notify(consumers::StateChangeInfo(delta, model::ChainScore(1), catapultState, height));
+				m_cache.commit(height);
+			}
+
+		private:
+			test::TempDirectoryGuard m_tempDir;
+			cache::CatapultCache m_cache;
+			std::unique_ptr<io::BlockStorageCache> m_pStorage;
+			std::shared_ptr<StateChangeLog> m_pLog;
+			std::vector<Address> m_addresses;
+		};
+
+		struct ApplyResult {
+			bool AreAllChangesApplied;
+			cache::SupplementalData SupplementalData;
+		};
+
+		ApplyResult Apply(TestContext& context, cache::CatapultCache& cache) {
+			ApplyResult result;
+			result.AreAllChangesApplied = ApplyStateChangeLog(context.dataDirectory(), context.storage(), cache, result.SupplementalData);
+			return result;
+		}
+
+		void AssertAccounts(const std::vector<Address>& expectedAddresses, const cache::CatapultCache& cache) {
+			auto view = cache.createView();
+			const auto& accountStateCacheView = view.sub<cache::AccountStateCache>();
+			ASSERT_EQ(expectedAddresses.size(), accountStateCacheView.size());
+			for (const auto& address : expectedAddresses)
+				EXPECT_TRUE(accountStateCacheView.contains(address));
+		}
+
+		void AssertAppliedChanges(TestContext& context, Height expectedHeight, bool expectedAreAllChangesApplied) {
+			// Act:
+			auto cache = CreateCache();
+			auto result = Apply(context, cache);
+
+			// Assert:
+			EXPECT_EQ(expectedAreAllChangesApplied, result.AreAllChangesApplied);
+
+			auto view = cache.createView();
+			EXPECT_EQ(expectedHeight, view.height());
+			EXPECT_EQ(expectedHeight.unwrap() - 1, view.sub<cache::BlockDifficultyCache>().size());
+			EXPECT_EQ(model::ChainScore(expectedHeight.unwrap()), result.SupplementalData.ChainScore);
+			EXPECT_EQ(expectedHeight.unwrap() * 1000, result.SupplementalData.State.NumTotalTransactions);
+		}
+	}
+
+	// region start
+
+	TEST(TEST_CLASS, LogIsNotStartedInitially) {
+		// Arrange:
+		TestContext context(1);
+
+		// Act + Assert:
+		EXPECT_FALSE(context.log().isStarted());
+	}
+
+	TEST(TEST_CLASS, CanStartLogWhenAllSubCachesSupportChanges) {
+		// Arrange:
+		TestContext context(1);
+
+		// Act:
+		auto isStarted = context.start();
+
+		// Assert:
+		EXPECT_TRUE(isStarted);
+		EXPECT_TRUE(context.log().isStarted());
+	}
+
+	TEST(TEST_CLASS, ChangesAreIgnoredWhenLogIsNotStarted) {
+		// Arrange:
+		TestContext context(1);
+
+		// Act:
+		context.change(Height(2));
+		context.log().flush();
+
+		// Assert:
+		EXPECT_FALSE(boost::filesystem::exists(GetLogFilePath(context.dataDirectory())));
+	}
+
+	// endregion
+
+	// region append / flush / reset
+
+	TEST(TEST_CLASS, ChangesAreBufferedUntilFlushInterval) {
+		// Arrange:
+		TestContext context(3);
+		context.start();
+
+		// Act:
+		context.change(Height(2));
+		context.change(Height(3));
+
+		// Assert:
+		EXPECT_FALSE(boost::filesystem::exists(GetLogFilePath(context.dataDirectory())));
+
+		// Act:
+		context.change(Height(4));
+
+		// Assert:
+		AssertAppliedChanges(context, Height(4), true);
+	}
+
+	TEST(TEST_CLASS, FlushAppendsBufferedChanges) {
+		// Arrange:
+		TestContext context(10);
+		context.start();
+		context.change(Height(2));
+		context.change(Height(3));
+
+		// Act:
+		context.log().flush();
+
+		// Assert:
+		AssertAppliedChanges(context, Height(3), true);
+	}
+
+	TEST(TEST_CLASS, ResetDiscardsBufferedChanges) {
+		// Arrange:
+		TestContext context(10);
+		context.start();
+		context.change(Height(2));
+		context.change(Height(3));
+
+		// Act:
+		context.log().reset();
+		context.log().flush();
+
+		// Assert:
+		EXPECT_FALSE(boost::filesystem::exists(GetLogFilePath(context.dataDirectory())));
+	}
+
+	TEST(TEST_CLASS, LogIsStoppedWhenBlockIsNotInStorage) {
+		// Arrange:
+		TestContext context(10);
+		context.start();
+		for (auto i = 2u; i <= Num_Storage_Blocks; ++i)
+			context.change(Height(i));
+
+		// Act: storage does not contain blocks after height 5
+		context.change(Height(6));
+		context.change(Height(7));
+		context.log().flush();
+
+		// Assert: only changes before the unknown block were logged
+		EXPECT_FALSE(context.log().isStarted());
+		AssertAppliedChanges(context, Height(5), true);
+	}
+
+	// endregion
+
+	// region subscriber
+
+	TEST(TEST_CLASS, SubscriberAppendsStateChangesWithLastChainScore) {
+		// Arrange:
+		TestContext context(1);
+		context.start();
+		auto pSubscriber = CreateStateChangeLogSubscriber(context.pLog());
+
+		// Act:
+		for (auto i = 2u; i <= 3; ++i) {
+			pSubscriber->notifyScoreChange(model::ChainScore(i));
+			context.change(Height(i), false, [&subscriber = *pSubscriber](const auto& changeInfo) {
+				subscriber.notifyStateChange(changeInfo);
+			});
+		}
+
+		// Assert:
+		AssertAppliedChanges(context, Height(3), true);
+	}
+
+	// endregion
+
+	// region ApplyStateChangeLog
+
+	TEST(TEST_CLASS, ApplySucceedsWhenLogIsNotPresent) {
+		// Arrange:
+		TestContext context(1);
+		auto cache = CreateCache();
+
+		// Act:
+		auto result = Apply(context, cache);
+
+		// Assert:
+		EXPECT_TRUE(result.AreAllChangesApplied);
+		EXPECT_EQ(Height(0), cache.createView().height());
+	}
+
+	TEST(TEST_CLASS, ApplyFailsWhenNotAllSubCachesSupportChanges) {
+		// Arrange:
+		TestContext context(1);
+		context.start();
+		context.change(Height(2));
+
+		// - create a cache containing a sub-cache that does not support changes
+		std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(1);
+		subCaches[0] = test::MakeSubCachePlugin<test::SimpleCacheT<0>, test::SimpleCacheStorageTraits>();
+		cache::CatapultCache cache(std::move(subCaches));
+
+		// Act:
+		auto result = Apply(context, cache);
+
+		// Assert:
+		EXPECT_FALSE(result.AreAllChangesApplied);
+		EXPECT_EQ(Height(0), cache.createView().height());
+	}
+
+	TEST(TEST_CLASS, ApplyRestoresAddedAndRemovedEntries) {
+		// Arrange:
+		TestContext context(1);
+		context.start();
+		context.change(Height(2));
+		context.change(Height(3));
+		context.change(Height(4), true);
+		context.change(Height(5), true);
+
+		// Act:
+		auto cache = CreateCache();
+		auto result = Apply(context, cache);
+
+		// Assert:
+		EXPECT_TRUE(result.AreAllChangesApplied);
+		EXPECT_EQ(Height(5), cache.createView().height());
+		AssertAccounts(context.addresses(), cache);
+		EXPECT_EQ(4u, cache.createView().sub<cache::BlockDifficultyCache>().size());
+	}
+
+	TEST(TEST_CLASS, ApplyIgnoresPartiallyWrittenChange) {
+		// Arrange:
+		TestContext context(1);
+		context.start();
+		context.change(Height(2));
+		context.change(Height(3));
+
+		// - simulate a crash while writing the last change
+		auto logFilePath = GetLogFilePath(context.dataDirectory());
+		boost::filesystem::resize_file(logFilePath, boost::filesystem::file_size(logFilePath) - 1);
+
+		// Assert:
+		AssertAppliedChanges(context, Height(2), false);
+	}
+
+	TEST(TEST_CLASS, ApplyStopsAtChangeFromDifferentFork) {
+		// Arrange:
+		TestContext context(1);
+		context.start();
+		context.change(Height(2));
+		context.change(Height(3));
+		context.change(Height(4));
+
+		// - replace the block at height 3 with a block from a different fork
+		{
+			auto storageModifier = context.storage().modifier();
+			storageModifier.dropBlocksAfter(Height(2));
+
+			model::Block block;
+			block.Size = sizeof(model::Block);
+			block.Height = Height(3);
+			block.Timestamp = Timestamp(12345);
+			storageModifier.saveBlock(test::BlockToBlockElement(block));
+		}
+
+		// Assert:
+		AssertAppliedChanges(context, Height(2), false);
+	}
+
+	// endregion
+}}
@@ -31,18 +31,9 @@ namespace catapult { namespace harvesting {
 		using HarvestingUtFacade = HarvestingUtFacadeFactory::HarvestingUtFacade;
 		using TransactionInfoPointers = std::vector<const model::TransactionInfo*>;
 
-		enum class SortDirection { Ascending, Descending };
-
-		template<SortDirection Direction>
-		struct MaxFeeMultiplierComparer {
-			bool operator()(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) const {
-				auto lhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pLhs->pEntity);
-				auto rhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pRhs->pEntity);
-				return SortDirection::Ascending == Direction
-						? lhsMaxFeeMultiplier < rhsMaxFeeMultiplier
-						: lhsMaxFeeMultiplier > rhsMaxFeeMultiplier;
-			}
-		};
+		bool IsMaxFeeMultiplierLess(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) {
+			return model::CalculateTransactionMaxFeeMultiplier(*pLhs->pEntity) < model::CalculateTransactionMaxFeeMultiplier(*pRhs->pEntity);
+		}
 
 		TransactionsInfo ToTransactionsInfo(const TransactionInfoPointers& transactionInfoPointers, BlockFeeMultiplier feeMultiplier) {
 			TransactionsInfo transactionsInfo;
@@ -68,8 +59,7 @@ namespace catapult { namespace harvesting {
 			// 2. pick the smallest multiplier so that all transactions pass validation
 			auto minFeeMultiplier = BlockFeeMultiplier();
 			if (!candidates.empty()) {
-				auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending>();
-				auto minIter = std::min_element(candidates.cbegin(), candidates.cend(), comparer);
+				auto minIter = std::min_element(candidates.cbegin(), candidates.cend(), IsMaxFeeMultiplierLess);
 				minFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*(*minIter)->pEntity);
 			}
 
@@ -77,9 +67,9 @@ namespace catapult { namespace harvesting {
 		}
 
 		TransactionsInfo SupplyMinimumFee(const cache::MemoryUtCacheView& utCacheView, HarvestingUtFacade& utFacade, uint32_t count) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending>();
-			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, comparer, [&utFacade](
+			// 1. get transactions with the smallest max fee multipliers from the ut cache
+			auto order = cache::MaxFeeMultiplierOrder::Ascending;
+			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, order, [&utFacade](
 					const auto& transactionInfo) {
 				return utFacade.apply(transactionInfo);
 			});
@@ -93,10 +83,10 @@ namespace catapult { namespace harvesting {
 		}
 
 		TransactionsInfo SupplyMaximumFee(const cache::MemoryUtCacheView& utCacheView, HarvestingUtFacade& utFacade, uint32_t count) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Descending>();
+			// 1. get transactions with the largest max fee multipliers from the ut cache
+			auto order = cache::MaxFeeMultiplierOrder::Descending;
 			auto maximizer = TransactionFeeMaximizer();
-			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, comparer, [&utFacade, &maximizer](
+			auto candidates = cache::GetFirstTransactionInfoPointers(utCacheView, count, order, [&utFacade, &maximizer](
 					const auto& transactionInfo) {
 				if (!utFacade.apply(transactionInfo))
 					return false;
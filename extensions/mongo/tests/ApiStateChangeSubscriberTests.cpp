@@ -20,6 +20,7 @@
 
 #include "mongo/src/ApiStateChangeSubscriber.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/state/CatapultState.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace mongo {
@@ -126,9 +127,10 @@ namespace catapult { namespace mongo {
 		auto cache = cache::CatapultCache({});
 		auto cacheDelta = cache.createDelta();
 		auto chainScore = model::ChainScore(123, 435);
+		auto catapultState = state::CatapultState();
 
 		// Act:
-		context.subscriber().notifyStateChange(consumers::StateChangeInfo(cacheDelta, chainScore, Height(123)));
+		context.subscriber().notifyStateChange(consumers::StateChangeInfo(cacheDelta, chainScore, catapultState, Height(123)));
 
 		// Assert:
 		EXPECT_TRUE(context.chainScoreProvider().scores().empty());
@@ -67,6 +67,17 @@ namespace catapult { namespace chain {
 
 			return cosignatures;
 		}
+
+		std::vector<bool> VerifyCosignatures(const DetachedCosignatures& cosignatures) {
+			std::vector<crypto::SignatureInput> signatureInputs;
+			signatureInputs.reserve(cosignatures.size());
+			for (const auto& cosignature : cosignatures)
+				signatureInputs.push_back({ cosignature.Signer, cosignature.ParentHash, cosignature.Signature });
+
+			std::vector<bool> results;
+			crypto::VerifyMulti(signatureInputs.data(), signatureInputs.size(), results);
+			return results;
+		}
 	}
 
 	struct StaleTransactionInfo {
@@ -210,6 +221,13 @@ namespace catapult { namespace chain {
 
 	private:
 		CosignatureUpdateResult updateImpl(const model::DetachedCosignature& cosignature) {
+			return updateImpl(cosignature, [&cosignature]() {
+				return crypto::Verify(cosignature.Signer, cosignature.ParentHash, cosignature.Signature);
+			});
+		}
+
+		template<typename TIsVerified>
+		CosignatureUpdateResult updateImpl(const model::DetachedCosignature& cosignature, TIsVerified isVerified) {
 			auto eligiblityResult = checkEligibility(cosignature);
 
 			// proactively refresh the cache even if the new cosignature is invalid
@@ -223,7 +241,7 @@ namespace catapult { namespace chain {
 				return eligiblityResult.updateResult();
 			}
 
-			if (!crypto::Verify(cosignature.Signer, cosignature.ParentHash, cosignature.Signature)) {
+			if (!isVerified()) {
 				CATAPULT_LOG(debug)
 						<< "ignoring unverifiable cosignature (signer = " << utils::HexFormat(cosignature.Signer)
 						<< ", parentHash = " << utils::HexFormat(cosignature.ParentHash) << ")";
@@ -239,19 +257,24 @@ namespace catapult { namespace chain {
 			if (cosignatures.empty())
 				return thread::make_ready_future(TransactionUpdateResult{ updateType, 0u });
 
-			std::vector<thread::future<CosignatureUpdateResult>> futures;
-			for (const auto& cosignature : cosignatures)
-				futures.emplace_back(update(cosignature));
+			auto pPromise = std::make_shared<thread::promise<TransactionUpdateResult>>(); // needs to be copyable to pass to post
+			auto updateFuture = pPromise->get_future();
 
-			return thread::when_all(std::move(futures)).then([updateType](auto&& resultsFuture) {
-				auto results = resultsFuture.get();
-				auto numCosignaturesAdded = std::count_if(results.begin(), results.end(), [](auto& resultFuture) {
-					auto result = resultFuture.get();
-					return CosignatureUpdateResult::Added_Incomplete == result || CosignatureUpdateResult::Added_Complete == result;
-				});
+			// verify all cosignatures as a single batch and then process them using the precomputed verification results
+			m_pPool->service().post([pThis = shared_from_this(), cosignatures, updateType, pPromise]() {
+				auto verificationResults = VerifyCosignatures(cosignatures);
 
-				return TransactionUpdateResult{ updateType, static_cast<size_t>(numCosignaturesAdded) };
+				size_t numCosignaturesAdded = 0;
+				for (auto i = 0u; i < cosignatures.size(); ++i) {
+					auto result = pThis->updateImpl(cosignatures[i], [isVerified = verificationResults[i]]() { return isVerified; });
+					if (CosignatureUpdateResult::Added_Incomplete == result || CosignatureUpdateResult::Added_Complete == result)
+						++numCosignaturesAdded;
+				}
+
+				pPromise->set_value(TransactionUpdateResult{ updateType, numCosignaturesAdded });
 			});
+
+			return updateFuture;
 		}
 
 		CosignatureUpdateResult addCosignature(const model::DetachedCosignature& cosignature) {
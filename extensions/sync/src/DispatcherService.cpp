@@ -52,6 +52,7 @@
 #include "catapult/subscribers/StateChangeSubscriber.h"
 #include "catapult/subscribers/TransactionStatusSubscriber.h"
 #include "catapult/thread/MultiServicePool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/validators/AggregateEntityValidator.h"
 #include <boost/filesystem.hpp>
 
@@ -77,10 +78,16 @@ namespace catapult { namespace sync {
 			return options;
 		}
 
+		std::shared_ptr<const validators::ParallelValidationPolicy> CreateValidationPolicy(
+				const std::shared_ptr<thread::IoServiceThreadPool>& pValidatorPool) {
+			// entity validation costs vary widely (e.g. aggregates vs transfers), so let idle workers steal remaining entities
+			return validators::CreateParallelValidationPolicy(pValidatorPool, thread::ParallelForStrategy::Work_Stealing);
+		}
+
 		std::unique_ptr<ConsumerDispatcher> CreateConsumerDispatcher(
 				extensions::ServiceState& state,
 				const ConsumerDispatcherOptions& options,
-				std::vector<DisruptorConsumer>&& disruptorConsumers) {
+				std::vector<DisruptorConsumerStage>&& disruptorConsumerStages) {
 			auto& statusSubscriber = state.transactionStatusSubscriber();
 			auto reclaimMemoryInspector = CreateReclaimMemoryInspector();
 			auto inspector = [&statusSubscriber, &nodes = state.nodes(), reclaimMemoryInspector](
@@ -100,10 +107,10 @@ namespace catapult { namespace sync {
 				CATAPULT_LOG(debug) << "enabling auditing to " << auditPath;
 
 				boost::filesystem::create_directories(auditPath);
-				disruptorConsumers.insert(disruptorConsumers.begin(), CreateAuditConsumer(auditPath.generic_string()));
+				disruptorConsumerStages.insert(disruptorConsumerStages.begin(), { CreateAuditConsumer(auditPath.generic_string()), 1 });
 			}
 
-			return std::make_unique<ConsumerDispatcher>(options, disruptorConsumers, inspector);
+			return std::make_unique<ConsumerDispatcher>(options, disruptorConsumerStages, inspector);
 		}
 
 		// endregion
@@ -125,6 +132,7 @@ namespace catapult { namespace sync {
 			};
 			return CreateBlockChainProcessor(
 					blockHitPredicateFactory,
+					chain::CreateStatePrefetcher(executionConfig),
 					chain::CreateBatchEntityProcessor(executionConfig),
 					GetReceiptValidationMode(blockChainConfig));
 		}
@@ -195,7 +203,7 @@ namespace catapult { namespace sync {
 						m_state.timeSupplier()));
 				m_consumers.push_back(CreateBlockStatelessValidationConsumer(
 						extensions::CreateStatelessValidator(m_state.pluginManager()),
-						validators::CreateParallelValidationPolicy(pValidatorPool),
+						CreateValidationPolicy(pValidatorPool),
 						ToRequiresValidationPredicate(m_state.hooks().knownHashPredicate(m_state.utCache()))));
 
 				auto disruptorConsumers = DisruptorConsumersFromBlockConsumers(m_consumers);
@@ -210,7 +218,7 @@ namespace catapult { namespace sync {
 				return CreateConsumerDispatcher(
 						m_state,
 						CreateBlockConsumerDispatcherOptions(m_nodeConfig),
-						std::move(disruptorConsumers));
+						DisruptorConsumerStagesFromConsumers(disruptorConsumers));
 			}
 
 		private:
@@ -249,10 +257,12 @@ namespace catapult { namespace sync {
 			explicit TransactionDispatcherBuilder(extensions::ServiceState& state)
 					: m_state(state)
 					, m_nodeConfig(m_state.config().Node)
+					, m_hashCalculatorConsumerIndex(0)
 			{}
 
 		public:
 			void addHashConsumers() {
+				m_hashCalculatorConsumerIndex = m_consumers.size();
 				m_consumers.push_back(CreateTransactionHashCalculatorConsumer(m_state.pluginManager().transactionRegistry()));
 				m_consumers.push_back(CreateTransactionHashCheckConsumer(
 						m_state.timeSupplier(),
@@ -269,7 +279,7 @@ namespace catapult { namespace sync {
 					chain::UtUpdater& utUpdater) {
 				m_consumers.push_back(CreateTransactionStatelessValidationConsumer(
 						extensions::CreateStatelessValidator(m_state.pluginManager()),
-						validators::CreateParallelValidationPolicy(pValidatorPool),
+						CreateValidationPolicy(pValidatorPool),
 						extensions::SubscriberToSink(m_state.transactionStatusSubscriber())));
 
 				auto disruptorConsumers = DisruptorConsumersFromTransactionConsumers(m_consumers);
@@ -283,16 +293,21 @@ namespace catapult { namespace sync {
 					utUpdater.update(std::move(transactionInfos));
 				}));
 
+				// hash calculation is independent for each element, so it can be parallelized across multiple worker threads
+				auto disruptorConsumerStages = DisruptorConsumerStagesFromConsumers(disruptorConsumers);
+				disruptorConsumerStages[m_hashCalculatorConsumerIndex].NumWorkerThreads = m_nodeConfig.NumTransactionHashCalculatorThreads;
+
 				return CreateConsumerDispatcher(
 						m_state,
 						CreateTransactionConsumerDispatcherOptions(m_nodeConfig),
-						std::move(disruptorConsumers));
+						std::move(disruptorConsumerStages));
 			}
 
 		private:
 			extensions::ServiceState& m_state;
 			const config::NodeConfiguration& m_nodeConfig;
 			std::vector<TransactionConsumer> m_consumers;
+			size_t m_hashCalculatorConsumerIndex;
 		};
 
 		void RegisterTransactionDispatcherService(
@@ -59,6 +59,35 @@ namespace catapult { namespace sync {
 			return chainSynchronizerConfig;
 		}
 
+		chain::RemoteChainApisSupplier CreateHelperRemoteChainApisSupplier(
+				const extensions::ServiceState& state,
+				net::PacketWriters& packetWriters) {
+			const auto& nodeConfig = state.config().Node;
+			auto numHelpers = std::max<uint32_t>(1, nodeConfig.MaxSyncDownloadPeers) - 1;
+			const auto& transactionRegistry = state.pluginManager().transactionRegistry();
+			return [numHelpers, &packetWriters, &transactionRegistry, syncTimeout = nodeConfig.SyncTimeout]() {
+				std::vector<std::shared_ptr<const api::RemoteChainApi>> remoteChainApis;
+				for (auto i = 0u; i < numHelpers; ++i) {
+					// every checked out io is unavailable until it is returned, so each pick returns a different peer
+					auto packetIoPair = packetWriters.pickOne(syncTimeout);
+					if (!packetIoPair)
+						break;
+
+					auto pRemoteChainApi = utils::UniqueToShared(api::CreateRemoteChainApi(
+							*packetIoPair.io(),
+							packetIoPair.node().identityKey(),
+							transactionRegistry));
+
+					// extend the lifetime of packetIoPair until the api is destroyed
+					remoteChainApis.push_back(std::shared_ptr<const api::RemoteChainApi>(
+							pRemoteChainApi.get(),
+							[pRemoteChainApi, packetIoPair](const auto*) {}));
+				}
+
+				return remoteChainApis;
+			};
+		}
+
 		thread::Task CreateSynchronizerTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			const auto& config = state.config();
 			auto chainSynchronizer = chain::CreateChainSynchronizer(
@@ -66,6 +95,7 @@ namespace catapult { namespace sync {
 						return score.get();
 					}),
 					CreateChainSynchronizerConfiguration(config),
+					CreateHelperRemoteChainApisSupplier(state, packetWriters),
 					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source));
 
 			thread::Task task;
@@ -80,8 +110,12 @@ namespace catapult { namespace sync {
 		}
 
 		thread::Task CreatePullUtTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
-			auto utSynchronizer = chain::CreateUtSynchronizer(
-					state.config().Node.MinFeeMultiplier,
+			const auto& nodeConfig = state.config().Node;
+			auto utSynchronizerFactory = nodeConfig.ShouldUseTransactionSketchSync
+					? chain::CreateUtSketchSynchronizer
+					: chain::CreateUtSynchronizer;
+			auto utSynchronizer = utSynchronizerFactory(
+					nodeConfig.MinFeeMultiplier,
 					[&cache = state.utCache()]() { return cache.view().shortHashes(); },
 					state.hooks().transactionRangeConsumerFactory()(Sync_Source));
 
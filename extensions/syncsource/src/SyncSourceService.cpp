@@ -41,8 +41,31 @@ namespace catapult { namespace syncsource {
 			model::ChainScoreSupplier ChainScoreSupplier;
 			handlers::PullBlocksHandlerConfiguration BlocksHandlerConfig;
 			handlers::UtRetriever UtRetriever;
+			handlers::UtSketchRetriever UtSketchRetriever;
 		};
 
+		handlers::UtSketchRetrieverResult RetrieveUnknownTransactions(
+				const cache::MemoryUtCache& cache,
+				BlockFeeMultiplier minFeeMultiplier,
+				const utils::ShortHashSketch& remoteSketch) {
+			handlers::UtSketchRetrieverResult result{};
+			auto view = cache.view();
+
+			// sketch all (even low fee) local transactions so that the difference is only affected by different cache contents
+			auto sketch = view.shortHashSketch(remoteSketch.size());
+			sketch.subtract(remoteSketch);
+
+			utils::ShortHashesSet localShortHashes;
+			utils::ShortHashesSet remoteShortHashes;
+			result.IsDecoded = sketch.tryDecode(localShortHashes, remoteShortHashes);
+			if (!result.IsDecoded)
+				return result;
+
+			result.NumDifferences = static_cast<uint32_t>(localShortHashes.size() + remoteShortHashes.size());
+			result.Transactions = view.transactionsWithShortHashes(minFeeMultiplier, localShortHashes);
+			return result;
+		}
+
 		HandlersConfiguration CreateHandlersConfiguration(const extensions::ServiceState& state) {
 			HandlersConfiguration config;
 			config.PushBlockCallback = extensions::CreateBlockPushEntityCallback(state.hooks());
@@ -51,6 +74,9 @@ namespace catapult { namespace syncsource {
 			config.UtRetriever = [&cache = state.utCache()](auto minFeeMultiplier, const auto& shortHashes) {
 				return cache.view().unknownTransactions(minFeeMultiplier, shortHashes);
 			};
+			config.UtSketchRetriever = [&cache = state.utCache()](auto minFeeMultiplier, const auto& remoteSketch) {
+				return RetrieveUnknownTransactions(cache, minFeeMultiplier, remoteSketch);
+			};
 
 			SetConfig(config.BlocksHandlerConfig, state.config().Node);
 			return config;
@@ -69,6 +95,7 @@ namespace catapult { namespace syncsource {
 			handlers::RegisterPullBlocksHandler(handlers, storage, config.BlocksHandlerConfig);
 
 			handlers::RegisterPullTransactionsHandler(handlers, config.UtRetriever);
+			handlers::RegisterPullTransactionsSketchHandler(handlers, config.UtSketchRetriever);
 		}
 
 		class SyncSourceServiceRegistrar : public extensions::ServiceRegistrar {
@@ -75,6 +75,35 @@ namespace catapult { namespace plugins {
 				});
 			});
 		}
+
+		void AddPrefetchKeysExtractors(PluginManager& manager) {
+			manager.addPrefetchKeysExtractor<model::AccountAddressNotification>([](
+					const auto& notification,
+					const auto& resolvers,
+					auto& keys) {
+				keys.Addresses.insert(resolvers.resolve(notification.Address));
+			});
+
+			manager.addPrefetchKeysExtractor<model::AccountPublicKeyNotification>([](const auto& notification, const auto&, auto& keys) {
+				keys.PublicKeys.insert(notification.PublicKey);
+			});
+
+			manager.addPrefetchKeysExtractor<model::BalanceTransferNotification>([](
+					const auto& notification,
+					const auto& resolvers,
+					auto& keys) {
+				keys.PublicKeys.insert(notification.Sender);
+				keys.Addresses.insert(resolvers.resolve(notification.Recipient));
+			});
+
+			manager.addPrefetchKeysExtractor<model::BalanceDebitNotification>([](const auto& notification, const auto&, auto& keys) {
+				keys.PublicKeys.insert(notification.Sender);
+			});
+
+			manager.addPrefetchKeysExtractor<model::BlockNotification>([](const auto& notification, const auto&, auto& keys) {
+				keys.PublicKeys.insert(notification.Signer);
+			});
+		}
 	}
 
 	void RegisterCoreSystem(PluginManager& manager) {
@@ -82,6 +111,7 @@ namespace catapult { namespace plugins {
 
 		AddAccountStateCache(manager, config);
 		AddBlockDifficultyCache(manager, config);
+		AddPrefetchKeysExtractors(manager);
 
 		manager.addStatelessValidatorHook([&config](auto& builder) {
 			builder
@@ -19,11 +19,16 @@
 **/
 
 #include "src/CoreSystem.h"
+#include "tests/test/core/AddressTestUtils.h"
 #include "tests/test/plugins/PluginTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace plugins {
 
+#define TEST_CLASS CoreSystemTests
+
+	// region basic
+
 	namespace {
 		struct CoreSystemTraits {
 		public:
@@ -103,4 +108,49 @@ namespace catapult { namespace plugins {
 	}
 
 	DEFINE_PLUGIN_TESTS(CoreSystemTests, CoreSystemTraits)
+
+	// endregion
+
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetchKeysExtractorExtractsBalanceTransferParticipants) {
+		// Arrange:
+		auto sender = test::GenerateRandomData<Key_Size>();
+		auto recipient = test::GenerateRandomUnresolvedAddress();
+		auto notification = model::BalanceTransferNotification(sender, recipient, UnresolvedMosaicId(123), Amount(234));
+
+		// Act:
+		auto keys = test::ExtractPrefetchKeys<CoreSystemTraits>(notification);
+
+		// Assert:
+		EXPECT_EQ(utils::KeySet({ sender }), keys.PublicKeys);
+		EXPECT_EQ(model::AddressSet({ model::ResolverContext().resolve(recipient) }), keys.Addresses);
+		EXPECT_TRUE(keys.MosaicIds.empty());
+	}
+
+	TEST(TEST_CLASS, PrefetchKeysExtractorExtractsBlockSigner) {
+		// Arrange:
+		auto signer = test::GenerateRandomData<Key_Size>();
+		auto notification = model::BlockNotification(signer, Timestamp(123), Difficulty(234));
+
+		// Act:
+		auto keys = test::ExtractPrefetchKeys<CoreSystemTraits>(notification);
+
+		// Assert:
+		EXPECT_EQ(utils::KeySet({ signer }), keys.PublicKeys);
+		EXPECT_TRUE(keys.Addresses.empty());
+	}
+
+	TEST(TEST_CLASS, PrefetchKeysExtractorIgnoresUnsupportedNotifications) {
+		// Arrange:
+		auto notification = model::SourceChangeNotification(1, 2, model::SourceChangeNotification::SourceChangeType::Absolute);
+
+		// Act:
+		auto keys = test::ExtractPrefetchKeys<CoreSystemTraits>(notification);
+
+		// Assert:
+		EXPECT_TRUE(keys.empty());
+	}
+
+	// endregion
 }}
@@ -39,4 +39,9 @@ namespace catapult { namespace cache {
 	void HashCacheStorage::LoadInto(const ValueType& timestampedHash, DestinationType& cacheDelta) {
 		cacheDelta.insert(timestampedHash);
 	}
+
+	void HashCacheStorage::Purge(const ValueType& timestampedHash, DestinationType& cacheDelta) {
+		if (cacheDelta.contains(timestampedHash))
+			cacheDelta.remove(timestampedHash);
+	}
 }}
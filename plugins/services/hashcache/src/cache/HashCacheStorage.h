@@ -34,5 +34,9 @@ namespace catapult { namespace cache {
 
 		/// Loads \a timestampedHash into \a cacheDelta.
 		static void LoadInto(const ValueType& timestampedHash, DestinationType& cacheDelta);
+
+		/// Purges \a timestampedHash from \a cacheDelta.
+		/// \note This is a no-op if \a timestampedHash is not contained in \a cacheDelta.
+		static void Purge(const ValueType& timestampedHash, DestinationType& cacheDelta);
 	};
 }}
@@ -85,6 +85,44 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region delta elements
+
+	TEST(TEST_CLASS, DeltaElementsReturnsElementsInTimestampOrder) {
+		// Arrange:
+		HashCache cache(CacheConfiguration(), utils::TimeSpan::FromHours(32));
+		{
+			auto delta = cache.createDelta();
+			for (auto i : { 10u, 20u, 30u })
+				delta->insert(HashCacheMixinTraits::MakeId(static_cast<uint8_t>(i)));
+
+			cache.commit();
+		}
+
+		auto delta = cache.createDelta();
+
+		// Act:
+		for (auto i : { 25u, 5u, 15u })
+			delta->insert(HashCacheMixinTraits::MakeId(static_cast<uint8_t>(i)));
+
+		for (auto i : { 30u, 10u })
+			delta->remove(HashCacheMixinTraits::MakeId(static_cast<uint8_t>(i)));
+
+		// Assert:
+		auto collectTimestamps = [](const auto& timestampedHashes) {
+			std::vector<Timestamp> timestamps;
+			for (const auto* pTimestampedHash : timestampedHashes)
+				timestamps.push_back(pTimestampedHash->Time);
+
+			return timestamps;
+		};
+
+		EXPECT_EQ(std::vector<Timestamp>({ Timestamp(5), Timestamp(15), Timestamp(25) }), collectTimestamps(delta->addedElements()));
+		EXPECT_TRUE(delta->modifiedElements().empty());
+		EXPECT_EQ(std::vector<Timestamp>({ Timestamp(10), Timestamp(30) }), collectTimestamps(delta->removedElements()));
+	}
+
+	// endregion
+
 	// region prune
 
 	TEST(TEST_CLASS, PruningBoundaryIsInitiallyUnset) {
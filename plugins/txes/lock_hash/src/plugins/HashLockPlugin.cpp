@@ -25,6 +25,7 @@
 #include "src/observers/Observers.h"
 #include "src/plugins/HashLockTransactionPlugin.h"
 #include "src/validators/Validators.h"
+#include "plugins/txes/aggregate/src/model/AggregateEntityType.h"
 #include "catapult/observers/ObserverUtils.h"
 #include "catapult/plugins/CacheHandlers.h"
 #include "catapult/plugins/PluginManager.h"
@@ -46,6 +47,15 @@ namespace catapult { namespace plugins {
 			});
 		});
 
+		manager.addPrefetchKeysExtractor<model::HashLockNotification>([](const auto& notification, const auto&, auto& keys) {
+			keys.LockHashes.insert(notification.Hash);
+		});
+
+		manager.addPrefetchKeysExtractor<model::TransactionNotification>([](const auto& notification, const auto&, auto& keys) {
+			if (model::Entity_Type_Aggregate_Bonded == notification.TransactionType)
+				keys.LockHashes.insert(notification.TransactionHash);
+		});
+
 		auto config = model::LoadPluginConfiguration<config::HashLockConfiguration>(manager.config(), "catapult.plugins.lockhash");
 		auto blockGenerationTargetTime = manager.config().BlockGenerationTargetTime;
 		auto currencyMosaicId = model::GetUnresolvedCurrencyMosaicId(manager.config());
@@ -20,11 +20,17 @@
 
 #include "src/plugins/HashLockPlugin.h"
 #include "src/model/HashLockEntityType.h"
+#include "src/model/HashLockNotifications.h"
+#include "plugins/txes/aggregate/src/model/AggregateEntityType.h"
 #include "tests/test/plugins/PluginTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace plugins {
 
+#define TEST_CLASS HashLockPluginTests
+
+	// region basic
+
 	namespace {
 		struct HashLockPluginTraits {
 		public:
@@ -94,4 +100,53 @@ namespace catapult { namespace plugins {
 	}
 
 	DEFINE_PLUGIN_TESTS(HashLockPluginTests, HashLockPluginTraits)
+
+	// endregion
+
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetchKeysExtractorExtractsHashLockHash) {
+		// Arrange:
+		auto signer = test::GenerateRandomData<Key_Size>();
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		auto notification = model::HashLockNotification(signer, { UnresolvedMosaicId(123), Amount(234) }, BlockDuration(345), hash);
+
+		// Act:
+		auto keys = test::ExtractPrefetchKeys<HashLockPluginTraits>(notification);
+
+		// Assert:
+		EXPECT_EQ(utils::HashSet({ hash }), keys.LockHashes);
+	}
+
+	namespace {
+		cache::PrefetchKeys ExtractPrefetchKeysFromTransactionNotification(const Hash256& hash, model::EntityType transactionType) {
+			auto signer = test::GenerateRandomData<Key_Size>();
+			auto notification = model::TransactionNotification(signer, hash, transactionType, Timestamp(123));
+			return test::ExtractPrefetchKeys<HashLockPluginTraits>(notification);
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetchKeysExtractorExtractsAggregateBondedTransactionHash) {
+		// Arrange:
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+
+		// Act:
+		auto keys = ExtractPrefetchKeysFromTransactionNotification(hash, model::Entity_Type_Aggregate_Bonded);
+
+		// Assert:
+		EXPECT_EQ(utils::HashSet({ hash }), keys.LockHashes);
+	}
+
+	TEST(TEST_CLASS, PrefetchKeysExtractorIgnoresOtherTransactionHashes) {
+		// Arrange:
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+
+		// Act:
+		auto keys = ExtractPrefetchKeysFromTransactionNotification(hash, model::Entity_Type_Aggregate_Complete);
+
+		// Assert:
+		EXPECT_TRUE(keys.empty());
+	}
+
+	// endregion
 }}
@@ -48,6 +48,14 @@ namespace catapult { namespace plugins {
 			});
 		});
 
+		manager.addPrefetchKeysExtractor<model::SecretLockNotification>([](const auto& notification, const auto&, auto& keys) {
+			keys.LockHashes.insert(notification.Secret);
+		});
+
+		manager.addPrefetchKeysExtractor<model::ProofPublicationNotification>([](const auto& notification, const auto&, auto& keys) {
+			keys.LockHashes.insert(notification.Secret);
+		});
+
 		auto config = model::LoadPluginConfiguration<config::SecretLockConfiguration>(manager.config(), "catapult.plugins.locksecret");
 		auto blockGenerationTargetTime = manager.config().BlockGenerationTargetTime;
 		manager.addStatelessValidatorHook([config, blockGenerationTargetTime](auto& builder) {
@@ -20,11 +20,16 @@
 
 #include "src/plugins/SecretLockPlugin.h"
 #include "src/model/SecretLockEntityType.h"
+#include "src/model/SecretLockNotifications.h"
 #include "tests/test/plugins/PluginTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace plugins {
 
+#define TEST_CLASS SecretLockPluginTests
+
+	// region basic
+
 	namespace {
 		struct SecretLockPluginTraits {
 		public:
@@ -95,4 +100,23 @@ namespace catapult { namespace plugins {
 	}
 
 	DEFINE_PLUGIN_TESTS(SecretLockPluginTests, SecretLockPluginTraits)
+
+	// endregion
+
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetchKeysExtractorExtractsPublishedSecret) {
+		// Arrange:
+		auto signer = test::GenerateRandomData<Key_Size>();
+		auto secret = test::GenerateRandomData<Hash256_Size>();
+		auto notification = model::ProofPublicationNotification(signer, model::LockHashAlgorithm::Op_Sha3_256, secret);
+
+		// Act:
+		auto keys = test::ExtractPrefetchKeys<SecretLockPluginTraits>(notification);
+
+		// Assert:
+		EXPECT_EQ(utils::HashSet({ secret }), keys.LockHashes);
+	}
+
+	// endregion
 }}
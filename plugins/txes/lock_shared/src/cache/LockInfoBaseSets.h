@@ -47,10 +47,18 @@ namespace catapult { namespace cache {
 
 	public:
 		explicit LockInfoBaseSets(const CacheConfiguration& config)
-				: CacheDatabaseMixin(config, { "default", "height_grouping" })
+				: CacheDatabaseMixin(
+						config,
+						{ "default", "height_grouping" },
+						{ RocksColumnProfile::Point_Lookup, RocksColumnProfile::Default })
 				, Primary(GetContainerMode(config), database(), 0)
 				, HeightGrouping(GetContainerMode(config), database(), 1)
-				, PatriciaTree(hasPatriciaTreeSupport(), database(), 2)
+				, PatriciaTree(
+						hasPatriciaTreeSupport(),
+						database(),
+						2,
+						config.PatriciaTreeNodeCacheOptions,
+						config.PatriciaTreeNumRetainedRoots)
 		{}
 
 	public:
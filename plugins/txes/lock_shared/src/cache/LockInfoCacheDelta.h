@@ -21,6 +21,7 @@
 #pragma once
 #include "catapult/cache/CacheMixinAliases.h"
 #include "catapult/cache/IdentifierGroupCacheUtils.h"
+#include "catapult/cache/PrefetchKeys.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
 #include "catapult/deltaset/BaseSetDelta.h"
 
@@ -90,6 +91,11 @@ namespace catapult { namespace cache {
 			});
 		}
 
+		/// Loads all lock infos identified by \a keys ahead of time.
+		void prefetch(const PrefetchKeys& keys) const {
+			m_pDelta->prefetch(keys.LockHashes);
+		}
+
 	private:
 		typename TCacheTypes::PrimaryTypes::BaseSetDeltaPointerType m_pDelta;
 		typename TCacheTypes::HeightGroupingTypes::BaseSetDeltaPointerType m_pHeightGroupingDelta;
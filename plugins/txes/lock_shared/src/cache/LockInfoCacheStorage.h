@@ -37,5 +37,13 @@ namespace catapult { namespace cache {
 		static void LoadInto(const ValueType& lockInfo, DestinationType& cacheDelta) {
 			cacheDelta.insert(lockInfo);
 		}
+
+		/// Purges \a lockInfo from \a cacheDelta.
+		/// \note This is a no-op if \a lockInfo is not contained in \a cacheDelta.
+		static void Purge(const ValueType& lockInfo, DestinationType& cacheDelta) {
+			auto key = TDescriptor::GetKeyFromValue(lockInfo);
+			if (cacheDelta.contains(key))
+				cacheDelta.remove(key);
+		}
 	};
 }}
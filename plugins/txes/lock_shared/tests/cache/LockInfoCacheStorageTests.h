@@ -50,6 +50,55 @@ namespace catapult { namespace cache {
 			// - the loaded cache value is correct
 			TLockInfoTraits::AssertEqual(originalLockInfo, loadedLockInfo);
 		}
+
+		static void AssertCanPurgeValueFromCache() {
+			// Arrange:
+			auto lockInfos = test::CreateLockInfos<TLockInfoTraits>(2);
+			typename TLockInfoTraits::CacheType cache(CacheConfiguration{});
+			{
+				auto delta = cache.createDelta();
+				for (const auto& lockInfo : lockInfos)
+					TLockInfoTraits::StorageType::LoadInto(lockInfo, *delta);
+
+				cache.commit();
+			}
+
+			// Act:
+			{
+				auto delta = cache.createDelta();
+				TLockInfoTraits::StorageType::Purge(lockInfos[0], *delta);
+				cache.commit();
+			}
+
+			// Assert:
+			auto view = cache.createView();
+			EXPECT_EQ(1u, view->size());
+			EXPECT_FALSE(view->contains(TLockInfoTraits::ToKey(lockInfos[0])));
+			EXPECT_TRUE(view->contains(TLockInfoTraits::ToKey(lockInfos[1])));
+		}
+
+		static void AssertPurgeIsNoOpWhenValueIsNotContained() {
+			// Arrange:
+			auto lockInfos = test::CreateLockInfos<TLockInfoTraits>(2);
+			typename TLockInfoTraits::CacheType cache(CacheConfiguration{});
+			{
+				auto delta = cache.createDelta();
+				TLockInfoTraits::StorageType::LoadInto(lockInfos[0], *delta);
+				cache.commit();
+			}
+
+			// Act:
+			{
+				auto delta = cache.createDelta();
+				TLockInfoTraits::StorageType::Purge(lockInfos[1], *delta);
+				cache.commit();
+			}
+
+			// Assert:
+			auto view = cache.createView();
+			EXPECT_EQ(1u, view->size());
+			EXPECT_TRUE(view->contains(TLockInfoTraits::ToKey(lockInfos[0])));
+		}
 	};
 }}
 
@@ -57,4 +106,6 @@ namespace catapult { namespace cache {
 	TEST(TEST_CLASS, TEST_NAME) { LockInfoCacheStorageTests<TRAITS_NAME>::Assert##TEST_NAME(); }
 
 #define DEFINE_LOCK_INFO_CACHE_STORAGE_TESTS(TRAITS_NAME) \
-	MAKE_LOCK_INFO_CACHE_STORAGE_TEST(TRAITS_NAME, CanLoadValueIntoCache)
+	MAKE_LOCK_INFO_CACHE_STORAGE_TEST(TRAITS_NAME, CanLoadValueIntoCache) \
+	MAKE_LOCK_INFO_CACHE_STORAGE_TEST(TRAITS_NAME, CanPurgeValueFromCache) \
+	MAKE_LOCK_INFO_CACHE_STORAGE_TEST(TRAITS_NAME, PurgeIsNoOpWhenValueIsNotContained)
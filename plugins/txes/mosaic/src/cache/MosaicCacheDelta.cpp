@@ -58,4 +58,8 @@ namespace catapult { namespace cache {
 		MosaicCacheDeltaMixins::BasicInsertRemove::insert(entry);
 		UpdateExpiryMap(*m_pMosaicIdsByExpiryHeight, entry);
 	}
+
+	void BasicMosaicCacheDelta::prefetch(const PrefetchKeys& keys) const {
+		m_pEntryById->prefetch(keys.MosaicIds);
+	}
 }}
@@ -22,6 +22,7 @@
 #include "MosaicBaseSets.h"
 #include "MosaicCacheSerializers.h"
 #include "catapult/cache/CacheMixinAliases.h"
+#include "catapult/cache/PrefetchKeys.h"
 #include "catapult/cache/ReadOnlyArtifactCache.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
 #include "catapult/deltaset/BaseSetDelta.h"
@@ -63,6 +64,9 @@ namespace catapult { namespace cache {
 		/// Inserts the mosaic \a entry into the cache.
 		void insert(const state::MosaicEntry& entry);
 
+		/// Loads all mosaics identified by \a keys ahead of time.
+		void prefetch(const PrefetchKeys& keys) const;
+
 	private:
 		MosaicCacheTypes::PrimaryTypes::BaseSetDeltaPointerType m_pEntryById;
 		MosaicCacheTypes::HeightGroupingTypes::BaseSetDeltaPointerType m_pMosaicIdsByExpiryHeight;
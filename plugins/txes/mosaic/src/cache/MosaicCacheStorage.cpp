@@ -26,4 +26,10 @@ namespace catapult { namespace cache {
 	void MosaicCacheStorage::LoadInto(const ValueType& entry, DestinationType& cacheDelta) {
 		cacheDelta.insert(entry);
 	}
+
+	void MosaicCacheStorage::Purge(const ValueType& entry, DestinationType& cacheDelta) {
+		auto key = MosaicCacheDescriptor::GetKeyFromValue(entry);
+		if (cacheDelta.contains(key))
+			cacheDelta.remove(key);
+	}
 }}
@@ -31,5 +31,9 @@ namespace catapult { namespace cache {
 			, public state::MosaicEntrySerializer {
 		/// Loads \a entry into \a cacheDelta.
 		static void LoadInto(const ValueType& entry, DestinationType& cacheDelta);
+
+		/// Purges \a entry from \a cacheDelta.
+		/// \note This is a no-op if \a entry is not contained in \a cacheDelta.
+		static void Purge(const ValueType& entry, DestinationType& cacheDelta);
 	};
 }}
@@ -55,6 +55,43 @@ namespace catapult { namespace plugins {
 		auto GetMosaicView(const cache::CatapultCache& cache) {
 			return cache.sub<cache::MosaicCache>().createView();
 		}
+
+		void AddPrefetchKeysExtractors(PluginManager& manager) {
+			manager.addPrefetchKeysExtractor<model::MosaicDefinitionNotification>([](const auto& notification, const auto&, auto& keys) {
+				keys.MosaicIds.insert(notification.MosaicId);
+			});
+
+			manager.addPrefetchKeysExtractor<model::MosaicSupplyChangeNotification>([](
+					const auto& notification,
+					const auto& resolvers,
+					auto& keys) {
+				keys.MosaicIds.insert(resolvers.resolve(notification.MosaicId));
+			});
+
+			manager.addPrefetchKeysExtractor<model::MosaicRequiredNotification>([](
+					const auto& notification,
+					const auto& resolvers,
+					auto& keys) {
+				keys.MosaicIds.insert(model::MosaicRequiredNotification::MosaicType::Resolved == notification.ProvidedMosaicType
+						? notification.MosaicId
+						: resolvers.resolve(notification.UnresolvedMosaicId));
+			});
+
+			manager.addPrefetchKeysExtractor<model::BalanceTransferNotification>([](
+					const auto& notification,
+					const auto& resolvers,
+					auto& keys) {
+				keys.MosaicIds.insert(resolvers.resolve(notification.MosaicId));
+			});
+
+			manager.addPrefetchKeysExtractor<model::MosaicRentalFeeNotification>([](
+					const auto& notification,
+					const auto& resolvers,
+					auto& keys) {
+				keys.PublicKeys.insert(notification.Sender);
+				keys.Addresses.insert(resolvers.resolve(notification.Recipient));
+			});
+		}
 	}
 
 	void RegisterMosaicSubsystem(PluginManager& manager) {
@@ -74,6 +111,8 @@ namespace catapult { namespace plugins {
 			counters.emplace_back(utils::DiagnosticCounterId("MOSAIC C"), [&cache]() { return GetMosaicView(cache)->size(); });
 		});
 
+		AddPrefetchKeysExtractors(manager);
+
 		auto maxDuration = config.MaxMosaicDuration.blocks(manager.config().BlockGenerationTargetTime);
 		manager.addStatelessValidatorHook([config, maxDuration](auto& builder) {
 			builder
@@ -48,4 +48,49 @@ namespace catapult { namespace cache {
 		// - the loaded cache value is correct
 		test::AssertEqual(originalEntry, loadedEntry);
 	}
+
+	TEST(TEST_CLASS, CanPurgeValueFromCache) {
+		// Arrange:
+		MosaicCache cache(CacheConfiguration{});
+		auto entry1 = test::CreateMosaicEntry(MosaicId(680), Amount(111));
+		auto entry2 = test::CreateMosaicEntry(MosaicId(681), Amount(222));
+		{
+			auto delta = cache.createDelta();
+			MosaicCacheStorage::LoadInto(entry1, *delta);
+			MosaicCacheStorage::LoadInto(entry2, *delta);
+			cache.commit();
+		}
+
+		// Act:
+		auto delta = cache.createDelta();
+		MosaicCacheStorage::Purge(entry1, *delta);
+		cache.commit();
+
+		// Assert:
+		auto view = cache.createView();
+		EXPECT_EQ(1u, view->size());
+		EXPECT_FALSE(view->contains(entry1.mosaicId()));
+		EXPECT_TRUE(view->contains(entry2.mosaicId()));
+	}
+
+	TEST(TEST_CLASS, PurgeIsNoOpWhenValueIsNotContained) {
+		// Arrange:
+		MosaicCache cache(CacheConfiguration{});
+		auto entry = test::CreateMosaicEntry(MosaicId(680), Amount(111));
+		{
+			auto delta = cache.createDelta();
+			MosaicCacheStorage::LoadInto(entry, *delta);
+			cache.commit();
+		}
+
+		// Act:
+		auto delta = cache.createDelta();
+		MosaicCacheStorage::Purge(test::CreateMosaicEntry(MosaicId(681), Amount(222)), *delta);
+		cache.commit();
+
+		// Assert:
+		auto view = cache.createView();
+		EXPECT_EQ(1u, view->size());
+		EXPECT_TRUE(view->contains(entry.mosaicId()));
+	}
 }}
@@ -21,11 +21,17 @@
 #include "src/plugins/MosaicPlugin.h"
 #include "src/cache/MosaicCache.h"
 #include "src/model/MosaicEntityType.h"
+#include "src/model/MosaicNotifications.h"
+#include "tests/test/core/AddressTestUtils.h"
 #include "tests/test/plugins/PluginTestUtils.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace plugins {
 
+#define TEST_CLASS MosaicPluginTests
+
+	// region basic
+
 	namespace {
 		struct MosaicPluginTraits {
 		public:
@@ -118,4 +124,40 @@ namespace catapult { namespace plugins {
 	}
 
 	DEFINE_PLUGIN_TESTS(MosaicPluginTests, MosaicPluginTraits)
+
+	// endregion
+
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetchKeysExtractorExtractsMosaicDefinitionMosaicId) {
+		// Arrange:
+		auto signer = test::GenerateRandomData<Key_Size>();
+		auto notification = model::MosaicDefinitionNotification(signer, MosaicId(123), model::MosaicProperties::FromValues({}));
+
+		// Act:
+		auto keys = test::ExtractPrefetchKeys<MosaicPluginTraits>(notification);
+
+		// Assert:
+		EXPECT_EQ(1u, keys.MosaicIds.size());
+		EXPECT_EQ(1u, keys.MosaicIds.count(MosaicId(123)));
+		EXPECT_TRUE(keys.PublicKeys.empty());
+	}
+
+	TEST(TEST_CLASS, PrefetchKeysExtractorExtractsBalanceTransferMosaicId) {
+		// Arrange:
+		auto sender = test::GenerateRandomData<Key_Size>();
+		auto recipient = test::GenerateRandomUnresolvedAddress();
+		auto notification = model::BalanceTransferNotification(sender, recipient, UnresolvedMosaicId(123), Amount(234));
+
+		// Act:
+		auto keys = test::ExtractPrefetchKeys<MosaicPluginTraits>(notification);
+
+		// Assert: account keys are extracted by the core system
+		EXPECT_EQ(1u, keys.MosaicIds.size());
+		EXPECT_EQ(1u, keys.MosaicIds.count(MosaicId(123)));
+		EXPECT_TRUE(keys.PublicKeys.empty());
+		EXPECT_TRUE(keys.Addresses.empty());
+	}
+
+	// endregion
 }}
@@ -26,4 +26,10 @@ namespace catapult { namespace cache {
 	void MultisigCacheStorage::LoadInto(const ValueType& entry, DestinationType& cacheDelta) {
 		cacheDelta.insert(entry);
 	}
+
+	void MultisigCacheStorage::Purge(const ValueType& entry, DestinationType& cacheDelta) {
+		auto key = MultisigCacheDescriptor::GetKeyFromValue(entry);
+		if (cacheDelta.contains(key))
+			cacheDelta.remove(key);
+	}
 }}
@@ -54,4 +54,49 @@ namespace catapult { namespace cache {
 		// - the loaded cache value is correct
 		test::AssertEqual(originalEntry, loadedEntry);
 	}
+
+	TEST(TEST_CLASS, CanPurgeValueFromCache) {
+		// Arrange:
+		MultisigCache cache(CacheConfiguration{});
+		auto entry1 = state::MultisigEntry(test::GenerateRandomData<Key_Size>());
+		auto entry2 = state::MultisigEntry(test::GenerateRandomData<Key_Size>());
+		{
+			auto delta = cache.createDelta();
+			MultisigCacheStorage::LoadInto(entry1, *delta);
+			MultisigCacheStorage::LoadInto(entry2, *delta);
+			cache.commit();
+		}
+
+		// Act:
+		auto delta = cache.createDelta();
+		MultisigCacheStorage::Purge(entry1, *delta);
+		cache.commit();
+
+		// Assert:
+		auto view = cache.createView();
+		EXPECT_EQ(1u, view->size());
+		EXPECT_FALSE(view->contains(entry1.key()));
+		EXPECT_TRUE(view->contains(entry2.key()));
+	}
+
+	TEST(TEST_CLASS, PurgeIsNoOpWhenValueIsNotContained) {
+		// Arrange:
+		MultisigCache cache(CacheConfiguration{});
+		auto entry = state::MultisigEntry(test::GenerateRandomData<Key_Size>());
+		{
+			auto delta = cache.createDelta();
+			MultisigCacheStorage::LoadInto(entry, *delta);
+			cache.commit();
+		}
+
+		// Act:
+		auto delta = cache.createDelta();
+		MultisigCacheStorage::Purge(state::MultisigEntry(test::GenerateRandomData<Key_Size>()), *delta);
+		cache.commit();
+
+		// Assert:
+		auto view = cache.createView();
+		EXPECT_EQ(1u, view->size());
+		EXPECT_TRUE(view->contains(entry.key()));
+	}
 }}
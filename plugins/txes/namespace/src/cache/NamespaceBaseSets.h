@@ -52,11 +52,19 @@ namespace catapult { namespace cache {
 
 	public:
 		explicit NamespaceBaseSets(const CacheConfiguration& config)
-				: CacheDatabaseMixin(config, { "default", "flat_map", "height_grouping" })
+				: CacheDatabaseMixin(
+						config,
+						{ "default", "flat_map", "height_grouping" },
+						{ RocksColumnProfile::Point_Lookup, RocksColumnProfile::Point_Lookup, RocksColumnProfile::Default })
 				, Primary(GetContainerMode(config), database(), 0)
 				, FlatMap(GetContainerMode(config), database(), 1)
 				, HeightGrouping(GetContainerMode(config), database(), 2)
-				, PatriciaTree(hasPatriciaTreeSupport(), database(), 3)
+				, PatriciaTree(
+						hasPatriciaTreeSupport(),
+						database(),
+						3,
+						config.PatriciaTreeNodeCacheOptions,
+						config.PatriciaTreeNumRetainedRoots)
 		{}
 
 	public:
@@ -202,4 +202,15 @@ namespace catapult { namespace cache {
 
 		return collectedIds;
 	}
+
+	void BasicNamespaceCacheDelta::prefetch(const PrefetchKeys& keys) const {
+		std::vector<NamespaceId> namespaceIds;
+		namespaceIds.reserve(keys.NamespaceIds.size());
+		for (auto namespaceId : keys.NamespaceIds)
+			namespaceIds.push_back(NamespaceId(namespaceId));
+
+		// history is only stored for root namespaces, so lookups of child ids are expected to miss
+		m_pNamespaceById->prefetch(namespaceIds);
+		m_pHistoryById->prefetch(namespaceIds);
+	}
 }}
@@ -23,6 +23,7 @@
 #include "NamespaceCacheMixins.h"
 #include "NamespaceCacheSerializers.h"
 #include "catapult/cache/CacheMixinAliases.h"
+#include "catapult/cache/PrefetchKeys.h"
 #include "catapult/cache/ReadOnlyArtifactCache.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
 
@@ -86,6 +87,9 @@ namespace catapult { namespace cache {
 		/// Prunes the namespace cache at \a height.
 		CollectedIds prune(Height height);
 
+		/// Loads all namespaces identified by \a keys ahead of time.
+		void prefetch(const PrefetchKeys& keys) const;
+
 	private:
 		void removeRoot(NamespaceId id);
 		void removeChild(const state::Namespace& ns);
@@ -20,6 +20,8 @@
 
 #include "NamespaceCacheStorage.h"
 #include "NamespaceCacheDelta.h"
+#include <algorithm>
+#include <vector>
 
 namespace catapult { namespace cache {
 
@@ -47,6 +49,22 @@ namespace catapult { namespace cache {
 
 			return sortedMap;
 		}
+
+		std::vector<NamespaceId> GetChildIdsDeepestFirst(const state::RootNamespace::Children& children) {
+			std::vector<std::pair<size_t, NamespaceId>> levelIdPairs;
+			for (const auto& child : children)
+				levelIdPairs.emplace_back(child.second.Path.size(), child.first);
+
+			std::sort(levelIdPairs.begin(), levelIdPairs.end(), [](const auto& lhs, const auto& rhs) {
+				return lhs.first > rhs.first;
+			});
+
+			std::vector<NamespaceId> childIds;
+			for (const auto& pair : levelIdPairs)
+				childIds.push_back(pair.second);
+
+			return childIds;
+		}
 	}
 
 	void NamespaceCacheStorage::LoadInto(const ValueType& history, DestinationType& cacheDelta) {
@@ -63,4 +81,16 @@ namespace catapult { namespace cache {
 			}
 		}
 	}
+
+	void NamespaceCacheStorage::Purge(const ValueType& history, DestinationType& cacheDelta) {
+		// remove all roots in the history one by one
+		// (children of each root need to be removed first because only empty roots can be removed)
+		while (cacheDelta.contains(history.id())) {
+			auto childIds = GetChildIdsDeepestFirst(cacheDelta.find(history.id()).get().root().children());
+			for (auto childId : childIds)
+				cacheDelta.remove(childId);
+
+			cacheDelta.remove(history.id());
+		}
+	}
 }}
@@ -42,10 +42,21 @@ namespace catapult { namespace plugins {
 	namespace {
 		// region alias
 
+		template<typename TNotification>
+		void AddAliasPrefetchKeysExtractor(PluginManager& manager) {
+			manager.addPrefetchKeysExtractor<TNotification>([](const auto& notification, const auto&, auto& keys) {
+				keys.NamespaceIds.insert(notification.NamespaceId.unwrap());
+			});
+		}
+
 		void RegisterAliasSubsystem(PluginManager& manager, const config::NamespaceConfiguration&) {
 			manager.addTransactionSupport(CreateAddressAliasTransactionPlugin());
 			manager.addTransactionSupport(CreateMosaicAliasTransactionPlugin());
 
+			AddAliasPrefetchKeysExtractor<model::AliasOwnerNotification>(manager);
+			AddAliasPrefetchKeysExtractor<model::AliasedAddressNotification>(manager);
+			AddAliasPrefetchKeysExtractor<model::AliasedMosaicIdNotification>(manager);
+
 			manager.addStatelessValidatorHook([](auto& builder) {
 				builder.add(validators::CreateAliasActionValidator());
 			});
@@ -147,6 +158,25 @@ namespace catapult { namespace plugins {
 			return cache.sub<cache::NamespaceCache>().createView();
 		}
 
+		void AddNamespacePrefetchKeysExtractors(PluginManager& manager) {
+			manager.addPrefetchKeysExtractor<model::RootNamespaceNotification>([](const auto& notification, const auto&, auto& keys) {
+				keys.NamespaceIds.insert(notification.NamespaceId.unwrap());
+			});
+
+			manager.addPrefetchKeysExtractor<model::ChildNamespaceNotification>([](const auto& notification, const auto&, auto& keys) {
+				keys.NamespaceIds.insert(notification.NamespaceId.unwrap());
+				keys.NamespaceIds.insert(notification.ParentId.unwrap());
+			});
+
+			manager.addPrefetchKeysExtractor<model::NamespaceRentalFeeNotification>([](
+					const auto& notification,
+					const auto& resolvers,
+					auto& keys) {
+				keys.PublicKeys.insert(notification.Sender);
+				keys.Addresses.insert(resolvers.resolve(notification.Recipient));
+			});
+		}
+
 		void RegisterNamespaceSubsystem(PluginManager& manager, const config::NamespaceConfiguration& config) {
 			auto currencyMosaicId = model::GetUnresolvedCurrencyMosaicId(manager.config());
 			auto rentalFeeConfig = ToNamespaceRentalFeeConfiguration(manager.config().Network, currencyMosaicId, config);
@@ -170,6 +200,8 @@ namespace catapult { namespace plugins {
 				counters.emplace_back(utils::DiagnosticCounterId("NS C DS"), [&cache]() { return GetNamespaceView(cache)->deepSize(); });
 			});
 
+			AddNamespacePrefetchKeysExtractors(manager);
+
 			manager.addStatelessValidatorHook([config, maxDuration](auto& builder) {
 				const auto& reservedNames = config.ReservedRootNamespaceNames;
 				builder
@@ -196,4 +196,60 @@ namespace catapult { namespace cache {
 	}
 
 	DEFINE_ROOT_NAMESPACE_HISTORY_LOAD_TESTS(LoadTraits,)
+
+	namespace {
+		void SeedCacheWithHistories(NamespaceCache& cache) {
+			auto owner1 = test::GenerateRandomData<Key_Size>();
+			auto owner2 = test::GenerateRandomData<Key_Size>();
+
+			auto delta = cache.createDelta();
+			delta->insert(state::RootNamespace(NamespaceId(123), owner1, test::CreateLifetime(11, 111)));
+			delta->insert(state::Namespace(test::CreatePath({ 123, 124 })));
+			delta->insert(state::Namespace(test::CreatePath({ 123, 124, 125 })));
+			delta->insert(state::RootNamespace(NamespaceId(123), owner2, test::CreateLifetime(222, 333)));
+			delta->insert(state::Namespace(test::CreatePath({ 123, 126 })));
+			delta->insert(state::Namespace(test::CreatePath({ 123, 126, 127 })));
+
+			delta->insert(state::RootNamespace(NamespaceId(200), owner1, test::CreateLifetime(11, 111)));
+			delta->insert(state::Namespace(test::CreatePath({ 200, 201 })));
+			cache.commit();
+		}
+	}
+
+	TEST(TEST_CLASS, CanPurgeHistoryWithMultipleRootsAndChildren) {
+		// Arrange:
+		NamespaceCache cache(CacheConfiguration{}, Default_Cache_Options);
+		SeedCacheWithHistories(cache);
+
+		// Sanity:
+		test::AssertCacheSizes(*cache.createView(), 2, 5, 8);
+
+		// Act:
+		auto delta = cache.createDelta();
+		NamespaceCacheStorage::Purge(state::RootNamespaceHistory(NamespaceId(123)), *delta);
+		cache.commit();
+
+		// Assert: only the unrelated history is left
+		auto view = cache.createView();
+		test::AssertCacheSizes(*view, 1, 2, 2);
+		for (auto id : { 123u, 124u, 125u, 126u, 127u })
+			EXPECT_FALSE(view->contains(NamespaceId(id))) << id;
+
+		EXPECT_TRUE(view->contains(NamespaceId(200)));
+		EXPECT_TRUE(view->contains(NamespaceId(201)));
+	}
+
+	TEST(TEST_CLASS, PurgeIsNoOpWhenHistoryIsNotContained) {
+		// Arrange:
+		NamespaceCache cache(CacheConfiguration{}, Default_Cache_Options);
+		SeedCacheWithHistories(cache);
+
+		// Act:
+		auto delta = cache.createDelta();
+		NamespaceCacheStorage::Purge(state::RootNamespaceHistory(NamespaceId(300)), *delta);
+		cache.commit();
+
+		// Assert:
+		test::AssertCacheSizes(*cache.createView(), 2, 5, 8);
+	}
 }}
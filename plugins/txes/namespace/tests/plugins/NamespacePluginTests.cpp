@@ -20,7 +20,9 @@
 
 #include "src/plugins/NamespacePlugin.h"
 #include "src/cache/NamespaceCache.h"
+#include "src/model/AliasNotifications.h"
 #include "src/model/NamespaceEntityType.h"
+#include "src/model/NamespaceNotifications.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "tests/test/NamespaceTestUtils.h"
 #include "tests/test/plugins/PluginTestUtils.h"
@@ -132,6 +134,37 @@ namespace catapult { namespace plugins {
 
 	// endregion
 
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetchKeysExtractorExtractsChildNamespaceIds) {
+		// Arrange:
+		auto signer = test::GenerateRandomData<Key_Size>();
+		auto notification = model::ChildNamespaceNotification(signer, NamespaceId(123), NamespaceId(234));
+
+		// Act:
+		auto keys = test::ExtractPrefetchKeys<NamespacePluginTraits>(notification);
+
+		// Assert:
+		EXPECT_EQ(2u, keys.NamespaceIds.size());
+		EXPECT_EQ(1u, keys.NamespaceIds.count(123));
+		EXPECT_EQ(1u, keys.NamespaceIds.count(234));
+	}
+
+	TEST(TEST_CLASS, PrefetchKeysExtractorExtractsAliasNamespaceId) {
+		// Arrange:
+		auto owner = test::GenerateRandomData<Key_Size>();
+		auto notification = model::AliasOwnerNotification(owner, NamespaceId(123), model::AliasAction::Link);
+
+		// Act:
+		auto keys = test::ExtractPrefetchKeys<NamespacePluginTraits>(notification);
+
+		// Assert:
+		EXPECT_EQ(1u, keys.NamespaceIds.size());
+		EXPECT_EQ(1u, keys.NamespaceIds.count(123));
+	}
+
+	// endregion
+
 	// region resolvers
 
 	namespace {
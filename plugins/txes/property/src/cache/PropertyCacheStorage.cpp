@@ -26,4 +26,10 @@ namespace catapult { namespace cache {
 	void PropertyCacheStorage::LoadInto(const ValueType& accountProperties, DestinationType& cacheDelta) {
 		cacheDelta.insert(accountProperties);
 	}
+
+	void PropertyCacheStorage::Purge(const ValueType& accountProperties, DestinationType& cacheDelta) {
+		auto key = PropertyCacheDescriptor::GetKeyFromValue(accountProperties);
+		if (cacheDelta.contains(key))
+			cacheDelta.remove(key);
+	}
 }}
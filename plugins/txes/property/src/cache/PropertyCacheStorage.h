@@ -31,5 +31,9 @@ namespace catapult { namespace cache {
 			, public state::AccountPropertiesSerializer {
 		/// Loads \a accountProperties into \a cacheDelta.
 		static void LoadInto(const ValueType& accountProperties, DestinationType& cacheDelta);
+
+		/// Purges \a accountProperties from \a cacheDelta.
+		/// \note This is a no-op if \a accountProperties is not contained in \a cacheDelta.
+		static void Purge(const ValueType& accountProperties, DestinationType& cacheDelta);
 	};
 }}
@@ -53,4 +53,49 @@ namespace catapult { namespace cache {
 		// - the loaded cache value is correct
 		test::AssertEqual(originalAccountProperties, loadedAccountProperties);
 	}
+
+	TEST(TEST_CLASS, CanPurgeValueFromCache) {
+		// Arrange:
+		PropertyCache cache(CacheConfiguration{}, model::NetworkIdentifier::Zero);
+		auto entry1 = state::AccountProperties(test::GenerateRandomData<Address_Decoded_Size>());
+		auto entry2 = state::AccountProperties(test::GenerateRandomData<Address_Decoded_Size>());
+		{
+			auto delta = cache.createDelta();
+			PropertyCacheStorage::LoadInto(entry1, *delta);
+			PropertyCacheStorage::LoadInto(entry2, *delta);
+			cache.commit();
+		}
+
+		// Act:
+		auto delta = cache.createDelta();
+		PropertyCacheStorage::Purge(entry1, *delta);
+		cache.commit();
+
+		// Assert:
+		auto view = cache.createView();
+		EXPECT_EQ(1u, view->size());
+		EXPECT_FALSE(view->contains(entry1.address()));
+		EXPECT_TRUE(view->contains(entry2.address()));
+	}
+
+	TEST(TEST_CLASS, PurgeIsNoOpWhenValueIsNotContained) {
+		// Arrange:
+		PropertyCache cache(CacheConfiguration{}, model::NetworkIdentifier::Zero);
+		auto entry = state::AccountProperties(test::GenerateRandomData<Address_Decoded_Size>());
+		{
+			auto delta = cache.createDelta();
+			PropertyCacheStorage::LoadInto(entry, *delta);
+			cache.commit();
+		}
+
+		// Act:
+		auto delta = cache.createDelta();
+		PropertyCacheStorage::Purge(state::AccountProperties(test::GenerateRandomData<Address_Decoded_Size>()), *delta);
+		cache.commit();
+
+		// Assert:
+		auto view = cache.createView();
+		EXPECT_EQ(1u, view->size());
+		EXPECT_TRUE(view->contains(entry.address()));
+	}
 }}
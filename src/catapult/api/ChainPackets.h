@@ -68,4 +68,7 @@ namespace catapult { namespace api {
 	};
 
 #pragma pack(pop)
+
+	/// Number of differences prepended to a pull transactions sketch response when the sketch difference could not be decoded.
+	constexpr uint32_t Undecodable_Sketch_Num_Differences = std::numeric_limits<uint32_t>::max();
 }}
@@ -20,6 +20,7 @@
 
 #include "RemoteTransactionApi.h"
 #include "RemoteApiUtils.h"
+#include "ChainPackets.h"
 #include "RemoteRequestDispatcher.h"
 #include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
@@ -51,6 +52,48 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct UtSketchTraits : public RegistryDependentTraits<model::Transaction> {
+		public:
+			using ResultType = UnconfirmedTransactionsSketchResult;
+			static constexpr auto PacketType() { return ionet::PacketType::Pull_Transactions_Sketch; }
+			static constexpr auto FriendlyName() { return "pull unconfirmed transactions sketch"; }
+
+			static auto CreateRequestPacketPayload(BlockFeeMultiplier minFeeMultiplier, utils::ShortHashSketch&& knownShortHashesSketch) {
+				ionet::PacketPayloadBuilder builder(PacketType());
+				builder.appendValue(minFeeMultiplier);
+				builder.appendValues(knownShortHashesSketch.cells());
+				return builder.build();
+			}
+
+		public:
+			using RegistryDependentTraits::RegistryDependentTraits;
+
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				// data is prepended with number of differences
+				auto dataSize = ionet::CalculatePacketDataSize(packet);
+				if (dataSize < sizeof(uint32_t))
+					return false;
+
+				auto numDifferences = reinterpret_cast<const uint32_t&>(*packet.Data());
+				dataSize -= sizeof(uint32_t);
+				if (Undecodable_Sketch_Num_Differences == numDifferences)
+					return 0 == dataSize;
+
+				// followed by transactions
+				const auto* pTransactionData = packet.Data() + sizeof(uint32_t);
+				auto offsets = ionet::ExtractEntityOffsets<model::Transaction>({ pTransactionData, dataSize }, *this);
+				if (offsets.empty() && 0 != dataSize)
+					return false;
+
+				result.IsDecoded = true;
+				result.NumDifferences = numDifferences;
+				if (!offsets.empty())
+					result.Transactions = model::TransactionRange::CopyVariable(pTransactionData, dataSize, offsets);
+
+				return true;
+			}
+		};
+
 		// endregion
 
 		class DefaultRemoteTransactionApi : public RemoteTransactionApi {
@@ -72,6 +115,12 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(UtTraits(m_registry), minFeeMultiplier, std::move(knownShortHashes));
 			}
 
+			FutureType<UtSketchTraits> unconfirmedTransactions(
+					BlockFeeMultiplier minFeeMultiplier,
+					utils::ShortHashSketch&& knownShortHashesSketch) const override {
+				return m_impl.dispatch(UtSketchTraits(m_registry), minFeeMultiplier, std::move(knownShortHashesSketch));
+			}
+
 		private:
 			const model::TransactionRegistry& m_registry;
 			mutable RemoteRequestDispatcher m_impl;
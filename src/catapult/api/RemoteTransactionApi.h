@@ -22,11 +22,30 @@
 #include "RemoteApi.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/thread/Future.h"
+#include "catapult/utils/ShortHashSketch.h"
 
 namespace catapult { namespace ionet { class PacketIo; } }
 
 namespace catapult { namespace api {
 
+	/// Unconfirmed transactions returned by a remote node in response to a short hash sketch.
+	struct UnconfirmedTransactionsSketchResult {
+	public:
+		/// Creates a default result.
+		UnconfirmedTransactionsSketchResult() : IsDecoded(false), NumDifferences(0)
+		{}
+
+	public:
+		/// \c true if the remote node could decode the difference between its short hashes and the sketch.
+		bool IsDecoded;
+
+		/// Number of short hashes in the decoded difference.
+		uint32_t NumDifferences;
+
+		/// Unconfirmed transactions that are known remotely but not locally.
+		model::TransactionRange Transactions;
+	};
+
 	/// An api for retrieving transaction information from a remote node.
 	class RemoteTransactionApi : public RemoteApi {
 	protected:
@@ -40,6 +59,12 @@ namespace catapult { namespace api {
 		virtual thread::future<model::TransactionRange> unconfirmedTransactions(
 				BlockFeeMultiplier minFeeMultiplier,
 				model::ShortHashRange&& knownShortHashes) const = 0;
+
+		/// Gets all unconfirmed transactions from the remote that have a fee multiplier at least \a minFeeMultiplier
+		/// and do not have a short hash in the set summarized by \a knownShortHashesSketch.
+		virtual thread::future<UnconfirmedTransactionsSketchResult> unconfirmedTransactions(
+				BlockFeeMultiplier minFeeMultiplier,
+				utils::ShortHashSketch&& knownShortHashesSketch) const = 0;
 	};
 
 	/// Creates a transaction api for interacting with a remote node with the specified \a io with public key (\a remotePublicKey)
@@ -0,0 +1,89 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "CacheChangesStorage.h"
+#include "CatapultCacheDelta.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/io/Stream.h"
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// A CacheChangesStorage implementation that wraps a cache and associated storage traits.
+	/// \note Storage traits must support purging values from a delta in addition to loading values into it.
+	template<typename TCache, typename TStorageTraits>
+	class CacheChangesStorageAdapter : public CacheChangesStorage {
+	public:
+		/// Creates an adapter.
+		CacheChangesStorageAdapter() : m_name(TCache::Name)
+		{}
+
+	public:
+		const std::string& name() const override {
+			return m_name;
+		}
+
+	public:
+		void saveAll(const CatapultCacheDelta& cacheDelta, io::OutputStream& output) const override {
+			const auto& delta = cacheDelta.sub<TCache>();
+
+			// removed elements are saved in reverse order so that ordered caches can always remove their last element
+			auto removedElements = ToVector(delta.removedElements());
+			io::Write64(output, removedElements.size());
+			for (auto iter = removedElements.crbegin(); removedElements.crend() != iter; ++iter)
+				TStorageTraits::Save(**iter, output);
+
+			auto addedElements = delta.addedElements();
+			auto modifiedElements = delta.modifiedElements();
+			io::Write64(output, modifiedElements.size() + addedElements.size());
+			for (const auto* pElement : modifiedElements)
+				TStorageTraits::Save(*pElement, output);
+
+			for (const auto* pElement : addedElements)
+				TStorageTraits::Save(*pElement, output);
+		}
+
+		void loadAll(io::InputStream& input, CatapultCacheDelta& cacheDelta) const override {
+			auto& delta = cacheDelta.sub<TCache>();
+
+			auto numRemovedElements = io::Read64(input);
+			for (auto i = 0u; i < numRemovedElements; ++i)
+				TStorageTraits::Purge(TStorageTraits::Load(input), delta);
+
+			// purge any existing value before loading the updated one
+			auto numUpdatedElements = io::Read64(input);
+			for (auto i = 0u; i < numUpdatedElements; ++i) {
+				auto value = TStorageTraits::Load(input);
+				TStorageTraits::Purge(value, delta);
+				TStorageTraits::LoadInto(value, delta);
+			}
+		}
+
+	private:
+		template<typename TPointerContainer>
+		static auto ToVector(const TPointerContainer& pointers) {
+			return std::vector<typename TPointerContainer::value_type>(pointers.cbegin(), pointers.cend());
+		}
+
+	private:
+		std::string m_name;
+	};
+}}
@@ -19,9 +19,13 @@
 **/
 
 #pragma once
+#include "catapult/tree/TreeNodeCache.h"
 #include "catapult/utils/FileSize.h"
+#include <memory>
 #include <string>
 
+namespace catapult { namespace cache { class RocksSharedResources; } }
+
 namespace catapult { namespace cache {
 
 	/// Possible patricia tree storage modes.
@@ -39,18 +43,22 @@ namespace catapult { namespace cache {
 		CacheConfiguration()
 				: ShouldUseCacheDatabase(false)
 				, ShouldStorePatriciaTrees(false)
+				, PatriciaTreeNumRetainedRoots(0)
 		{}
 
-		/// Creates a cache configuration around \a databaseDirectory, \a maxCacheDatabaseWriteBatchSize
-		/// and specified patricia tree storage \a mode.
+		/// Creates a cache configuration around \a databaseDirectory, \a maxCacheDatabaseWriteBatchSize,
+		/// specified patricia tree storage \a mode and optional database resources shared across caches (\a pDatabaseResources).
 		explicit CacheConfiguration(
 				const std::string& databaseDirectory,
 				utils::FileSize maxCacheDatabaseWriteBatchSize,
-				PatriciaTreeStorageMode mode)
+				PatriciaTreeStorageMode mode,
+				const std::shared_ptr<RocksSharedResources>& pDatabaseResources = nullptr)
 				: ShouldUseCacheDatabase(true)
 				, CacheDatabaseDirectory(databaseDirectory)
 				, MaxCacheDatabaseWriteBatchSize(maxCacheDatabaseWriteBatchSize)
 				, ShouldStorePatriciaTrees(PatriciaTreeStorageMode::Enabled == mode)
+				, DatabaseResources(pDatabaseResources)
+				, PatriciaTreeNumRetainedRoots(0)
 		{}
 
 	public:
@@ -65,5 +73,15 @@ namespace catapult { namespace cache {
 
 		/// \c true if patricia trees should be stored, \c false otherwise.
 		bool ShouldStorePatriciaTrees;
+
+		/// Database resources (block cache, write buffer budget and statistics) shared across caches (optional).
+		std::shared_ptr<RocksSharedResources> DatabaseResources;
+
+		/// Options of the decoded node cache in front of each stored patricia tree (disabled by default).
+		tree::TreeNodeCacheOptions PatriciaTreeNodeCacheOptions;
+
+		/// Number of most recent roots from which all nodes of each stored patricia tree remain reachable
+		/// (\c 0 disables removal of stale nodes).
+		size_t PatriciaTreeNumRetainedRoots;
 	};
 }}
@@ -29,17 +29,21 @@ namespace catapult { namespace cache {
 	/// Mixin that owns a cache database.
 	class CacheDatabaseMixin {
 	protected:
-		/// Creates a mixin around \a config and \a columnFamilyNames with optional \a pruningMode.
+		/// Creates a mixin around \a config and \a columnFamilyNames tuned by corresponding \a columnProfiles
+		/// with optional \a pruningMode.
 		CacheDatabaseMixin(
 				const CacheConfiguration& config,
 				const std::vector<std::string>& columnFamilyNames,
+				const std::vector<RocksColumnProfile>& columnProfiles,
 				FilterPruningMode pruningMode = FilterPruningMode::Disabled)
 				: m_pDatabase(config.ShouldUseCacheDatabase
 						? std::make_unique<CacheDatabase>(CacheDatabaseSettings(
 								config.CacheDatabaseDirectory,
 								GetAdjustedColumnFamilyNames(config, columnFamilyNames),
+								GetAdjustedColumnProfiles(config, columnProfiles),
 								config.MaxCacheDatabaseWriteBatchSize,
-								pruningMode))
+								pruningMode,
+								config.DatabaseResources))
 						: std::make_unique<CacheDatabase>())
 				, m_containerMode(GetContainerMode(config))
 				, m_hasPatriciaTreeSupport(config.ShouldStorePatriciaTrees)
@@ -81,6 +85,16 @@ namespace catapult { namespace cache {
 			return adjustedColumnFamilyNames;
 		}
 
+		static std::vector<RocksColumnProfile> GetAdjustedColumnProfiles(
+				const CacheConfiguration& config,
+				const std::vector<RocksColumnProfile>& columnProfiles) {
+			auto adjustedColumnProfiles = columnProfiles;
+			if (config.ShouldStorePatriciaTrees)
+				adjustedColumnProfiles.push_back(RocksColumnProfile::Patricia_Tree);
+
+			return adjustedColumnProfiles;
+		}
+
 	private:
 		std::unique_ptr<CacheDatabase> m_pDatabase;
 		const deltaset::ConditionalContainerMode m_containerMode;
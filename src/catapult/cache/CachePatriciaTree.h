@@ -30,8 +30,15 @@ namespace catapult { namespace cache {
 	class CachePatriciaTree {
 	public:
 		/// Creates a tree around \a database and \a columnId if \a enable is \c true.
-		CachePatriciaTree(bool enable, CacheDatabase& database, size_t columnId)
-				: m_pImpl(enable ? std::make_unique<Impl>(database, columnId) : nullptr)
+		/// Decoded tree nodes are cached as specified by \a nodeCacheOptions and stale nodes are removed
+		/// once they are no longer reachable from the last \a numRetainedRoots roots (\c 0 retains all nodes).
+		CachePatriciaTree(
+				bool enable,
+				CacheDatabase& database,
+				size_t columnId,
+				const tree::TreeNodeCacheOptions& nodeCacheOptions = tree::TreeNodeCacheOptions(),
+				size_t numRetainedRoots = 0)
+				: m_pImpl(enable ? std::make_unique<Impl>(database, columnId, nodeCacheOptions, numRetainedRoots) : nullptr)
 		{}
 
 	public:
@@ -40,6 +47,16 @@ namespace catapult { namespace cache {
 			return m_pImpl ? &m_pImpl->tree() : nullptr;
 		}
 
+		/// Gets a pointer to the decoded node cache of the underlying tree if enabled.
+		const tree::TreeNodeCache* nodeCache() const {
+			return m_pImpl ? m_pImpl->nodeCache() : nullptr;
+		}
+
+		/// Gets the stale node garbage collection statistics of the underlying tree if enabled.
+		PatriciaTreeGarbageStatistics garbageStatistics() const {
+			return m_pImpl ? m_pImpl->garbageStatistics() : PatriciaTreeGarbageStatistics();
+		}
+
 	public:
 		/// Returns a delta based on the same data source as this tree.
 		auto rebase() {
@@ -61,9 +78,13 @@ namespace catapult { namespace cache {
 	private:
 		class Impl {
 		public:
-			Impl(CacheDatabase& database, size_t columnId)
+			Impl(
+					CacheDatabase& database,
+					size_t columnId,
+					const tree::TreeNodeCacheOptions& nodeCacheOptions,
+					size_t numRetainedRoots)
 					: m_container(database, columnId)
-					, m_dataSource(m_container)
+					, m_dataSource(m_container, nodeCacheOptions, numRetainedRoots)
 					, m_pTree(std::make_unique<TTree>(m_dataSource)) {
 				Hash256 rootHash;
 				if (!m_container.prop("root", rootHash))
@@ -73,6 +94,7 @@ namespace catapult { namespace cache {
 					return;
 
 				m_pTree = std::make_unique<TTree>(m_dataSource, rootHash);
+				m_dataSource.pin(rootHash);
 			}
 
 		public:
@@ -84,9 +106,19 @@ namespace catapult { namespace cache {
 				return *m_pTree;
 			}
 
+			const tree::TreeNodeCache* nodeCache() const {
+				return m_dataSource.nodeCache();
+			}
+
+			PatriciaTreeGarbageStatistics garbageStatistics() const {
+				return m_dataSource.garbageStatistics();
+			}
+
 		public:
 			void commit() {
+				auto oldRootHash = m_pTree->root();
 				m_pTree->commit();
+				m_dataSource.collectGarbage(oldRootHash, m_pTree->root());
 
 				// skip setProp if hash did not change
 				Hash256 rootHash;
@@ -94,6 +126,9 @@ namespace catapult { namespace cache {
 					return;
 
 				m_container.setProp("root", m_pTree->root());
+
+				// top levels change with every new root, so they need to be repinned
+				m_dataSource.pin(m_pTree->root());
 			}
 
 		private:
@@ -152,6 +152,13 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	void CatapultCacheDelta::prefetch(const PrefetchKeys& keys) const {
+		for (const auto& pSubView : m_subViews) {
+			if (pSubView)
+				pSubView->prefetch(keys);
+		}
+	}
+
 	ReadOnlyCatapultCache CatapultCacheDelta::toReadOnly() const {
 		return ReadOnlyCatapultCache(ExtractReadOnlyViews(m_subViews));
 	}
@@ -293,5 +300,12 @@ namespace catapult { namespace cache {
 				false);
 	}
 
+	std::vector<std::unique_ptr<const CacheChangesStorage>> CatapultCache::changesStorages() const {
+		return MapSubCaches<const CacheChangesStorage>(
+				m_subCaches,
+				[](const auto& pSubCache) { return pSubCache->createChangesStorage(); },
+				false);
+	}
+
 	// endregion
 }}
@@ -26,6 +26,7 @@
 
 namespace catapult {
 	namespace cache {
+		class CacheChangesStorage;
 		class CacheHeight;
 		class CacheStorage;
 		class SubCachePlugin;
@@ -78,6 +79,9 @@ namespace catapult { namespace cache {
 		/// Gets cache storages for all subcaches.
 		std::vector<std::unique_ptr<CacheStorage>> storages();
 
+		/// Gets cache changes storages for all subcaches that support saving and loading changes.
+		std::vector<std::unique_ptr<const CacheChangesStorage>> changesStorages() const;
+
 	private:
 		std::unique_ptr<CacheHeight> m_pCacheHeight; // use a unique_ptr to allow fwd declare
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
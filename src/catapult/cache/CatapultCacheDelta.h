@@ -61,6 +61,9 @@ namespace catapult { namespace cache {
 		/// Sets the merkle roots for all subcaches (\a subCacheMerkleRoots).
 		void setSubCacheMerkleRoots(const std::vector<Hash256>& subCacheMerkleRoots);
 
+		/// Loads entries identified by \a keys into all subcaches that support prefetching.
+		void prefetch(const PrefetchKeys& keys) const;
+
 	public:
 		/// Creates a read-only view of this delta.
 		ReadOnlyCatapultCache toReadOnly() const;
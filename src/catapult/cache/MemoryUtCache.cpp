@@ -47,15 +47,41 @@ namespace catapult { namespace cache {
 		size_t Id;
 	};
 
+	struct MaxFeeMultiplierIndexEntry {
+	public:
+		MaxFeeMultiplierIndexEntry(BlockFeeMultiplier maxFeeMultiplier, size_t id, const TransactionData* pData)
+				: MaxFeeMultiplier(maxFeeMultiplier)
+				, Id(id)
+				, pData(pData)
+		{}
+
+		explicit MaxFeeMultiplierIndexEntry(const TransactionData& data)
+				: MaxFeeMultiplierIndexEntry(model::CalculateTransactionMaxFeeMultiplier(*data.pEntity), data.Id, &data)
+		{}
+
+	public:
+		bool operator<(const MaxFeeMultiplierIndexEntry& rhs) const {
+			// order by id within same multiplier so that older transactions are preferred
+			return MaxFeeMultiplier != rhs.MaxFeeMultiplier ? MaxFeeMultiplier < rhs.MaxFeeMultiplier : Id < rhs.Id;
+		}
+
+	public:
+		BlockFeeMultiplier MaxFeeMultiplier;
+		size_t Id;
+		const TransactionData* pData;
+	};
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			uint64_t maxResponseSize,
 			const TransactionDataContainer& transactionDataContainer,
+			const MaxFeeMultiplierIndex& maxFeeMultiplierIndex,
 			const IdLookup& idLookup,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
+			, m_maxFeeMultiplierIndex(maxFeeMultiplierIndex)
 			, m_idLookup(idLookup)
 			, m_readLock(std::move(readLock))
 	{}
@@ -75,6 +101,30 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	void MemoryUtCacheView::forEach(MaxFeeMultiplierOrder order, const TransactionInfoConsumer& consumer) const {
+		if (MaxFeeMultiplierOrder::Ascending == order) {
+			for (const auto& entry : m_maxFeeMultiplierIndex) {
+				if (!consumer(*entry.pData))
+					return;
+			}
+
+			return;
+		}
+
+		// walk groups of equal multipliers from largest to smallest but each group from oldest to newest
+		auto groupEnd = m_maxFeeMultiplierIndex.cend();
+		while (m_maxFeeMultiplierIndex.cbegin() != groupEnd) {
+			auto maxFeeMultiplier = std::prev(groupEnd)->MaxFeeMultiplier;
+			auto groupBegin = m_maxFeeMultiplierIndex.lower_bound(MaxFeeMultiplierIndexEntry(maxFeeMultiplier, 0, nullptr));
+			for (auto iter = groupBegin; groupEnd != iter; ++iter) {
+				if (!consumer(*iter->pData))
+					return;
+			}
+
+			groupEnd = groupBegin;
+		}
+	}
+
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
 		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
 		auto shortHashesIter = shortHashes.begin();
@@ -84,28 +134,66 @@ namespace catapult { namespace cache {
 		return shortHashes;
 	}
 
+	namespace {
+		using UnknownTransactions = std::vector<std::shared_ptr<const model::Transaction>>;
+
+		template<typename TPredicate>
+		UnknownTransactions FilterTransactions(
+				const TransactionDataContainer& transactionDataContainer,
+				uint64_t maxResponseSize,
+				BlockFeeMultiplier minFeeMultiplier,
+				TPredicate predicate) {
+			uint64_t totalSize = 0;
+			UnknownTransactions transactions;
+			for (const auto& data : transactionDataContainer) {
+				if (data.pEntity->MaxFee < model::CalculateTransactionFee(minFeeMultiplier, *data.pEntity))
+					continue;
+
+				if (predicate(utils::ToShortHash(data.EntityHash))) {
+					auto pTransaction = data.pEntity;
+					totalSize += pTransaction->Size;
+					if (totalSize > maxResponseSize)
+						break;
+
+					transactions.push_back(pTransaction);
+				}
+			}
+
+			return transactions;
+		}
+	}
+
 	MemoryUtCacheView::UnknownTransactions MemoryUtCacheView::unknownTransactions(
 			BlockFeeMultiplier minFeeMultiplier,
 			const utils::ShortHashesSet& knownShortHashes) const {
-		uint64_t totalSize = 0;
-		UnknownTransactions transactions;
-		for (const auto& data : m_transactionDataContainer) {
-			if (data.pEntity->MaxFee < model::CalculateTransactionFee(minFeeMultiplier, *data.pEntity))
-				continue;
-
-			auto shortHash = utils::ToShortHash(data.EntityHash);
-			auto iter = knownShortHashes.find(shortHash);
-			if (knownShortHashes.cend() == iter) {
-				auto pTransaction = data.pEntity;
-				totalSize += pTransaction->Size;
-				if (totalSize > m_maxResponseSize)
-					break;
-
-				transactions.push_back(pTransaction);
-			}
-		}
+		auto isUnknown = [&knownShortHashes](const auto& shortHash) {
+			return knownShortHashes.cend() == knownShortHashes.find(shortHash);
+		};
+		return FilterTransactions(m_transactionDataContainer, m_maxResponseSize, minFeeMultiplier, isUnknown);
+	}
 
-		return transactions;
+	utils::ShortHashSketch MemoryUtCacheView::shortHashSketch(size_t numCells) const {
+		std::vector<utils::ShortHash> shortHashes;
+		shortHashes.reserve(m_transactionDataContainer.size());
+		for (const auto& data : m_transactionDataContainer)
+			shortHashes.push_back(utils::ToShortHash(data.EntityHash));
+
+		utils::ShortHashSketch sketch(numCells);
+		sketch.insertDistinct(std::move(shortHashes));
+
+		return sketch;
+	}
+
+	MemoryUtCacheView::UnknownTransactions MemoryUtCacheView::transactionsWithShortHashes(
+			BlockFeeMultiplier minFeeMultiplier,
+			const utils::ShortHashesSet& shortHashes) const {
+		if (shortHashes.empty())
+			return UnknownTransactions();
+
+		auto isRequested = [&shortHashes](const auto& shortHash) {
+			return shortHashes.cend() != shortHashes.find(shortHash);
+		};
+		return FilterTransactions(m_transactionDataContainer, m_maxResponseSize, minFeeMultiplier, isRequested);
 	}
 
 	// endregion
@@ -122,12 +210,14 @@ namespace catapult { namespace cache {
 					uint64_t maxCacheSize,
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
+					MaxFeeMultiplierIndex& maxFeeMultiplierIndex,
 					IdLookup& idLookup,
 					AccountCounters& counters,
 					utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
+					, m_maxFeeMultiplierIndex(maxFeeMultiplierIndex)
 					, m_idLookup(idLookup)
 					, m_counters(counters)
 					, m_readLock(std::move(readLock))
@@ -147,7 +237,8 @@ namespace catapult { namespace cache {
 					return false;
 
 				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				auto dataIter = m_transactionDataContainer.emplace(transactionInfo, m_idSequence).first;
+				m_maxFeeMultiplierIndex.emplace(*dataIter);
 
 				m_counters.increment(transactionInfo.pEntity->Signer);
 
@@ -165,6 +256,7 @@ namespace catapult { namespace cache {
 
 				m_counters.decrement(dataIter->pEntity->Signer);
 
+				m_maxFeeMultiplierIndex.erase(MaxFeeMultiplierIndexEntry(*dataIter));
 				m_transactionDataContainer.erase(dataIter);
 				m_idLookup.erase(iter);
 				return erasedInfo;
@@ -185,6 +277,7 @@ namespace catapult { namespace cache {
 				for (const auto& data : m_transactionDataContainer)
 					transactionInfosCopy.emplace_back(data.copy());
 
+				m_maxFeeMultiplierIndex.clear();
 				m_transactionDataContainer.clear();
 				m_idLookup.clear();
 				m_counters.reset();
@@ -195,6 +288,7 @@ namespace catapult { namespace cache {
 			uint64_t m_maxCacheSize;
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
+			MaxFeeMultiplierIndex& m_maxFeeMultiplierIndex;
 			IdLookup& m_idLookup;
 			AccountCounters& m_counters;
 			utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
@@ -208,6 +302,7 @@ namespace catapult { namespace cache {
 
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
+		cache::MaxFeeMultiplierIndex MaxFeeMultiplierIndex;
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
 		AccountCounters Counters;
 	};
@@ -221,7 +316,12 @@ namespace catapult { namespace cache {
 	MemoryUtCache::~MemoryUtCache() = default;
 
 	MemoryUtCacheView MemoryUtCache::view() const {
-		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->IdLookup, m_lock.acquireReader());
+		return MemoryUtCacheView(
+				m_options.MaxResponseSize,
+				m_pImpl->TransactionDataContainer,
+				m_pImpl->MaxFeeMultiplierIndex,
+				m_pImpl->IdLookup,
+				m_lock.acquireReader());
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
@@ -229,6 +329,7 @@ namespace catapult { namespace cache {
 				m_options.MaxCacheSize,
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
+				m_pImpl->MaxFeeMultiplierIndex,
 				m_pImpl->IdLookup,
 				m_pImpl->Counters,
 				m_lock.acquireReader()));
@@ -24,11 +24,17 @@
 #include "UtCache.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/utils/Hashers.h"
+#include "catapult/utils/ShortHashSketch.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 #include <set>
 #include <unordered_map>
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult {
+	namespace cache {
+		struct MaxFeeMultiplierIndexEntry;
+		struct TransactionData;
+	}
+}
 
 namespace catapult { namespace cache {
 
@@ -36,6 +42,18 @@ namespace catapult { namespace cache {
 	/// \note std::set is used to allow incomplete type.
 	using TransactionDataContainer = std::set<TransactionData>;
 
+	/// Secondary index of all transactions in a TransactionDataContainer ordered by max fee multiplier.
+	using MaxFeeMultiplierIndex = std::set<MaxFeeMultiplierIndexEntry>;
+
+	/// Possible max fee multiplier orderings.
+	enum class MaxFeeMultiplierOrder {
+		/// Transactions with the smallest max fee multiplier come first.
+		Ascending,
+
+		/// Transactions with the largest max fee multiplier come first.
+		Descending
+	};
+
 	/// A read only view on top of unconfirmed transactions cache.
 	class MemoryUtCacheView {
 	private:
@@ -45,10 +63,12 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// (\a transactionDataContainer), a max fee multiplier index (\a maxFeeMultiplierIndex) and an id lookup (\a idLookup)
+		/// with lock context \a readLock.
 		explicit MemoryUtCacheView(
 				uint64_t maxResponseSize,
 				const TransactionDataContainer& transactionDataContainer,
+				const MaxFeeMultiplierIndex& maxFeeMultiplierIndex,
 				const IdLookup& idLookup,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
@@ -62,6 +82,11 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Calls \a consumer with all transaction infos ordered by max fee multiplier according to \a order
+		/// until all are consumed or \c false is returned by consumer.
+		/// \note Transaction infos with equal max fee multipliers are always forwarded from oldest to newest.
+		void forEach(MaxFeeMultiplierOrder order, const TransactionInfoConsumer& consumer) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// A short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -70,9 +95,17 @@ namespace catapult { namespace cache {
 		/// and do not have a short hash in \a knownShortHashes.
 		UnknownTransactions unknownTransactions(BlockFeeMultiplier minFeeMultiplier, const utils::ShortHashesSet& knownShortHashes) const;
 
+		/// Gets a sketch with \a numCells cells of the (distinct) short hashes of all transactions in the cache.
+		utils::ShortHashSketch shortHashSketch(size_t numCells) const;
+
+		/// Gets a vector of all transactions in the cache that have a fee multiplier at least \a minFeeMultiplier
+		/// and have a short hash in \a shortHashes.
+		UnknownTransactions transactionsWithShortHashes(BlockFeeMultiplier minFeeMultiplier, const utils::ShortHashesSet& shortHashes) const;
+
 	private:
 		uint64_t m_maxResponseSize;
 		const TransactionDataContainer& m_transactionDataContainer;
+		const MaxFeeMultiplierIndex& m_maxFeeMultiplierIndex;
 		const IdLookup& m_idLookup;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
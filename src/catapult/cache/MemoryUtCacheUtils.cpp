@@ -84,4 +84,24 @@ namespace catapult { namespace cache {
 
 		return candidateTransactionInfoPointers;
 	}
+
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t count,
+			MaxFeeMultiplierOrder order,
+			const predicate<const model::TransactionInfo&>& filter) {
+		std::vector<const model::TransactionInfo*> transactionInfoPointers;
+		transactionInfoPointers.reserve(std::min<size_t>(utCacheView.size(), count));
+
+		if (0 != count) {
+			utCacheView.forEach(order, [count, filter, &transactionInfoPointers](const auto& transactionInfo) {
+				if (filter(transactionInfo))
+					transactionInfoPointers.push_back(&transactionInfo);
+
+				return transactionInfoPointers.size() != count;
+			});
+		}
+
+		return transactionInfoPointers;
+	}
 }}
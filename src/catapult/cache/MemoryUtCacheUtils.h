@@ -41,4 +41,13 @@ namespace catapult { namespace cache {
 			uint32_t count,
 			const predicate<const model::TransactionInfo*, const model::TransactionInfo*>& sortComparer,
 			const predicate<const model::TransactionInfo&>& filter);
+
+	/// Gets pointers to the first \a count transaction infos in \a utCacheView that pass \a filter when ordered by max fee multiplier
+	/// according to \a order.
+	/// \note Pointers are only safe to access during the lifetime of \a utCacheView.
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t count,
+			MaxFeeMultiplierOrder order,
+			const predicate<const model::TransactionInfo&>& filter);
 }}
@@ -74,11 +74,11 @@ namespace catapult { namespace cache {
 			return minGenerationId <= generationId && generationId <= maxGenerationId;
 		};
 
-		auto handleModification = [&tree, height](const auto& pair) {
-			if (detail::IsActiveAdapter::IsActive(pair.second, height))
-				tree.set(pair.first, pair.second);
-			else
-				tree.unset(pair.first);
+		// collect all changes so that they can be applied to the tree in a single batch
+		typename TTree::Changes changes;
+		auto handleModification = [&changes, height](const auto& pair) {
+			auto isActive = detail::IsActiveAdapter::IsActive(pair.second, height);
+			changes.emplace_back(pair.first, isActive ? &pair.second : nullptr);
 		};
 
 		auto deltas = set.deltas();
@@ -96,7 +96,9 @@ namespace catapult { namespace cache {
 
 		for (const auto& pair : deltas.Removed) {
 			if (needsApplication(pair.first))
-				tree.unset(pair.first);
+				changes.emplace_back(pair.first, nullptr);
 		}
+
+		tree.update(changes);
 	}
 }}
@@ -0,0 +1,55 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/ContainerTypes.h"
+#include "catapult/utils/ArraySet.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/types.h"
+#include <unordered_set>
+
+namespace catapult { namespace cache {
+
+	/// Keys of cache entries that are expected to be accessed and should be loaded ahead of time.
+	struct PrefetchKeys {
+	public:
+		/// Account addresses.
+		model::AddressSet Addresses;
+
+		/// Account public keys.
+		utils::KeySet PublicKeys;
+
+		/// Mosaic ids.
+		std::unordered_set<MosaicId, utils::BaseValueHasher<MosaicId>> MosaicIds;
+
+		/// Raw namespace ids.
+		/// \note Namespace ids are defined by the namespace plugin, so they are stored unwrapped.
+		std::unordered_set<uint64_t> NamespaceIds;
+
+		/// Lock hashes.
+		utils::HashSet LockHashes;
+
+	public:
+		/// Returns \c true if there are no keys.
+		bool empty() const {
+			return Addresses.empty() && PublicKeys.empty() && MosaicIds.empty() && NamespaceIds.empty() && LockHashes.empty();
+		}
+	};
+}}
@@ -50,7 +50,7 @@ namespace catapult { namespace cache {
 		public:
 			/// Creates base sets around \a config.
 			explicit BaseSets(const CacheConfiguration& config)
-					: CacheDatabaseMixin(config, { "default" }, PruningMode)
+					: CacheDatabaseMixin(config, { "default" }, { RocksColumnProfile::Point_Lookup }, PruningMode)
 					, Primary(GetContainerMode(config), database(), 0)
 			{}
 
@@ -99,9 +99,14 @@ namespace catapult { namespace cache {
 		public:
 			/// Creates base sets around \a config.
 			explicit BaseSets(const CacheConfiguration& config)
-					: CacheDatabaseMixin(config, { "default" })
+					: CacheDatabaseMixin(config, { "default" }, { RocksColumnProfile::Point_Lookup })
 					, Primary(GetContainerMode(config), database(), 0)
-					, PatriciaTree(hasPatriciaTreeSupport(), database(), 1)
+					, PatriciaTree(
+							hasPatriciaTreeSupport(),
+							database(),
+							1,
+							config.PatriciaTreeNodeCacheOptions,
+							config.PatriciaTreeNumRetainedRoots)
 			{}
 
 		public:
@@ -25,8 +25,10 @@
 
 namespace catapult {
 	namespace cache {
+		class CacheChangesStorage;
 		class CacheStorage;
 		class CatapultCache;
+		struct PrefetchKeys;
 	}
 }
 
@@ -92,6 +94,9 @@ namespace catapult { namespace cache {
 
 		/// Returns a read-only view of this view.
 		virtual const void* asReadOnly() const = 0;
+
+		/// Loads cache entries identified by \a keys ahead of time if supported.
+		virtual void prefetch(const PrefetchKeys& keys) const = 0;
 	};
 
 	/// Detached sub cache view.
@@ -143,6 +148,10 @@ namespace catapult { namespace cache {
 	public:
 		/// Returns a cache storage based on this cache.
 		virtual std::unique_ptr<CacheStorage> createStorage() = 0;
+
+		/// Returns a cache changes storage based on this cache.
+		/// \note \c nullptr is returned if cache changes cannot be saved and loaded.
+		virtual std::unique_ptr<const CacheChangesStorage> createChangesStorage() const = 0;
 	};
 
 	// endregion
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "CacheChangesStorageAdapter.h"
 #include "CacheStorageAdapter.h"
 #include "SubCachePlugin.h"
 #include <memory>
@@ -81,6 +82,10 @@ namespace catapult { namespace cache {
 					: nullptr;
 		}
 
+		std::unique_ptr<const CacheChangesStorage> createChangesStorage() const override {
+			return IsCacheStorageSupported(*m_pCache) ? CreateChangesStorage(ChangesSupport<TStorageTraits>()) : nullptr;
+		}
+
 	public:
 		/// Gets a typed reference to the underlying cache.
 		TCache& cache() {
@@ -101,6 +106,29 @@ namespace catapult { namespace cache {
 			return !!cache.createView()->tryMakeIterableView();
 		}
 
+	private:
+		// changes can only be loaded when storage traits can purge values from a delta
+
+		template<typename T, typename = void>
+		struct ChangesSupport : public std::false_type {};
+
+		template<typename T>
+		struct ChangesSupport<
+				T,
+				typename utils::traits::enable_if_type<decltype(T::Purge(
+						std::declval<const typename T::ValueType&>(),
+						std::declval<typename T::DestinationType&>()))>::type>
+				: public std::true_type
+		{};
+
+		static std::unique_ptr<const CacheChangesStorage> CreateChangesStorage(std::false_type) {
+			return nullptr;
+		}
+
+		static std::unique_ptr<const CacheChangesStorage> CreateChangesStorage(std::true_type) {
+			return std::make_unique<CacheChangesStorageAdapter<TCache, TStorageTraits>>();
+		}
+
 	private:
 		// region SubCacheViewAdapter
 
@@ -119,6 +147,12 @@ namespace catapult { namespace cache {
 				return MerkleRootAccessor<UnderlyingViewType>();
 			}
 
+			auto prefetcher() const {
+				// need to dereference to get underlying view type from LockedCacheView
+				using UnderlyingViewType = typename std::remove_reference<decltype(*m_view)>::type;
+				return Prefetcher<UnderlyingViewType>();
+			}
+
 			auto merkleRootMutator() {
 				// need to dereference to get underlying view type from LockedCacheView
 				using UnderlyingViewType = typename std::remove_reference<decltype(*m_view)>::type;
@@ -158,6 +192,10 @@ namespace catapult { namespace cache {
 				return &m_view->asReadOnly();
 			}
 
+			void prefetch(const PrefetchKeys& keys) const override {
+				Prefetch(m_view, keys, prefetcher());
+			}
+
 		private:
 			enum class MerkleRootType { Unsupported, Supported };
 			using UnsupportedMerkleRootFlag = std::integral_constant<MerkleRootType, MerkleRootType::Unsupported>;
@@ -220,6 +258,25 @@ namespace catapult { namespace cache {
 				view->updateMerkleRoot(height);
 			}
 
+		private:
+			template<typename T, typename = void>
+			struct Prefetcher : public std::false_type {};
+
+			template<typename T>
+			struct Prefetcher<
+					T,
+					typename utils::traits::enable_if_type<decltype(
+							reinterpret_cast<const T*>(0)->prefetch(std::declval<const PrefetchKeys&>()))>::type>
+					: public std::true_type
+			{};
+
+			static void Prefetch(const TView&, const PrefetchKeys&, std::false_type)
+			{}
+
+			static void Prefetch(const TView& view, const PrefetchKeys& keys, std::true_type) {
+				view->prefetch(keys);
+			}
+
 		private:
 			TView m_view;
 			SubCacheViewIdentifier m_id;
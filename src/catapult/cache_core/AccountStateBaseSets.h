@@ -51,10 +51,18 @@ namespace catapult { namespace cache {
 
 	public:
 		explicit AccountStateBaseSets(const CacheConfiguration& config)
-				: CacheDatabaseMixin(config, { "default", "key_lookup" })
+				: CacheDatabaseMixin(
+						config,
+						{ "default", "key_lookup" },
+						{ RocksColumnProfile::Point_Lookup, RocksColumnProfile::Point_Lookup })
 				, Primary(GetContainerMode(config), database(), 0)
 				, KeyLookupMap(GetContainerMode(config), database(), 1)
-				, PatriciaTree(hasPatriciaTreeSupport(), database(), 2)
+				, PatriciaTree(
+						hasPatriciaTreeSupport(),
+						database(),
+						2,
+						config.PatriciaTreeNodeCacheOptions,
+						config.PatriciaTreeNumRetainedRoots)
 		{}
 
 	public:
@@ -72,6 +72,17 @@ namespace catapult { namespace cache {
 		return m_options.HarvestingMosaicId;
 	}
 
+	void BasicAccountStateCacheDelta::prefetch(const PrefetchKeys& keys) const {
+		m_pKeyToAddress->prefetch(keys.PublicKeys);
+
+		// account states are always stored by address, so public keys need to be converted
+		auto addresses = keys.Addresses;
+		for (const auto& publicKey : keys.PublicKeys)
+			addresses.insert(model::PublicKeyToAddress(publicKey, m_options.NetworkIdentifier));
+
+		m_pStateByAddress->prefetch(addresses);
+	}
+
 	Address BasicAccountStateCacheDelta::getAddress(const Key& publicKey) {
 		auto keyToAddressIter = m_pKeyToAddress->find(publicKey);
 		const auto* pPair = keyToAddressIter.get();
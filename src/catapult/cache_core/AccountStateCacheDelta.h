@@ -23,6 +23,7 @@
 #include "AccountStateCacheSerializers.h"
 #include "ReadOnlyAccountStateCache.h"
 #include "catapult/cache/CacheMixinAliases.h"
+#include "catapult/cache/PrefetchKeys.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
 #include "catapult/model/ContainerTypes.h"
 
@@ -128,6 +129,10 @@ namespace catapult { namespace cache {
 		/// Gets all high value addresses.
 		model::AddressSet highValueAddresses() const;
 
+	public:
+		/// Loads all accounts identified by addresses or public keys in \a keys ahead of time.
+		void prefetch(const PrefetchKeys& keys) const;
+
 	private:
 		Address getAddress(const Key& publicKey);
 
@@ -26,4 +26,14 @@ namespace catapult { namespace cache {
 	void AccountStateCacheStorage::LoadInto(const ValueType& accountState, DestinationType& cacheDelta) {
 		cacheDelta.addAccount(accountState);
 	}
+
+	void AccountStateCacheStorage::Purge(const ValueType& accountState, DestinationType& cacheDelta) {
+		auto accountStateIter = cacheDelta.find(accountState.Address);
+		if (!accountStateIter.tryGet())
+			return;
+
+		// use the height of the existing account because it is the one that needs to be removed
+		cacheDelta.queueRemove(accountState.Address, accountStateIter.get().AddressHeight);
+		cacheDelta.commitRemovals();
+	}
 }}
@@ -32,5 +32,9 @@ namespace catapult { namespace cache {
 			, public state::AccountStateSerializer {
 		/// Loads \a accountState into \a cacheDelta.
 		static void LoadInto(const ValueType& accountState, DestinationType& cacheDelta);
+
+		/// Purges \a accountState from \a cacheDelta.
+		/// \note This is a no-op if \a accountState is not contained in \a cacheDelta.
+		static void Purge(const ValueType& accountState, DestinationType& cacheDelta);
 	};
 }}
@@ -41,4 +41,9 @@ namespace catapult { namespace cache {
 	void BlockDifficultyCacheStorage::LoadInto(const state::BlockDifficultyInfo& blockDifficultyInfo, DestinationType& cacheDelta) {
 		cacheDelta.insert(blockDifficultyInfo);
 	}
+
+	void BlockDifficultyCacheStorage::Purge(const state::BlockDifficultyInfo& blockDifficultyInfo, DestinationType& cacheDelta) {
+		if (cacheDelta.contains(blockDifficultyInfo))
+			cacheDelta.remove(blockDifficultyInfo);
+	}
 }}
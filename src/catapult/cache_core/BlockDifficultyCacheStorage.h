@@ -34,5 +34,9 @@ namespace catapult { namespace cache {
 
 		/// Loads \a blockDifficultyInfo into \a cacheDelta.
 		static void LoadInto(const state::BlockDifficultyInfo& blockDifficultyInfo, DestinationType& cacheDelta);
+
+		/// Purges \a blockDifficultyInfo from \a cacheDelta.
+		/// \note This is a no-op if \a blockDifficultyInfo is not contained in \a cacheDelta.
+		static void Purge(const state::BlockDifficultyInfo& blockDifficultyInfo, DestinationType& cacheDelta);
 	};
 }}
@@ -58,5 +58,50 @@ namespace catapult { namespace cache {
 	};
 
 	/// Patricia tree typed container.
-	using PatriciaTreeContainer = cache::RdbTypedColumnContainer<PatriciaTreeColumnDescriptor>;
+	/// \note In addition to tree nodes, the container stores a journal of stale nodes for each tree generation.
+	class PatriciaTreeContainer : public RdbTypedColumnContainer<PatriciaTreeColumnDescriptor> {
+	private:
+		using BaseType = RdbTypedColumnContainer<PatriciaTreeColumnDescriptor>;
+		using JournalKey = std::array<uint8_t, sizeof(uint64_t) + 1>;
+
+	public:
+		using BaseType::BaseType;
+
+	public:
+		/// Loads the stale node journal of \a generation into \a journal.
+		/// Returns \c false if the journal of \a generation is not found.
+		bool loadJournal(uint64_t generation, std::string& journal) const {
+			auto key = ToJournalKey(generation);
+			RdbDataIterator iter;
+			RdbColumnContainer::find(key, iter);
+			if (RdbDataIterator::End() == iter)
+				return false;
+
+			auto buffer = iter.buffer();
+			journal.assign(reinterpret_cast<const char*>(buffer.pData), buffer.Size);
+			return true;
+		}
+
+		/// Saves the stale node \a journal of \a generation.
+		void saveJournal(uint64_t generation, const std::string& journal) {
+			auto key = ToJournalKey(generation);
+			RdbColumnContainer::insert(key, journal);
+		}
+
+		/// Removes the stale node journal of \a generation.
+		void removeJournal(uint64_t generation) {
+			auto key = ToJournalKey(generation);
+			RdbColumnContainer::remove(key);
+		}
+
+	private:
+		static JournalKey ToJournalKey(uint64_t generation) {
+			// journal keys are prefixed by generation (like keys of prunable columns) and cannot collide with
+			// properties (shorter) or node hashes (longer)
+			JournalKey key;
+			reinterpret_cast<uint64_t&>(key[0]) = generation;
+			key[sizeof(uint64_t)] = 'j';
+			return key;
+		}
+	};
 }}
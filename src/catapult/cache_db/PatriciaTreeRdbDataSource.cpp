@@ -0,0 +1,256 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeRdbDataSource.h"
+#include "catapult/tree/StaleNodeFinder.h"
+#include "catapult/utils/Logging.h"
+#include <algorithm>
+#include <cstring>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Journal_Entry_Size = Hash256_Size + sizeof(uint32_t);
+	}
+
+	PatriciaTreeRdbDataSource::PatriciaTreeRdbDataSource(
+			PatriciaTreeContainer& container,
+			const tree::TreeNodeCacheOptions& nodeCacheOptions,
+			size_t numRetainedRoots)
+			: m_container(container)
+			, m_pNodeCache(nodeCacheOptions.isEnabled() ? std::make_unique<tree::TreeNodeCache>(nodeCacheOptions) : nullptr)
+			, m_numRetainedRoots(numRetainedRoots)
+			, m_generation(0)
+			, m_oldestGeneration(1)
+			, m_numRemovedNodes(0)
+			, m_numReclaimedBytes(0) {
+		if (isGarbageCollectionEnabled())
+			loadJournals();
+	}
+
+	PatriciaTreeGarbageStatistics PatriciaTreeRdbDataSource::garbageStatistics() const {
+		return { m_staleNodeGenerations.size(), m_numRemovedNodes, m_numReclaimedBytes };
+	}
+
+	std::shared_ptr<const tree::TreeNode> PatriciaTreeRdbDataSource::get(const Hash256& hash) const {
+		auto savedNodeIter = m_savedNodes.find(hash);
+		if (m_savedNodes.cend() != savedNodeIter)
+			return savedNodeIter->second;
+
+		if (m_pNodeCache) {
+			auto pCachedNode = m_pNodeCache->find(hash);
+			if (pCachedNode)
+				return pCachedNode;
+		}
+
+		auto iter = m_container.find(hash);
+		if (m_container.cend() == iter)
+			return nullptr;
+
+		const auto& pair = *iter;
+		auto pNode = std::make_shared<const tree::TreeNode>(pair.second.copy());
+		return m_pNodeCache ? m_pNodeCache->add(pNode) : pNode;
+	}
+
+	void PatriciaTreeRdbDataSource::pin(const Hash256& rootHash) {
+		if (!m_pNodeCache || Hash256() == rootHash)
+			return;
+
+		// walk the tree breadth first and collect all nodes in the top levels
+		std::vector<std::shared_ptr<const tree::TreeNode>> pinnedNodes;
+		std::vector<Hash256> levelHashes{ rootHash };
+		for (auto level = 0u; level < m_pNodeCache->options().NumPinnedLevels && !levelHashes.empty(); ++level) {
+			std::vector<Hash256> nextLevelHashes;
+			for (const auto& hash : levelHashes) {
+				auto pNode = get(hash);
+				if (!pNode)
+					continue;
+
+				pinnedNodes.push_back(pNode);
+				if (!pNode->isBranch())
+					continue;
+
+				const auto& branchNode = pNode->asBranchNode();
+				for (auto i = 0u; i < tree::BranchTreeNode::Max_Links; ++i) {
+					if (branchNode.hasLink(i))
+						nextLevelHashes.push_back(branchNode.link(i));
+				}
+			}
+
+			levelHashes = std::move(nextLevelHashes);
+		}
+
+		m_pNodeCache->pin(pinnedNodes);
+	}
+
+	void PatriciaTreeRdbDataSource::set(const tree::LeafTreeNode& node) {
+		set(tree::TreeNode(node));
+	}
+
+	void PatriciaTreeRdbDataSource::set(const tree::BranchTreeNode& node) {
+		set(tree::TreeNode(node));
+	}
+
+	bool PatriciaTreeRdbDataSource::isGarbageCollectionEnabled() const {
+		return 0 != m_numRetainedRoots;
+	}
+
+	void PatriciaTreeRdbDataSource::set(const tree::TreeNode& node) {
+		m_container.insert(std::make_pair(node.hash(), node.copy()));
+		if (!m_pNodeCache && !isGarbageCollectionEnabled())
+			return;
+
+		// cache saved nodes because they are not visible in the database until the write batch is flushed
+		auto pNode = std::make_shared<const tree::TreeNode>(node.copy());
+		if (m_pNodeCache)
+			m_pNodeCache->add(pNode);
+
+		if (!isGarbageCollectionEnabled())
+			return;
+
+		// a saved node is reachable from the new root (or from none), so it must not be removed as part of an older generation
+		auto staleNodeIter = m_staleNodeGenerations.find(node.hash());
+		if (m_staleNodeGenerations.cend() != staleNodeIter) {
+			m_changedGenerations.insert(staleNodeIter->second);
+			m_staleNodeGenerations.erase(staleNodeIter);
+		}
+
+		m_savedNodes.emplace(node.hash(), pNode);
+	}
+
+	// region garbage collection
+
+	void PatriciaTreeRdbDataSource::collectGarbage(const Hash256& oldRootHash, const Hash256& newRootHash) {
+		if (!isGarbageCollectionEnabled())
+			return;
+
+		utils::HashSet savedNodeHashes;
+		for (const auto& pair : m_savedNodes)
+			savedNodeHashes.insert(pair.first);
+
+		StaleNodes staleNodes;
+		tree::FindStaleNodes(*this, oldRootHash, newRootHash, savedNodeHashes, [&staleNodes](const auto& node) {
+			auto size = Hash256_Size + tree::PatriciaTreeSerializer::SerializeValue(node).size();
+			staleNodes.push_back({ node.hash(), static_cast<uint32_t>(size) });
+		});
+
+		m_savedNodes.clear();
+
+		// rewrite journals of older generations that contained nodes that have been saved again
+		for (auto generation : m_changedGenerations) {
+			auto journalIter = m_journals.find(generation);
+			if (m_journals.cend() == journalIter)
+				continue;
+
+			auto& journal = journalIter->second;
+			journal.erase(std::remove_if(journal.begin(), journal.end(), [this, generation](const auto& staleNode) {
+				auto staleNodeIter = m_staleNodeGenerations.find(staleNode.Hash);
+				return m_staleNodeGenerations.cend() == staleNodeIter || generation != staleNodeIter->second;
+			}), journal.end());
+			saveJournal(generation, journal);
+		}
+
+		m_changedGenerations.clear();
+
+		// a change that does not make any node stale does not need a new generation
+		// because all nodes reachable from the old root are also reachable from the new root
+		if (!staleNodes.empty()) {
+			++m_generation;
+			for (const auto& staleNode : staleNodes)
+				m_staleNodeGenerations[staleNode.Hash] = m_generation;
+
+			saveJournal(m_generation, staleNodes);
+			m_journals.emplace(m_generation, std::move(staleNodes));
+			m_container.setProp("gen", m_generation);
+		}
+
+		// nodes that became stale in a generation are reachable from the root preceding that generation,
+		// so they can be removed once that root is no longer retained
+		auto numRemovedNodes = m_numRemovedNodes;
+		auto numReclaimedBytes = m_numReclaimedBytes;
+		while (m_oldestGeneration + m_numRetainedRoots <= m_generation + 1)
+			removeGeneration(m_oldestGeneration++);
+
+		m_container.setProp("gcgen", m_oldestGeneration);
+
+		if (numRemovedNodes != m_numRemovedNodes) {
+			CATAPULT_LOG(debug)
+					<< "removed " << (m_numRemovedNodes - numRemovedNodes) << " stale patricia tree nodes ("
+					<< (m_numReclaimedBytes - numReclaimedBytes) << " bytes), " << m_staleNodeGenerations.size() << " pending";
+		}
+	}
+
+	void PatriciaTreeRdbDataSource::loadJournals() {
+		m_container.prop("gen", m_generation);
+		m_container.prop("gcgen", m_oldestGeneration);
+
+		std::string buffer;
+		for (auto generation = m_oldestGeneration; generation <= m_generation; ++generation) {
+			if (!m_container.loadJournal(generation, buffer))
+				continue;
+
+			StaleNodes staleNodes(buffer.size() / Journal_Entry_Size);
+			for (auto i = 0u; i < staleNodes.size(); ++i) {
+				const auto* pEntry = buffer.data() + i * Journal_Entry_Size;
+				std::memcpy(staleNodes[i].Hash.data(), pEntry, Hash256_Size);
+				std::memcpy(&staleNodes[i].Size, pEntry + Hash256_Size, sizeof(uint32_t));
+
+				// later generations take precedence because journals of older generations are rewritten when nodes are saved again
+				m_staleNodeGenerations[staleNodes[i].Hash] = generation;
+			}
+
+			m_journals.emplace(generation, std::move(staleNodes));
+		}
+	}
+
+	void PatriciaTreeRdbDataSource::saveJournal(uint64_t generation, const StaleNodes& staleNodes) {
+		std::string buffer(staleNodes.size() * Journal_Entry_Size, 0);
+		for (auto i = 0u; i < staleNodes.size(); ++i) {
+			auto* pEntry = &buffer[i * Journal_Entry_Size];
+			std::memcpy(pEntry, staleNodes[i].Hash.data(), Hash256_Size);
+			std::memcpy(pEntry + Hash256_Size, &staleNodes[i].Size, sizeof(uint32_t));
+		}
+
+		m_container.saveJournal(generation, buffer);
+	}
+
+	void PatriciaTreeRdbDataSource::removeGeneration(uint64_t generation) {
+		auto journalIter = m_journals.find(generation);
+		if (m_journals.cend() == journalIter)
+			return;
+
+		for (const auto& staleNode : journalIter->second) {
+			// skip nodes that have been saved again or became stale again in a later generation
+			auto staleNodeIter = m_staleNodeGenerations.find(staleNode.Hash);
+			if (m_staleNodeGenerations.cend() == staleNodeIter || generation != staleNodeIter->second)
+				continue;
+
+			m_staleNodeGenerations.erase(staleNodeIter);
+			m_container.remove(staleNode.Hash);
+			++m_numRemovedNodes;
+			m_numReclaimedBytes += staleNode.Size;
+		}
+
+		m_container.removeJournal(generation);
+		m_journals.erase(journalIter);
+	}
+
+	// endregion
+}}
@@ -20,16 +20,37 @@
 
 #pragma once
 #include "PatriciaTreeContainer.h"
+#include "catapult/tree/TreeNodeCache.h"
+#include "catapult/utils/Hashers.h"
 #include "catapult/types.h"
+#include <map>
+#include <set>
+#include <unordered_map>
 
 namespace catapult { namespace cache {
 
+	/// Patricia tree stale node garbage collection statistics.
+	struct PatriciaTreeGarbageStatistics {
+		/// Number of stale nodes that are still reachable from a retained root and pending removal.
+		size_t NumPendingNodes;
+
+		/// Number of stale nodes removed since the data source was created.
+		uint64_t NumRemovedNodes;
+
+		/// Number of bytes (keys and values) reclaimed by removed nodes since the data source was created.
+		uint64_t NumReclaimedBytes;
+	};
+
 	/// Patricia tree rocksdb-based data source.
 	class PatriciaTreeRdbDataSource {
 	public:
-		/// Creates data source around \a container.
-		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container) : m_container(container)
-		{}
+		/// Creates data source around \a container with decoded node cache \a nodeCacheOptions.
+		/// Stale nodes are removed once they are no longer reachable from the last \a numRetainedRoots roots
+		/// (\c 0 disables garbage collection).
+		explicit PatriciaTreeRdbDataSource(
+				PatriciaTreeContainer& container,
+				const tree::TreeNodeCacheOptions& nodeCacheOptions = tree::TreeNodeCacheOptions(),
+				size_t numRetainedRoots = 0);
 
 	public:
 		/// Gets the number of saved nodes.
@@ -37,33 +58,69 @@ namespace catapult { namespace cache {
 			return m_container.size();
 		}
 
+		/// Gets the decoded node cache or \c nullptr if it is disabled.
+		const tree::TreeNodeCache* nodeCache() const {
+			return m_pNodeCache.get();
+		}
+
+		/// Gets the stale node garbage collection statistics.
+		PatriciaTreeGarbageStatistics garbageStatistics() const;
+
+	public:
 		/// Gets the tree node associated with \a hash.
-		std::unique_ptr<const tree::TreeNode> get(const Hash256& hash) const {
-			auto iter = m_container.find(hash);
-			if (m_container.cend() == iter)
-				return nullptr;
+		/// \note Returned node is immutable and can be shared with the node cache.
+		std::shared_ptr<const tree::TreeNode> get(const Hash256& hash) const;
 
-			const auto& pair = *iter;
-			return std::make_unique<const tree::TreeNode>(pair.second.copy());
-		}
+		/// Pins the configured number of top levels of the tree with root \a rootHash in the node cache.
+		void pin(const Hash256& rootHash);
 
 	public:
 		/// Saves a leaf tree \a node.
-		void set(const tree::LeafTreeNode& node) {
-			set(tree::TreeNode(node));
-		}
+		void set(const tree::LeafTreeNode& node);
 
 		/// Saves a branch tree \a node.
-		void set(const tree::BranchTreeNode& node) {
-			set(tree::TreeNode(node));
-		}
+		void set(const tree::BranchTreeNode& node);
+
+		/// Journals all nodes that became stale when the tree root changed from \a oldRootHash to \a newRootHash
+		/// and removes all journaled nodes that are no longer reachable from any retained root.
+		/// \note All nodes saved since the previous call are assumed to be part of the change.
+		void collectGarbage(const Hash256& oldRootHash, const Hash256& newRootHash);
 
 	private:
-		void set(const tree::TreeNode& node) {
-			m_container.insert(std::make_pair(node.hash(), node.copy()));
-		}
+		struct StaleNode {
+			Hash256 Hash;
+			uint32_t Size;
+		};
+
+		using StaleNodes = std::vector<StaleNode>;
+
+	private:
+		bool isGarbageCollectionEnabled() const;
+
+		void set(const tree::TreeNode& node);
+
+		void loadJournals();
+
+		void saveJournal(uint64_t generation, const StaleNodes& staleNodes);
+
+		void removeGeneration(uint64_t generation);
 
 	private:
 		PatriciaTreeContainer& m_container;
+		std::unique_ptr<tree::TreeNodeCache> m_pNodeCache;
+		size_t m_numRetainedRoots;
+
+		// nodes saved since last collection (they are not visible in the database until the write batch is flushed)
+		std::unordered_map<Hash256, std::shared_ptr<const tree::TreeNode>, utils::ArrayHasher<Hash256>> m_savedNodes;
+
+		// journaled stale nodes (and generations in which they became stale) pending removal
+		uint64_t m_generation;
+		uint64_t m_oldestGeneration;
+		std::map<uint64_t, StaleNodes> m_journals;
+		std::unordered_map<Hash256, uint64_t, utils::ArrayHasher<Hash256>> m_staleNodeGenerations;
+		std::set<uint64_t> m_changedGenerations;
+
+		uint64_t m_numRemovedNodes;
+		uint64_t m_numReclaimedBytes;
 	};
 }}
@@ -135,6 +135,22 @@ namespace catapult { namespace cache {
 			return iter;
 		}
 
+		/// Loads all elements with \a keys in a single batched lookup so that subsequent finds are served from memory.
+		/// \note Elements are not deserialized and results are discarded.
+		template<typename TKeys>
+		void prefetch(const TKeys& keys) const {
+			if (keys.empty())
+				return;
+
+			std::vector<RawBuffer> serializedKeys;
+			serializedKeys.reserve(keys.size());
+			for (const KeyType& key : keys)
+				serializedKeys.push_back(SerializeKey(key));
+
+			std::vector<RdbDataIterator> iterators;
+			TContainer::find(serializedKeys, iterators);
+		}
+
 		/// Prunes elements with keys smaller than \a key. Returns number of pruned elements.
 		size_t prune(const KeyType& key) {
 			return TContainer::prune(TDescriptor::Serializer::KeyToBoundary(key));
@@ -85,14 +85,70 @@ namespace catapult { namespace cache {
 			const std::vector<std::string>& columnFamilyNames,
 			utils::FileSize maxDatabaseWriteBatchSize,
 			FilterPruningMode pruningMode)
+			: RocksDatabaseSettings(
+					databaseDirectory,
+					columnFamilyNames,
+					std::vector<RocksColumnProfile>(columnFamilyNames.size(), RocksColumnProfile::Default),
+					maxDatabaseWriteBatchSize,
+					pruningMode,
+					nullptr)
+	{}
+
+	RocksDatabaseSettings::RocksDatabaseSettings(
+			const std::string& databaseDirectory,
+			const std::vector<std::string>& columnFamilyNames,
+			const std::vector<RocksColumnProfile>& columnProfiles,
+			utils::FileSize maxDatabaseWriteBatchSize,
+			FilterPruningMode pruningMode,
+			const std::shared_ptr<RocksSharedResources>& pSharedResources)
 			: DatabaseDirectory(databaseDirectory)
 			, ColumnFamilyNames(columnFamilyNames)
 			, MaxDatabaseWriteBatchSize(maxDatabaseWriteBatchSize)
 			, PruningMode(pruningMode)
+			, ColumnProfiles(columnProfiles)
+			, SharedResources(pSharedResources)
 	{}
 
 	// endregion
 
+	namespace {
+		constexpr int Bloom_Filter_Bits_Per_Key = 10;
+		constexpr double Memtable_Prefix_Bloom_Size_Ratio = 0.1;
+
+		void ApplyColumnProfile(
+				rocksdb::ColumnFamilyOptions& options,
+				RocksColumnProfile profile,
+				const std::shared_ptr<rocksdb::Cache>& pBlockCache) {
+			if (RocksColumnProfile::Default == profile && !pBlockCache)
+				return;
+
+			rocksdb::BlockBasedTableOptions tableOptions;
+			if (pBlockCache)
+				tableOptions.block_cache = pBlockCache;
+
+			if (RocksColumnProfile::Default != profile) {
+				// bloom filters allow most lookups of missing keys to skip reading data blocks;
+				// index and filter blocks are charged to the (shared) block cache so memory usage stays bounded
+				tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(Bloom_Filter_Bits_Per_Key, false));
+				tableOptions.cache_index_and_filter_blocks = true;
+				tableOptions.pin_l0_filter_and_index_blocks_in_cache = true;
+			}
+
+			if (RocksColumnProfile::Patricia_Tree == profile) {
+				// all keys are 32-byte node hashes, so the fixed prefix is the whole key; the prefix extractor is
+				// needed to enable memtable blooms, which filter lookups of freshly written nodes
+				tableOptions.data_block_index_type = rocksdb::BlockBasedTableOptions::kDataBlockBinaryAndHash;
+				options.prefix_extractor.reset(rocksdb::NewFixedPrefixTransform(Hash256_Size));
+				options.memtable_prefix_bloom_size_ratio = Memtable_Prefix_Bloom_Size_Ratio;
+
+				// nodes are only looked up via links from their parents, so lookups are expected to hit
+				options.optimize_filters_for_hits = true;
+			}
+
+			options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+		}
+	}
+
 	RocksDatabase::RocksDatabase() = default;
 
 	RocksDatabase::RocksDatabase(const RocksDatabaseSettings& settings)
@@ -102,6 +158,9 @@ namespace catapult { namespace cache {
 		if (settings.ColumnFamilyNames.empty())
 			CATAPULT_THROW_INVALID_ARGUMENT("missing column family names")
 
+		if (settings.ColumnFamilyNames.size() != settings.ColumnProfiles.size())
+			CATAPULT_THROW_INVALID_ARGUMENT("column family names and profiles must have same size")
+
 		if (0 != settings.MaxDatabaseWriteBatchSize.bytes() && settings.MaxDatabaseWriteBatchSize < utils::FileSize::FromKilobytes(100))
 			CATAPULT_THROW_INVALID_ARGUMENT("too small setting of DatabaseWriteBatchSize")
 
@@ -115,12 +174,21 @@ namespace catapult { namespace cache {
 		dbOptions.create_if_missing = true;
 		dbOptions.create_missing_column_families = true;
 
+		std::shared_ptr<rocksdb::Cache> pBlockCache;
+		if (m_settings.SharedResources) {
+			m_settings.SharedResources->configure(dbOptions);
+			pBlockCache = m_settings.SharedResources->blockCache();
+		}
+
 		rocksdb::ColumnFamilyOptions defaultColumnOptions;
 		defaultColumnOptions.compaction_filter = m_pruningFilter.compactionFilter();
 
 		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
-		for (const auto& columnFamilyName : settings.ColumnFamilyNames)
-			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, defaultColumnOptions));
+		for (auto i = 0u; i < settings.ColumnFamilyNames.size(); ++i) {
+			auto columnOptions = defaultColumnOptions;
+			ApplyColumnProfile(columnOptions, settings.ColumnProfiles[i], pBlockCache);
+			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(settings.ColumnFamilyNames[i], columnOptions));
+		}
 
 		auto status = rocksdb::DB::Open(dbOptions, m_settings.DatabaseDirectory, columnFamilies, &m_handles, &pDb);
 		m_pDb.reset(pDb);
@@ -166,6 +234,30 @@ namespace catapult { namespace cache {
 			CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
 	}
 
+	void RocksDatabase::multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results) {
+		if (!m_pDb)
+			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
+
+		results.resize(keys.size());
+		if (keys.empty())
+			return;
+
+		// batched lookup allows rocksdb to issue reads for all keys in parallel instead of one after another
+		std::vector<rocksdb::PinnableSlice> values(keys.size());
+		std::vector<rocksdb::Status> statuses(keys.size());
+		m_pDb->MultiGet(rocksdb::ReadOptions(), m_handles[columnId], keys.size(), keys.data(), values.data(), statuses.data());
+
+		for (auto i = 0u; i < keys.size(); ++i) {
+			const auto& status = statuses[i];
+			const auto& key = keys[i];
+			if (!status.ok() && !status.IsNotFound())
+				CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
+
+			results[i].storage() = std::move(values[i]);
+			results[i].setFound(status.ok());
+		}
+	}
+
 	void RocksDatabase::put(size_t columnId, const rocksdb::Slice& key, const std::string& value) {
 		if (!m_pDb)
 			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
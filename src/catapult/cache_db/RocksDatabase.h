@@ -20,6 +20,7 @@
 
 #pragma once
 #include "RocksPruningFilter.h"
+#include "RocksSharedResources.h"
 #include "catapult/utils/FileSize.h"
 #include "catapult/types.h"
 #include <memory>
@@ -98,6 +99,17 @@ namespace catapult { namespace cache {
 				utils::FileSize maxDatabaseWriteBatchSize,
 				FilterPruningMode pruningMode);
 
+		/// Creates database settings around \a databaseDirectory, column names (\a columnFamilyNames) with corresponding
+		/// \a columnProfiles, maximum size of saved batch (\a maxDatabaseWriteBatchSize), \a pruningMode
+		/// and (optional) node-wide shared resources (\a pSharedResources).
+		RocksDatabaseSettings(
+				const std::string& databaseDirectory,
+				const std::vector<std::string>& columnFamilyNames,
+				const std::vector<RocksColumnProfile>& columnProfiles,
+				utils::FileSize maxDatabaseWriteBatchSize,
+				FilterPruningMode pruningMode,
+				const std::shared_ptr<RocksSharedResources>& pSharedResources);
+
 	public:
 		/// Database directory.
 		const std::string DatabaseDirectory;
@@ -110,6 +122,12 @@ namespace catapult { namespace cache {
 
 		/// Database pruning mode.
 		const FilterPruningMode PruningMode;
+
+		/// Tuning profiles of database columns (one per column name).
+		const std::vector<RocksColumnProfile> ColumnProfiles;
+
+		/// Resources shared with other databases (optional).
+		const std::shared_ptr<RocksSharedResources> SharedResources;
 	};
 
 	/// RocksDb-backed database.
@@ -135,6 +153,10 @@ namespace catapult { namespace cache {
 		/// Gets \a key from \a columnId returning data in \a result.
 		void get(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result);
 
+		/// Gets all \a keys from \a columnId in a single batched lookup returning data in \a results.
+		/// \note \a results is resized to match \a keys and each result corresponds to the key with the same index.
+		void multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results);
+
 		/// Puts \a value with \a key in \a columnId.
 		void put(size_t columnId, const rocksdb::Slice& key, const std::string& value);
 
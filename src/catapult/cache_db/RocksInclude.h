@@ -25,9 +25,15 @@
 #pragma warning(disable : 4100) /* unreferenced formal parameter */
 #endif
 
+#include <rocksdb/cache.h>
 #include <rocksdb/compaction_filter.h>
 #include <rocksdb/db.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/slice_transform.h>
+#include <rocksdb/statistics.h>
+#include <rocksdb/table.h>
 #include <rocksdb/write_batch.h>
+#include <rocksdb/write_buffer_manager.h>
 
 #if defined(_MSC_VER)
 #pragma warning(pop)
@@ -0,0 +1,87 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "RocksSharedResources.h"
+#include "RocksInclude.h"
+#include "catapult/exceptions.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		rocksdb::Tickers ToTicker(RocksStatistic statistic) {
+			switch (statistic) {
+			case RocksStatistic::Block_Cache_Hit:
+				return rocksdb::BLOCK_CACHE_HIT;
+			case RocksStatistic::Block_Cache_Miss:
+				return rocksdb::BLOCK_CACHE_MISS;
+			case RocksStatistic::Bloom_Filter_Useful:
+				return rocksdb::BLOOM_FILTER_USEFUL;
+			case RocksStatistic::Memtable_Hit:
+				return rocksdb::MEMTABLE_HIT;
+			case RocksStatistic::Memtable_Miss:
+				return rocksdb::MEMTABLE_MISS;
+			case RocksStatistic::Bytes_Read:
+				return rocksdb::BYTES_READ;
+			case RocksStatistic::Bytes_Written:
+				return rocksdb::BYTES_WRITTEN;
+			}
+
+			CATAPULT_THROW_INVALID_ARGUMENT_1("unknown rocks statistic", static_cast<uint16_t>(statistic));
+		}
+	}
+
+	RocksSharedResources::RocksSharedResources(utils::FileSize blockCacheSize, utils::FileSize writeBufferBudget)
+			: m_pStatistics(rocksdb::CreateDBStatistics()) {
+		if (0 != blockCacheSize.bytes())
+			m_pBlockCache = rocksdb::NewLRUCache(blockCacheSize.bytes());
+
+		// charge memtables against the block cache (when present) so that the node has a single memory budget
+		if (0 != writeBufferBudget.bytes())
+			m_pWriteBufferManager = std::make_shared<rocksdb::WriteBufferManager>(writeBufferBudget.bytes(), m_pBlockCache);
+	}
+
+	RocksSharedResources::~RocksSharedResources() = default;
+
+	utils::FileSize RocksSharedResources::blockCacheCapacity() const {
+		return utils::FileSize::FromBytes(m_pBlockCache ? m_pBlockCache->GetCapacity() : 0);
+	}
+
+	utils::FileSize RocksSharedResources::blockCacheUsage() const {
+		return utils::FileSize::FromBytes(m_pBlockCache ? m_pBlockCache->GetUsage() : 0);
+	}
+
+	utils::FileSize RocksSharedResources::writeBufferUsage() const {
+		return utils::FileSize::FromBytes(m_pWriteBufferManager ? m_pWriteBufferManager->memory_usage() : 0);
+	}
+
+	uint64_t RocksSharedResources::statistic(RocksStatistic statistic) const {
+		return m_pStatistics->getTickerCount(ToTicker(statistic));
+	}
+
+	std::shared_ptr<rocksdb::Cache> RocksSharedResources::blockCache() const {
+		return m_pBlockCache;
+	}
+
+	void RocksSharedResources::configure(rocksdb::DBOptions& options) const {
+		options.statistics = m_pStatistics;
+		if (m_pWriteBufferManager)
+			options.write_buffer_manager = m_pWriteBufferManager;
+	}
+}}
@@ -0,0 +1,105 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/FileSize.h"
+#include <memory>
+
+namespace rocksdb {
+	class Cache;
+	class Statistics;
+	class WriteBufferManager;
+	struct DBOptions;
+}
+
+namespace catapult { namespace cache {
+
+	/// Tuning profile of a database column.
+	enum class RocksColumnProfile {
+		/// Default column options.
+		Default,
+
+		/// Column dominated by point lookups (bloom filters, cached index and filter blocks).
+		Point_Lookup,
+
+		/// Column storing patricia tree nodes keyed by 32-byte hashes.
+		Patricia_Tree
+	};
+
+	/// RocksDb statistics exposed by shared resources.
+	enum class RocksStatistic {
+		/// Number of block cache hits.
+		Block_Cache_Hit,
+
+		/// Number of block cache misses.
+		Block_Cache_Miss,
+
+		/// Number of lookups avoided because of bloom filters.
+		Bloom_Filter_Useful,
+
+		/// Number of memtable hits.
+		Memtable_Hit,
+
+		/// Number of memtable misses.
+		Memtable_Miss,
+
+		/// Number of bytes read.
+		Bytes_Read,
+
+		/// Number of bytes written.
+		Bytes_Written
+	};
+
+	/// RocksDb resources shared by all databases opened by a node.
+	class RocksSharedResources {
+	public:
+		/// Creates resources with a block cache of \a blockCacheSize and a memtable budget of \a writeBufferBudget.
+		/// \note Zero sizes disable the corresponding shared resource.
+		RocksSharedResources(utils::FileSize blockCacheSize, utils::FileSize writeBufferBudget);
+
+		/// Destroys resources.
+		~RocksSharedResources();
+
+	public:
+		/// Gets the capacity of the shared block cache.
+		utils::FileSize blockCacheCapacity() const;
+
+		/// Gets the current usage of the shared block cache.
+		utils::FileSize blockCacheUsage() const;
+
+		/// Gets the current memtable usage accounted against the write buffer budget.
+		utils::FileSize writeBufferUsage() const;
+
+		/// Gets the current value of \a statistic accumulated across all databases.
+		uint64_t statistic(RocksStatistic statistic) const;
+
+	public:
+		/// Gets the shared block cache (if any).
+		std::shared_ptr<rocksdb::Cache> blockCache() const;
+
+		/// Attaches shared resources to database \a options.
+		void configure(rocksdb::DBOptions& options) const;
+
+	private:
+		std::shared_ptr<rocksdb::Cache> m_pBlockCache;
+		std::shared_ptr<rocksdb::WriteBufferManager> m_pWriteBufferManager;
+		std::shared_ptr<rocksdb::Statistics> m_pStatistics;
+	};
+}}
@@ -45,6 +45,12 @@ namespace catapult { namespace cache {
 		elements.setSize(size);
 	}
 
+	/// Loads all elements with \a keys from \a elements in a single batched lookup.
+	template<typename TDescriptor, typename TContainer, typename TKeys>
+	void PrefetchSet(const RdbTypedColumnContainer<TDescriptor, TContainer>& elements, const TKeys& keys) {
+		elements.prefetch(keys);
+	}
+
 	/// Optionally prunes \a elements using \a pruningBoundary, which indicates the upper bound of elements to remove.
 	template<typename TDescriptor, typename TContainer, typename TPruningBoundary>
 	void PruneBaseSet(RdbTypedColumnContainer<TDescriptor, TContainer>& elements, const TPruningBoundary& pruningBoundary) {
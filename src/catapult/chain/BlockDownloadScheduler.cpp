@@ -0,0 +1,160 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BlockDownloadScheduler.h"
+#include "catapult/model/Block.h"
+#include <algorithm>
+
+namespace catapult { namespace chain {
+
+	namespace {
+		bool IsValidResponse(const BlockDownloadRequest& request, const model::BlockRange& range) {
+			if (range.size() > request.NumBlocks)
+				return false;
+
+			auto expectedHeight = request.StartHeight;
+			for (const auto& block : range) {
+				if (expectedHeight != block.Height)
+					return false;
+
+				expectedHeight = expectedHeight + Height(1);
+			}
+
+			return true;
+		}
+	}
+
+	BlockDownloadScheduler::BlockDownloadScheduler(Height startHeight, uint32_t numBlocks, uint32_t maxBlocksPerRequest)
+			: m_nextHeight(startHeight) {
+		auto height = startHeight;
+		while (0 < numBlocks) {
+			auto numChunkBlocks = std::min(numBlocks, maxBlocksPerRequest);
+			addChunk(height, numChunkBlocks);
+
+			height = height + Height(numChunkBlocks);
+			numBlocks -= numChunkBlocks;
+		}
+	}
+
+	Height BlockDownloadScheduler::nextHeight() const {
+		return m_nextHeight;
+	}
+
+	bool BlockDownloadScheduler::isComplete() const {
+		return std::all_of(m_chunks.cbegin(), m_chunks.cend(), [](const auto& pair) {
+			return pair.second.IsCompleted;
+		});
+	}
+
+	bool BlockDownloadScheduler::tryNext(size_t peerId, BlockDownloadRequest& request) {
+		// prefer unassigned chunks, otherwise duplicate the lowest chunk that is only assigned to a different peer
+		auto iter = std::find_if(m_chunks.begin(), m_chunks.end(), [](const auto& pair) {
+			return !pair.second.IsCompleted && pair.second.PeerIds.empty();
+		});
+
+		if (m_chunks.end() == iter) {
+			iter = std::find_if(m_chunks.begin(), m_chunks.end(), [peerId](const auto& pair) {
+				const auto& chunk = pair.second;
+				return !chunk.IsCompleted && 1 == chunk.PeerIds.size() && peerId != chunk.PeerIds[0];
+			});
+		}
+
+		if (m_chunks.end() == iter)
+			return false;
+
+		iter->second.PeerIds.push_back(peerId);
+		request = { iter->first, iter->second.NumBlocks };
+		return true;
+	}
+
+	bool BlockDownloadScheduler::complete(size_t peerId, const BlockDownloadRequest& request, model::BlockRange&& range) {
+		auto iter = m_chunks.find(request.StartHeight);
+
+		// ignore responses to requests that have already been completed by a different peer or have been truncated
+		if (m_chunks.end() == iter || iter->second.IsCompleted || !unassign(peerId, iter->second))
+			return true;
+
+		auto& chunk = iter->second;
+		if (!IsValidResponse(request, range))
+			return false;
+
+		if (range.empty()) {
+			// only the authoritative peer can end the download early, other peers are assumed to be behind
+			if (0 != peerId)
+				return false;
+
+			truncate(request.StartHeight);
+			return true;
+		}
+
+		// split partial responses and schedule the remaining blocks separately
+		auto numBlocks = static_cast<uint32_t>(range.size());
+		if (numBlocks < chunk.NumBlocks) {
+			auto numRemainingBlocks = chunk.NumBlocks - numBlocks;
+			chunk.NumBlocks = numBlocks;
+			addChunk(request.StartHeight + Height(numBlocks), numRemainingBlocks);
+		}
+
+		chunk.PeerIds.clear();
+		chunk.IsCompleted = true;
+		chunk.Range = std::move(range);
+		return true;
+	}
+
+	void BlockDownloadScheduler::fail(size_t peerId, const BlockDownloadRequest& request) {
+		auto iter = m_chunks.find(request.StartHeight);
+		if (m_chunks.end() == iter || iter->second.IsCompleted)
+			return;
+
+		unassign(peerId, iter->second);
+	}
+
+	std::vector<model::BlockRange> BlockDownloadScheduler::takeReadyRanges() {
+		std::vector<model::BlockRange> ranges;
+		while (!m_chunks.empty()) {
+			auto iter = m_chunks.begin();
+			if (m_nextHeight != iter->first || !iter->second.IsCompleted)
+				break;
+
+			m_nextHeight = m_nextHeight + Height(iter->second.NumBlocks);
+			ranges.push_back(std::move(iter->second.Range));
+			m_chunks.erase(iter);
+		}
+
+		return ranges;
+	}
+
+	void BlockDownloadScheduler::addChunk(Height startHeight, uint32_t numBlocks) {
+		m_chunks.emplace(startHeight, Chunk{ numBlocks, {}, false, model::BlockRange() });
+	}
+
+	void BlockDownloadScheduler::truncate(Height height) {
+		m_chunks.erase(m_chunks.lower_bound(height), m_chunks.end());
+	}
+
+	bool BlockDownloadScheduler::unassign(size_t peerId, Chunk& chunk) {
+		auto iter = std::find(chunk.PeerIds.begin(), chunk.PeerIds.end(), peerId);
+		if (chunk.PeerIds.end() == iter)
+			return false;
+
+		chunk.PeerIds.erase(iter);
+		return true;
+	}
+}}
@@ -0,0 +1,90 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/RangeTypes.h"
+#include "catapult/types.h"
+#include <map>
+#include <vector>
+
+namespace catapult { namespace chain {
+
+	/// Request for a contiguous range of blocks.
+	struct BlockDownloadRequest {
+		/// Height of the first requested block.
+		Height StartHeight;
+
+		/// Number of requested blocks.
+		uint32_t NumBlocks;
+	};
+
+	/// Splits a height range into requests that can be downloaded from multiple peers in parallel
+	/// and reassembles the responses in height order.
+	/// \note Peer \c 0 is the authoritative peer. An empty response from it marks the end of the remote chain.
+	/// \note This class is not thread safe.
+	class BlockDownloadScheduler {
+	public:
+		/// Creates a scheduler for \a numBlocks blocks starting at \a startHeight that are requested
+		/// in requests of at most \a maxBlocksPerRequest blocks.
+		BlockDownloadScheduler(Height startHeight, uint32_t numBlocks, uint32_t maxBlocksPerRequest);
+
+	public:
+		/// Gets the height of the first block that has not been taken.
+		Height nextHeight() const;
+
+		/// Returns \c true if all requests have been completed.
+		bool isComplete() const;
+
+	public:
+		/// Tries to assign the next request to the peer identified by \a peerId and sets \a request on success.
+		/// \note When there are no unassigned requests, the lowest request outstanding at a single different peer is
+		///       assigned again so that a slow peer cannot stall the download.
+		bool tryNext(size_t peerId, BlockDownloadRequest& request);
+
+		/// Completes \a request assigned to the peer identified by \a peerId with \a range.
+		/// Returns \c false if \a range is not a valid response and the peer should not be used anymore.
+		bool complete(size_t peerId, const BlockDownloadRequest& request, model::BlockRange&& range);
+
+		/// Fails \a request assigned to the peer identified by \a peerId so that it can be reassigned.
+		void fail(size_t peerId, const BlockDownloadRequest& request);
+
+		/// Takes all completed ranges that directly follow the previously taken ranges.
+		std::vector<model::BlockRange> takeReadyRanges();
+
+	private:
+		struct Chunk {
+			uint32_t NumBlocks;
+			std::vector<size_t> PeerIds;
+			bool IsCompleted;
+			model::BlockRange Range;
+		};
+
+	private:
+		void addChunk(Height startHeight, uint32_t numBlocks);
+
+		void truncate(Height height);
+
+		bool unassign(size_t peerId, Chunk& chunk);
+
+	private:
+		Height m_nextHeight;
+		std::map<Height, Chunk> m_chunks;
+	};
+}}
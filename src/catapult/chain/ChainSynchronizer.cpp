@@ -19,11 +19,13 @@
 **/
 
 #include "ChainSynchronizer.h"
+#include "BlockDownloadScheduler.h"
 #include "CompareChains.h"
 #include "catapult/api/RemoteChainApi.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/SpinLock.h"
+#include <mutex>
 #include <queue>
 
 namespace catapult { namespace chain {
@@ -223,6 +225,171 @@ namespace catapult { namespace chain {
 			});
 		}
 
+		// region ParallelBlocksDownload
+
+		class ParallelBlocksDownload : public std::enable_shared_from_this<ParallelBlocksDownload> {
+		public:
+			using RemoteApiType = api::RemoteChainApi;
+			using RemoteApis = std::vector<std::shared_ptr<const RemoteApiType>>;
+
+		public:
+			// note: remoteChainApi is the authoritative peer and is guaranteed to outlive the download
+			ParallelBlocksDownload(
+					const RemoteApiType& remoteChainApi,
+					RemoteApis&& helperRemoteChainApis,
+					const api::BlocksFromOptions& blocksFromOptions,
+					Height startHeight,
+					uint32_t numBlocks)
+					: m_remoteChainApi(remoteChainApi)
+					, m_helperRemoteChainApis(std::move(helperRemoteChainApis))
+					, m_blocksFromOptions(blocksFromOptions)
+					, m_scheduler(startHeight, numBlocks, blocksFromOptions.NumBlocks)
+					, m_peerStates(1 + m_helperRemoteChainApis.size())
+					, m_numOutstandingRequests(0)
+					, m_isAuthoritativePeerFailed(false)
+					, m_isCompleted(false)
+			{}
+
+		public:
+			/// Starts the download and returns a future that is resolved with \c true if the authoritative peer did not fail.
+			thread::future<bool> start() {
+				auto future = m_promise.get_future();
+				schedule();
+				return future;
+			}
+
+			/// Takes all downloaded blocks that directly follow the start height.
+			std::vector<model::BlockRange> takeRanges() {
+				std::lock_guard<std::mutex> guard(m_mutex);
+				return m_scheduler.takeReadyRanges();
+			}
+
+		private:
+			struct PeerState {
+				bool IsActive = true;
+				bool IsBusy = false;
+			};
+
+			using Request = std::pair<size_t, BlockDownloadRequest>;
+
+		private:
+			const RemoteApiType& remoteApi(size_t peerId) const {
+				return 0 == peerId ? m_remoteChainApi : *m_helperRemoteChainApis[peerId - 1];
+			}
+
+			void schedule() {
+				std::vector<Request> requests;
+				auto isCompleted = false;
+				{
+					std::lock_guard<std::mutex> guard(m_mutex);
+					if (m_isCompleted)
+						return;
+
+					for (auto peerId = 0u; peerId < m_peerStates.size(); ++peerId) {
+						auto& peerState = m_peerStates[peerId];
+						BlockDownloadRequest request;
+						if (!peerState.IsActive || peerState.IsBusy || !m_scheduler.tryNext(peerId, request))
+							continue;
+
+						peerState.IsBusy = true;
+						++m_numOutstandingRequests;
+						requests.emplace_back(peerId, request);
+					}
+
+					// don't wait for (duplicated) requests of slow helper peers once all blocks are available,
+					// but always wait for the authoritative peer because its api is not owned by the download
+					m_isCompleted = !m_peerStates[0].IsBusy
+							&& (0 == m_numOutstandingRequests || m_scheduler.isComplete() || m_isAuthoritativePeerFailed);
+					isCompleted = m_isCompleted;
+				}
+
+				// issue requests outside of the lock because continuations of ready futures are executed inline
+				for (const auto& request : requests)
+					issue(request.first, request.second);
+
+				if (isCompleted)
+					m_promise.set_value(!m_isAuthoritativePeerFailed);
+			}
+
+			void issue(size_t peerId, const BlockDownloadRequest& request) {
+				auto options = m_blocksFromOptions;
+				options.NumBlocks = request.NumBlocks;
+				remoteApi(peerId).blocksFrom(request.StartHeight, options).then([pThis = shared_from_this(), peerId, request](
+						auto&& blocksFuture) {
+					pThis->handleResponse(peerId, request, std::move(blocksFuture));
+				});
+			}
+
+			void handleResponse(size_t peerId, const BlockDownloadRequest& request, thread::future<model::BlockRange>&& blocksFuture) {
+				{
+					std::lock_guard<std::mutex> guard(m_mutex);
+					auto& peerState = m_peerStates[peerId];
+					peerState.IsBusy = false;
+					--m_numOutstandingRequests;
+
+					try {
+						auto range = blocksFuture.get();
+						CATAPULT_LOG(debug)
+								<< "peer " << peerId << " returned " << range.size()
+								<< " blocks (requested " << request.NumBlocks << " from height " << request.StartHeight << ")";
+
+						if (!m_scheduler.complete(peerId, request, std::move(range)))
+							deactivate(peerId, "returned unexpected blocks");
+					} catch (const catapult_runtime_error& e) {
+						CATAPULT_LOG(warning) << "exception thrown while requesting blocks: " << e.what();
+						m_scheduler.fail(peerId, request);
+						deactivate(peerId, "failed");
+					}
+				}
+
+				schedule();
+			}
+
+			void deactivate(size_t peerId, const char* reason) {
+				CATAPULT_LOG(info) << "excluding peer " << peerId << " from block download because it " << reason;
+				m_peerStates[peerId].IsActive = false;
+				if (0 != peerId)
+					return;
+
+				// stop downloading when the authoritative peer fails
+				m_isAuthoritativePeerFailed = true;
+				for (auto& peerState : m_peerStates)
+					peerState.IsActive = false;
+			}
+
+		private:
+			const RemoteApiType& m_remoteChainApi;
+			RemoteApis m_helperRemoteChainApis;
+			api::BlocksFromOptions m_blocksFromOptions;
+			BlockDownloadScheduler m_scheduler;
+			std::vector<PeerState> m_peerStates;
+			size_t m_numOutstandingRequests;
+			bool m_isAuthoritativePeerFailed;
+			bool m_isCompleted;
+			thread::promise<bool> m_promise;
+			std::mutex m_mutex;
+		};
+
+		NodeInteractionFuture ParallelChainBlocksFrom(
+				const std::shared_ptr<ParallelBlocksDownload>& pDownload,
+				const Key& sourcePublicKey,
+				const std::shared_ptr<UnprocessedElements>& pUnprocessedElements) {
+			return thread::compose(pDownload->start(), [pDownload, sourcePublicKey, pUnprocessedElements](auto&& downloadFuture) {
+				if (!downloadFuture.get())
+					return thread::make_ready_future(ionet::NodeInteractionResultCode::Failure);
+
+				// merge all contiguous ranges into a single range so that forks are resolved at once
+				RangeAggregator rangeAggregator(sourcePublicKey);
+				for (auto& range : pDownload->takeRanges())
+					rangeAggregator.add(std::move(range));
+
+				CATAPULT_LOG(info) << "peers returned " << rangeAggregator.numBlocks() << " contiguous blocks";
+				return CompleteChainBlocksFrom(rangeAggregator, *pUnprocessedElements);
+			});
+		}
+
+		// endregion
+
 		class DefaultChainSynchronizer {
 		public:
 			using RemoteApiType = api::RemoteChainApi;
@@ -233,8 +400,10 @@ namespace catapult { namespace chain {
 			explicit DefaultChainSynchronizer(
 					const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 					const ChainSynchronizerConfiguration& config,
+					const RemoteChainApisSupplier& helperRemoteChainApisSupplier,
 					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer)
 					: m_pLocalChainApi(pLocalChainApi)
+					, m_helperRemoteChainApisSupplier(helperRemoteChainApisSupplier)
 					, m_compareChainOptions(config.MaxBlocksPerSyncAttempt, config.MaxRollbackBlocks)
 					, m_blocksFromOptions(config.MaxBlocksPerSyncAttempt, config.MaxChainBytesPerSyncAttempt)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
@@ -293,6 +462,13 @@ namespace catapult { namespace chain {
 				CATAPULT_LOG(debug)
 						<< "pulling blocks from remote with common height " << compareResult.CommonBlockHeight
 						<< " (fork depth = " << compareResult.ForkDepth << ")";
+
+				auto helperRemoteChainApis = m_helperRemoteChainApisSupplier
+						? m_helperRemoteChainApisSupplier()
+						: ParallelBlocksDownload::RemoteApis();
+				if (!helperRemoteChainApis.empty())
+					return parallelSyncWithPeers(remoteChainApi, std::move(helperRemoteChainApis), compareResult);
+
 				return ChainBlocksFrom(
 						CreateFutureSupplier(remoteChainApi, m_blocksFromOptions),
 						compareResult.CommonBlockHeight + Height(1),
@@ -301,8 +477,27 @@ namespace catapult { namespace chain {
 						*m_pUnprocessedElements);
 			}
 
+			NodeInteractionFuture parallelSyncWithPeers(
+					const RemoteApiType& remoteChainApi,
+					ParallelBlocksDownload::RemoteApis&& helperRemoteChainApis,
+					const CompareChainsResult& compareResult) const {
+				// request one full batch of blocks from each peer but at least enough blocks to resolve the fork
+				auto numPeers = static_cast<uint32_t>(1 + helperRemoteChainApis.size());
+				auto numBlocks = std::max<uint64_t>(compareResult.ForkDepth, numPeers * m_blocksFromOptions.NumBlocks);
+
+				CATAPULT_LOG(debug) << "downloading " << numBlocks << " blocks in parallel from " << numPeers << " peers";
+				auto pDownload = std::make_shared<ParallelBlocksDownload>(
+						remoteChainApi,
+						std::move(helperRemoteChainApis),
+						m_blocksFromOptions,
+						compareResult.CommonBlockHeight + Height(1),
+						static_cast<uint32_t>(numBlocks));
+				return ParallelChainBlocksFrom(pDownload, remoteChainApi.remotePublicKey(), m_pUnprocessedElements);
+			}
+
 		private:
 			std::shared_ptr<const api::ChainApi> m_pLocalChainApi;
+			RemoteChainApisSupplier m_helperRemoteChainApisSupplier;
 			CompareChainsOptions m_compareChainOptions;
 			api::BlocksFromOptions m_blocksFromOptions;
 			std::shared_ptr<UnprocessedElements> m_pUnprocessedElements;
@@ -313,7 +508,19 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
-		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(pLocalChainApi, config, blockRangeConsumer);
+		return CreateChainSynchronizer(pLocalChainApi, config, RemoteChainApisSupplier(), blockRangeConsumer);
+	}
+
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const RemoteChainApisSupplier& helperRemoteChainApisSupplier,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
+		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(
+				pLocalChainApi,
+				config,
+				helperRemoteChainApisSupplier,
+				blockRangeConsumer);
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
 }}
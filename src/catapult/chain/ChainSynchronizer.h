@@ -42,6 +42,9 @@ namespace catapult { namespace chain {
 			model::AnnotatedBlockRange&&,
 			const disruptor::ProcessingCompleteFunc&)>;
 
+	/// Function signature for supplying additional remote chain apis.
+	using RemoteChainApisSupplier = supplier<std::vector<std::shared_ptr<const api::RemoteChainApi>>>;
+
 	/// Configuration for customizing a chain synchronizer.
 	struct ChainSynchronizerConfiguration {
 		/// Maximum number of blocks per sync attempt.
@@ -60,4 +63,14 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
+
+	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config,
+	/// a supplier of additional peers (\a helperRemoteChainApisSupplier) and a block range consumer (\a blockRangeConsumer).
+	/// \note Blocks are downloaded in parallel from the synchronizing peer and all supplied peers. Blocks are only
+	///       forwarded to the consumer after they have been reassembled into a single contiguous range.
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const RemoteChainApisSupplier& helperRemoteChainApisSupplier,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
 }}
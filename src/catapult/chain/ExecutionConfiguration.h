@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/cache/PrefetchKeys.h"
 #include "catapult/model/NetworkInfo.h"
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/observers/ObserverTypes.h"
@@ -33,6 +34,7 @@ namespace catapult { namespace chain {
 		using ValidatorPointer = std::shared_ptr<const validators::stateful::AggregateNotificationValidator>;
 		using PublisherPointer = std::shared_ptr<const model::NotificationPublisher>;
 		using ResolverContextFactoryFunc = std::function<model::ResolverContext (const cache::ReadOnlyCatapultCache&)>;
+		using PrefetchKeysExtractorFunc = consumer<const model::Notification&, const model::ResolverContext&, cache::PrefetchKeys&>;
 
 	public:
 		/// Network info.
@@ -49,5 +51,9 @@ namespace catapult { namespace chain {
 
 		/// Resolver context factory.
 		ResolverContextFactoryFunc ResolverContextFactory;
+
+		/// Prefetch keys extractor (optional).
+		/// \note When set, state touched by entities is loaded ahead of their execution.
+		PrefetchKeysExtractorFunc PrefetchKeysExtractor;
 	};
 }}
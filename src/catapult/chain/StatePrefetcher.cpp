@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "StatePrefetcher.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+
+namespace catapult { namespace chain {
+
+	namespace {
+		using PrefetchKeysExtractorFunc = decltype(ExecutionConfiguration::PrefetchKeysExtractor);
+
+		class PrefetchKeysSubscriber : public model::NotificationSubscriber {
+		public:
+			PrefetchKeysSubscriber(
+					const PrefetchKeysExtractorFunc& extractor,
+					const model::ResolverContext& resolvers,
+					cache::PrefetchKeys& keys)
+					: m_extractor(extractor)
+					, m_resolvers(resolvers)
+					, m_keys(keys)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				m_extractor(notification, m_resolvers, m_keys);
+			}
+
+		private:
+			const PrefetchKeysExtractorFunc& m_extractor;
+			const model::ResolverContext& m_resolvers;
+			cache::PrefetchKeys& m_keys;
+		};
+
+		class DefaultStatePrefetcher {
+		public:
+			explicit DefaultStatePrefetcher(const ExecutionConfiguration& config) : m_config(config)
+			{}
+
+		public:
+			void operator()(const model::WeakEntityInfos& entityInfos, const cache::CatapultCacheDelta& cache) const {
+				if (!m_config.PrefetchKeysExtractor || entityInfos.empty())
+					return;
+
+				auto readOnlyCache = cache.toReadOnly();
+				auto resolverContext = m_config.ResolverContextFactory(readOnlyCache);
+
+				cache::PrefetchKeys keys;
+				PrefetchKeysSubscriber sub(m_config.PrefetchKeysExtractor, resolverContext, keys);
+				for (const auto& entityInfo : entityInfos)
+					m_config.pNotificationPublisher->publish(entityInfo, sub);
+
+				if (!keys.empty())
+					cache.prefetch(keys);
+			}
+
+		private:
+			ExecutionConfiguration m_config;
+		};
+	}
+
+	StatePrefetcher CreateStatePrefetcher(const ExecutionConfiguration& config) {
+		return DefaultStatePrefetcher(config);
+	}
+}}
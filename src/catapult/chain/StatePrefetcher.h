@@ -0,0 +1,35 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "ExecutionConfiguration.h"
+
+namespace catapult { namespace cache { class CatapultCacheDelta; } }
+
+namespace catapult { namespace chain {
+
+	/// Function signature for loading all state that will be accessed when executing a batch of entity infos
+	/// into a cache delta ahead of time.
+	using StatePrefetcher = consumer<const model::WeakEntityInfos&, const cache::CatapultCacheDelta&>;
+
+	/// Creates a state prefetcher around \a config.
+	/// \note The prefetcher is a no-op when \a config does not have a prefetch keys extractor.
+	StatePrefetcher CreateStatePrefetcher(const ExecutionConfiguration& config);
+}}
@@ -21,6 +21,7 @@
 #include "UtSynchronizer.h"
 #include "EntitiesSynchronizer.h"
 #include "catapult/api/RemoteTransactionApi.h"
+#include <atomic>
 
 namespace catapult { namespace chain {
 
@@ -54,6 +55,78 @@ namespace catapult { namespace chain {
 			ShortHashesSupplier m_shortHashesSupplier;
 			handlers::TransactionRangeHandler m_transactionRangeConsumer;
 		};
+
+		constexpr uint32_t Initial_Num_Differences = 1024;
+		constexpr uint32_t Min_Num_Differences = 32;
+		constexpr uint32_t Max_Num_Differences = 1u << 24;
+
+		class UtSketchTraits {
+		public:
+			using RemoteApiType = api::RemoteTransactionApi;
+			static constexpr auto Name = "unconfirmed transactions";
+
+		public:
+			explicit UtSketchTraits(
+					BlockFeeMultiplier minFeeMultiplier,
+					const ShortHashesSupplier& shortHashesSupplier,
+					const handlers::TransactionRangeHandler& transactionRangeConsumer)
+					: m_minFeeMultiplier(minFeeMultiplier)
+					, m_shortHashesSupplier(shortHashesSupplier)
+					, m_transactionRangeConsumer(transactionRangeConsumer)
+					, m_pEstimatedNumDifferences(std::make_shared<std::atomic<uint32_t>>(Initial_Num_Differences))
+			{}
+
+		public:
+			thread::future<model::TransactionRange> apiCall(const RemoteApiType& api) const {
+				auto pEstimatedNumDifferences = m_pEstimatedNumDifferences;
+				auto shortHashes = m_shortHashesSupplier();
+				auto numCells = utils::ShortHashSketch::CalculateCellCount(*pEstimatedNumDifferences);
+				if (numCells * sizeof(utils::ShortHashSketchCell) >= shortHashes.size() * sizeof(utils::ShortHash)) {
+					auto transactionsFuture = api.unconfirmedTransactions(m_minFeeMultiplier, std::move(shortHashes));
+					return transactionsFuture.then([pEstimatedNumDifferences](auto&& future) {
+						// the remote only returns its side of the difference, so use that as the next estimate
+						auto transactions = future.get();
+						SetEstimate(*pEstimatedNumDifferences, static_cast<uint32_t>(transactions.size()));
+						return transactions;
+					});
+				}
+
+				// only sketch distinct short hashes (like the remote)
+				utils::ShortHashSketch sketch(numCells);
+				sketch.insertDistinct(std::vector<utils::ShortHash>(shortHashes.cbegin(), shortHashes.cend()));
+
+				auto resultFuture = api.unconfirmedTransactions(m_minFeeMultiplier, std::move(sketch));
+				return resultFuture.then([pEstimatedNumDifferences](auto&& future) {
+					auto result = future.get();
+					if (!result.IsDecoded) {
+						// retry with a larger sketch next time
+						CATAPULT_LOG(debug) << "remote could not decode sketch for " << *pEstimatedNumDifferences << " differences";
+						SetEstimate(*pEstimatedNumDifferences, *pEstimatedNumDifferences);
+						return model::TransactionRange();
+					}
+
+					SetEstimate(*pEstimatedNumDifferences, result.NumDifferences);
+					return std::move(result.Transactions);
+				});
+			}
+
+			void consume(model::TransactionRange&& range, const Key& sourcePublicKey) const {
+				m_transactionRangeConsumer(model::AnnotatedTransactionRange(std::move(range), sourcePublicKey));
+			}
+
+		private:
+			static void SetEstimate(std::atomic<uint32_t>& estimatedNumDifferences, uint32_t numDifferences) {
+				// leave room for the difference to grow until the next request
+				auto estimate = 2 * std::min(Max_Num_Differences, numDifferences);
+				estimatedNumDifferences = std::min(Max_Num_Differences, std::max(Min_Num_Differences, estimate));
+			}
+
+		private:
+			BlockFeeMultiplier m_minFeeMultiplier;
+			ShortHashesSupplier m_shortHashesSupplier;
+			handlers::TransactionRangeHandler m_transactionRangeConsumer;
+			std::shared_ptr<std::atomic<uint32_t>> m_pEstimatedNumDifferences;
+		};
 	}
 
 	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
@@ -64,4 +137,13 @@ namespace catapult { namespace chain {
 		auto pSynchronizer = std::make_shared<EntitiesSynchronizer<UtTraits>>(std::move(traits));
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
+
+	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSketchSynchronizer(
+			BlockFeeMultiplier minFeeMultiplier,
+			const ShortHashesSupplier& shortHashesSupplier,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer) {
+		auto traits = UtSketchTraits(minFeeMultiplier, shortHashesSupplier, transactionRangeConsumer);
+		auto pSynchronizer = std::make_shared<EntitiesSynchronizer<UtSketchTraits>>(std::move(traits));
+		return CreateRemoteNodeSynchronizer(pSynchronizer);
+	}
 }}
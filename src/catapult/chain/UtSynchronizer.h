@@ -36,4 +36,13 @@ namespace catapult { namespace chain {
 			BlockFeeMultiplier minFeeMultiplier,
 			const ShortHashesSupplier& shortHashesSupplier,
 			const handlers::TransactionRangeHandler& transactionRangeConsumer);
+
+	/// Creates an unconfirmed transactions synchronizer around the specified short hashes supplier (\a shortHashesSupplier)
+	/// and transaction range consumer (\a transactionRangeConsumer) for transactions with fee multipliers at least \a minFeeMultiplier.
+	/// \note Short hashes are summarized in a sketch sized by the estimated difference from the remote node
+	///       unless sending all short hashes is cheaper.
+	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSketchSynchronizer(
+			BlockFeeMultiplier minFeeMultiplier,
+			const ShortHashesSupplier& shortHashesSupplier,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer);
 }}
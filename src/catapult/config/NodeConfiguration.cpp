@@ -40,12 +40,14 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(ShouldAllowAddressReuse);
 		LOAD_NODE_PROPERTY(ShouldUseSingleThreadPool);
 		LOAD_NODE_PROPERTY(ShouldUseCacheDatabaseStorage);
+		LOAD_NODE_PROPERTY(ShouldUsePackedBlockStorage);
 
 		LOAD_NODE_PROPERTY(ShouldEnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
 
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(MaxSyncDownloadPeers);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -56,6 +58,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(TransactionSelectionStrategy);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxResponseSize);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxSize);
+		LOAD_NODE_PROPERTY(ShouldUseTransactionSketchSync);
 
 		LOAD_NODE_PROPERTY(ConnectTimeout);
 		LOAD_NODE_PROPERTY(SyncTimeout);
@@ -68,6 +71,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(BlockElementTraceInterval);
 		LOAD_NODE_PROPERTY(TransactionDisruptorSize);
 		LOAD_NODE_PROPERTY(TransactionElementTraceInterval);
+		LOAD_NODE_PROPERTY(NumTransactionHashCalculatorThreads);
 
 		LOAD_NODE_PROPERTY(ShouldAbortWhenDispatcherIsFull);
 		LOAD_NODE_PROPERTY(ShouldAuditDispatcherInputs);
@@ -77,6 +81,17 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(IncomingSecurityModes);
 
 		LOAD_NODE_PROPERTY(MaxCacheDatabaseWriteBatchSize);
+		LOAD_NODE_PROPERTY(CacheDatabaseBlockCacheSize);
+		LOAD_NODE_PROPERTY(CacheDatabaseWriteBufferBudget);
+		LOAD_NODE_PROPERTY(MaxPatriciaTreeNodeCacheSize);
+		LOAD_NODE_PROPERTY(PatriciaTreeNodeCachePinnedLevels);
+		LOAD_NODE_PROPERTY(PatriciaTreeRetainedRoots);
+		LOAD_NODE_PROPERTY(MaxBlockStorageCacheSize);
+		LOAD_NODE_PROPERTY(BlockLoadPrefetchSize);
+		LOAD_NODE_PROPERTY(BlockLoadStateHashInterval);
+		LOAD_NODE_PROPERTY(NumStateStorageThreads);
+		LOAD_NODE_PROPERTY(StateStorageBufferSize);
+		LOAD_NODE_PROPERTY(StateChangeLogFlushInterval);
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
 
 #undef LOAD_NODE_PROPERTY
@@ -112,7 +127,7 @@ namespace catapult { namespace config {
 		auto extensionsPair = utils::ExtractSectionAsOrderedVector(bag, "extensions");
 		config.Extensions = extensionsPair.first;
 
-		utils::VerifyBagSizeLte(bag, 33 + 4 + 4 + 5 + extensionsPair.second);
+		utils::VerifyBagSizeLte(bag, 48 + 4 + 4 + 5 + extensionsPair.second);
 		return config;
 	}
 
@@ -48,6 +48,9 @@ namespace catapult { namespace config {
 		/// \c true if cache data should be saved in a database.
 		bool ShouldUseCacheDatabaseStorage;
 
+		/// \c true if blocks should be saved in packed, memory mapped segment files instead of one file per block.
+		bool ShouldUsePackedBlockStorage;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool ShouldEnableTransactionSpamThrottling;
 
@@ -60,6 +63,10 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of peers (including the synchronizing peer) that blocks are downloaded from in parallel.
+		/// \note A value of \c 1 disables parallel downloads.
+		uint32_t MaxSyncDownloadPeers;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -84,6 +91,10 @@ namespace catapult { namespace config {
 		/// Maximum size of the unconfirmed transactions cache.
 		uint32_t UnconfirmedTransactionsCacheMaxSize;
 
+		/// \c true if unconfirmed transactions should be pulled by exchanging short hash sketches instead of full short hash lists.
+		/// \note Requires peers to support sketch requests.
+		bool ShouldUseTransactionSketchSync;
+
 		/// Timeout for connecting to a peer.
 		utils::TimeSpan ConnectTimeout;
 
@@ -112,6 +123,9 @@ namespace catapult { namespace config {
 		/// Multiple of elements at which a transaction element should be traced through queue and completion.
 		uint32_t TransactionElementTraceInterval;
 
+		/// Number of worker threads concurrently calculating transaction hashes in the transaction dispatcher.
+		uint32_t NumTransactionHashCalculatorThreads;
+
 		/// \c true if the process should terminate when any dispatcher is full.
 		bool ShouldAbortWhenDispatcherIsFull;
 
@@ -130,6 +144,41 @@ namespace catapult { namespace config {
 		/// Maximum cache database write batch size.
 		utils::FileSize MaxCacheDatabaseWriteBatchSize;
 
+		/// Size of the block cache shared by all cache databases.
+		utils::FileSize CacheDatabaseBlockCacheSize;
+
+		/// Memtable budget shared by all cache databases.
+		utils::FileSize CacheDatabaseWriteBufferBudget;
+
+		/// Maximum number of decoded nodes cached in front of each patricia tree database column.
+		uint32_t MaxPatriciaTreeNodeCacheSize;
+
+		/// Number of top patricia tree levels pinned in each decoded node cache.
+		uint32_t PatriciaTreeNodeCachePinnedLevels;
+
+		/// Number of most recent patricia tree generations whose roots remain fully stored (\c 0 disables stale node removal).
+		uint32_t PatriciaTreeRetainedRoots;
+
+		/// Maximum size of block elements cached in memory by the block storage cache.
+		utils::FileSize MaxBlockStorageCacheSize;
+
+		/// Maximum number of blocks read ahead of execution when loading the block chain from storage.
+		/// \note \c 0 will disable prefetching.
+		uint32_t BlockLoadPrefetchSize;
+
+		/// Number of blocks executed between state hash calculations when loading the block chain from storage.
+		uint32_t BlockLoadStateHashInterval;
+
+		/// Number of worker threads concurrently loading and saving sub-cache state files.
+		uint32_t NumStateStorageThreads;
+
+		/// Size of the buffer used when reading or writing a sub-cache state file.
+		utils::FileSize StateStorageBufferSize;
+
+		/// Number of state changes buffered in memory before they are appended to the state change log.
+		/// \note \c 0 will disable the state change log.
+		uint32_t StateChangeLogFlushInterval;
+
 		/// Maximum number of nodes to track in memory.
 		uint32_t MaxTrackedNodes;
 
@@ -56,9 +56,11 @@ namespace catapult { namespace consumers {
 		public:
 			DefaultBlockChainProcessor(
 					const BlockHitPredicateFactory& blockHitPredicateFactory,
+					const chain::StatePrefetcher& statePrefetcher,
 					const chain::BatchEntityProcessor& batchEntityProcessor,
 					ReceiptValidationMode receiptValidationMode)
 					: m_blockHitPredicateFactory(blockHitPredicateFactory)
+					, m_statePrefetcher(statePrefetcher)
 					, m_batchEntityProcessor(batchEntityProcessor)
 					, m_receiptValidationMode(receiptValidationMode)
 			{}
@@ -88,26 +90,30 @@ namespace catapult { namespace consumers {
 					if (!CheckGenerationHash(element, *pParent, *pParentGenerationHash, blockHitPredicate))
 						return chain::Failure_Chain_Block_Not_Hit;
 
-					// 2. validate and observe block
+					// 2. load all state that will be accessed by the block
+					auto entityInfos = ExtractEntityInfos(element);
+					m_statePrefetcher(entityInfos, state.Cache);
+
+					// 3. validate and observe block
 					model::BlockStatementBuilder blockStatementBuilder;
 					auto blockDependentState = createBlockDependentObserverState(state, blockStatementBuilder);
 
 					const auto& block = element.Block;
-					auto result = m_batchEntityProcessor(block.Height, block.Timestamp, ExtractEntityInfos(element), blockDependentState);
+					auto result = m_batchEntityProcessor(block.Height, block.Timestamp, entityInfos, blockDependentState);
 					if (!IsValidationResultSuccess(result)) {
 						CATAPULT_LOG(warning) << "batch processing of block " << block.Height << " failed with " << result;
 						return result;
 					}
 
-					// 3. check state hash
+					// 4. check state hash
 					if (!CheckStateHash(element, state.Cache))
 						return chain::Failure_Chain_Block_Inconsistent_State_Hash;
 
-					// 4. check receipts hash
+					// 5. check receipts hash
 					if (!CheckReceiptsHash(element, blockStatementBuilder, m_receiptValidationMode))
 						return chain::Failure_Chain_Block_Inconsistent_Receipts_Hash;
 
-					// 5. set next parent
+					// 6. set next parent
 					pParent = &block;
 					pParentGenerationHash = &element.GenerationHash;
 				}
@@ -182,6 +188,7 @@ namespace catapult { namespace consumers {
 
 		private:
 			BlockHitPredicateFactory m_blockHitPredicateFactory;
+			chain::StatePrefetcher m_statePrefetcher;
 			chain::BatchEntityProcessor m_batchEntityProcessor;
 			ReceiptValidationMode m_receiptValidationMode;
 		};
@@ -189,8 +196,9 @@ namespace catapult { namespace consumers {
 
 	BlockChainProcessor CreateBlockChainProcessor(
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
+			const chain::StatePrefetcher& statePrefetcher,
 			const chain::BatchEntityProcessor& batchEntityProcessor,
 			ReceiptValidationMode receiptValidationMode) {
-		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode);
+		return DefaultBlockChainProcessor(blockHitPredicateFactory, statePrefetcher, batchEntityProcessor, receiptValidationMode);
 	}
 }}
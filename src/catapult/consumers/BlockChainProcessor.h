@@ -20,6 +20,7 @@
 
 #pragma once
 #include "catapult/chain/BatchEntityProcessor.h"
+#include "catapult/chain/StatePrefetcher.h"
 #include "catapult/disruptor/DisruptorElement.h"
 #include "catapult/model/WeakEntityInfo.h"
 #include <functional>
@@ -76,10 +77,11 @@ namespace catapult { namespace consumers {
 		Enabled
 	};
 
-	/// Creates a block chain processor around the specified block hit predicate factory (\a blockHitPredicateFactory)
-	/// and batch entity processor (\a batchEntityProcessor) with \a receiptValidationMode.
+	/// Creates a block chain processor around the specified block hit predicate factory (\a blockHitPredicateFactory),
+	/// state prefetcher (\a statePrefetcher) and batch entity processor (\a batchEntityProcessor) with \a receiptValidationMode.
 	BlockChainProcessor CreateBlockChainProcessor(
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
+			const chain::StatePrefetcher& statePrefetcher,
 			const chain::BatchEntityProcessor& batchEntityProcessor,
 			ReceiptValidationMode receiptValidationMode);
 }}
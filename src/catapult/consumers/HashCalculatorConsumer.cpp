@@ -28,6 +28,26 @@
 namespace catapult { namespace consumers {
 
 	namespace {
+		template<typename TTransactionElements>
+		void UpdateHashes(const model::TransactionRegistry& transactionRegistry, TTransactionElements& transactionElements) {
+			// calculate all entity hashes together, which is faster than calculating them one at a time
+			std::vector<const model::Transaction*> transactions;
+			transactions.reserve(transactionElements.size());
+			for (const auto& transactionElement : transactionElements)
+				transactions.push_back(&transactionElement.Transaction);
+
+			auto entityHashes = model::CalculateHashes(transactionRegistry, transactions);
+
+			auto i = 0u;
+			for (auto& transactionElement : transactionElements) {
+				transactionElement.EntityHash = entityHashes[i++];
+				transactionElement.MerkleComponentHash = model::CalculateMerkleComponentHash(
+						transactionElement.Transaction,
+						transactionElement.EntityHash,
+						transactionRegistry);
+			}
+		}
+
 		class BlockHashCalculatorConsumer {
 		public:
 			explicit BlockHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry)
@@ -42,14 +62,14 @@ namespace catapult { namespace consumers {
 				for (auto& element : elements) {
 					// note that disruptor input elements have been extracted from a packet (or created within this
 					// process), so their sizes have already been validated
-					crypto::MerkleHashBuilder transactionsHashBuilder;
-					for (const auto& transaction : element.Block.Transactions()) {
-						model::TransactionElement transactionElement(transaction);
-						model::UpdateHashes(m_transactionRegistry, transactionElement);
-						element.Transactions.push_back(transactionElement);
+					for (const auto& transaction : element.Block.Transactions())
+						element.Transactions.push_back(model::TransactionElement(transaction));
+
+					UpdateHashes(m_transactionRegistry, element.Transactions);
 
+					crypto::MerkleHashBuilder transactionsHashBuilder(element.Transactions.size());
+					for (const auto& transactionElement : element.Transactions)
 						transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
-					}
 
 					Hash256 transactionsHash;
 					transactionsHashBuilder.final(transactionsHash);
@@ -83,8 +103,7 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
-				for (auto& element : elements)
-					model::UpdateHashes(m_transactionRegistry, element);
+				UpdateHashes(m_transactionRegistry, elements);
 
 				return Continue();
 			}
@@ -20,7 +20,10 @@
 
 #include "Hashes.h"
 #include "KeccakHash.h"
+#include "KeccakMultiBuffer.h"
 #include "catapult/utils/Casting.h"
+#include <algorithm>
+#include <vector>
 
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -96,6 +99,105 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region multi-buffer sha3
+
+	namespace {
+		constexpr size_t Sha3_256_Block_Size = 136;
+
+		HashLanes DetectMaxSupportedHashLanes() {
+			if (detail::IsSha3_256_X8Supported())
+				return HashLanes::Eight;
+
+			if (detail::IsSha3_256_X4Supported())
+				return HashLanes::Four;
+
+			return HashLanes::One;
+		}
+
+		void Sha3_256_Single(const RawBuffer* pDataBuffers, size_t numBuffers, Hash256& hash) {
+			Sha3_256_Builder builder;
+			for (auto i = 0u; i < numBuffers; ++i)
+				builder.update(pDataBuffers[i]);
+
+			builder.final(hash);
+		}
+
+		template<size_t Num_Lanes, typename TLanesHasher>
+		void Sha3_256_Lanes(
+				const RawBuffer* pDataBuffers,
+				size_t numBuffersPerMessage,
+				size_t count,
+				Hash256* pHashes,
+				TLanesHasher lanesHasher) {
+			// all lanes absorb the same number of blocks, so hash messages with similar sizes together
+			std::vector<std::pair<size_t, size_t>> blockCountIndexPairs;
+			blockCountIndexPairs.reserve(count);
+			for (auto i = 0u; i < count; ++i) {
+				size_t messageSize = 0;
+				for (auto j = 0u; j < numBuffersPerMessage; ++j)
+					messageSize += pDataBuffers[i * numBuffersPerMessage + j].Size;
+
+				blockCountIndexPairs.emplace_back(messageSize / Sha3_256_Block_Size, i);
+			}
+
+			std::sort(blockCountIndexPairs.begin(), blockCountIndexPairs.end());
+
+			Hash256 unusedHash;
+			detail::KeccakLaneMessage messages[Num_Lanes];
+			for (auto i = 0u; i < count; i += Num_Lanes) {
+				auto numMessages = std::min<size_t>(Num_Lanes, count - i);
+				if (1 == numMessages) {
+					auto index = blockCountIndexPairs[i].second;
+					Sha3_256_Single(pDataBuffers + index * numBuffersPerMessage, numBuffersPerMessage, pHashes[index]);
+					break;
+				}
+
+				// fill any unused lanes with empty messages
+				for (auto lane = 0u; lane < Num_Lanes; ++lane) {
+					if (lane < numMessages) {
+						auto index = blockCountIndexPairs[i + lane].second;
+						messages[lane] = { pDataBuffers + index * numBuffersPerMessage, numBuffersPerMessage, pHashes[index].data() };
+					} else {
+						messages[lane] = { nullptr, 0, unusedHash.data() };
+					}
+				}
+
+				lanesHasher(messages);
+			}
+		}
+	}
+
+	HashLanes GetMaxSupportedHashLanes() noexcept {
+		static const auto Max_Supported_Hash_Lanes = DetectMaxSupportedHashLanes();
+		return Max_Supported_Hash_Lanes;
+	}
+
+	void Sha3_256_Multi(const RawBuffer* pDataBuffers, size_t numBuffersPerMessage, size_t count, Hash256* pHashes) noexcept {
+		Sha3_256_Multi(pDataBuffers, numBuffersPerMessage, count, pHashes, HashLanes::Eight);
+	}
+
+	void Sha3_256_Multi(
+			const RawBuffer* pDataBuffers,
+			size_t numBuffersPerMessage,
+			size_t count,
+			Hash256* pHashes,
+			HashLanes maxLanes) noexcept {
+		auto lanes = std::min(maxLanes, GetMaxSupportedHashLanes());
+		switch (lanes) {
+		case HashLanes::Eight:
+			return Sha3_256_Lanes<8>(pDataBuffers, numBuffersPerMessage, count, pHashes, detail::Sha3_256_X8);
+
+		case HashLanes::Four:
+			return Sha3_256_Lanes<4>(pDataBuffers, numBuffersPerMessage, count, pHashes, detail::Sha3_256_X4);
+
+		default:
+			for (auto i = 0u; i < count; ++i)
+				Sha3_256_Single(pDataBuffers + i * numBuffersPerMessage, numBuffersPerMessage, pHashes[i]);
+		}
+	}
+
+	// endregion
+
 	// region sha3 / keccak builders
 
 	namespace {
@@ -48,6 +48,39 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region multi-buffer sha3
+
+	/// Number of messages hashed in parallel by multi-buffer hash functions.
+	enum class HashLanes : uint8_t {
+		/// Messages are hashed one at a time.
+		One = 1,
+
+		/// Four messages are hashed in parallel (AVX2).
+		Four = 4,
+
+		/// Eight messages are hashed in parallel (AVX-512).
+		Eight = 8
+	};
+
+	/// Gets the maximum number of hash lanes supported by the current cpu.
+	HashLanes GetMaxSupportedHashLanes() noexcept;
+
+	/// Calculates the 256-bit SHA3 hashes of \a count messages into \a pHashes, where each message is the concatenation of
+	/// \a numBuffersPerMessage consecutive buffers pointed to by \a pDataBuffers.
+	/// \note Messages are hashed in parallel using the widest lanes supported by the cpu.
+	void Sha3_256_Multi(const RawBuffer* pDataBuffers, size_t numBuffersPerMessage, size_t count, Hash256* pHashes) noexcept;
+
+	/// Calculates the 256-bit SHA3 hashes of \a count messages into \a pHashes using at most \a maxLanes lanes,
+	/// where each message is the concatenation of \a numBuffersPerMessage consecutive buffers pointed to by \a pDataBuffers.
+	void Sha3_256_Multi(
+			const RawBuffer* pDataBuffers,
+			size_t numBuffersPerMessage,
+			size_t count,
+			Hash256* pHashes,
+			HashLanes maxLanes) noexcept;
+
+	// endregion
+
 	// region sha3 / keccak builders
 
 	/// Use with KeccakBuilder to generate SHA3 hashes.
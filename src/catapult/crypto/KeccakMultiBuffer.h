@@ -0,0 +1,57 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+
+namespace catapult { namespace crypto { namespace detail {
+
+	// region lane message
+
+	/// Single message hashed by one lane of a multi-buffer keccak permutation.
+	struct KeccakLaneMessage {
+		/// Pointer to the buffers that are concatenated to form the message.
+		const RawBuffer* pBuffers;
+
+		/// Number of buffers.
+		size_t NumBuffers;
+
+		/// Pointer to the (32 byte) output hash.
+		uint8_t* pHash;
+	};
+
+	// endregion
+
+	// region simd entry points
+
+	/// Returns \c true if four lane (AVX2) multi-buffer SHA3 hashing is supported by the current cpu.
+	bool IsSha3_256_X4Supported() noexcept;
+
+	/// Calculates the 256-bit SHA3 hashes of the four messages pointed to by \a pMessages.
+	void Sha3_256_X4(const KeccakLaneMessage* pMessages) noexcept;
+
+	/// Returns \c true if eight lane (AVX-512) multi-buffer SHA3 hashing is supported by the current cpu.
+	bool IsSha3_256_X8Supported() noexcept;
+
+	/// Calculates the 256-bit SHA3 hashes of the eight messages pointed to by \a pMessages.
+	void Sha3_256_X8(const KeccakLaneMessage* pMessages) noexcept;
+
+	// endregion
+}}}
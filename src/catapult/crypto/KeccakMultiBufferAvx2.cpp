@@ -0,0 +1,91 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "KeccakMultiBufferLanes.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace catapult { namespace crypto { namespace detail {
+
+#ifdef __AVX2__
+
+	namespace {
+		struct Avx2Lanes {
+			using Vector = __m256i;
+
+			static constexpr size_t Count = 4;
+
+			static Vector Zero() {
+				return _mm256_setzero_si256();
+			}
+
+			static Vector Broadcast(uint64_t value) {
+				return _mm256_set1_epi64x(static_cast<long long>(value));
+			}
+
+			static Vector Load(const uint64_t* pWords) {
+				return _mm256_load_si256(reinterpret_cast<const __m256i*>(pWords));
+			}
+
+			static void Store(uint64_t* pWords, Vector vector) {
+				_mm256_store_si256(reinterpret_cast<__m256i*>(pWords), vector);
+			}
+
+			static Vector Xor(Vector lhs, Vector rhs) {
+				return _mm256_xor_si256(lhs, rhs);
+			}
+
+			static Vector XorAndNot(Vector a, Vector b, Vector c) {
+				// a ^ (~b & c)
+				return _mm256_xor_si256(a, _mm256_andnot_si256(b, c));
+			}
+
+			static Vector Rotl(Vector vector, unsigned count) {
+				if (0 == count)
+					return vector;
+
+				auto left = _mm256_sll_epi64(vector, _mm_cvtsi32_si128(static_cast<int>(count)));
+				auto right = _mm256_srl_epi64(vector, _mm_cvtsi32_si128(static_cast<int>(64 - count)));
+				return _mm256_or_si256(left, right);
+			}
+		};
+	}
+
+	bool IsSha3_256_X4Supported() noexcept {
+		return __builtin_cpu_supports("avx2");
+	}
+
+	void Sha3_256_X4(const KeccakLaneMessage* pMessages) noexcept {
+		Sha3_256_Lanes<Avx2Lanes>(pMessages);
+	}
+
+#else
+
+	bool IsSha3_256_X4Supported() noexcept {
+		return false;
+	}
+
+	void Sha3_256_X4(const KeccakLaneMessage*) noexcept
+	{}
+
+#endif
+}}}
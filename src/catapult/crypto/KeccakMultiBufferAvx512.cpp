@@ -0,0 +1,91 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "KeccakMultiBufferLanes.h"
+
+#ifdef __AVX512F__
+#include <immintrin.h>
+
+// some avx512 intrinsics use _mm512_undefined_epi32, which triggers false uninitialized warnings in gcc
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+#endif
+
+namespace catapult { namespace crypto { namespace detail {
+
+#ifdef __AVX512F__
+
+	namespace {
+		struct Avx512Lanes {
+			using Vector = __m512i;
+
+			static constexpr size_t Count = 8;
+
+			static Vector Zero() {
+				return _mm512_setzero_si512();
+			}
+
+			static Vector Broadcast(uint64_t value) {
+				return _mm512_set1_epi64(static_cast<long long>(value));
+			}
+
+			static Vector Load(const uint64_t* pWords) {
+				return _mm512_load_si512(pWords);
+			}
+
+			static void Store(uint64_t* pWords, Vector vector) {
+				_mm512_store_si512(pWords, vector);
+			}
+
+			static Vector Xor(Vector lhs, Vector rhs) {
+				return _mm512_xor_si512(lhs, rhs);
+			}
+
+			static Vector XorAndNot(Vector a, Vector b, Vector c) {
+				// a ^ (~b & c) as a single ternary logic instruction
+				return _mm512_ternarylogic_epi64(a, b, c, 0xD2);
+			}
+
+			static Vector Rotl(Vector vector, unsigned count) {
+				return _mm512_rolv_epi64(vector, _mm512_set1_epi64(count));
+			}
+		};
+	}
+
+	bool IsSha3_256_X8Supported() noexcept {
+		return __builtin_cpu_supports("avx512f");
+	}
+
+	void Sha3_256_X8(const KeccakLaneMessage* pMessages) noexcept {
+		Sha3_256_Lanes<Avx512Lanes>(pMessages);
+	}
+
+#else
+
+	bool IsSha3_256_X8Supported() noexcept {
+		return false;
+	}
+
+	void Sha3_256_X8(const KeccakLaneMessage*) noexcept
+	{}
+
+#endif
+}}}
@@ -0,0 +1,204 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "KeccakMultiBuffer.h"
+#include <cstring>
+
+// notice that this header is included by translation units compiled with instruction set specific flags,
+// so it must not instantiate any functions with external linkage (e.g. std algorithms) that could be shared with other ones
+
+namespace catapult { namespace crypto { namespace detail {
+
+	namespace {
+		constexpr size_t Sha3_256_Rate = 136;
+		constexpr size_t Sha3_256_Rate_Words = Sha3_256_Rate / sizeof(uint64_t);
+
+		constexpr uint64_t Keccak_Round_Constants[] = {
+			0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL, 0x8000000080008000ULL,
+			0x000000000000808BULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+			0x000000000000008AULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+			0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+			0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800AULL, 0x800000008000000AULL,
+			0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+		};
+
+		// rotation offsets indexed by state word (x + 5 * y)
+		constexpr unsigned Keccak_Rho_Offsets[] = {
+			0, 1, 62, 28, 27,
+			36, 44, 6, 55, 20,
+			3, 10, 43, 25, 39,
+			41, 45, 15, 21, 8,
+			18, 2, 61, 56, 14
+		};
+
+		/// Applies the keccak-f[1600] permutation to all lanes of \a state.
+		template<typename TLanes>
+		void KeccakF1600(typename TLanes::Vector* state) {
+			using Vector = typename TLanes::Vector;
+			Vector c[5];
+			Vector b[25];
+			for (auto round = 0u; round < 24; ++round) {
+				// theta
+				for (auto x = 0u; x < 5; ++x)
+					c[x] = TLanes::Xor(TLanes::Xor(state[x], state[x + 5]), TLanes::Xor(TLanes::Xor(state[x + 10], state[x + 15]), state[x + 20]));
+
+				for (auto x = 0u; x < 5; ++x) {
+					auto d = TLanes::Xor(c[(x + 4) % 5], TLanes::Rotl(c[(x + 1) % 5], 1));
+					for (auto y = 0u; y < 25; y += 5)
+						state[y + x] = TLanes::Xor(state[y + x], d);
+				}
+
+				// rho and pi
+				for (auto x = 0u; x < 5; ++x) {
+					for (auto y = 0u; y < 5; ++y)
+						b[y + 5 * ((2 * x + 3 * y) % 5)] = TLanes::Rotl(state[x + 5 * y], Keccak_Rho_Offsets[x + 5 * y]);
+				}
+
+				// chi
+				for (auto y = 0u; y < 25; y += 5) {
+					for (auto x = 0u; x < 5; ++x)
+						state[y + x] = TLanes::XorAndNot(b[y + x], b[y + (x + 1) % 5], b[y + (x + 2) % 5]);
+				}
+
+				// iota
+				state[0] = TLanes::Xor(state[0], TLanes::Broadcast(Keccak_Round_Constants[round]));
+			}
+		}
+
+		/// Sequentially reads the buffers composing a lane message.
+		class LaneMessageReader {
+		public:
+			LaneMessageReader() : m_pBuffers(nullptr), m_bufferIndex(0), m_bufferOffset(0)
+			{}
+
+		public:
+			void reset(const KeccakLaneMessage& message) {
+				m_pBuffers = message.pBuffers;
+				m_bufferIndex = 0;
+				m_bufferOffset = 0;
+			}
+
+			void read(uint8_t* pDestination, size_t size) {
+				while (0 != size) {
+					const auto& buffer = m_pBuffers[m_bufferIndex];
+					auto numAvailableBytes = buffer.Size - m_bufferOffset;
+					auto numBytes = numAvailableBytes < size ? numAvailableBytes : size;
+					if (0 != numBytes)
+						std::memcpy(pDestination, buffer.pData + m_bufferOffset, numBytes);
+
+					pDestination += numBytes;
+					size -= numBytes;
+					m_bufferOffset += numBytes;
+					if (m_bufferOffset == buffer.Size) {
+						++m_bufferIndex;
+						m_bufferOffset = 0;
+					}
+				}
+			}
+
+		private:
+			const RawBuffer* m_pBuffers;
+			size_t m_bufferIndex;
+			size_t m_bufferOffset;
+		};
+
+		size_t CalculateMessageSize(const KeccakLaneMessage& message) {
+			size_t size = 0;
+			for (auto i = 0u; i < message.NumBuffers; ++i)
+				size += message.pBuffers[i].Size;
+
+			return size;
+		}
+
+		/// Calculates the 256-bit SHA3 hashes of TLanes::Count messages pointed to by \a pMessages in parallel.
+		/// \note Messages are processed in lockstep, so lanes that finish early are idle until the longest message is hashed.
+		template<typename TLanes>
+		void Sha3_256_Lanes(const KeccakLaneMessage* pMessages) {
+			constexpr auto Num_Lanes = TLanes::Count;
+			LaneMessageReader readers[Num_Lanes];
+			size_t remainingSizes[Num_Lanes];
+			size_t numBlocks[Num_Lanes];
+			size_t maxNumBlocks = 0;
+			for (auto lane = 0u; lane < Num_Lanes; ++lane) {
+				readers[lane].reset(pMessages[lane]);
+				remainingSizes[lane] = CalculateMessageSize(pMessages[lane]);
+
+				// the last block always contains the padding
+				numBlocks[lane] = remainingSizes[lane] / Sha3_256_Rate + 1;
+				if (numBlocks[lane] > maxNumBlocks)
+					maxNumBlocks = numBlocks[lane];
+			}
+
+			typename TLanes::Vector state[25];
+			for (auto& word : state)
+				word = TLanes::Zero();
+
+			uint8_t blocks[Num_Lanes][Sha3_256_Rate];
+			std::memset(blocks, 0, sizeof(blocks));
+
+			alignas(64) uint64_t laneWords[Num_Lanes];
+			for (auto blockIndex = 0u; blockIndex < maxNumBlocks; ++blockIndex) {
+				auto hasFinishedLane = false;
+				for (auto lane = 0u; lane < Num_Lanes; ++lane) {
+					// finished lanes are absorbing stale blocks, but their results have already been extracted
+					if (blockIndex >= numBlocks[lane])
+						continue;
+
+					auto* pBlock = blocks[lane];
+					if (blockIndex + 1 < numBlocks[lane]) {
+						readers[lane].read(pBlock, Sha3_256_Rate);
+						remainingSizes[lane] -= Sha3_256_Rate;
+						continue;
+					}
+
+					// pad the last block (sha3 domain separation and pad10*1)
+					auto remainingSize = remainingSizes[lane];
+					readers[lane].read(pBlock, remainingSize);
+					std::memset(pBlock + remainingSize, 0, Sha3_256_Rate - remainingSize);
+					pBlock[remainingSize] ^= 0x06;
+					pBlock[Sha3_256_Rate - 1] ^= 0x80;
+					hasFinishedLane = true;
+				}
+
+				for (auto i = 0u; i < Sha3_256_Rate_Words; ++i) {
+					for (auto lane = 0u; lane < Num_Lanes; ++lane)
+						std::memcpy(&laneWords[lane], blocks[lane] + i * sizeof(uint64_t), sizeof(uint64_t));
+
+					state[i] = TLanes::Xor(state[i], TLanes::Load(laneWords));
+				}
+
+				KeccakF1600<TLanes>(state);
+
+				if (!hasFinishedLane)
+					continue;
+
+				// extract the hashes of all lanes that absorbed their last block
+				for (auto i = 0u; i < Hash256_Size / sizeof(uint64_t); ++i) {
+					TLanes::Store(laneWords, state[i]);
+					for (auto lane = 0u; lane < Num_Lanes; ++lane) {
+						if (blockIndex + 1 == numBlocks[lane])
+							std::memcpy(pMessages[lane].pHash + i * sizeof(uint64_t), &laneWords[lane], sizeof(uint64_t));
+					}
+				}
+			}
+		}
+	}
+}}}
@@ -21,6 +21,7 @@
 #include "MerkleHashBuilder.h"
 #include "Hashes.h"
 #include "catapult/functions.h"
+#include <algorithm>
 
 namespace catapult { namespace crypto {
 
@@ -35,30 +36,36 @@ namespace catapult { namespace crypto {
 			// build the merkle tree
 			auto numRemainingHashes = hashes.size();
 			hashConsumer(hashes.data(), hashes.size());
+
+			std::vector<RawBuffer> pairBuffers;
+			std::vector<Hash256> levelHashes;
 			while (numRemainingHashes > 1) {
 				// merkle tree needs padding in case of an odd number of hashes, need to do before the next round of hashes is
 				// pushed into the vector because nodes with same depth should be consecutive entries in the vector
-				if (1 == numRemainingHashes % 2)
+				if (1 == numRemainingHashes % 2) {
 					hashConsumer(&hashes[numRemainingHashes - 1], 1);
 
-				auto i = 0u;
-				for (; i < numRemainingHashes; i += 2) {
-					if (i + 1 < numRemainingHashes) {
-						Sha3_256({ hashes[i].data(), 2 * Hash256_Size }, hashes[i / 2]);
-						hashConsumer(&hashes[i / 2], 1);
-						continue;
-					}
-
 					// if there is an odd number of hashes, duplicate the last one
-					Sha3_256_Builder builder;
-					builder.update(hashes[i]);
-					builder.update(hashes[i]);
-					builder.final(hashes[i / 2]);
-					hashConsumer(&hashes[i / 2], 1);
+					if (hashes.size() == numRemainingHashes)
+						hashes.push_back(hashes[numRemainingHashes - 1]);
+					else
+						hashes[numRemainingHashes] = hashes[numRemainingHashes - 1];
+
 					++numRemainingHashes;
 				}
 
-				numRemainingHashes /= 2;
+				// hash all (independent) pairs of the current level together
+				auto numLevelHashes = numRemainingHashes / 2;
+				pairBuffers.clear();
+				for (auto i = 0u; i < numLevelHashes; ++i)
+					pairBuffers.push_back({ hashes[2 * i].data(), 2 * Hash256_Size });
+
+				levelHashes.resize(numLevelHashes);
+				Sha3_256_Multi(pairBuffers.data(), 1, numLevelHashes, levelHashes.data());
+
+				std::copy(levelHashes.cbegin(), levelHashes.cend(), hashes.begin());
+				hashConsumer(hashes.data(), numLevelHashes);
+				numRemainingHashes = numLevelHashes;
 			}
 
 			return hashes[0];
@@ -0,0 +1,106 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SharedKey.h"
+#include "CryptoUtils.h"
+#include "KeyPair.h"
+#include "SecureZero.h"
+#include <ref10/crypto_verify_32.h>
+
+extern "C" {
+#include <ref10/ge.h>
+}
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		constexpr Key Identity_Encoding{ { 1 } };
+
+		void ConditionalSwap(ge_p3& lhs, ge_p3& rhs, unsigned int swap) {
+			auto temp = lhs;
+			fe_cmov(lhs.X, rhs.X, swap);
+			fe_cmov(lhs.Y, rhs.Y, swap);
+			fe_cmov(lhs.Z, rhs.Z, swap);
+			fe_cmov(lhs.T, rhs.T, swap);
+
+			fe_cmov(rhs.X, temp.X, swap);
+			fe_cmov(rhs.Y, temp.Y, swap);
+			fe_cmov(rhs.Z, temp.Z, swap);
+			fe_cmov(rhs.T, temp.T, swap);
+		}
+
+		void Add(ge_p3& result, const ge_p3& lhs, const ge_p3& rhs) {
+			ge_cached cached;
+			ge_p1p1 sum;
+			ge_p3_to_cached(&cached, &rhs);
+			ge_add(&sum, &lhs, &cached);
+			ge_p1p1_to_p3(&result, &sum);
+		}
+
+		void Double(ge_p3& result, const ge_p3& point) {
+			ge_p1p1 sum;
+			ge_p3_dbl(&sum, &point);
+			ge_p1p1_to_p3(&result, &sum);
+		}
+
+		// montgomery ladder, which performs the same operations independent of the (secret) scalar bits
+		void ScalarMultiply(ge_p3& result, const uint8_t* scalar, const ge_p3& point) {
+			ge_p3 r0;
+			ge_p3_0(&r0);
+			auto r1 = point;
+
+			unsigned int swap = 0;
+			for (auto i = 255; i > 0; --i) {
+				auto bit = static_cast<unsigned int>((scalar[(i - 1) / 8] >> ((i - 1) & 7)) & 1);
+				swap ^= bit;
+				ConditionalSwap(r0, r1, swap);
+				swap = bit;
+
+				// invariant: r1 - r0 == point
+				Add(r1, r0, r1);
+				Double(r0, r0);
+			}
+
+			ConditionalSwap(r0, r1, swap);
+			result = r0;
+		}
+	}
+
+	bool TryDeriveSharedKey(const KeyPair& keyPair, const Key& otherPublicKey, Key& sharedKey) {
+		// decoding yields -A, which is fine because both parties end up with the negated shared point
+		ge_p3 otherPoint;
+		if (0 != ge_frombytes_negate_vartime(&otherPoint, otherPublicKey.data()))
+			return false;
+
+		// use the same clamped scalar as the one used for signing, which clears small order components
+		Hash512 privateHash;
+		HashPrivateKey(keyPair.privateKey(), privateHash);
+		privateHash[0] &= 0xF8;
+		privateHash[31] &= 0x7F;
+		privateHash[31] |= 0x40;
+
+		ge_p3 sharedPoint;
+		ScalarMultiply(sharedPoint, privateHash.data(), otherPoint);
+		SecureZero(privateHash.data(), privateHash.size());
+
+		ge_p3_tobytes(sharedKey.data(), &sharedPoint);
+		return 0 != crypto_verify_32(sharedKey.data(), Identity_Encoding.data());
+	}
+}}
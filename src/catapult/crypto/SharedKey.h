@@ -0,0 +1,32 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+
+namespace catapult { namespace crypto { class KeyPair; } }
+
+namespace catapult { namespace crypto {
+
+	/// Derives a shared key (\a sharedKey) between \a keyPair and the owner of \a otherPublicKey (diffie-hellman over ed25519).
+	/// Returns \c false if \a otherPublicKey is not a valid point or the derived key is degenerate.
+	/// \note Both parties derive the same key, i.e. \c Derive(a, B) == \c Derive(b, A).
+	bool TryDeriveSharedKey(const KeyPair& keyPair, const Key& otherPublicKey, Key& sharedKey);
+}}
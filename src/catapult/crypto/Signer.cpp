@@ -22,7 +22,9 @@
 #include "CryptoUtils.h"
 #include "Hashes.h"
 #include "catapult/exceptions.h"
+#include <algorithm>
 #include <cstring>
+#include <random>
 #include <ref10/crypto_verify_32.h>
 
 extern "C" {
@@ -174,4 +176,323 @@ namespace catapult { namespace crypto {
 		ge_tobytes(checkr, &R);
 		return 0 == crypto_verify_32(checkr, encodedR);
 	}
+
+	namespace {
+		using Scalar = std::array<uint8_t, Encoded_Size>;
+
+		/// Maximum number of signatures verified together in a single batch.
+		constexpr size_t Max_Batch_Size = 128;
+
+		/// Number of bytes of each random batch coefficient.
+		constexpr size_t Coefficient_Size = 16;
+
+		/// Encoded identity element.
+		constexpr Scalar Identity_Encoding{ { 1 } };
+
+		// region point encoding checks
+
+		bool IsCanonicalPointEncoding(const uint8_t* encoded) {
+			// y must be less than p = 2^255 - 19
+			if (0x7F != (encoded[Encoded_Size - 1] & 0x7F) || encoded[0] < 0xED)
+				return true;
+
+			return !std::all_of(encoded + 1, encoded + Encoded_Size - 1, [](auto byte) { return 0xFF == byte; });
+		}
+
+		bool HasSmallOrder(const uint8_t* encoded) {
+			// encodings (ignoring the sign bit) of points with small order, including non-canonical ones
+			// (this also covers all encodings of points with x == 0)
+			static const Scalar Small_Order_Encodings[] = {
+				{ { 0x00 } },
+				{ { 0x01 } },
+				{ {
+					0x26, 0xE8, 0x95, 0x8F, 0xC2, 0xB2, 0x27, 0xB0, 0x45, 0xC3, 0xF4, 0x89, 0xF2, 0xEF, 0x98, 0xF0,
+					0xD5, 0xDF, 0xAC, 0x05, 0xD3, 0xC6, 0x33, 0x39, 0xB1, 0x38, 0x02, 0x88, 0x6D, 0x53, 0xFC, 0x05
+				} },
+				{ {
+					0xC7, 0x17, 0x6A, 0x70, 0x3D, 0x4D, 0xD8, 0x4F, 0xBA, 0x3C, 0x0B, 0x76, 0x0D, 0x10, 0x67, 0x0F,
+					0x2A, 0x20, 0x53, 0xFA, 0x2C, 0x39, 0xCC, 0xC6, 0x4E, 0xC7, 0xFD, 0x77, 0x92, 0xAC, 0x03, 0x7A
+				} },
+				{ {
+					0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+					0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F
+				} },
+				{ {
+					0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+					0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F
+				} },
+				{ {
+					0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+					0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F
+				} }
+			};
+
+			for (const auto& smallOrderEncoding : Small_Order_Encodings) {
+				if (0 == std::memcmp(encoded, smallOrderEncoding.data(), Encoded_Size - 1)
+						&& (encoded[Encoded_Size - 1] & 0x7F) == smallOrderEncoding[Encoded_Size - 1])
+					return true;
+			}
+
+			return false;
+		}
+
+		/// Returns \c true if \a signatureInput can be part of a batch.
+		/// Signatures that fail the cheap checks or have unusual (non-canonical or small order) points are verified individually,
+		/// which guarantees that the batch and the individual verification results agree for them.
+		bool IsBatchable(const SignatureInput& signatureInput) {
+			const uint8_t* encodedR = signatureInput.Signature.data();
+			const uint8_t* encodedS = signatureInput.Signature.data() + Encoded_Size;
+			const uint8_t* encodedA = signatureInput.Signer.data();
+			return IsCanonicalS(encodedS)
+					&& IsCanonicalPointEncoding(encodedR) && !HasSmallOrder(encodedR)
+					&& IsCanonicalPointEncoding(encodedA) && !HasSmallOrder(encodedA);
+		}
+
+		// endregion
+
+		// region multi-scalar multiplication
+
+		class PointAccumulator {
+		public:
+			PointAccumulator() : m_isEmpty(true)
+			{}
+
+		public:
+			bool isEmpty() const {
+				return m_isEmpty;
+			}
+
+			const ge_p3& point() const {
+				return m_point;
+			}
+
+		public:
+			void add(const ge_p3& point) {
+				if (m_isEmpty) {
+					m_point = point;
+					m_isEmpty = false;
+					return;
+				}
+
+				ge_cached cached;
+				ge_p3_to_cached(&cached, &point);
+
+				ge_p1p1 sum;
+				ge_add(&sum, &m_point, &cached);
+				ge_p1p1_to_p3(&m_point, &sum);
+			}
+
+			void add(const PointAccumulator& accumulator) {
+				if (!accumulator.isEmpty())
+					add(accumulator.point());
+			}
+
+			void dbl() {
+				if (m_isEmpty)
+					return;
+
+				ge_p1p1 doubled;
+				ge_p3_dbl(&doubled, &m_point);
+				ge_p1p1_to_p3(&m_point, &doubled);
+			}
+
+			void reset() {
+				m_isEmpty = true;
+			}
+
+		private:
+			ge_p3 m_point;
+			bool m_isEmpty;
+		};
+
+		uint32_t GetWindowDigit(const Scalar& scalar, size_t bitOffset, size_t windowBits) {
+			auto byteIndex = bitOffset / 8;
+			uint32_t value = 0;
+			for (auto i = 0u; i < 3 && byteIndex + i < scalar.size(); ++i)
+				value |= static_cast<uint32_t>(scalar[byteIndex + i]) << (8 * i);
+
+			return (value >> (bitOffset % 8)) & ((1u << windowBits) - 1);
+		}
+
+		size_t CalculateWindowBits(size_t numPoints) {
+			size_t log2 = 0;
+			while (numPoints >>= 1)
+				++log2;
+
+			return std::min<size_t>(8, std::max<size_t>(3, log2 > 2 ? log2 - 2 : 0));
+		}
+
+		/// Calculates sum(scalars[i] * points[i]) using Pippenger's bucket method.
+		PointAccumulator MultiScalarMultiply(const std::vector<Scalar>& scalars, const std::vector<ge_p3>& points) {
+			auto windowBits = CalculateWindowBits(points.size());
+			auto numWindows = (Encoded_Size * 8 + windowBits - 1) / windowBits;
+			std::vector<PointAccumulator> buckets((1u << windowBits) - 1);
+
+			PointAccumulator result;
+			for (auto window = numWindows; window > 0; --window) {
+				for (auto i = 0u; i < windowBits; ++i)
+					result.dbl();
+
+				for (auto& bucket : buckets)
+					bucket.reset();
+
+				// sort the points into buckets by their digits in the current window
+				auto bitOffset = (window - 1) * windowBits;
+				for (auto i = 0u; i < points.size(); ++i) {
+					auto digit = GetWindowDigit(scalars[i], bitOffset, windowBits);
+					if (0 != digit)
+						buckets[digit - 1].add(points[i]);
+				}
+
+				// sum(k * bucket[k]) is calculated as a sum of running sums starting from the highest bucket
+				PointAccumulator runningSum;
+				PointAccumulator windowSum;
+				for (auto iter = buckets.crbegin(); buckets.crend() != iter; ++iter) {
+					runningSum.add(*iter);
+					windowSum.add(runningSum);
+				}
+
+				result.add(windowSum);
+			}
+
+			return result;
+		}
+
+		// endregion
+
+		// region batch verification
+
+		std::array<uint8_t, Hash256_Size> GenerateBatchSeed() {
+			std::random_device randomDevice;
+			std::array<uint8_t, Hash256_Size> seed;
+			for (auto i = 0u; i < seed.size(); i += sizeof(uint32_t)) {
+				auto value = randomDevice();
+				std::memcpy(seed.data() + i, &value, sizeof(uint32_t));
+			}
+
+			return seed;
+		}
+
+		/// Verifies the signature inputs at \a indexes within \a pSignatureInputs together.
+		/// The batch equation is [8]([sum(z_i * S_i)]B - sum([z_i]R_i) - sum([z_i * h_i]A_i)) == 0,
+		/// where z_i are random coefficients that prevent invalid signatures from cancelling each other out.
+		bool VerifyBatch(const SignatureInput* pSignatureInputs, const std::vector<size_t>& indexes) {
+			auto seed = GenerateBatchSeed();
+			const Scalar Zero_Scalar{};
+
+			std::vector<Scalar> scalars(2 * indexes.size());
+			std::vector<ge_p3> points(2 * indexes.size());
+			Scalar sumZS{};
+			for (auto i = 0u; i < indexes.size(); ++i) {
+				const auto& signatureInput = pSignatureInputs[indexes[i]];
+				const uint8_t* encodedR = signatureInput.Signature.data();
+				const uint8_t* encodedS = signatureInput.Signature.data() + Encoded_Size;
+
+				// h = H(encodedR || public || data) mod group order
+				Hash512 h;
+				HashBuilder hasher_h;
+				hasher_h.update({ { encodedR, Encoded_Size }, signatureInput.Signer });
+				hasher_h.update(signatureInput.Data);
+				hasher_h.final(h);
+				sc_reduce(h.data());
+
+				// z = H(seed || i)[0:128]
+				Hash256 zHash;
+				Sha3_256_Builder hasher_z;
+				hasher_z.update({ seed, { reinterpret_cast<const uint8_t*>(&i), sizeof(i) } });
+				hasher_z.final(zHash);
+
+				auto& z = scalars[2 * i];
+				std::memcpy(z.data(), zHash.data(), Coefficient_Size);
+
+				// -R and -A
+				if (0 != ge_frombytes_negate_vartime(&points[2 * i], encodedR))
+					return false;
+
+				if (0 != ge_frombytes_negate_vartime(&points[2 * i + 1], signatureInput.Signer.data()))
+					return false;
+
+				// z * h and sum(z * S)
+				sc_muladd(scalars[2 * i + 1].data(), z.data(), h.data(), Zero_Scalar.data());
+				sc_muladd(sumZS.data(), z.data(), encodedS, sumZS.data());
+			}
+
+			auto result = MultiScalarMultiply(scalars, points);
+
+			ge_p3 sumZSMulBase;
+			ge_scalarmult_base(&sumZSMulBase, sumZS.data());
+			result.add(sumZSMulBase);
+
+			// multiply by cofactor
+			for (auto i = 0u; i < 3; ++i)
+				result.dbl();
+
+			if (result.isEmpty())
+				return true;
+
+			Scalar encodedResult;
+			ge_p3_tobytes(encodedResult.data(), &result.point());
+			return 0 == crypto_verify_32(encodedResult.data(), Identity_Encoding.data());
+		}
+
+		bool VerifyMultiImpl(const SignatureInput* pSignatureInputs, size_t count, std::vector<bool>* pResults) {
+			if (pResults)
+				pResults->assign(count, false);
+
+			auto areAllValid = true;
+			auto verifyIndividually = [pSignatureInputs, pResults, &areAllValid](auto index) {
+				const auto& signatureInput = pSignatureInputs[index];
+				auto isVerified = Verify(signatureInput.Signer, signatureInput.Data, signatureInput.Signature);
+				if (pResults)
+					(*pResults)[index] = isVerified;
+
+				areAllValid = areAllValid && isVerified;
+			};
+
+			std::vector<size_t> batchIndexes;
+			batchIndexes.reserve(Max_Batch_Size);
+			auto verifyBatch = [pSignatureInputs, pResults, &areAllValid, &batchIndexes, verifyIndividually]() {
+				if (batchIndexes.size() < 2 || !VerifyBatch(pSignatureInputs, batchIndexes)) {
+					// locate failures (when results are requested)
+					for (auto index : batchIndexes) {
+						if (!pResults && !areAllValid)
+							break;
+
+						verifyIndividually(index);
+					}
+				} else if (pResults) {
+					for (auto index : batchIndexes)
+						(*pResults)[index] = true;
+				}
+
+				batchIndexes.clear();
+			};
+
+			for (auto i = 0u; i < count; ++i) {
+				if (!IsBatchable(pSignatureInputs[i]))
+					verifyIndividually(i);
+				else
+					batchIndexes.push_back(i);
+
+				if (Max_Batch_Size == batchIndexes.size())
+					verifyBatch();
+
+				if (!pResults && !areAllValid)
+					return false;
+			}
+
+			verifyBatch();
+			return areAllValid;
+		}
+
+		// endregion
+	}
+
+	bool VerifyMulti(const SignatureInput* pSignatureInputs, size_t count) {
+		return VerifyMultiImpl(pSignatureInputs, count, nullptr);
+	}
+
+	bool VerifyMulti(const SignatureInput* pSignatureInputs, size_t count, std::vector<bool>& results) {
+		return VerifyMultiImpl(pSignatureInputs, count, &results);
+	}
 }}
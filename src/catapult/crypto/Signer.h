@@ -39,4 +39,28 @@ namespace catapult { namespace crypto {
 	/// Verifies that \a signature of data in \a buffersList is valid, using public key \a publicKey.
 	/// Returns \c true if signature is valid.
 	bool Verify(const Key& publicKey, std::initializer_list<const RawBuffer> buffersList, const Signature& signature);
+
+	/// Input to batch signature verification.
+	struct SignatureInput {
+		/// Public key of the signer.
+		const Key& Signer;
+
+		/// Signed data.
+		RawBuffer Data;
+
+		/// Signature of the data.
+		const catapult::Signature& Signature;
+	};
+
+	/// Verifies all \a count signature inputs pointed to by \a pSignatureInputs using randomized batch verification.
+	/// Returns \c true if all signatures are valid.
+	/// \note Batch verification uses the cofactored verification equation, so a batch containing a signature that is only
+	///       invalid due to a small order component can be accepted even though Verify rejects the signature individually.
+	bool VerifyMulti(const SignatureInput* pSignatureInputs, size_t count);
+
+	/// Verifies all \a count signature inputs pointed to by \a pSignatureInputs using randomized batch verification
+	/// and sets the corresponding element of \a results to \c true if the corresponding signature is valid.
+	/// Returns \c true if all signatures are valid.
+	/// \note When a batch fails verification, its signatures are verified individually in order to locate the invalid ones.
+	bool VerifyMulti(const SignatureInput* pSignatureInputs, size_t count, std::vector<bool>& results);
 }}
@@ -41,7 +41,8 @@ namespace catapult { namespace deltaset {
 	/// \tparam TSetTraits Traits describing the underlying set.
 	/// \tparam TCommitPolicy The policy for committing changes to a base set.
 	///
-	/// \note: 1) this class is not thread safe.
+	/// \note: 1) this class is not thread safe unless TSetTraits::SetType is a persistent set, in which case reads can
+	///           run concurrently with a (single) commit because commits publish a new version instead of modifying in place
 	///        2) if TSetTraits::SetType is an unordered set, the element must implement operator ==
 	///        3) if MutableTypeTraits are used, the element must implement a (deep) copy
 	template<
@@ -90,10 +91,19 @@ namespace catapult { namespace deltaset {
 			return m_elements.cend() != m_elements.find(key);
 		}
 
+		/// Gets a snapshot of the current version of this set.
+		/// \note This is only supported for persistent sets, which can be snapshot in constant time.
+		SetType snapshot() const {
+			static_assert(IsPersistentSet<SetType>::value, "snapshot is only supported by persistent sets");
+			return m_elements;
+		}
+
 	public:
 		/// Returns a delta based on the same original elements as this set.
+		/// \note Persistent sets allow many outstanding attached deltas because each delta reads from its own snapshot.
+		///       In this case, the most recently created delta is the one that is committed.
 		std::shared_ptr<DeltaType> rebase() {
-			if (m_pWeakDelta.lock())
+			if (!IsPersistentSet<SetType>::value && m_pWeakDelta.lock())
 				CATAPULT_THROW_RUNTIME_ERROR("only a single attached delta is allowed at a time");
 
 			auto pDelta = std::make_shared<DeltaType>(m_elements);
@@ -116,9 +126,26 @@ namespace catapult { namespace deltaset {
 			if (!pDelta)
 				CATAPULT_THROW_RUNTIME_ERROR("attempting to commit changes to a set without any outstanding attached deltas");
 
-			auto deltas = pDelta->deltas();
+			commitDelta(*pDelta, IsPersistentSet<SetType>(), std::forward<TArgs>(args)...);
+		}
+
+	private:
+		template<typename... TArgs>
+		void commitDelta(DeltaType& delta, std::false_type, TArgs&&... args) {
+			auto deltas = delta.deltas();
 			TCommitPolicy::Update(m_elements, deltas, std::forward<TArgs>(args)...);
-			pDelta->reset();
+			delta.reset();
+		}
+
+		template<typename... TArgs>
+		void commitDelta(DeltaType& delta, std::true_type, TArgs&&... args) {
+			// apply all changes to a (structurally shared) copy of the current version and publish it with a single store
+			// so that readers are never blocked and previously taken snapshots are never modified
+			auto elements = m_elements;
+			auto deltas = delta.deltas();
+			TCommitPolicy::Update(elements, deltas, std::forward<TArgs>(args)...);
+			m_elements = elements;
+			delta.reset(elements);
 		}
 
 	private:
@@ -20,6 +20,7 @@
 
 #pragma once
 #include <memory>
+#include <type_traits>
 
 namespace catapult { namespace deltaset {
 
@@ -139,6 +140,16 @@ namespace catapult { namespace deltaset {
 
 	// endregion
 
+	// region persistence traits
+
+	/// Determines if \a TSet is a persistent set (i.e. a set that can be snapshot in constant time and whose snapshots
+	/// are never affected by modifications).
+	/// \note BaseSet publishes new versions of persistent sets on commit instead of modifying them in place.
+	template<typename TSet>
+	struct IsPersistentSet : std::false_type {};
+
+	// endregion
+
 	// region mutability traits
 
 	// mutability tagging allows BaseSet to optimize for immutable values that can never be modified
@@ -22,6 +22,7 @@
 #include "BaseSetDefaultTraits.h"
 #include "BaseSetFindIterator.h"
 #include "DeltaElements.h"
+#include "PrefetchSet.h"
 #include "catapult/utils/NonCopyable.h"
 #include "catapult/exceptions.h"
 #include "catapult/preprocessor.h"
@@ -175,6 +176,13 @@ namespace catapult { namespace deltaset {
 			return !contains(m_removedElements, key) && (contains(m_addedElements, key) || contains(m_originalElements, key));
 		}
 
+		/// Hints that all elements with \a keys will be searched for in this set.
+		/// \note This allows storage-backed original elements to be loaded in bulk before individual finds.
+		template<typename TKeys>
+		void prefetch(const TKeys& keys) const {
+			PrefetchSet(m_originalElements, keys);
+		}
+
 	private:
 		template<typename TSet> // SetType or MemorySetType
 		static constexpr bool contains(const TSet& set, const KeyType& key) {
@@ -324,6 +332,14 @@ namespace catapult { namespace deltaset {
 			m_keyGenerationIdMap.clear();
 		}
 
+		/// Resets all pending modifications and rebases this delta on top of \a originalElements.
+		/// \note This is only supported for persistent sets, which are held by value.
+		void reset(const SetType& originalElements) {
+			static_assert(IsPersistentSet<SetType>::value, "rebasing a delta is only supported by persistent sets");
+			m_originalElements = originalElements;
+			reset();
+		}
+
 	public:
 		/// Gets the current generation id.
 		uint32_t generationId() const {
@@ -364,8 +380,11 @@ namespace catapult { namespace deltaset {
 			using type = std::unordered_map<KeyType, uint32_t, typename T::hasher, typename T::key_equal>;
 		};
 
+		// persistent sets are held by value so that a delta keeps reading from a stable snapshot when its base set is committed
+		using OriginalSetType = typename std::conditional<IsPersistentSet<SetType>::value, SetType, const SetType&>::type;
+
 	private:
-		const SetType& m_originalElements;
+		OriginalSetType m_originalElements;
 		MemorySetType m_addedElements;
 		MemorySetType m_removedElements;
 		MemorySetType m_copiedElements;
@@ -21,6 +21,7 @@
 #pragma once
 #include "BaseSetCommitPolicy.h"
 #include "DeltaElements.h"
+#include "PrefetchSet.h"
 #include <memory>
 
 namespace catapult { namespace deltaset {
@@ -153,6 +154,14 @@ namespace catapult { namespace deltaset {
 					: ConditionalIterator(m_pContainer2->find(key), MemoryFlag());
 		}
 
+		/// Hints that all elements with \a keys will be searched for in this set.
+		/// \note Only storage containers are prefetched because memory containers are always fully loaded.
+		template<typename TKeys>
+		void prefetch(const TKeys& keys) const {
+			if (m_pContainer1)
+				PrefetchSet(*m_pContainer1, keys);
+		}
+
 	public:
 		/// Applies all changes in \a deltas to the underlying container.
 		void update(const DeltaElements<MemorySetType>& deltas) {
@@ -208,6 +217,13 @@ namespace catapult { namespace deltaset {
 		container.update(deltas);
 	}
 
+	/// Hints that all elements with \a keys will be looked up in \a container.
+	/// \note Specialization for ConditionalContainer.
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TKeys>
+	void PrefetchSet(const ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container, const TKeys& keys) {
+		container.prefetch(keys);
+	}
+
 	/// Optionally prunes \a elements using \a pruningBoundary, which indicates the upper bound of elements to remove.
 	/// \note Specialization for ConditionalContainer.
 	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TPruningBoundary>
@@ -21,11 +21,12 @@
 #pragma once
 #include "BaseSetDefaultTraits.h"
 #include <unordered_set>
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
 	/// Mixin that wraps BaseSetDelta and provides a facade on top of BaseSetDelta::deltas().
-	/// \note This only works for map-based delta sets.
+	/// \note For set-based delta sets, element pointers are returned in set order.
 	template<typename TSetDelta>
 	class DeltaElementsMixin {
 	private:
@@ -50,9 +51,47 @@ namespace catapult { namespace deltaset {
 			}
 		};
 
+		// used to extract values from set elements
+		// (assume pair indicates maps and only forward value)
+
+		template<typename TSetElement>
+		struct ElementHelperT {
+			using ValueType = TSetElement;
+
+			template<typename TPointer>
+			using PointerContainer = std::vector<TPointer>;
+
+			template<typename TPointer>
+			static void Add(PointerContainer<TPointer>& container, TPointer pointer) {
+				container.push_back(pointer);
+			}
+
+			static const TSetElement& GetValue(const TSetElement& element) {
+				return element;
+			}
+		};
+
+		template<typename TKey, typename TValue>
+		struct ElementHelperT<std::pair<TKey, TValue>> {
+			using ValueType = TValue;
+
+			template<typename TPointer>
+			using PointerContainer = std::unordered_set<TPointer>;
+
+			template<typename TPointer>
+			static void Add(PointerContainer<TPointer>& container, TPointer pointer) {
+				container.insert(pointer);
+			}
+
+			static const TValue& GetValue(const std::pair<TKey, TValue>& pair) {
+				return pair.second;
+			}
+		};
+
 	private:
-		using DerefHelper = DerefHelperT<typename TSetDelta::SetType::value_type::second_type>;
-		using PointerContainer = std::unordered_set<typename DerefHelper::const_pointer_type>;
+		using ElementHelper = ElementHelperT<typename TSetDelta::SetType::value_type>;
+		using DerefHelper = DerefHelperT<typename ElementHelper::ValueType>;
+		using PointerContainer = typename ElementHelper::template PointerContainer<typename DerefHelper::const_pointer_type>;
 
 	public:
 		/// Creates a mixin around \a setDelta.
@@ -79,8 +118,8 @@ namespace catapult { namespace deltaset {
 		template<typename TSource>
 		static PointerContainer CollectAllPointers(const TSource& source) {
 			PointerContainer dest;
-			for (const auto& pair : source)
-				dest.insert(&DerefHelper::Deref(pair.second));
+			for (const auto& element : source)
+				ElementHelper::Add(dest, &DerefHelper::Deref(ElementHelper::GetValue(element)));
 
 			return dest;
 		}
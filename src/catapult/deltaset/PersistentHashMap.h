@@ -0,0 +1,716 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#pragma once
+#include "BaseSetDefaultTraits.h"
+#include "DeltaElements.h"
+#include "catapult/utils/NonCopyable.h"
+#include "catapult/exceptions.h"
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace deltaset {
+
+	/// A persistent (structurally shared) unordered map implemented as a hash array mapped trie.
+	/// \note Copies are constant time snapshots that share all nodes with the source.
+	///       Modifications copy only the nodes along the path from the root to the modified leaf, so snapshots
+	///       (and iterators into them) are never affected by later modifications.
+	///       The root is always loaded and stored atomically, so a single writer can publish new versions of a map
+	///       while any number of readers concurrently access (or snapshot) the same instance.
+	template<typename TKey, typename TValue, typename THasher = std::hash<TKey>, typename TKeyEqual = std::equal_to<TKey>>
+	class PersistentHashMap {
+	public:
+		using key_type = TKey;
+		using mapped_type = TValue;
+		using value_type = std::pair<const TKey, TValue>;
+		using size_type = size_t;
+		using hasher = THasher;
+		using key_equal = TKeyEqual;
+
+	private:
+		static constexpr uint32_t Bits_Per_Level = 5;
+		static constexpr size_t Level_Mask = (1u << Bits_Per_Level) - 1;
+		static constexpr uint32_t Hash_Bits = sizeof(size_t) * 8;
+		static constexpr size_t Max_Branch_Depth = (Hash_Bits + Bits_Per_Level - 1) / Bits_Per_Level;
+
+		struct Node;
+		using NodePointer = std::shared_ptr<Node>;
+
+		// a node is either a branch, which has one child per occupied slot in its bitmap,
+		// or a leaf, which has all values with the same (full) hash
+		struct Node {
+			bool IsLeaf;
+			uint64_t EditId;
+			size_t Size;
+			size_t Hash;
+			uint32_t Bitmap;
+			std::vector<NodePointer> Children;
+			std::vector<value_type> Values;
+		};
+
+		// a branch visited by an iterator along with the index of the child being iterated
+		struct IteratorFrame {
+			Node* pNode;
+			size_t ChildIndex;
+		};
+
+	public:
+		/// Iterator used for iterating over the map.
+		/// \note Each iterator holds the root of the version it was created from, so it remains valid across modifications.
+		template<bool IsConst>
+		class basic_iterator {
+		public:
+			using difference_type = std::ptrdiff_t;
+			using value_type = typename std::conditional<
+				IsConst,
+				const typename PersistentHashMap::value_type,
+				typename PersistentHashMap::value_type
+			>::type;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using iterator_category = std::forward_iterator_tag;
+
+		public:
+			/// Creates an end iterator.
+			basic_iterator() : basic_iterator(nullptr)
+			{}
+
+			/// Creates a const iterator around a non-const iterator (\a iter).
+			template<bool IsOtherConst, typename = typename std::enable_if<IsConst && !IsOtherConst>::type>
+			basic_iterator(const basic_iterator<IsOtherConst>& iter)
+					: m_pRoot(iter.m_pRoot)
+					, m_frames(iter.m_frames)
+					, m_depth(iter.m_depth)
+					, m_hasFrames(iter.m_hasFrames)
+					, m_pLeaf(iter.m_pLeaf)
+					, m_valueIndex(iter.m_valueIndex)
+			{}
+
+		private:
+			explicit basic_iterator(const NodePointer& pRoot)
+					: m_pRoot(pRoot)
+					, m_depth(0)
+					, m_hasFrames(true)
+					, m_pLeaf(nullptr)
+					, m_valueIndex(0)
+			{}
+
+		public:
+			/// Returns \c true if this iterator and \a rhs are equal.
+			bool operator==(const basic_iterator& rhs) const {
+				return m_pLeaf == rhs.m_pLeaf && m_valueIndex == rhs.m_valueIndex;
+			}
+
+			/// Returns \c true if this iterator and \a rhs are not equal.
+			bool operator!=(const basic_iterator& rhs) const {
+				return !(*this == rhs);
+			}
+
+		public:
+			/// Advances the iterator to the next position.
+			basic_iterator& operator++() {
+				if (!m_pLeaf)
+					CATAPULT_THROW_OUT_OF_RANGE("cannot advance iterator beyond end");
+
+				if (++m_valueIndex < m_pLeaf->Values.size())
+					return *this;
+
+				if (!m_hasFrames)
+					buildFrames();
+
+				for (; 0 != m_depth; --m_depth) {
+					auto& frame = m_frames[m_depth - 1];
+					if (++frame.ChildIndex < frame.pNode->Children.size()) {
+						descend(frame.pNode->Children[frame.ChildIndex].get());
+						return *this;
+					}
+				}
+
+				*this = basic_iterator();
+				return *this;
+			}
+
+			/// Advances the iterator to the next position.
+			basic_iterator operator++(int) {
+				auto copy = *this;
+				++*this;
+				return copy;
+			}
+
+		public:
+			/// Returns a pointer to the current element.
+			value_type* operator->() const {
+				if (!m_pLeaf)
+					CATAPULT_THROW_OUT_OF_RANGE("cannot dereference at end");
+
+				return &m_pLeaf->Values[m_valueIndex];
+			}
+
+			/// Returns a reference to the current element.
+			value_type& operator*() const {
+				return *(this->operator->());
+			}
+
+		private:
+			void push(Node* pNode, size_t childIndex) {
+				m_frames[m_depth++] = { pNode, childIndex };
+			}
+
+			// iterators created by find only point to a leaf, so the path to it is only rebuilt when advancing
+			void buildFrames() {
+				auto shift = 0u;
+				auto* pNode = m_pRoot.get();
+				while (m_pLeaf != pNode) {
+					auto childIndex = ChildIndex(pNode->Bitmap, SlotBit(m_pLeaf->Hash, shift));
+					push(pNode, childIndex);
+					pNode = pNode->Children[childIndex].get();
+					shift += Bits_Per_Level;
+				}
+
+				m_hasFrames = true;
+			}
+
+			void descend(Node* pNode) {
+				while (!pNode->IsLeaf) {
+					push(pNode, 0);
+					pNode = pNode->Children[0].get();
+				}
+
+				m_pLeaf = pNode;
+				m_valueIndex = 0;
+			}
+
+		private:
+			NodePointer m_pRoot;
+			std::array<IteratorFrame, Max_Branch_Depth> m_frames;
+			size_t m_depth;
+			bool m_hasFrames;
+			Node* m_pLeaf;
+			size_t m_valueIndex;
+
+		private:
+			template<bool IsOtherConst>
+			friend class basic_iterator;
+
+			friend class PersistentHashMap;
+		};
+
+		/// Non-const iterator.
+		/// \note Values modified through this iterator are modified in all snapshots sharing the containing leaf.
+		using iterator = basic_iterator<false>;
+
+		/// Const iterator.
+		using const_iterator = basic_iterator<true>;
+
+	public:
+		/// Creates an empty map.
+		PersistentHashMap() = default;
+
+		/// Creates a map around \a values.
+		PersistentHashMap(std::initializer_list<value_type> values) {
+			insert(values.begin(), values.end());
+		}
+
+		/// Creates a snapshot of \a map.
+		PersistentHashMap(const PersistentHashMap& map)
+				: m_pRoot(map.loadRoot())
+				, m_hasher(map.m_hasher)
+				, m_keyEqual(map.m_keyEqual)
+		{}
+
+	public:
+		/// Replaces the contents of this map with a snapshot of \a map.
+		PersistentHashMap& operator=(const PersistentHashMap& map) {
+			storeRoot(map.loadRoot());
+			return *this;
+		}
+
+	public:
+		/// Gets a value indicating whether or not the map is empty.
+		bool empty() const {
+			return 0 == size();
+		}
+
+		/// Gets the size of the map.
+		size_t size() const {
+			auto pRoot = loadRoot();
+			return pRoot ? pRoot->Size : 0;
+		}
+
+	public:
+		/// Returns a const iterator to the first element of the map.
+		const_iterator cbegin() const {
+			return beginIterator<const_iterator>();
+		}
+
+		/// Returns a const iterator to the element following the last element of the map.
+		const_iterator cend() const {
+			return const_iterator();
+		}
+
+		/// Returns a const iterator to the first element of the map.
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		/// Returns a const iterator to the element following the last element of the map.
+		const_iterator end() const {
+			return cend();
+		}
+
+		/// Returns an iterator to the first element of the map.
+		iterator begin() {
+			return beginIterator<iterator>();
+		}
+
+		/// Returns an iterator to the element following the last element of the map.
+		iterator end() {
+			return iterator();
+		}
+
+	public:
+		/// Returns a const iterator to the element with \a key if it is contained in this map, or cend() otherwise.
+		const_iterator find(const key_type& key) const {
+			return findIterator<const_iterator>(key);
+		}
+
+		/// Returns an iterator to the element with \a key if it is contained in this map, or end() otherwise.
+		iterator find(const key_type& key) {
+			return findIterator<iterator>(key);
+		}
+
+		/// Gets the number of elements with \a key in this map.
+		size_t count(const key_type& key) const {
+			return cend() != find(key) ? 1 : 0;
+		}
+
+	public:
+		/// Batch of modifications to a map that are published together.
+		/// \note Branches created by a batch are private to it until it is committed, so later modifications in the same batch
+		///       update them in place instead of copying them again.
+		class Batch : public utils::NonCopyable {
+		public:
+			/// Creates a batch around \a map.
+			explicit Batch(PersistentHashMap& map)
+					: m_map(map)
+					, m_pRoot(map.m_pRoot)
+					, m_editId(NextEditId())
+			{}
+
+		public:
+			/// Inserts \a value if its key is not already contained.
+			/// Returns \c true if \a value was inserted.
+			bool insert(const value_type& value) {
+				return m_map.update(m_pRoot, value, false, m_editId);
+			}
+
+			/// Replaces the element with the key of \a value with \a value.
+			/// Returns \c true if an element was replaced.
+			bool assign(const value_type& value) {
+				return m_map.update(m_pRoot, value, true, m_editId);
+			}
+
+			/// Removes the element with \a key.
+			/// Returns \c true if an element was removed.
+			bool erase(const key_type& key) {
+				return m_map.erase(m_pRoot, key, m_editId);
+			}
+
+		public:
+			/// Publishes all modifications to the underlying map.
+			void commit() {
+				m_map.storeRoot(m_pRoot);
+
+				// published branches are shared with readers, so they must never be updated in place again
+				m_editId = NextEditId();
+			}
+
+		private:
+			PersistentHashMap& m_map;
+			NodePointer m_pRoot;
+			uint64_t m_editId;
+		};
+
+	public:
+		/// Inserts \a value into this map if its key is not already contained.
+		/// Returns an iterator to the element with the key of \a value and a flag indicating whether or not \a value was inserted.
+		std::pair<iterator, bool> insert(const value_type& value) {
+			Batch batch(*this);
+			auto isInserted = batch.insert(value);
+			if (isInserted)
+				batch.commit();
+
+			return std::make_pair(find(value.first), isInserted);
+		}
+
+		/// Inserts \a value into this map if its key is not already contained.
+		/// \note The position hint is ignored.
+		iterator insert(const_iterator, const value_type& value) {
+			return insert(value).first;
+		}
+
+		/// Inserts all values in the range [\a first, \a last) into this map.
+		template<typename TInputIterator>
+		void insert(TInputIterator first, TInputIterator last) {
+			Batch batch(*this);
+			for (; last != first; ++first)
+				batch.insert(*first);
+
+			batch.commit();
+		}
+
+		/// Replaces the element with the key of \a value with \a value.
+		/// Returns \c true if an element was replaced or \c false if no element with the key of \a value is contained.
+		bool assign(const value_type& value) {
+			Batch batch(*this);
+			auto isAssigned = batch.assign(value);
+			if (isAssigned)
+				batch.commit();
+
+			return isAssigned;
+		}
+
+		/// Removes the element with \a key from this map.
+		/// Returns the number of removed elements.
+		size_t erase(const key_type& key) {
+			Batch batch(*this);
+			if (!batch.erase(key))
+				return 0;
+
+			batch.commit();
+			return 1;
+		}
+
+		/// Removes the element pointed to by \a iter from this map.
+		/// Returns an iterator to the element following the removed element.
+		iterator erase(const_iterator iter) {
+			auto nextIter = iter;
+			++nextIter;
+
+			// nextIter pins the original version, so its key can still be accessed after the erase
+			erase(iter->first);
+			return cend() == nextIter ? end() : find(nextIter->first);
+		}
+
+		/// Removes all elements from this map.
+		void clear() {
+			storeRoot(nullptr);
+		}
+
+	private:
+		// modifications are only ever made by a single writer, so batches can read the root without synchronization
+		// and only publishing a new root needs to be atomic with respect to concurrent readers
+
+		NodePointer loadRoot() const {
+			return std::atomic_load(&m_pRoot);
+		}
+
+		void storeRoot(NodePointer pRoot) {
+			std::atomic_store(&m_pRoot, std::move(pRoot));
+		}
+
+		template<typename TIterator>
+		TIterator beginIterator() const {
+			auto pRoot = loadRoot();
+			if (!pRoot)
+				return TIterator();
+
+			TIterator iter(pRoot);
+			iter.descend(pRoot.get());
+			return iter;
+		}
+
+		template<typename TIterator>
+		TIterator findIterator(const key_type& key) const {
+			auto pRoot = loadRoot();
+			if (!pRoot)
+				return TIterator();
+
+			auto hash = m_hasher(key);
+			auto shift = 0u;
+			auto* pNode = pRoot.get();
+			while (!pNode->IsLeaf) {
+				auto bit = SlotBit(hash, shift);
+				if (!(pNode->Bitmap & bit))
+					return TIterator();
+
+				pNode = pNode->Children[ChildIndex(pNode->Bitmap, bit)].get();
+				shift += Bits_Per_Level;
+			}
+
+			if (hash != pNode->Hash)
+				return TIterator();
+
+			for (auto i = 0u; i < pNode->Values.size(); ++i) {
+				if (m_keyEqual(pNode->Values[i].first, key)) {
+					TIterator iter(pRoot);
+					iter.m_hasFrames = false;
+					iter.m_pLeaf = pNode;
+					iter.m_valueIndex = i;
+					return iter;
+				}
+			}
+
+			return TIterator();
+		}
+
+		bool update(NodePointer& pRoot, const value_type& value, bool isAssign, uint64_t editId) const {
+			bool isChanged = false;
+			pRoot = update(pRoot, m_hasher(value.first), 0, value, isAssign, editId, isChanged);
+			return isChanged;
+		}
+
+		bool erase(NodePointer& pRoot, const key_type& key, uint64_t editId) const {
+			if (!pRoot)
+				return false;
+
+			bool isErased = false;
+			pRoot = erase(pRoot, m_hasher(key), 0, key, editId, isErased);
+			return isErased;
+		}
+
+		// inserts \a value when \a isAssign is \c false or replaces an existing value when \a isAssign is \c true
+		NodePointer update(
+				const NodePointer& pNode,
+				size_t hash,
+				uint32_t shift,
+				const value_type& value,
+				bool isAssign,
+				uint64_t editId,
+				bool& isChanged) const {
+			if (!pNode) {
+				if (isAssign)
+					return pNode;
+
+				isChanged = true;
+				return CreateLeaf(hash, { value }, editId);
+			}
+
+			if (pNode->IsLeaf) {
+				if (hash != pNode->Hash) {
+					if (isAssign)
+						return pNode;
+
+					isChanged = true;
+					return Merge(pNode, CreateLeaf(hash, { value }, editId), shift, editId);
+				}
+
+				// leaf values are never updated in place because they are exposed by iterators
+				std::vector<value_type> values;
+				values.reserve(pNode->Values.size() + 1);
+				for (const auto& leafValue : pNode->Values) {
+					if (m_keyEqual(leafValue.first, value.first)) {
+						if (!isAssign)
+							return pNode;
+
+						isChanged = true;
+						values.push_back(value);
+					} else {
+						values.push_back(leafValue);
+					}
+				}
+
+				if (!isAssign) {
+					isChanged = true;
+					values.push_back(value);
+				}
+
+				return isChanged ? CreateLeaf(hash, std::move(values), editId) : pNode;
+			}
+
+			auto bit = SlotBit(hash, shift);
+			auto childIndex = ChildIndex(pNode->Bitmap, bit);
+			if (!(pNode->Bitmap & bit)) {
+				if (isAssign)
+					return pNode;
+
+				isChanged = true;
+				auto pBranch = Editable(pNode, editId);
+				pBranch->Children.insert(pBranch->Children.begin() + static_cast<std::ptrdiff_t>(childIndex), CreateLeaf(hash, { value }, editId));
+				pBranch->Bitmap |= bit;
+				++pBranch->Size;
+				return pBranch;
+			}
+
+			auto pChild = update(pNode->Children[childIndex], hash, shift + Bits_Per_Level, value, isAssign, editId, isChanged);
+			if (!isChanged)
+				return pNode;
+
+			auto pBranch = Editable(pNode, editId);
+			pBranch->Children[childIndex] = std::move(pChild);
+			if (!isAssign)
+				++pBranch->Size;
+
+			return pBranch;
+		}
+
+		NodePointer erase(
+				const NodePointer& pNode,
+				size_t hash,
+				uint32_t shift,
+				const key_type& key,
+				uint64_t editId,
+				bool& isErased) const {
+			if (pNode->IsLeaf) {
+				if (hash != pNode->Hash)
+					return pNode;
+
+				std::vector<value_type> values;
+				for (const auto& leafValue : pNode->Values) {
+					if (m_keyEqual(leafValue.first, key))
+						isErased = true;
+					else
+						values.push_back(leafValue);
+				}
+
+				if (!isErased)
+					return pNode;
+
+				return values.empty() ? nullptr : CreateLeaf(hash, std::move(values), editId);
+			}
+
+			auto bit = SlotBit(hash, shift);
+			if (!(pNode->Bitmap & bit))
+				return pNode;
+
+			auto childIndex = ChildIndex(pNode->Bitmap, bit);
+			auto pChild = erase(pNode->Children[childIndex], hash, shift + Bits_Per_Level, key, editId, isErased);
+			if (!isErased)
+				return pNode;
+
+			// collapse branches that are left with a single leaf so that leaves are stored as close to the root as possible
+			const auto& children = pNode->Children;
+			if (pChild && 1 == children.size() && pChild->IsLeaf)
+				return pChild;
+
+			if (!pChild) {
+				if (1 == children.size())
+					return nullptr;
+
+				const auto& pOtherChild = children[0 == childIndex ? 1 : 0];
+				if (2 == children.size() && pOtherChild->IsLeaf)
+					return pOtherChild;
+			}
+
+			auto pBranch = Editable(pNode, editId);
+			if (pChild) {
+				pBranch->Children[childIndex] = std::move(pChild);
+			} else {
+				pBranch->Children.erase(pBranch->Children.begin() + static_cast<std::ptrdiff_t>(childIndex));
+				pBranch->Bitmap &= ~bit;
+			}
+
+			--pBranch->Size;
+			return pBranch;
+		}
+
+	private:
+		static uint32_t SlotBit(size_t hash, uint32_t shift) {
+			return 1u << ((hash >> shift) & Level_Mask);
+		}
+
+		static size_t ChildIndex(uint32_t bitmap, uint32_t bit) {
+			return std::bitset<32>(bitmap & (bit - 1)).count();
+		}
+
+		static uint64_t NextEditId() {
+			static std::atomic<uint64_t> editId(0);
+			return ++editId;
+		}
+
+		// returns \a pNode if it was created by the batch with \a editId or a copy of it otherwise
+		static NodePointer Editable(const NodePointer& pNode, uint64_t editId) {
+			if (editId == pNode->EditId)
+				return pNode;
+
+			auto pCopy = std::make_shared<Node>(*pNode);
+			pCopy->EditId = editId;
+			return pCopy;
+		}
+
+		static NodePointer CreateLeaf(size_t hash, std::vector<value_type>&& values, uint64_t editId) {
+			auto pNode = std::make_shared<Node>();
+			pNode->IsLeaf = true;
+			pNode->EditId = editId;
+			pNode->Size = values.size();
+			pNode->Hash = hash;
+			pNode->Bitmap = 0;
+			pNode->Values = std::move(values);
+			return pNode;
+		}
+
+		static NodePointer CreateBranch(uint32_t bitmap, std::vector<NodePointer>&& children, size_t size, uint64_t editId) {
+			auto pNode = std::make_shared<Node>();
+			pNode->IsLeaf = false;
+			pNode->EditId = editId;
+			pNode->Size = size;
+			pNode->Hash = 0;
+			pNode->Bitmap = bitmap;
+			pNode->Children = std::move(children);
+			return pNode;
+		}
+
+		static NodePointer Merge(const NodePointer& pNode1, const NodePointer& pNode2, uint32_t shift, uint64_t editId) {
+			// leaves with different hashes always diverge before all hash bits are consumed
+			auto bit1 = SlotBit(pNode1->Hash, shift);
+			auto bit2 = SlotBit(pNode2->Hash, shift);
+			auto size = pNode1->Size + pNode2->Size;
+			if (bit1 == bit2)
+				return CreateBranch(bit1, { Merge(pNode1, pNode2, shift + Bits_Per_Level, editId) }, size, editId);
+
+			auto children = bit1 < bit2 ? std::vector<NodePointer>{ pNode1, pNode2 } : std::vector<NodePointer>{ pNode2, pNode1 };
+			return CreateBranch(bit1 | bit2, std::move(children), size, editId);
+		}
+
+	private:
+		NodePointer m_pRoot;
+		THasher m_hasher;
+		TKeyEqual m_keyEqual;
+	};
+
+	/// Applies all changes in \a deltas to \a elements.
+	/// \note All changes are applied in a single batch, so each modified branch is copied at most once.
+	template<typename TKeyTraits, typename TKey, typename TValue, typename THasher, typename TKeyEqual, typename TMemorySet>
+	void UpdateSet(PersistentHashMap<TKey, TValue, THasher, TKeyEqual>& elements, const DeltaElements<TMemorySet>& deltas) {
+		typename PersistentHashMap<TKey, TValue, THasher, TKeyEqual>::Batch batch(elements);
+		for (const auto& element : deltas.Added)
+			batch.insert(element);
+
+		for (const auto& element : deltas.Copied) {
+			if (!batch.assign(element))
+				CATAPULT_THROW_INVALID_ARGUMENT("element not found, cannot update");
+		}
+
+		for (const auto& element : deltas.Removed)
+			batch.erase(TKeyTraits::ToKey(element));
+
+		batch.commit();
+	}
+
+	/// Persistent hash maps support constant time snapshots.
+	template<typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	struct IsPersistentSet<PersistentHashMap<TKey, TValue, THasher, TKeyEqual>> : std::true_type {};
+}}
@@ -20,6 +20,7 @@
 
 #include "ConsumerDispatcher.h"
 #include "ConsumerEntry.h"
+#include "ParallelConsumerEntry.h"
 #include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/Functional.h"
 #include <thread>
@@ -34,6 +35,76 @@ namespace catapult { namespace disruptor {
 			return options;
 		}
 
+		const std::vector<DisruptorConsumerStage>& CheckStages(const std::vector<DisruptorConsumerStage>& stages) {
+			for (const auto& stage : stages) {
+				if (0 == stage.NumWorkerThreads)
+					CATAPULT_THROW_INVALID_ARGUMENT("consumer stage must have at least one worker thread");
+			}
+
+			// inspector runs on the thread of the last consumer, so it must observe elements in order
+			if (!stages.empty() && 1 != stages.back().NumWorkerThreads)
+				CATAPULT_THROW_INVALID_ARGUMENT("last consumer stage must have a single worker thread");
+
+			return stages;
+		}
+
+		template<typename TIsMarked>
+		void AdvanceAcrossMarkedPositions(DisruptorBarrier& barrier, TIsMarked isMarked) {
+			// elements can be marked out of order, so only advance the barrier across contiguous marked elements;
+			// the thread marking the element at the barrier position is responsible for advancing past later elements
+			auto position = barrier.position();
+			while (isMarked(position)) {
+				if (barrier.tryAdvance(position))
+					++position;
+				else
+					position = barrier.position();
+			}
+		}
+
+		// number of idle polls before a spin-then-yield consumer starts yielding
+		constexpr uint32_t Num_Spin_Iterations = 1000;
+
+		// maximum time a blocking consumer waits before rechecking whether or not the dispatcher is running
+		constexpr auto Max_Blocking_Wait_Time = std::chrono::milliseconds(10);
+
+		class ConsumerWaiter {
+		public:
+			ConsumerWaiter(ConsumerWaitStrategy waitStrategy, const DisruptorBarrier& barrier)
+					: m_waitStrategy(waitStrategy)
+					, m_barrier(barrier)
+					, m_numIdleIterations(0)
+			{}
+
+		public:
+			void reset() {
+				m_numIdleIterations = 0;
+			}
+
+			void wait(PositionType position) {
+				switch (m_waitStrategy) {
+				case ConsumerWaitStrategy::Busy_Spin:
+					return;
+
+				case ConsumerWaitStrategy::Spin_Then_Yield:
+					if (m_numIdleIterations < Num_Spin_Iterations)
+						++m_numIdleIterations;
+					else
+						std::this_thread::yield();
+
+					return;
+
+				case ConsumerWaitStrategy::Blocking:
+					m_barrier.waitForAdvance(position, Max_Blocking_Wait_Time);
+					return;
+				}
+			}
+
+		private:
+			ConsumerWaitStrategy m_waitStrategy;
+			const DisruptorBarrier& m_barrier;
+			uint32_t m_numIdleIterations;
+		};
+
 		void LogCompletion(const DisruptorElement& element, const DisruptorBarriers& barriers, size_t elementTraceInterval) {
 			if (!IsIntervalElementId(element.id(), elementTraceInterval))
 				return;
@@ -54,38 +125,90 @@ namespace catapult { namespace disruptor {
 			const ConsumerDispatcherOptions& options,
 			const std::vector<DisruptorConsumer>& consumers,
 			const DisruptorInspector& inspector)
+			: ConsumerDispatcher(options, DisruptorConsumerStagesFromConsumers(consumers), inspector)
+	{}
+
+	ConsumerDispatcher::ConsumerDispatcher(
+			const ConsumerDispatcherOptions& options,
+			const std::vector<DisruptorConsumerStage>& stages,
+			const DisruptorInspector& inspector)
 			: NamedObjectMixin(CheckOptions(options).DispatcherName)
 			, m_elementTraceInterval(options.ElementTraceInterval)
 			, m_shouldThrowIfFull(options.ShouldThrowIfFull)
+			, m_waitStrategy(options.WaitStrategy)
 			, m_keepRunning(true)
-			, m_barriers(consumers.size() + 1)
+			, m_barriers(CheckStages(stages).size() + 1)
 			, m_disruptor(options.DisruptorSize, options.ElementTraceInterval)
 			, m_inspector(inspector)
-			, m_numActiveElements(0) {
+			, m_numActiveElements(0)
+			, m_claimPosition(0) {
 		auto currentLevel = 0u;
-		for (const auto& consumer : consumers) {
-			ConsumerEntry consumerEntry(currentLevel++);
-			m_threads.create_thread([pThis = this, consumerEntry, consumer]() mutable {
-				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
-				while (pThis->m_keepRunning) {
-					auto* pDisruptorElement = pThis->tryNext(consumerEntry);
-					if (!pDisruptorElement) {
-						std::this_thread::sleep_for(std::chrono::milliseconds(10));
-						continue;
-					}
-
-					auto result = consumer(pDisruptorElement->input());
-					if (CompletionStatus::Aborted == result.CompletionStatus)
-						pThis->m_disruptor.markSkipped(consumerEntry.position(), result.CompletionCode);
-
-					pThis->advance(consumerEntry);
-				}
-			});
+		for (const auto& stage : stages) {
+			auto level = currentLevel++;
+			if (1 == stage.NumWorkerThreads) {
+				spawnWorker(ConsumerEntry(level), stage.Consumer);
+				continue;
+			}
+
+			auto pConsumerEntry = std::make_shared<ParallelConsumerEntry>(level, options.DisruptorSize);
+			for (auto i = 0u; i < stage.NumWorkerThreads; ++i)
+				spawnParallelWorker(pConsumerEntry, stage.Consumer);
 		}
 
 		CATAPULT_LOG(info) << options.DispatcherName << " ConsumerDispatcher spawned " << m_threads.size() << " workers";
 	}
 
+	void ConsumerDispatcher::spawnWorker(ConsumerEntry consumerEntry, const DisruptorConsumer& consumer) {
+		m_threads.create_thread([pThis = this, consumerEntry, consumer]() mutable {
+			thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
+			ConsumerWaiter waiter(pThis->m_waitStrategy, pThis->m_barriers[consumerEntry.level()]);
+			while (pThis->m_keepRunning) {
+				auto* pDisruptorElement = pThis->tryNext(consumerEntry);
+				if (!pDisruptorElement) {
+					waiter.wait(consumerEntry.position());
+					continue;
+				}
+
+				waiter.reset();
+
+				auto result = consumer(pDisruptorElement->input());
+				if (CompletionStatus::Aborted == result.CompletionStatus)
+					pThis->m_disruptor.markSkipped(consumerEntry.position(), result.CompletionCode);
+
+				pThis->advance(consumerEntry);
+			}
+		});
+	}
+
+	void ConsumerDispatcher::spawnParallelWorker(
+			const std::shared_ptr<ParallelConsumerEntry>& pConsumerEntry,
+			const DisruptorConsumer& consumer) {
+		m_threads.create_thread([pThis = this, pConsumerEntry, consumer]() {
+			auto& consumerEntry = *pConsumerEntry;
+			thread::SetThreadName(std::to_string(consumerEntry.level()) + "* " + pThis->name());
+			const auto& barrier = pThis->m_barriers[consumerEntry.level()];
+			ConsumerWaiter waiter(pThis->m_waitStrategy, barrier);
+			while (pThis->m_keepRunning) {
+				PositionType position;
+				auto barrierPosition = barrier.position();
+				if (!consumerEntry.tryClaim(barrierPosition, position)) {
+					waiter.wait(barrierPosition);
+					continue;
+				}
+
+				waiter.reset();
+
+				if (!pThis->m_disruptor.isSkipped(position)) {
+					auto result = consumer(pThis->m_disruptor.elementAt(position).input());
+					if (CompletionStatus::Aborted == result.CompletionStatus)
+						pThis->m_disruptor.markSkipped(position, result.CompletionCode);
+				}
+
+				pThis->complete(consumerEntry, position);
+			}
+		});
+	}
+
 	ConsumerDispatcher::~ConsumerDispatcher() {
 		shutdown();
 	}
@@ -100,7 +223,7 @@ namespace catapult { namespace disruptor {
 	}
 
 	size_t ConsumerDispatcher::size() const {
-		return m_threads.size();
+		return m_barriers.size() - 1;
 	}
 
 	size_t ConsumerDispatcher::numAddedElements() const {
@@ -140,19 +263,44 @@ namespace catapult { namespace disruptor {
 		element.markProcessingComplete();
 	}
 
-	bool ConsumerDispatcher::canProcessNextElement() const {
+	void ConsumerDispatcher::complete(ParallelConsumerEntry& consumerEntry, PositionType position) {
+		// parallel stages are never last, so the inspector never needs to run here
+		consumerEntry.complete(position);
+		AdvanceAcrossMarkedPositions(m_barriers[consumerEntry.level() + 1], [&consumerEntry](auto markedPosition) {
+			return consumerEntry.isCompleted(markedPosition);
+		});
+	}
+
+	bool ConsumerDispatcher::canProcessElementAt(PositionType position) const {
 		auto minPosition = m_barriers[m_barriers.size() - 1].position();
-		auto maxPosition = m_barriers[0].position();
-		auto requiredCapacity = maxPosition - minPosition + 1 + 1; // check for space for *next* element
+		auto requiredCapacity = position - minPosition + 1 + 1; // check for space for element at position
 		auto totalCapacity = m_disruptor.capacity();
 
 		if (requiredCapacity < totalCapacity)
 			return true;
 
-		CATAPULT_LOG(warning) << "disruptor is full (minPosition = " << minPosition << ", maxPosition = " << maxPosition << ")";
+		CATAPULT_LOG(warning) << "disruptor is full (minPosition = " << minPosition << ", maxPosition = " << position << ")";
 		return requiredCapacity == totalCapacity;
 	}
 
+	bool ConsumerDispatcher::tryClaimNextPosition(PositionType& position) {
+		// need to atomically check spare capacity AND claim position, but producers only contend on the claim position
+		auto claimPosition = m_claimPosition.load();
+		do {
+			if (!canProcessElementAt(claimPosition))
+				return false;
+		} while (!m_claimPosition.compare_exchange_weak(claimPosition, claimPosition + 1));
+
+		position = claimPosition;
+		return true;
+	}
+
+	void ConsumerDispatcher::advancePublishedBarrier() {
+		AdvanceAcrossMarkedPositions(m_barriers[0], [&disruptor = m_disruptor](auto position) {
+			return disruptor.isPublished(position);
+		});
+	}
+
 	ProcessingCompleteFunc ConsumerDispatcher::wrap(const ProcessingCompleteFunc& processingComplete) {
 		return [processingComplete, &numActiveElements = m_numActiveElements](auto elementId, const auto& result) {
 			processingComplete(elementId, result);
@@ -166,9 +314,8 @@ namespace catapult { namespace disruptor {
 			return 0;
 		}
 
-		// need to atomically check spare capacity AND add element
-		utils::SpinLockGuard guard(m_addSpinLock);
-		if (!canProcessNextElement()) {
+		PositionType position;
+		if (!tryClaimNextPosition(position)) {
 			if (m_shouldThrowIfFull)
 				CATAPULT_THROW_RUNTIME_ERROR("consumer is too far behind");
 
@@ -176,8 +323,8 @@ namespace catapult { namespace disruptor {
 		}
 
 		++m_numActiveElements;
-		auto id = m_disruptor.add(std::move(input), wrap(processingComplete));
-		m_barriers[0].advance();
+		auto id = m_disruptor.publish(position, std::move(input), wrap(processingComplete));
+		advancePublishedBarrier();
 		return id;
 	}
 
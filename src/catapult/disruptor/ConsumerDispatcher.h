@@ -27,7 +27,12 @@
 #include <boost/thread.hpp>
 #include <atomic>
 
-namespace catapult { namespace disruptor { class ConsumerEntry; } }
+namespace catapult {
+	namespace disruptor {
+		class ConsumerEntry;
+		class ParallelConsumerEntry;
+	}
+}
 
 namespace catapult { namespace disruptor {
 
@@ -42,6 +47,14 @@ namespace catapult { namespace disruptor {
 				const std::vector<DisruptorConsumer>& consumers,
 				const DisruptorInspector& inspector);
 
+		/// Creates a dispatcher of consumer \a stages configured with \a options.
+		/// Inspector (\a inspector) is a special consumer that is always run (independent of skip) and as a last one.
+		/// Inspector runs within a thread of the last stage, which must have a single worker thread.
+		ConsumerDispatcher(
+				const ConsumerDispatcherOptions& options,
+				const std::vector<DisruptorConsumerStage>& stages,
+				const DisruptorInspector& inspector);
+
 		/// Creates a dispatcher of \a consumers configured with \a options.
 		explicit ConsumerDispatcher(const ConsumerDispatcherOptions& options, const std::vector<DisruptorConsumer>& consumers);
 
@@ -54,7 +67,7 @@ namespace catapult { namespace disruptor {
 		/// Returns \c true if dispatcher is running, \c false otherwise.
 		bool isRunning() const;
 
-		/// Returns the number of registered consumers.
+		/// Returns the number of registered consumers (stages).
 		size_t size() const;
 
 		/// Pushes the \a input into underlying disruptor and returns the assigned element id.
@@ -75,20 +88,30 @@ namespace catapult { namespace disruptor {
 
 		void advance(ConsumerEntry& consumerEntry);
 
-		bool canProcessNextElement() const;
+		void spawnWorker(ConsumerEntry consumerEntry, const DisruptorConsumer& consumer);
+
+		void spawnParallelWorker(const std::shared_ptr<ParallelConsumerEntry>& pConsumerEntry, const DisruptorConsumer& consumer);
+
+		void complete(ParallelConsumerEntry& consumerEntry, PositionType position);
+
+		bool canProcessElementAt(PositionType position) const;
+
+		bool tryClaimNextPosition(PositionType& position);
+
+		void advancePublishedBarrier();
 
 		ProcessingCompleteFunc wrap(const ProcessingCompleteFunc& processingComplete);
 
 	private:
 		size_t m_elementTraceInterval;
 		bool m_shouldThrowIfFull;
+		ConsumerWaitStrategy m_waitStrategy;
 		std::atomic_bool m_keepRunning;
 		DisruptorBarriers m_barriers;
 		Disruptor m_disruptor;
 		DisruptorInspector m_inspector;
 		boost::thread_group m_threads;
 		std::atomic<size_t> m_numActiveElements;
-
-		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add
+		std::atomic<PositionType> m_claimPosition; // next position to be claimed by a producer
 	};
 }}
@@ -23,6 +23,18 @@
 
 namespace catapult { namespace disruptor {
 
+	/// Strategies used by consumer threads when waiting for new elements.
+	enum class ConsumerWaitStrategy {
+		/// Consumer continuously polls its barrier without yielding the cpu.
+		Busy_Spin,
+
+		/// Consumer polls its barrier for a short period and then yields the cpu between polls.
+		Spin_Then_Yield,
+
+		/// Consumer blocks until its barrier is advanced.
+		Blocking
+	};
+
 	/// Consumer dispatcher options.
 	struct ConsumerDispatcherOptions {
 	public:
@@ -32,6 +44,7 @@ namespace catapult { namespace disruptor {
 				, DisruptorSize(disruptorSize)
 				, ElementTraceInterval(1)
 				, ShouldThrowIfFull(true)
+				, WaitStrategy(ConsumerWaitStrategy::Blocking)
 		{}
 
 	public:
@@ -46,5 +59,8 @@ namespace catapult { namespace disruptor {
 
 		/// \c true if the dispatcher should throw if full, \c false if it should return an error.
 		bool ShouldThrowIfFull;
+
+		/// Strategy used by consumer threads when waiting for new elements.
+		ConsumerWaitStrategy WaitStrategy;
 	};
 }}
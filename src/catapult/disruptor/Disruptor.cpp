@@ -27,22 +27,39 @@ namespace catapult { namespace disruptor {
 
 	// short rationale for lack of locks:
 	//  1. m_container is initialized with size, so most operations here don't require locks
-	//  2. add is guarded by a lock inside ConsumerDispatcher, which checks if the Disruptor is full
-	//  3. markSkipped and isSkipped are guarded by a lock inside DisruptorElement
+	//  2. publish positions are claimed inside ConsumerDispatcher, which checks if the Disruptor is full,
+	//     so concurrent producers always write to distinct elements
+	//  3. elements are only visible to consumers after they are marked as published in m_publishedMarkers
+	//  4. markSkipped and isSkipped are guarded by a lock inside DisruptorElement
 
 	Disruptor::Disruptor(size_t disruptorSize, size_t elementTraceInterval)
 			: m_elementTraceInterval(elementTraceInterval)
 			, m_container(disruptorSize)
+			, m_publishedMarkers(disruptorSize)
 			, m_allElementsCount(0)
 	{}
 
 	DisruptorElementId Disruptor::add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete) {
-		auto element = DisruptorElement(std::move(input), ++m_allElementsCount, processingComplete);
+		return publish(m_allElementsCount, std::move(input), processingComplete);
+	}
+
+	DisruptorElementId Disruptor::publish(
+			PositionType position,
+			ConsumerInput&& input,
+			const ProcessingCompleteFunc& processingComplete) {
+		auto element = DisruptorElement(std::move(input), position + 1, processingComplete);
 		if (IsIntervalElementId(element.id(), m_elementTraceInterval))
 			CATAPULT_LOG(debug) << "disruptor queuing " << element;
 
-		m_container.push_back(std::move(element));
-		return element.id();
+		auto id = element.id();
+		m_container[position] = std::move(element);
+		m_publishedMarkers.mark(position);
+		++m_allElementsCount;
+		return id;
+	}
+
+	bool Disruptor::isPublished(PositionType position) const {
+		return m_publishedMarkers.isMarked(position);
 	}
 
 	void Disruptor::markSkipped(PositionType position, CompletionCode code) {
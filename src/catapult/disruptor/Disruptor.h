@@ -21,10 +21,12 @@
 #pragma once
 #include "DisruptorBarriers.h"
 #include "DisruptorElement.h"
+#include "PositionMarkers.h"
 #include "catapult/model/Block.h"
 #include "catapult/model/EntityRange.h"
 #include "catapult/utils/CircularBuffer.h"
 #include "catapult/utils/NonCopyable.h"
+#include <algorithm>
 #include <vector>
 
 namespace catapult { namespace disruptor {
@@ -41,6 +43,14 @@ namespace catapult { namespace disruptor {
 		/// Once the processing of the input is complete, \a processingComplete will be called.
 		DisruptorElementId add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete);
 
+		/// Stores an \a input at a previously claimed \a position, marks it as published and returns the assigned disruptor element id.
+		/// Once the processing of the input is complete, \a processingComplete will be called.
+		/// \note This can be called concurrently by multiple producers as long as each one publishes to a distinct position.
+		DisruptorElementId publish(PositionType position, ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete);
+
+		/// Returns \c true if the element at \a position has been published.
+		bool isPublished(PositionType position) const;
+
 		/// Sets skip flag on the element at \a position with \a code.
 		void markSkipped(PositionType position, CompletionCode code);
 
@@ -54,7 +64,7 @@ namespace catapult { namespace disruptor {
 
 		/// Gets the size of the disruptor.
 		CATAPULT_INLINE size_t size() const {
-			return m_container.size();
+			return std::min<size_t>(m_allElementsCount, m_container.capacity());
 		}
 
 		/// Gets the capacity of the disruptor.
@@ -70,6 +80,7 @@ namespace catapult { namespace disruptor {
 	private:
 		size_t m_elementTraceInterval;
 		utils::CircularBuffer<DisruptorElement> m_container;
+		PositionMarkers m_publishedMarkers;
 		std::atomic<uint64_t> m_allElementsCount;
 	};
 }}
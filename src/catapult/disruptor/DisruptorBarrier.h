@@ -23,6 +23,9 @@
 #include "catapult/utils/Logging.h"
 #include "catapult/preprocessor.h"
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -36,11 +39,38 @@ namespace catapult { namespace disruptor {
 		DisruptorBarrier(size_t level, PositionType position)
 				: m_level(level)
 				, m_position(position)
+				, m_numWaiters(0)
 		{}
 
-		/// Advances the barrier.
+		/// Advances the barrier and wakes up all consumers blocked in waitForAdvance.
 		CATAPULT_INLINE void advance() {
 			++m_position;
+			notifyWaiters();
+		}
+
+		/// Advances the barrier if and only if it is currently at \a position.
+		/// Returns \c true if the barrier was advanced by this call.
+		CATAPULT_INLINE bool tryAdvance(PositionType position) {
+			if (!m_position.compare_exchange_strong(position, position + 1))
+				return false;
+
+			notifyWaiters();
+			return true;
+		}
+
+		/// Blocks until the barrier advances past \a position or \a timeout elapses.
+		/// Returns \c true if the barrier is past \a position.
+		bool waitForAdvance(PositionType position, const std::chrono::milliseconds& timeout) const {
+			if (position != m_position)
+				return true;
+
+			// waiter count must be incremented before position is checked under the lock so that a concurrent advance
+			// either is observed by the check or observes the waiter and signals
+			++m_numWaiters;
+			std::unique_lock<std::mutex> lock(m_mutex);
+			auto isAdvanced = m_condition.wait_for(lock, timeout, [this, position]() { return position != m_position; });
+			--m_numWaiters;
+			return isAdvanced;
 		}
 
 		/// Returns level of the barrier.
@@ -53,8 +83,22 @@ namespace catapult { namespace disruptor {
 			return m_position;
 		}
 
+	private:
+		CATAPULT_INLINE void notifyWaiters() {
+			// only signal when there are waiters in order to keep advance cheap when consumers are not blocking
+			if (0 == m_numWaiters)
+				return;
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_condition.notify_all();
+		}
+
 	private:
 		const size_t m_level;
 		std::atomic<PositionType> m_position;
+
+		mutable std::atomic<uint32_t> m_numWaiters;
+		mutable std::mutex m_mutex;
+		mutable std::condition_variable m_condition;
 	};
 }}
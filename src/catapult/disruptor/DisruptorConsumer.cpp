@@ -53,4 +53,12 @@ namespace catapult { namespace disruptor {
 				transactionConsumers,
 				[](const auto& transactionConsumer, auto& input) { return transactionConsumer(input.transactions()); });
 	}
+
+	std::vector<DisruptorConsumerStage> DisruptorConsumerStagesFromConsumers(const std::vector<DisruptorConsumer>& consumers) {
+		std::vector<DisruptorConsumerStage> stages;
+		for (const auto& consumer : consumers)
+			stages.push_back({ consumer, 1 });
+
+		return stages;
+	}
 }}
@@ -46,10 +46,23 @@ namespace catapult { namespace disruptor {
 	/// A const transaction disruptor consumer function.
 	using ConstTransactionConsumer = DisruptorConsumerT<const TransactionElements>;
 
+	/// Disruptor consumer stage composed of a consumer and the number of worker threads executing it.
+	struct DisruptorConsumerStage {
+		/// Consumer.
+		DisruptorConsumer Consumer;
+
+		/// Number of worker threads concurrently processing (distinct) elements.
+		/// \note Only consumers that process each element independently of all other elements can have multiple worker threads.
+		size_t NumWorkerThreads;
+	};
+
 	/// Maps \a blockConsumers to disruptor consumers so that they can be used to create a ConsumerDispatcher.
 	std::vector<DisruptorConsumer> DisruptorConsumersFromBlockConsumers(const std::vector<BlockConsumer>& blockConsumers);
 
 	/// Maps \a transactionConsumers to disruptor consumers so that they can be used to create a ConsumerDispatcher.
 	std::vector<DisruptorConsumer> DisruptorConsumersFromTransactionConsumers(
 			const std::vector<TransactionConsumer>& transactionConsumers);
+
+	/// Maps \a consumers to disruptor consumer stages that are each executed by a single worker thread.
+	std::vector<DisruptorConsumerStage> DisruptorConsumerStagesFromConsumers(const std::vector<DisruptorConsumer>& consumers);
 }}
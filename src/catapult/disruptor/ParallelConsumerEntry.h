@@ -0,0 +1,72 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PositionMarkers.h"
+#include <atomic>
+
+namespace catapult { namespace disruptor {
+
+	/// Holds information about a consumer that is executed by multiple worker threads.
+	class ParallelConsumerEntry {
+	public:
+		/// Creates an entry with a \a level for a disruptor with \a disruptorSize elements.
+		ParallelConsumerEntry(size_t level, size_t disruptorSize)
+				: m_level(level)
+				, m_claimPosition(0)
+				, m_completionMarkers(disruptorSize)
+		{}
+
+	public:
+		/// Returns consumer level.
+		size_t level() const {
+			return m_level;
+		}
+
+		/// Returns \c true if the element at \a position has been completely processed.
+		bool isCompleted(PositionType position) const {
+			return m_completionMarkers.isMarked(position);
+		}
+
+	public:
+		/// Claims the next unclaimed position if it is less than \a endPosition.
+		/// Returns \c true and sets \a position to the claimed position on success.
+		bool tryClaim(PositionType endPosition, PositionType& position) {
+			auto claimPosition = m_claimPosition.load();
+			do {
+				if (claimPosition >= endPosition)
+					return false;
+			} while (!m_claimPosition.compare_exchange_weak(claimPosition, claimPosition + 1));
+
+			position = claimPosition;
+			return true;
+		}
+
+		/// Marks the element at \a position as completely processed.
+		void complete(PositionType position) {
+			m_completionMarkers.mark(position);
+		}
+
+	private:
+		const size_t m_level;
+		std::atomic<PositionType> m_claimPosition;
+		PositionMarkers m_completionMarkers;
+	};
+}}
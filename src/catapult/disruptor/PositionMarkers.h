@@ -0,0 +1,55 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "DisruptorTypes.h"
+#include "catapult/preprocessor.h"
+#include <atomic>
+#include <vector>
+
+namespace catapult { namespace disruptor {
+
+	/// Fixed size set of markers indicating which (circular buffer) positions have been reached.
+	/// \note Markers can be set concurrently by multiple threads as long as each one marks a distinct position.
+	class PositionMarkers {
+	public:
+		/// Creates markers for a circular buffer with \a size elements.
+		explicit PositionMarkers(size_t size) : m_markers(size) {
+			for (auto& marker : m_markers)
+				marker = 0;
+		}
+
+	public:
+		/// Marks \a position as reached.
+		CATAPULT_INLINE void mark(PositionType position) {
+			m_markers[position % m_markers.size()] = position + 1;
+		}
+
+		/// Returns \c true if \a position has been marked.
+		/// \note Marking a position unmarks all other positions sharing the same circular buffer element.
+		CATAPULT_INLINE bool isMarked(PositionType position) const {
+			// markers are one-based, so that default initialized markers do not mark position zero
+			return position + 1 == m_markers[position % m_markers.size()];
+		}
+
+	private:
+		std::vector<std::atomic<PositionType>> m_markers;
+	};
+}}
@@ -33,6 +33,11 @@ namespace catapult { namespace extensions {
 		executionConfig.ResolverContextFactory = [&pluginManager](const auto& cache) {
 			return pluginManager.createResolverContext(cache);
 		};
+
+		// only prefetch when cache state is backed by a database because in-memory lookups are already cheap
+		if (pluginManager.storageConfig().PreferCacheDatabase)
+			executionConfig.PrefetchKeysExtractor = pluginManager.createPrefetchKeysExtractor();
+
 		return executionConfig;
 	}
 }}
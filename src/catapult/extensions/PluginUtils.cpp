@@ -32,6 +32,11 @@ namespace catapult { namespace extensions {
 		storageConfig.PreferCacheDatabase = config.Node.ShouldUseCacheDatabaseStorage;
 		storageConfig.CacheDatabaseDirectory = (boost::filesystem::path(config.User.DataDirectory) / "statedb").generic_string();
 		storageConfig.MaxCacheDatabaseWriteBatchSize = config.Node.MaxCacheDatabaseWriteBatchSize;
+		storageConfig.CacheDatabaseBlockCacheSize = config.Node.CacheDatabaseBlockCacheSize;
+		storageConfig.CacheDatabaseWriteBufferBudget = config.Node.CacheDatabaseWriteBufferBudget;
+		storageConfig.MaxPatriciaTreeNodeCacheSize = config.Node.MaxPatriciaTreeNodeCacheSize;
+		storageConfig.PatriciaTreeNodeCachePinnedLevels = config.Node.PatriciaTreeNodeCachePinnedLevels;
+		storageConfig.PatriciaTreeRetainedRoots = config.Node.PatriciaTreeRetainedRoots;
 		return storageConfig;
 	}
 
@@ -20,6 +20,8 @@
 
 #include "TransactionHandlers.h"
 #include "HandlerUtils.h"
+#include "catapult/api/ChainPackets.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/utils/ShortHash.h"
 #include "catapult/types.h"
@@ -88,4 +90,61 @@ namespace catapult { namespace handlers {
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever) {
 		handlers.registerHandler(ionet::PacketType::Pull_Transactions, CreatePullTransactionsHandler(utRetriever));
 	}
+
+	namespace {
+		struct PullTransactionsSketchInfo {
+		public:
+			PullTransactionsSketchInfo() : IsValid(false)
+			{}
+
+		public:
+			bool IsValid;
+			BlockFeeMultiplier MinFeeMultiplier;
+			std::vector<utils::ShortHashSketchCell> Cells;
+		};
+
+		auto ProcessPullTransactionsSketchRequest(const ionet::Packet& packet) {
+			// packet is guaranteed to have correct type because this function is only called for matching packets by ServerPacketHandlers
+			auto dataSize = ionet::CalculatePacketDataSize(packet);
+			if (dataSize < sizeof(BlockFeeMultiplier))
+				return PullTransactionsSketchInfo();
+
+			// data is prepended with min fee multiplier
+			PullTransactionsSketchInfo info;
+			info.MinFeeMultiplier = BlockFeeMultiplier(reinterpret_cast<const BlockFeeMultiplier::ValueType&>(*packet.Data()));
+			dataSize -= sizeof(BlockFeeMultiplier);
+
+			// followed by sketch cells
+			const auto* pCellDataStart = packet.Data() + sizeof(BlockFeeMultiplier);
+			auto numCells = ionet::CountFixedSizeStructures<utils::ShortHashSketchCell>({ pCellDataStart, dataSize });
+			if (!utils::ShortHashSketch::IsValidCellCount(numCells))
+				return PullTransactionsSketchInfo();
+
+			const auto* pCell = reinterpret_cast<const utils::ShortHashSketchCell*>(pCellDataStart);
+			info.Cells.assign(pCell, pCell + numCells);
+
+			info.IsValid = true;
+			return info;
+		}
+
+		auto CreatePullTransactionsSketchHandler(const UtSketchRetriever& utSketchRetriever) {
+			return [utSketchRetriever](const auto& packet, auto& context) {
+				auto info = ProcessPullTransactionsSketchRequest(packet);
+				if (!info.IsValid)
+					return;
+
+				auto result = utSketchRetriever(info.MinFeeMultiplier, utils::ShortHashSketch(std::move(info.Cells)));
+
+				// response is prepended with the number of decoded differences
+				ionet::PacketPayloadBuilder builder(ionet::PacketType::Pull_Transactions_Sketch);
+				builder.appendValue(result.IsDecoded ? result.NumDifferences : api::Undecodable_Sketch_Num_Differences);
+				builder.appendEntities(result.Transactions);
+				context.response(builder.build());
+			};
+		}
+	}
+
+	void RegisterPullTransactionsSketchHandler(ionet::ServerPacketHandlers& handlers, const UtSketchRetriever& utSketchRetriever) {
+		handlers.registerHandler(ionet::PacketType::Pull_Transactions_Sketch, CreatePullTransactionsSketchHandler(utSketchRetriever));
+	}
 }}
@@ -24,6 +24,7 @@
 #include "catapult/model/RangeTypes.h"
 #include "catapult/model/Transaction.h"
 #include "catapult/utils/ShortHash.h"
+#include "catapult/utils/ShortHashSketch.h"
 #include <unordered_set>
 
 namespace catapult { namespace handlers {
@@ -44,4 +45,23 @@ namespace catapult { namespace handlers {
 	/// Registers a pull transactions handler in \a handlers that responds with unconfirmed transactions
 	/// returned by the retriever (\a utRetriever).
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever);
+
+	/// Result of retrieving unconfirmed transactions given a short hash sketch.
+	struct UtSketchRetrieverResult {
+		/// \c true if the difference between the local and remote short hashes could be decoded.
+		bool IsDecoded;
+
+		/// Number of short hashes in the decoded difference.
+		uint32_t NumDifferences;
+
+		/// Unconfirmed transactions that are known locally but not remotely.
+		UnconfirmedTransactions Transactions;
+	};
+
+	/// Prototype for a function that retrieves unconfirmed transactions given a sketch of remote short hashes.
+	using UtSketchRetriever = std::function<UtSketchRetrieverResult (BlockFeeMultiplier, const utils::ShortHashSketch&)>;
+
+	/// Registers a pull transactions sketch handler in \a handlers that responds with unconfirmed transactions
+	/// returned by the retriever (\a utSketchRetriever).
+	void RegisterPullTransactionsSketchHandler(ionet::ServerPacketHandlers& handlers, const UtSketchRetriever& utSketchRetriever);
 }}
@@ -61,6 +61,10 @@ namespace catapult { namespace io {
 				return m_pStorage->loadBlock(height);
 			}
 
+			std::vector<std::shared_ptr<const model::Block>> loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const override {
+				return m_pStorage->loadBlocks(height, maxBlocks, maxBytes);
+			}
+
 			std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override {
 				return m_pStorage->loadBlockElement(height);
 			}
@@ -0,0 +1,43 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BlockStorage.h"
+
+namespace catapult { namespace io {
+
+	std::vector<std::shared_ptr<const model::Block>> BlockStorage::loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const {
+		std::vector<std::shared_ptr<const model::Block>> blocks;
+		if (Height(0) == height)
+			return blocks;
+
+		size_t totalSize = 0;
+		auto endHeight = chainHeight() + Height(1);
+		for (auto currentHeight = height; endHeight > currentHeight && blocks.size() < maxBlocks; currentHeight = currentHeight + Height(1)) {
+			auto pBlock = loadBlock(currentHeight);
+			if (!blocks.empty() && totalSize + pBlock->Size > maxBytes)
+				break;
+
+			totalSize += pBlock->Size;
+			blocks.push_back(std::move(pBlock));
+		}
+
+		return blocks;
+	}
+}}
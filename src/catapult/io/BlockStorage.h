@@ -24,6 +24,7 @@
 #include "catapult/model/RangeTypes.h"
 #include "catapult/utils/NonCopyable.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace io {
 
@@ -52,6 +53,10 @@ namespace catapult { namespace io {
 		/// Returns the block at \a height.
 		virtual std::shared_ptr<const model::Block> loadBlock(Height height) const = 0;
 
+		/// Returns at most \a maxBlocks consecutive blocks starting at \a height with a total size of at most \a maxBytes.
+		/// \note The block at \a height is always returned (if it exists) even if it is larger than \a maxBytes.
+		virtual std::vector<std::shared_ptr<const model::Block>> loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const;
+
 		/// Returns the block element (owning a block) at \a height.
 		virtual std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const = 0;
 
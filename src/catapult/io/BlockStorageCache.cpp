@@ -20,7 +20,11 @@
 
 #include "BlockStorageCache.h"
 #include "catapult/model/Elements.h"
+#include "catapult/utils/Hashers.h"
 #include "catapult/utils/MemoryUtils.h"
+#include "catapult/utils/SpinLock.h"
+#include <list>
+#include <unordered_map>
 
 namespace catapult { namespace io {
 
@@ -76,45 +80,121 @@ namespace catapult { namespace io {
 
 	// region CachedData
 
+	namespace {
+		uint64_t GetApproximateSize(const model::BlockElement& blockElement) {
+			return sizeof(model::BlockElement)
+					+ blockElement.Block.Size
+					+ blockElement.Transactions.size() * sizeof(model::TransactionElement);
+		}
+	}
+
 	struct CachedData {
+	private:
+		using BlockElementPointer = std::shared_ptr<const model::BlockElement>;
+		using BlockElementList = std::list<BlockElementPointer>;
+
+	public:
+		explicit CachedData(uint64_t maxSize)
+				: m_maxSize(maxSize)
+				, m_totalSize(0)
+				, m_numHits(0)
+				, m_numMisses(0)
+		{}
+
 	public:
 		Height height() const {
 			return m_chainHeight;
 		}
 
-		std::shared_ptr<const model::Block> block(Height) const {
-			return BlockElementAsSharedBlock(m_pBlockElement);
+		BlockStorageCacheStatistics statistics() const {
+			utils::SpinLockGuard guard(m_lock);
+			return { m_elements.size(), m_totalSize, m_numHits, m_numMisses };
 		}
 
-		std::shared_ptr<const model::BlockElement> blockElement(Height) const {
-			return m_pBlockElement;
+	public:
+		// note: find and add are const because they are called by (concurrent) views; the lru state is guarded by m_lock
+		BlockElementPointer find(Height height) const {
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_heightToElementIter.find(height);
+			if (m_heightToElementIter.cend() == iter) {
+				++m_numMisses;
+				return nullptr;
+			}
+
+			++m_numHits;
+			m_elements.splice(m_elements.begin(), m_elements, iter->second);
+			return *iter->second;
 		}
 
-	public:
-		bool contains(Height height) const {
-			return m_pBlockElement && height == m_pBlockElement->Block.Height;
+		BlockElementPointer add(const BlockElementPointer& pBlockElement) const {
+			utils::SpinLockGuard guard(m_lock);
+			auto height = pBlockElement->Block.Height;
+			auto iter = m_heightToElementIter.find(height);
+			if (m_heightToElementIter.cend() != iter) {
+				// another view loaded the same block concurrently, so keep the cached element
+				m_elements.splice(m_elements.begin(), m_elements, iter->second);
+				return *iter->second;
+			}
+
+			m_elements.push_front(pBlockElement);
+			m_heightToElementIter.emplace(height, m_elements.begin());
+			m_totalSize += GetApproximateSize(*pBlockElement);
+
+			while (m_totalSize > m_maxSize && m_elements.size() > 1)
+				remove(std::prev(m_elements.end()));
+
+			return pBlockElement;
 		}
 
 	public:
 		void update(Height height) {
 			m_chainHeight = height;
 
-			if (m_pBlockElement && height < m_pBlockElement->Block.Height)
-				m_pBlockElement.reset();
+			utils::SpinLockGuard guard(m_lock);
+			for (auto iter = m_elements.begin(); m_elements.end() != iter;) {
+				auto nextIter = std::next(iter);
+				if (height < (*iter)->Block.Height)
+					remove(iter);
+
+				iter = nextIter;
+			}
 		}
 
 		void update(const model::BlockElement& blockElement) {
-			// note: update receives elements during loadBlock, but also saveBlock. We get them from BlockChainSyncConsumer,
+			// note: update receives elements during saveBlock. We get them from BlockChainSyncConsumer,
 			// and it gets them from disruptor... in order NOT to copy here we'd need to take ownership of those.
 			// Currently we can't/shouldn't do it, as there's "new block" consumer afterwards and possibly ProcessingCompleteFunc.
-			m_pBlockElement = Copy(blockElement);
+			// note: when an element at the same height is already cached (e.g. after a rollback), it needs to be replaced
+			{
+				utils::SpinLockGuard guard(m_lock);
+				auto iter = m_heightToElementIter.find(blockElement.Block.Height);
+				if (m_heightToElementIter.cend() != iter)
+					remove(iter->second);
+			}
+
+			add(Copy(blockElement));
+		}
+
+	private:
+		void remove(BlockElementList::iterator iter) const {
+			m_totalSize -= GetApproximateSize(**iter);
+			m_heightToElementIter.erase((*iter)->Block.Height);
+			m_elements.erase(iter);
 		}
 
 	private:
 		// note: the reason to have them separated is drop blocks, which
-		// updates the height, but we don't want to touch cached block(s).
+		// updates the height, but we don't want to touch cached block(s) at or below it.
 		Height m_chainHeight;
-		std::shared_ptr<const model::BlockElement> m_pBlockElement;
+		uint64_t m_maxSize;
+
+		// most recently used elements are at the front
+		mutable BlockElementList m_elements;
+		mutable std::unordered_map<Height, BlockElementList::iterator, utils::BaseValueHasher<Height>> m_heightToElementIter;
+		mutable uint64_t m_totalSize;
+		mutable uint64_t m_numHits;
+		mutable uint64_t m_numMisses;
+		mutable utils::SpinLock m_lock;
 	};
 
 	// endregion
@@ -123,8 +203,12 @@ namespace catapult { namespace io {
 
 	// This ctor takes r-value, to move the storage (that's not a move ctor).
 	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage)
+			: BlockStorageCache(std::move(pStorage), utils::FileSize())
+	{}
+
+	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, utils::FileSize maxCacheSize)
 			: m_pStorage(std::move(pStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
+			, m_pCachedData(std::make_unique<CachedData>(maxCacheSize.bytes())) {
 		m_pCachedData->update(m_pStorage->chainHeight());
 	}
 
@@ -142,20 +226,57 @@ namespace catapult { namespace io {
 		if (height > chainHeight())
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
 
-		if (m_cachedData.contains(height))
-			return m_cachedData.block(height);
+		return BlockElementAsSharedBlock(loadBlockElement(height));
+	}
+
+	std::vector<std::shared_ptr<const model::Block>> BlockStorageView::loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const {
+		std::vector<std::shared_ptr<const model::Block>> blocks;
+		if (Height(0) == height || height > chainHeight())
+			return blocks;
+
+		size_t totalSize = 0;
+		auto tryAppend = [&blocks, &totalSize, maxBytes](std::shared_ptr<const model::Block>&& pBlock) {
+			if (!blocks.empty() && totalSize + pBlock->Size > maxBytes)
+				return false;
+
+			totalSize += pBlock->Size;
+			blocks.push_back(std::move(pBlock));
+			return true;
+		};
+
+		auto numBlocks = std::min<size_t>(maxBlocks, (chainHeight() - height).unwrap() + 1);
+		while (blocks.size() < numBlocks) {
+			auto currentHeight = height + Height(blocks.size());
+			auto pBlockElement = m_cachedData.find(currentHeight);
+			if (pBlockElement) {
+				if (!tryAppend(BlockElementAsSharedBlock(pBlockElement)))
+					break;
+
+				continue;
+			}
+
+			// load all remaining blocks with a single range load
+			auto remainingBytes = maxBytes > totalSize ? maxBytes - totalSize : 0;
+			for (auto& pBlock : m_storage.loadBlocks(currentHeight, numBlocks - blocks.size(), remainingBytes)) {
+				if (!tryAppend(std::move(pBlock)))
+					break;
+			}
 
-		return m_storage.loadBlock(height);
+			break;
+		}
+
+		return blocks;
 	}
 
 	std::shared_ptr<const model::BlockElement> BlockStorageView::loadBlockElement(Height height) const {
 		if (height > chainHeight())
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
 
-		if (m_cachedData.contains(height))
-			return m_cachedData.blockElement(height);
+		auto pBlockElement = m_cachedData.find(height);
+		if (pBlockElement)
+			return pBlockElement;
 
-		return m_storage.loadBlockElement(height);
+		return m_cachedData.add(m_storage.loadBlockElement(height));
 	}
 
 	std::pair<std::vector<uint8_t>, bool> BlockStorageView::loadBlockStatementData(Height height) const {
@@ -184,10 +305,10 @@ namespace catapult { namespace io {
 		if (blockElements.empty())
 			return;
 
-		for (const auto& blockElement : blockElements)
+		for (const auto& blockElement : blockElements) {
 			m_storage.saveBlock(blockElement);
-
-		CacheBlockElement(m_cachedData, blockElements.back());
+			CacheBlockElement(m_cachedData, blockElement);
+		}
 	}
 
 	void BlockStorageModifier::dropBlocksAfter(Height height) {
@@ -207,5 +328,9 @@ namespace catapult { namespace io {
 		return BlockStorageModifier(*m_pStorage, m_lock.acquireReader(), *m_pCachedData);
 	}
 
+	BlockStorageCacheStatistics BlockStorageCache::statistics() const {
+		return m_pCachedData->statistics();
+	}
+
 	// endregion
 }}
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "BlockStorage.h"
+#include "catapult/utils/FileSize.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 
 namespace catapult { namespace io { struct CachedData; } }
@@ -49,6 +50,10 @@ namespace catapult { namespace io {
 		/// Returns the block at \a height.
 		std::shared_ptr<const model::Block> loadBlock(Height height) const;
 
+		/// Returns at most \a maxBlocks consecutive blocks starting at \a height with a total size of at most \a maxBytes.
+		/// \note Blocks that are not cached are loaded from storage with a single range load and are not added to the cache.
+		std::vector<std::shared_ptr<const model::Block>> loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const;
+
 		/// Returns the block element (owning a block) at \a height.
 		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const;
 
@@ -92,13 +97,32 @@ namespace catapult { namespace io {
 		CachedData& m_cachedData;
 	};
 
+	/// Block storage cache statistics.
+	struct BlockStorageCacheStatistics {
+		/// Number of cached block elements.
+		size_t NumCachedBlocks;
+
+		/// Approximate size of all cached block elements.
+		uint64_t CachedBlocksSize;
+
+		/// Number of block loads served by the cache.
+		uint64_t NumHits;
+
+		/// Number of block loads forwarded to the underlying storage.
+		uint64_t NumMisses;
+	};
+
 	/// A cache around a BlockStorage.
-	/// \note Currently this "cache" only provides synchronization.
+	/// \note Recently saved and loaded block elements are kept in a size bounded least recently used cache.
 	class BlockStorageCache {
 	public:
-		/// Creates a new cache around \a pStorage.
+		/// Creates a new cache around \a pStorage that only retains the most recently used block element.
 		explicit BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage);
 
+		/// Creates a new cache around \a pStorage that retains block elements with a combined size of at most \a maxCacheSize.
+		/// \note The most recently used block element is always retained.
+		BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, utils::FileSize maxCacheSize);
+
 		/// Destroys the cache.
 		~BlockStorageCache();
 
@@ -109,6 +133,9 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets the cache statistics.
+		BlockStorageCacheStatistics statistics() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<CachedData> m_pCachedData;
@@ -0,0 +1,63 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BlockStorageConverter.h"
+#include "BlockStatementSerializer.h"
+#include "BufferInputStreamAdapter.h"
+#include "catapult/utils/Logging.h"
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr uint64_t Log_Interval = 10'000;
+
+		void LoadBlockStatement(const BlockStorage& source, Height height, model::BlockElement& blockElement) {
+			auto blockStatementPair = source.loadBlockStatementData(height);
+			if (!blockStatementPair.second)
+				return;
+
+			BufferInputStreamAdapter<std::vector<uint8_t>> input(blockStatementPair.first);
+			auto pBlockStatement = std::make_shared<model::BlockStatement>();
+			ReadBlockStatement(input, *pBlockStatement);
+			blockElement.OptionalStatement = std::move(pBlockStatement);
+		}
+	}
+
+	uint64_t ConvertBlockStorage(const BlockStorage& source, BlockStorage& destination) {
+		auto sourceHeight = source.chainHeight();
+		auto destinationHeight = destination.chainHeight();
+		if (sourceHeight <= destinationHeight)
+			return 0;
+
+		uint64_t numCopiedBlocks = 0;
+		for (auto height = destinationHeight + Height(1); height <= sourceHeight; height = height + Height(1)) {
+			// copy the block element because the statement needs to be attached
+			auto pSourceBlockElement = source.loadBlockElement(height);
+			auto blockElement = *pSourceBlockElement;
+			LoadBlockStatement(source, height, blockElement);
+			destination.saveBlock(blockElement);
+
+			if (0 == ++numCopiedBlocks % Log_Interval)
+				CATAPULT_LOG(info) << "converted blocks up to height " << height << " / " << sourceHeight;
+		}
+
+		return numCopiedBlocks;
+	}
+}}
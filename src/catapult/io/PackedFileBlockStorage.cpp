@@ -0,0 +1,511 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PackedFileBlockStorage.h"
+#include "BlockStatementSerializer.h"
+#include "PodIoUtils.h"
+#include "Stream.h"
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <inttypes.h>
+
+namespace catapult { namespace io {
+
+	namespace {
+		static constexpr auto Index_File = "packed_index.dat";
+		static constexpr auto Hash_File = "packed_hashes.dat";
+		static constexpr uint32_t No_Statement_Marker = 0;
+		static constexpr auto Default_Max_Segment_Size = utils::FileSize::FromMegabytes(1024);
+		static constexpr size_t Record_Alignment = 8;
+
+		// region path utils
+
+#ifdef _MSC_VER
+#define SPRINTF sprintf_s
+#else
+#define SPRINTF sprintf
+#endif
+
+		std::string GetPath(const std::string& baseDirectory, const char* filename) {
+			boost::filesystem::path path = baseDirectory;
+			path /= filename;
+			return path.generic_string();
+		}
+
+		// endregion
+
+		// region file utils
+
+		void WriteAt(RawFile& file, uint64_t position, const RawBuffer& buffer) {
+			// zero fill any gap because seeking past the end of the file is not allowed
+			if (position > file.size()) {
+				file.seek(file.size());
+				file.write(std::vector<uint8_t>(position - file.size()));
+			}
+
+			file.seek(position);
+			file.write(buffer);
+		}
+
+		// endregion
+
+		// region RecordOutputStream
+
+		class RecordOutputStream final : public OutputStream {
+		public:
+			explicit RecordOutputStream(std::vector<uint8_t>& record) : m_record(record)
+			{}
+
+		public:
+			void write(const RawBuffer& buffer) override {
+				m_record.insert(m_record.end(), buffer.pData, buffer.pData + buffer.Size);
+			}
+
+			void flush() override
+			{}
+
+		private:
+			std::vector<uint8_t>& m_record;
+		};
+
+		// endregion
+
+		// region RecordReader
+
+		class RecordReader {
+		public:
+			RecordReader(const uint8_t* pData, size_t size, Height height)
+					: m_pData(pData)
+					, m_size(size)
+					, m_height(height)
+			{}
+
+		public:
+			const uint8_t* read(size_t size) {
+				if (size > m_size)
+					CATAPULT_THROW_RUNTIME_ERROR_1("packed block record is corrupt, height", m_height);
+
+				auto pData = m_pData;
+				m_pData += size;
+				m_size -= size;
+				return pData;
+			}
+
+			uint32_t read32() {
+				uint32_t value;
+				std::memcpy(&value, read(sizeof(uint32_t)), sizeof(uint32_t));
+				return value;
+			}
+
+			void read(Hash256& hash) {
+				std::memcpy(hash.data(), read(Hash256_Size), Hash256_Size);
+			}
+
+		private:
+			const uint8_t* m_pData;
+			size_t m_size;
+			Height m_height;
+		};
+
+		// endregion
+
+		// region record serialization
+
+		void AppendHashes(RecordOutputStream& output, const std::vector<Hash256>& hashes) {
+			Write32(output, static_cast<uint32_t>(hashes.size()));
+			output.write({ reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size() * Hash256_Size });
+		}
+
+		std::vector<uint8_t> SerializeRecord(const model::BlockElement& blockElement) {
+			std::vector<uint8_t> record;
+			record.reserve(blockElement.Block.Size + 2 * Hash256_Size * (blockElement.Transactions.size() + 2));
+
+			// 1. write block and constant size data
+			RecordOutputStream output(record);
+			output.write({ reinterpret_cast<const uint8_t*>(&blockElement.Block), blockElement.Block.Size });
+			output.write(blockElement.EntityHash);
+			output.write(blockElement.GenerationHash);
+
+			// 2. write transaction hashes
+			std::vector<Hash256> transactionHashes;
+			transactionHashes.reserve(2 * blockElement.Transactions.size());
+			for (const auto& transactionElement : blockElement.Transactions) {
+				transactionHashes.push_back(transactionElement.EntityHash);
+				transactionHashes.push_back(transactionElement.MerkleComponentHash);
+			}
+
+			Write32(output, static_cast<uint32_t>(blockElement.Transactions.size()));
+			output.write({ reinterpret_cast<const uint8_t*>(transactionHashes.data()), transactionHashes.size() * Hash256_Size });
+
+			// 3. write sub cache merkle roots
+			AppendHashes(output, blockElement.SubCacheMerkleRoots);
+
+			// 4. write statements (size prefixed, a serialized block statement is never empty)
+			auto statementSizeOffset = record.size();
+			Write32(output, No_Statement_Marker);
+			if (blockElement.OptionalStatement) {
+				WriteBlockStatement(output, *blockElement.OptionalStatement);
+				auto statementSize = static_cast<uint32_t>(record.size() - statementSizeOffset - sizeof(uint32_t));
+				std::memcpy(&record[statementSizeOffset], &statementSize, sizeof(uint32_t));
+			}
+
+			return record;
+		}
+
+		void ReadTransactionHashes(RecordReader& reader, model::BlockElement& blockElement) {
+			auto numTransactions = reader.read32();
+			for (const auto& transaction : blockElement.Block.Transactions()) {
+				if (0 == numTransactions--)
+					CATAPULT_THROW_RUNTIME_ERROR_1("packed block record has too few transaction hashes", blockElement.Block.Height);
+
+				blockElement.Transactions.push_back(model::TransactionElement(transaction));
+				reader.read(blockElement.Transactions.back().EntityHash);
+				reader.read(blockElement.Transactions.back().MerkleComponentHash);
+			}
+		}
+
+		void ReadSubCacheMerkleRoots(RecordReader& reader, std::vector<Hash256>& subCacheMerkleRoots) {
+			auto numHashes = reader.read32();
+			subCacheMerkleRoots.resize(numHashes);
+			for (auto& hash : subCacheMerkleRoots)
+				reader.read(hash);
+		}
+
+		// endregion
+	}
+
+	// region MappedFile
+
+	/// Read only memory mapping of a file that grows by appending.
+	class PackedFileBlockStorage::MappedFile {
+	public:
+		struct Mapping {
+		public:
+			Mapping(const std::string& path, uint64_t size)
+					: Region(boost::interprocess::file_mapping(path.c_str(), boost::interprocess::read_only),
+							boost::interprocess::read_only,
+							0,
+							size)
+			{}
+
+		public:
+			const uint8_t* data() const {
+				return static_cast<const uint8_t*>(Region.get_address());
+			}
+
+			uint64_t size() const {
+				return Region.get_size();
+			}
+
+		public:
+			boost::interprocess::mapped_region Region;
+		};
+
+	public:
+		explicit MappedFile(const std::string& path) : m_path(path)
+		{}
+
+	public:
+		/// Gets a mapping of the file that contains at least \a size bytes.
+		/// \note Previously returned mappings stay valid as long as they are referenced.
+		std::shared_ptr<const Mapping> map(uint64_t size) const {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			if (m_pMapping && m_pMapping->size() >= size)
+				return m_pMapping;
+
+			// remap the entire file because it was appended to since the last mapping
+			auto fileSize = boost::filesystem::exists(m_path) ? boost::filesystem::file_size(m_path) : 0;
+			if (fileSize < size)
+				CATAPULT_THROW_RUNTIME_ERROR_2("packed block storage file is truncated", m_path, size);
+
+			m_pMapping = std::make_shared<const Mapping>(m_path, fileSize);
+			return m_pMapping;
+		}
+
+	private:
+		std::string m_path;
+		mutable std::shared_ptr<const Mapping> m_pMapping;
+		mutable std::mutex m_mutex;
+	};
+
+	struct PackedFileBlockStorage::RecordLocation {
+		/// Offset of the record in the segment.
+		uint64_t Offset;
+
+		/// Segment containing the record.
+		uint32_t SegmentId;
+
+		/// Size of the record.
+		uint32_t Size;
+	};
+
+	namespace {
+		// note: index slot zero holds the chain height, slot N holds the location of the block at height N
+		constexpr auto Index_Slot_Size = 16u;
+
+		template<typename TMapping>
+		std::shared_ptr<const model::Block> MapBlock(const std::shared_ptr<TMapping>& pMapping, uint64_t offset, uint32_t size, Height height) {
+			const auto* pBlock = reinterpret_cast<const model::Block*>(pMapping->data() + offset);
+			if (size < sizeof(model::Block) || size < pBlock->Size || height != pBlock->Height)
+				CATAPULT_THROW_RUNTIME_ERROR_1("packed block record is corrupt, height", height);
+
+			// alias the mapping so that it stays alive as long as the block is referenced
+			return std::shared_ptr<const model::Block>(pMapping, pBlock);
+		}
+	}
+
+	// endregion
+
+	// region ctor
+
+	PackedFileBlockStorage::PackedFileBlockStorage(const std::string& dataDirectory)
+			: PackedFileBlockStorage(dataDirectory, Default_Max_Segment_Size)
+	{}
+
+	PackedFileBlockStorage::PackedFileBlockStorage(const std::string& dataDirectory, utils::FileSize maxSegmentSize)
+			: m_dataDirectory(dataDirectory)
+			, m_maxSegmentSize(maxSegmentSize.bytes())
+			, m_pIndexFile(std::make_unique<MappedFile>(GetPath(m_dataDirectory, Index_File)))
+			, m_pHashFile(std::make_unique<MappedFile>(GetPath(m_dataDirectory, Hash_File)))
+			, m_tailSegmentId(0) {
+		static_assert(Index_Slot_Size == sizeof(RecordLocation), "index slot must be able to hold a record location");
+
+		auto indexPath = GetPath(m_dataDirectory, Index_File);
+		if (boost::filesystem::exists(indexPath)) {
+			RawFile indexFile(indexPath, OpenMode::Read_Only, LockMode::None);
+			m_chainHeight = Read<Height>(indexFile);
+		}
+
+		while (boost::filesystem::exists(segmentPath(m_tailSegmentId + 1)))
+			++m_tailSegmentId;
+	}
+
+	PackedFileBlockStorage::~PackedFileBlockStorage() = default;
+
+	// endregion
+
+	// region LightBlockStorage
+
+	Height PackedFileBlockStorage::chainHeight() const {
+		return m_chainHeight;
+	}
+
+	model::HashRange PackedFileBlockStorage::loadHashesFrom(Height height, size_t maxHashes) const {
+		if (Height(0) == height || m_chainHeight < height)
+			return model::HashRange();
+
+		auto numAvailableHashes = static_cast<size_t>((m_chainHeight - height).unwrap() + 1);
+		auto numHashes = std::min(maxHashes, numAvailableHashes);
+
+		auto startOffset = height.unwrap() * Hash256_Size;
+		auto pMapping = m_pHashFile->map(startOffset + numHashes * Hash256_Size);
+
+		uint8_t* pData = nullptr;
+		auto range = model::HashRange::PrepareFixed(numHashes, &pData);
+		std::memcpy(pData, pMapping->data() + startOffset, numHashes * Hash256_Size);
+		return range;
+	}
+
+	void PackedFileBlockStorage::saveBlock(const model::BlockElement& blockElement) {
+		auto height = blockElement.Block.Height;
+		if (height != m_chainHeight + Height(1))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot save out of order block at height", height);
+
+		auto record = SerializeRecord(blockElement);
+		auto recordSize = record.size();
+		record.resize((recordSize + Record_Alignment - 1) / Record_Alignment * Record_Alignment);
+		prepareWriters();
+
+		// 1. append record to the tail segment, starting a new segment when the tail segment is full
+		// (note that records are never overwritten, so previously loaded blocks are never modified)
+		if (0 != m_pTailSegmentWriter->size() && m_pTailSegmentWriter->size() + record.size() > m_maxSegmentSize) {
+			++m_tailSegmentId;
+			m_pTailSegmentWriter = std::make_unique<RawFile>(segmentPath(m_tailSegmentId), OpenMode::Read_Append, LockMode::None);
+		}
+
+		RecordLocation location{ m_pTailSegmentWriter->size(), m_tailSegmentId, static_cast<uint32_t>(recordSize) };
+		m_pTailSegmentWriter->seek(location.Offset);
+		m_pTailSegmentWriter->write(record);
+
+		// 2. write hash
+		WriteAt(*m_pHashWriter, height.unwrap() * Hash256_Size, blockElement.EntityHash);
+
+		// 3. write location and height
+		WriteAt(*m_pIndexWriter, height.unwrap() * Index_Slot_Size, { reinterpret_cast<const uint8_t*>(&location), sizeof(RecordLocation) });
+		setHeight(height);
+	}
+
+	void PackedFileBlockStorage::dropBlocksAfter(Height height) {
+		prepareWriters();
+		setHeight(height);
+	}
+
+	// endregion
+
+	// region BlockStorage
+
+	std::shared_ptr<const model::Block> PackedFileBlockStorage::loadBlock(Height height) const {
+		uint32_t recordSize;
+		return loadRecord(height, "block", recordSize);
+	}
+
+	std::vector<std::shared_ptr<const model::Block>> PackedFileBlockStorage::loadBlocks(
+			Height height,
+			size_t maxBlocks,
+			size_t maxBytes) const {
+		std::vector<std::shared_ptr<const model::Block>> blocks;
+		if (Height(0) == height || m_chainHeight < height)
+			return blocks;
+
+		auto numAvailableBlocks = static_cast<size_t>((m_chainHeight - height).unwrap() + 1);
+		auto numBlocks = std::min(maxBlocks, numAvailableBlocks);
+		if (0 == numBlocks)
+			return blocks;
+
+		// map the index slots of all requested blocks at once
+		auto indexOffset = height.unwrap() * Index_Slot_Size;
+		auto pIndexMapping = m_pIndexFile->map(indexOffset + numBlocks * Index_Slot_Size);
+
+		// blocks are zero-copy views, so all blocks stored in the same segment share a single mapping
+		size_t totalSize = 0;
+		uint32_t mappedSegmentId = 0;
+		std::shared_ptr<const MappedFile::Mapping> pMapping;
+		blocks.reserve(numBlocks);
+		for (auto i = 0u; i < numBlocks; ++i) {
+			RecordLocation location;
+			std::memcpy(&location, pIndexMapping->data() + indexOffset + i * Index_Slot_Size, sizeof(RecordLocation));
+
+			if (!pMapping || mappedSegmentId != location.SegmentId || pMapping->size() < location.Offset + location.Size) {
+				pMapping = segment(location.SegmentId).map(location.Offset + location.Size);
+				mappedSegmentId = location.SegmentId;
+			}
+
+			auto pBlock = MapBlock(pMapping, location.Offset, location.Size, height + Height(i));
+			if (!blocks.empty() && totalSize + pBlock->Size > maxBytes)
+				break;
+
+			totalSize += pBlock->Size;
+			blocks.push_back(std::move(pBlock));
+		}
+
+		return blocks;
+	}
+
+	std::shared_ptr<const model::BlockElement> PackedFileBlockStorage::loadBlockElement(Height height) const {
+		uint32_t recordSize;
+		auto pBlock = loadRecord(height, "block element", recordSize);
+
+		// the block element references the block in the mapping, so keep the mapping alive via the deleter
+		auto pBlockElement = std::shared_ptr<model::BlockElement>(new model::BlockElement(*pBlock), [pBlock](const auto* pElement) {
+			delete pElement;
+		});
+
+		RecordReader reader(reinterpret_cast<const uint8_t*>(pBlock.get()), recordSize, height);
+		reader.read(pBlock->Size);
+		reader.read(pBlockElement->EntityHash);
+		reader.read(pBlockElement->GenerationHash);
+		ReadTransactionHashes(reader, *pBlockElement);
+		ReadSubCacheMerkleRoots(reader, pBlockElement->SubCacheMerkleRoots);
+		return pBlockElement;
+	}
+
+	std::pair<std::vector<uint8_t>, bool> PackedFileBlockStorage::loadBlockStatementData(Height height) const {
+		uint32_t recordSize;
+		auto pBlock = loadRecord(height, "block statement data", recordSize);
+
+		// skip everything preceding the statement
+		RecordReader reader(reinterpret_cast<const uint8_t*>(pBlock.get()), recordSize, height);
+		reader.read(pBlock->Size + 2 * Hash256_Size);
+		reader.read(2 * Hash256_Size * reader.read32());
+		reader.read(Hash256_Size * reader.read32());
+
+		auto statementSize = reader.read32();
+		if (No_Statement_Marker == statementSize)
+			return std::make_pair(std::vector<uint8_t>(), false);
+
+		const auto* pStatementData = reader.read(statementSize);
+		return std::make_pair(std::vector<uint8_t>(pStatementData, pStatementData + statementSize), true);
+	}
+
+	// endregion
+
+	// region private helpers
+
+	void PackedFileBlockStorage::requireHeight(Height height, const char* description) const {
+		if (height <= m_chainHeight && Height(0) != height)
+			return;
+
+		std::ostringstream out;
+		out << "cannot load " << description << " at height (" << height << ") greater than chain height (" << m_chainHeight << ")";
+		CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+	}
+
+	std::string PackedFileBlockStorage::segmentPath(uint32_t segmentId) const {
+		char filename[32];
+		SPRINTF(filename, "packed_%05" PRIu32 ".dat", segmentId);
+		return GetPath(m_dataDirectory, filename);
+	}
+
+	PackedFileBlockStorage::MappedFile& PackedFileBlockStorage::segment(uint32_t segmentId) const {
+		std::lock_guard<std::mutex> guard(m_segmentFilesMutex);
+		if (m_segmentFiles.size() <= segmentId)
+			m_segmentFiles.resize(segmentId + 1);
+
+		auto& pSegmentFile = m_segmentFiles[segmentId];
+		if (!pSegmentFile)
+			pSegmentFile = std::make_unique<MappedFile>(segmentPath(segmentId));
+
+		return *pSegmentFile;
+	}
+
+	std::shared_ptr<const model::Block> PackedFileBlockStorage::loadRecord(
+			Height height,
+			const char* description,
+			uint32_t& recordSize) const {
+		requireHeight(height, description);
+
+		auto indexOffset = height.unwrap() * Index_Slot_Size;
+		auto pIndexMapping = m_pIndexFile->map(indexOffset + Index_Slot_Size);
+
+		RecordLocation location;
+		std::memcpy(&location, pIndexMapping->data() + indexOffset, sizeof(RecordLocation));
+
+		auto pMapping = segment(location.SegmentId).map(location.Offset + location.Size);
+		recordSize = location.Size;
+		return MapBlock(pMapping, location.Offset, location.Size, height);
+	}
+
+	void PackedFileBlockStorage::prepareWriters() {
+		if (m_pIndexWriter)
+			return;
+
+		m_pIndexWriter = std::make_unique<RawFile>(GetPath(m_dataDirectory, Index_File), OpenMode::Read_Append, LockMode::None);
+		m_pHashWriter = std::make_unique<RawFile>(GetPath(m_dataDirectory, Hash_File), OpenMode::Read_Append, LockMode::None);
+		m_pTailSegmentWriter = std::make_unique<RawFile>(segmentPath(m_tailSegmentId), OpenMode::Read_Append, LockMode::None);
+	}
+
+	void PackedFileBlockStorage::setHeight(Height height) {
+		WriteAt(*m_pIndexWriter, 0, { reinterpret_cast<const uint8_t*>(&height), sizeof(Height) });
+		m_chainHeight = height;
+	}
+
+	// endregion
+}}
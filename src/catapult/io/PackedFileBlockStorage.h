@@ -0,0 +1,88 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "BlockStorage.h"
+#include "RawFile.h"
+#include "catapult/utils/FileSize.h"
+#include <mutex>
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// File-based block storage that packs blocks into large, memory mapped segment files.
+	/// \note Blocks are appended to segment files and located via a fixed size offset index.
+	///       Loaded blocks are zero-copy views into the memory mapped segments.
+	class PackedFileBlockStorage final : public BlockStorage {
+	public:
+		/// Creates a packed file-based block storage, where blocks will be stored inside \a dataDirectory
+		/// in segment files of at most 1GB.
+		explicit PackedFileBlockStorage(const std::string& dataDirectory);
+
+		/// Creates a packed file-based block storage, where blocks will be stored inside \a dataDirectory
+		/// in segment files of at most \a maxSegmentSize.
+		PackedFileBlockStorage(const std::string& dataDirectory, utils::FileSize maxSegmentSize);
+
+		/// Destroys the storage.
+		~PackedFileBlockStorage() override;
+
+	public:
+		// LightBlockStorage
+		Height chainHeight() const override;
+		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
+		void saveBlock(const model::BlockElement& blockElement) override;
+		void dropBlocksAfter(Height height) override;
+
+		// BlockStorage
+		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
+		std::vector<std::shared_ptr<const model::Block>> loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const override;
+		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
+		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override;
+
+	private:
+		class MappedFile;
+		struct RecordLocation;
+
+	private:
+		void requireHeight(Height height, const char* description) const;
+		std::string segmentPath(uint32_t segmentId) const;
+		MappedFile& segment(uint32_t segmentId) const;
+		std::shared_ptr<const model::Block> loadRecord(Height height, const char* description, uint32_t& recordSize) const;
+		void prepareWriters();
+		void setHeight(Height height);
+
+	private:
+		std::string m_dataDirectory;
+		uint64_t m_maxSegmentSize;
+		Height m_chainHeight;
+
+		// used for reading
+		std::unique_ptr<MappedFile> m_pIndexFile;
+		std::unique_ptr<MappedFile> m_pHashFile;
+		mutable std::vector<std::unique_ptr<MappedFile>> m_segmentFiles;
+		mutable std::mutex m_segmentFilesMutex;
+
+		// used for writing
+		std::unique_ptr<RawFile> m_pIndexWriter;
+		std::unique_ptr<RawFile> m_pHashWriter;
+		uint32_t m_tailSegmentId;
+		std::unique_ptr<RawFile> m_pTailSegmentWriter;
+	};
+}}
@@ -0,0 +1,88 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BufferChunkPool.h"
+#include <atomic>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		bool TryReuse(const std::shared_ptr<ByteBuffer>& pBuffer) {
+			// a buffer is only owned by the pool once all other references have been released
+			if (1 != pBuffer.use_count())
+				return false;
+
+			// the last reference might have been released on a different thread, so synchronize with that release
+			std::atomic_thread_fence(std::memory_order_acquire);
+			pBuffer->clear();
+			return true;
+		}
+	}
+
+	BufferChunkPool::BufferChunkPool(size_t chunkSize, size_t maxChunks)
+			: m_chunkSize(chunkSize)
+			, m_maxChunks(maxChunks)
+			, m_numAllocations(0)
+	{}
+
+	size_t BufferChunkPool::chunkSize() const {
+		return m_chunkSize;
+	}
+
+	size_t BufferChunkPool::numChunks() const {
+		return m_chunks.size();
+	}
+
+	size_t BufferChunkPool::numAllocations() const {
+		return m_numAllocations;
+	}
+
+	std::shared_ptr<ByteBuffer> BufferChunkPool::acquire(size_t minCapacity) {
+		if (minCapacity > m_chunkSize) {
+			if (m_pLargeBuffer && m_pLargeBuffer->capacity() >= minCapacity && TryReuse(m_pLargeBuffer))
+				return m_pLargeBuffer;
+
+			m_pLargeBuffer = allocate(minCapacity);
+			return m_pLargeBuffer;
+		}
+
+		for (const auto& pChunk : m_chunks) {
+			if (TryReuse(pChunk))
+				return pChunk;
+		}
+
+		auto pChunk = allocate(m_chunkSize);
+		if (m_chunks.size() < m_maxChunks)
+			m_chunks.push_back(pChunk);
+
+		return pChunk;
+	}
+
+	void BufferChunkPool::releaseLargeBuffer() {
+		m_pLargeBuffer.reset();
+	}
+
+	std::shared_ptr<ByteBuffer> BufferChunkPool::allocate(size_t capacity) {
+		auto pBuffer = std::make_shared<ByteBuffer>();
+		pBuffer->reserve(capacity);
+		++m_numAllocations;
+		return pBuffer;
+	}
+}}
@@ -0,0 +1,63 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "IoTypes.h"
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace ionet {
+
+	/// A pool of reusable fixed-size buffer chunks and (at most) one reusable large buffer.
+	/// \note A pooled buffer is only reused after all outstanding references to it have been released.
+	class BufferChunkPool {
+	public:
+		/// Creates a pool of chunks with capacity \a chunkSize that retains at most \a maxChunks chunks.
+		BufferChunkPool(size_t chunkSize, size_t maxChunks);
+
+	public:
+		/// Gets the capacity of pooled chunks.
+		size_t chunkSize() const;
+
+		/// Gets the number of chunks retained by the pool.
+		size_t numChunks() const;
+
+		/// Gets the total number of buffers allocated by the pool.
+		size_t numAllocations() const;
+
+	public:
+		/// Acquires an empty buffer with a capacity of at least \a minCapacity.
+		/// \note The most recently allocated buffer larger than the chunk size is retained until it is released.
+		std::shared_ptr<ByteBuffer> acquire(size_t minCapacity);
+
+		/// Releases the retained large buffer, if any.
+		void releaseLargeBuffer();
+
+	private:
+		std::shared_ptr<ByteBuffer> allocate(size_t capacity);
+
+	private:
+		size_t m_chunkSize;
+		size_t m_maxChunks;
+		size_t m_numAllocations;
+		std::vector<std::shared_ptr<ByteBuffer>> m_chunks;
+		std::shared_ptr<ByteBuffer> m_pLargeBuffer;
+	};
+}}
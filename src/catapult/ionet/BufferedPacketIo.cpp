@@ -26,24 +26,6 @@
 namespace catapult { namespace ionet {
 
 	namespace {
-		class WriteRequest {
-		public:
-			explicit WriteRequest(PacketIo& io, const PacketPayload& payload)
-					: m_io(io)
-					, m_payload(payload)
-			{}
-
-		public:
-			template<typename TCallback>
-			void invoke(TCallback callback) {
-				m_io.write(m_payload, callback);
-			}
-
-		private:
-			PacketIo& m_io;
-			PacketPayload m_payload;
-		};
-
 		class ReadRequest {
 		public:
 			explicit ReadRequest(PacketIo& io) : m_io(io)
@@ -138,7 +120,6 @@ namespace catapult { namespace ionet {
 			RequestQueue<TRequest, TCallback, boost::asio::strand> m_requests;
 		};
 
-		using QueuedWriteOperation = QueuedOperation<WriteRequest, PacketIo::WriteCallback>;
 		using QueuedReadOperation = QueuedOperation<ReadRequest, PacketIo::ReadCallback>;
 
 		class BufferedPacketIo
@@ -148,14 +129,13 @@ namespace catapult { namespace ionet {
 			BufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::strand& strand)
 					: m_pIo(pIo)
 					, m_strand(strand)
-					, m_pWriteOperation(std::make_unique<QueuedWriteOperation>(m_strand))
 					, m_pReadOperation(std::make_unique<QueuedReadOperation>(m_strand))
 			{}
 
 		public:
 			void write(const PacketPayload& payload, const WriteCallback& callback) override {
-				auto request = WriteRequest(*m_pIo, payload);
-				m_pWriteOperation->push(request, [pThis = shared_from_this(), callback](auto code) {
+				// forward writes without waiting for prior writes to complete so that the underlying io can coalesce them
+				m_pIo->write(payload, [pThis = shared_from_this(), callback](auto code) {
 					callback(code);
 				});
 			}
@@ -170,7 +150,6 @@ namespace catapult { namespace ionet {
 		private:
 			std::shared_ptr<PacketIo> m_pIo;
 			boost::asio::strand& m_strand;
-			std::unique_ptr<QueuedWriteOperation> m_pWriteOperation;
 			std::unique_ptr<QueuedReadOperation> m_pReadOperation;
 		};
 	}
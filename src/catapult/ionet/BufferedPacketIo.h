@@ -26,5 +26,6 @@ namespace catapult { namespace ionet { class PacketIo; } }
 namespace catapult { namespace ionet {
 
 	/// Adds buffering to \a pIo using \a strand for synchronization.
+	/// \note Reads are serialized but writes are forwarded immediately, so \a pIo must queue writes in order.
 	std::shared_ptr<PacketIo> CreateBufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::strand& strand);
 }}
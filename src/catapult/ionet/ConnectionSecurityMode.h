@@ -29,7 +29,10 @@ namespace catapult { namespace ionet {
 	ENUM_VALUE(None, 1) \
 	\
 	/* Connection only allows signed packets. */ \
-	ENUM_VALUE(Signed, 2)
+	ENUM_VALUE(Signed, 2) \
+	\
+	/* Connection only allows packets authenticated with a session key established during the challenge handshake. */ \
+	ENUM_VALUE(Signed_Session, 4)
 
 #define ENUM_VALUE(LABEL, VALUE) LABEL = VALUE,
 	/// Possible connection security modes.
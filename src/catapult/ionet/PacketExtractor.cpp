@@ -26,21 +26,30 @@ namespace catapult { namespace ionet {
 
 	PacketExtractor::PacketExtractor(ByteBuffer& data, size_t maxPacketDataSize)
 			: m_data(data)
+			, m_pDataOffset(nullptr)
+			, m_maxPacketDataSize(maxPacketDataSize)
+			, m_consumedBytes(0)
+	{}
+
+	PacketExtractor::PacketExtractor(ByteBuffer& data, size_t& dataOffset, size_t maxPacketDataSize)
+			: m_data(data)
+			, m_pDataOffset(&dataOffset)
 			, m_maxPacketDataSize(maxPacketDataSize)
 			, m_consumedBytes(0)
 	{}
 
 	PacketExtractResult PacketExtractor::tryExtractNextPacket(const Packet*& pExtractedPacket) {
 		pExtractedPacket = nullptr;
-		auto remainingDataSize = m_data.size() - m_consumedBytes;
+		auto dataOffset = (m_pDataOffset ? *m_pDataOffset : 0) + m_consumedBytes;
+		auto remainingDataSize = m_data.size() - dataOffset;
 		if (remainingDataSize < sizeof(PacketHeader))
 			return PacketExtractResult::Insufficient_Data;
 
-		const auto& packet = reinterpret_cast<const Packet&>(m_data[m_consumedBytes]);
+		const auto& packet = reinterpret_cast<const Packet&>(m_data[dataOffset]);
 		if (!IsPacketDataSizeValid(packet, m_maxPacketDataSize)) {
 			CATAPULT_LOG(warning)
 					<< "unable to extract " << packet
-					<< " (" << m_data.size() << " bytes, " << remainingDataSize << " remaining, " << m_consumedBytes << " consumed)";
+					<< " (" << m_data.size() << " bytes, " << remainingDataSize << " remaining, " << dataOffset << " consumed)";
 			return PacketExtractResult::Packet_Error;
 		}
 
@@ -56,11 +65,17 @@ namespace catapult { namespace ionet {
 		if (0 == m_consumedBytes)
 			return;
 
-		auto remainingDataSize = m_data.size() - m_consumedBytes;
-		if (0 != remainingDataSize)
-			std::memmove(m_data.data(), &m_data[m_consumedBytes], remainingDataSize);
+		if (m_pDataOffset) {
+			// skip the consumed data instead of moving the remaining data
+			*m_pDataOffset += m_consumedBytes;
+		} else {
+			auto remainingDataSize = m_data.size() - m_consumedBytes;
+			if (0 != remainingDataSize)
+				std::memmove(m_data.data(), &m_data[m_consumedBytes], remainingDataSize);
+
+			m_data.resize(remainingDataSize);
+		}
 
-		m_data.resize(remainingDataSize);
 		m_consumedBytes = 0;
 	}
 }}
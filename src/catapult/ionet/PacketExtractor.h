@@ -52,15 +52,21 @@ namespace catapult { namespace ionet {
 		/// size of \a maxPacketDataSize.
 		PacketExtractor(ByteBuffer& data, size_t maxPacketDataSize);
 
+		/// Creates a packet extractor for extracting a packet from \a data starting at \a dataOffset that allows a maximum
+		/// packet data size of \a maxPacketDataSize.
+		/// \note Consuming packets advances \a dataOffset instead of deleting their backing memory.
+		PacketExtractor(ByteBuffer& data, size_t& dataOffset, size_t maxPacketDataSize);
+
 	public:
 		/// Tries to extract the next packet into (\a pExtractedPacket).
 		PacketExtractResult tryExtractNextPacket(const Packet*& pExtractedPacket);
 
-		/// Marks all extracted packets as consumed and deletes their backing memory.
+		/// Marks all extracted packets as consumed and deletes their backing memory (or advances the data offset).
 		void consume();
 
 	private:
 		ByteBuffer& m_data;
+		size_t* m_pDataOffset;
 		size_t m_maxPacketDataSize;
 		size_t m_consumedBytes;
 	};
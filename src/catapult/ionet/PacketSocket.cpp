@@ -27,6 +27,7 @@
 #include "catapult/utils/Logging.h"
 #include <deque>
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace ionet {
 
@@ -74,6 +75,7 @@ namespace catapult { namespace ionet {
 					, m_wrapper(wrapper)
 					, m_buffer(options)
 					, m_maxPacketDataSize(options.MaxPacketDataSize)
+					, m_isWriting(false)
 			{}
 
 		public:
@@ -84,55 +86,64 @@ namespace catapult { namespace ionet {
 					return;
 				}
 
-				auto pContext = std::make_shared<WriteContext>(payload, callback);
-				boost::asio::async_write(m_socket, pContext->headerBuffer(), m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
-				}));
+				m_pendingWrites.emplace_back(payload, callback);
+				if (!m_isWriting)
+					writePending();
 			}
 
 		private:
-			struct WriteContext {
-			public:
-				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback)
-						: m_payload(payload)
-						, m_callback(callback)
-						, m_nextBufferIndex(0)
-				{}
+			// maximum number of buffers gathered into a single write (matches the asio scatter / gather limit)
+			static constexpr size_t Max_Buffers_Per_Write = 64;
 
+			using PendingWrite = std::pair<PacketPayload, PacketSocket::WriteCallback>;
+
+			class WriteBatch {
 			public:
-				auto headerBuffer() const {
-					const auto& header = m_payload.header();
-					return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
-				}
+				bool tryAdd(PendingWrite&& pendingWrite) {
+					// always accept the first payload even if it has more buffers than can be gathered at once
+					auto numBuffers = 1 + pendingWrite.first.buffers().size();
+					if (!m_writes.empty() && m_buffers.size() + numBuffers > Max_Buffers_Per_Write)
+						return false;
+
+					m_writes.push_back(std::move(pendingWrite));
 
-				auto nextDataBuffer() {
-					auto rawBuffer = m_payload.buffers()[m_nextBufferIndex++];
-					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
+					const auto& payload = m_writes.back().first;
+					const auto& header = payload.header();
+					m_buffers.push_back(boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header)));
+					for (const auto& rawBuffer : payload.buffers())
+						m_buffers.push_back(boost::asio::buffer(rawBuffer.pData, rawBuffer.Size));
+
+					return true;
 				}
 
-				bool tryComplete(const boost::system::error_code& ec) {
-					auto lastCode = mapWriteErrorCodeToSocketOperationCode(ec);
-					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_payload.buffers().size()) {
-						m_callback(lastCode);
-						return true;
-					}
+				const std::vector<boost::asio::const_buffer>& buffers() const {
+					return m_buffers;
+				}
 
-					return false;
+				void complete(SocketOperationCode code) {
+					for (const auto& write : m_writes)
+						write.second(code);
 				}
 
 			private:
-				const PacketPayload m_payload;
-				const PacketSocket::WriteCallback m_callback;
-				size_t m_nextBufferIndex;
+				// payloads are held (and never moved after being added) so that gathered buffers remain valid
+				std::deque<PendingWrite> m_writes;
+				std::vector<boost::asio::const_buffer> m_buffers;
 			};
 
-			void writeNext(const boost::system::error_code& lastEc, const std::shared_ptr<WriteContext>& pContext) {
-				if (pContext->tryComplete(lastEc))
-					return;
+			void writePending() {
+				// gather headers and data buffers of all pending payloads (up to limit) into a single write
+				auto pBatch = std::make_shared<WriteBatch>();
+				while (!m_pendingWrites.empty() && pBatch->tryAdd(std::move(m_pendingWrites.front())))
+					m_pendingWrites.pop_front();
+
+				m_isWriting = true;
+				boost::asio::async_write(m_socket, pBatch->buffers(), m_wrapper.wrap([this, pBatch](const auto& ec, auto) {
+					m_isWriting = false;
+					pBatch->complete(mapWriteErrorCodeToSocketOperationCode(ec));
 
-				auto buffer = pContext->nextDataBuffer();
-				boost::asio::async_write(m_socket, buffer, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
+					if (!m_pendingWrites.empty())
+						this->writePending();
 				}));
 			}
 
@@ -239,6 +250,8 @@ namespace catapult { namespace ionet {
 			TSocketCallbackWrapper& m_wrapper;
 			WorkingBuffer m_buffer;
 			size_t m_maxPacketDataSize;
+			std::deque<PendingWrite> m_pendingWrites;
+			bool m_isWriting;
 		};
 
 		/// Implements PacketSocket using an explicit strand and ensures deterministic shutdown by using
@@ -34,7 +34,8 @@ namespace catapult {
 namespace catapult { namespace ionet {
 
 	/// An asio socket wrapper that natively supports packets.
-	/// This wrapper is threadsafe but does not prevent interleaving reads or writes.
+	/// This wrapper is threadsafe but does not prevent interleaving reads.
+	/// \note Writes are queued and pending payloads are sent together using gathered (scatter / gather) writes.
 	class PacketSocket : public PacketIo, public BatchPacketReader {
 	public:
 		/// Statistics about a socket.
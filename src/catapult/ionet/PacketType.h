@@ -66,6 +66,12 @@ namespace catapult { namespace ionet {
 	/* Sub cache merkle roots have been requested. */ \
 	ENUM_VALUE(Sub_Cache_Merkle_Roots, 12) \
 	\
+	/* Unconfirmed transactions not in a short hash sketch have been requested by a peer. */ \
+	ENUM_VALUE(Pull_Transactions_Sketch, 13) \
+	\
+	/* A secure packet with a session message authentication code. */ \
+	ENUM_VALUE(Secure_Session, 14) \
+	\
 	/* api only packets have types [500, 600) */ \
 	\
 	/* Partial aggregate transactions have been pushed by an api-node. */ \
@@ -21,24 +21,25 @@
 #include "SecurePacketSocketDecorator.h"
 #include "PacketSocket.h"
 #include "SecureSignedPacketIo.h"
+#include "catapult/crypto/KeyPair.h"
 #include "catapult/utils/FileSize.h"
 
 namespace catapult { namespace ionet {
 
 	namespace {
-		class SecureSignedPacketSocket : public PacketSocket {
+		using PacketIoDecorator = std::function<std::shared_ptr<PacketIo> (const std::shared_ptr<PacketIo>&)>;
+		using BatchPacketReaderDecorator = std::function<std::shared_ptr<BatchPacketReader> (const std::shared_ptr<BatchPacketReader>&)>;
+
+		class SecurePacketSocket : public PacketSocket {
 		public:
-			SecureSignedPacketSocket(
+			SecurePacketSocket(
 					const std::shared_ptr<PacketSocket>& pSocket,
-					const crypto::KeyPair& sourceKeyPair,
-					const Key& remoteKey,
-					uint32_t maxPacketDataSize)
+					const PacketIoDecorator& decorateIo,
+					const BatchPacketReaderDecorator& decorateReader)
 					: m_pSocket(pSocket)
-					, m_sourceKeyPair(sourceKeyPair)
-					, m_remoteKey(remoteKey)
-					, m_maxPacketDataSize(maxPacketDataSize)
-					, m_pIo(createSecureSignedPacketIo(m_pSocket))
-					, m_pReader(CreateSecureSignedBatchPacketReader(m_pSocket, m_remoteKey))
+					, m_decorateIo(decorateIo)
+					, m_pIo(m_decorateIo(m_pSocket))
+					, m_pReader(decorateReader(m_pSocket))
 			{}
 
 		public:
@@ -64,22 +65,44 @@ namespace catapult { namespace ionet {
 			}
 
 			std::shared_ptr<PacketIo> buffered() override {
-				return createSecureSignedPacketIo(m_pSocket->buffered());
-			}
-
-		private:
-			std::shared_ptr<PacketIo> createSecureSignedPacketIo(const std::shared_ptr<PacketIo>& pSocket) {
-				return CreateSecureSignedPacketIo(pSocket, m_sourceKeyPair, m_remoteKey, m_maxPacketDataSize);
+				return m_decorateIo(m_pSocket->buffered());
 			}
 
 		private:
 			std::shared_ptr<PacketSocket> m_pSocket;
-			const crypto::KeyPair& m_sourceKeyPair;
-			Key m_remoteKey;
-			uint32_t m_maxPacketDataSize;
+			PacketIoDecorator m_decorateIo;
 			std::shared_ptr<PacketIo> m_pIo;
 			std::shared_ptr<BatchPacketReader> m_pReader;
 		};
+
+		std::shared_ptr<PacketSocket> CreateSecureSignedPacketSocket(
+				const std::shared_ptr<PacketSocket>& pSocket,
+				const crypto::KeyPair& sourceKeyPair,
+				const Key& remoteKey,
+				uint32_t maxPacketDataSize) {
+			return std::make_shared<SecurePacketSocket>(
+					pSocket,
+					[&sourceKeyPair, remoteKey, maxPacketDataSize](const auto& pIo) {
+						return CreateSecureSignedPacketIo(pIo, sourceKeyPair, remoteKey, maxPacketDataSize);
+					},
+					[remoteKey](const auto& pReader) {
+						return CreateSecureSignedBatchPacketReader(pReader, remoteKey);
+					});
+		}
+
+		std::shared_ptr<PacketSocket> CreateSecureSessionPacketSocket(
+				const std::shared_ptr<PacketSocket>& pSocket,
+				const SessionKeys& sessionKeys,
+				uint32_t maxPacketDataSize) {
+			return std::make_shared<SecurePacketSocket>(
+					pSocket,
+					[sessionKeys, maxPacketDataSize](const auto& pIo) {
+						return CreateSecureSessionPacketIo(pIo, sessionKeys, maxPacketDataSize);
+					},
+					[sessionKeys](const auto& pReader) {
+						return CreateSecureSessionBatchPacketReader(pReader, sessionKeys);
+					});
+		}
 	}
 
 	std::shared_ptr<PacketSocket> Secure(
@@ -87,9 +110,15 @@ namespace catapult { namespace ionet {
 			ConnectionSecurityMode securityMode,
 			const crypto::KeyPair& sourceKeyPair,
 			const Key& remoteKey,
+			const Hash256& sessionSecret,
 			utils::FileSize maxPacketDataSize) {
+		if (HasFlag(ConnectionSecurityMode::Signed_Session, securityMode)) {
+			auto sessionKeys = DeriveSessionKeys(sessionSecret, sourceKeyPair.publicKey(), remoteKey);
+			return CreateSecureSessionPacketSocket(pSocket, sessionKeys, maxPacketDataSize.bytes32());
+		}
+
 		return HasFlag(ConnectionSecurityMode::Signed, securityMode)
-				? std::make_shared<SecureSignedPacketSocket>(pSocket, sourceKeyPair, remoteKey, maxPacketDataSize.bytes32())
+				? CreateSecureSignedPacketSocket(pSocket, sourceKeyPair, remoteKey, maxPacketDataSize.bytes32())
 				: pSocket;
 	}
 }}
@@ -34,22 +34,96 @@ namespace catapult { namespace ionet {
 			catapult::Signature Signature;
 		};
 
-		Hash256 CalculatePayloadHash(const PacketPayload& payload) {
-			// sign full payload, including header
-			crypto::Sha3_256_Builder hashBuilder;
+		struct SecureSessionPacketHeader : public ionet::Packet {
+			static constexpr PacketType Packet_Type = PacketType::Secure_Session;
+
+			Hash256 Mac;
+		};
+
+		void UpdatePayloadHash(crypto::Sha3_256_Builder& hashBuilder, const PacketPayload& payload) {
 			hashBuilder.update({ reinterpret_cast<const uint8_t*>(&payload.header()), sizeof(PacketHeader) });
 			for (const auto& buffer : payload.buffers())
 				hashBuilder.update(buffer);
+		}
+
+		Hash256 CalculatePayloadHash(const PacketPayload& payload) {
+			// sign full payload, including header
+			crypto::Sha3_256_Builder hashBuilder;
+			UpdatePayloadHash(hashBuilder, payload);
 
 			Hash256 payloadHash;
 			hashBuilder.final(payloadHash);
 			return payloadHash;
 		}
 
+		Hash256 CalculatePayloadMac(const Hash256& key, const PacketPayload& payload) {
+			// sha3 is not susceptible to length extension, so prefixing the key is sufficient (and cheaper than hmac)
+			crypto::Sha3_256_Builder hashBuilder;
+			hashBuilder.update(key);
+			UpdatePayloadHash(hashBuilder, payload);
+
+			Hash256 payloadMac;
+			hashBuilder.final(payloadMac);
+			return payloadMac;
+		}
+
+		Hash256 CalculatePacketMac(const Hash256& key, const Packet& packet) {
+			Hash256 packetMac;
+			crypto::Sha3_256_Builder hashBuilder;
+			hashBuilder.update({ key, { reinterpret_cast<const uint8_t*>(&packet), packet.Size } });
+			hashBuilder.final(packetMac);
+			return packetMac;
+		}
+
+		bool AreMacsEqual(const Hash256& lhs, const Hash256& rhs) {
+			// compare all bytes so that the comparison time does not depend on the position of the first difference
+			uint8_t difference = 0;
+			for (auto i = 0u; i < lhs.size(); ++i)
+				difference |= lhs[i] ^ rhs[i];
+
+			return 0 == difference;
+		}
+
+		struct SignedTraits {
+			using HeaderType = SecurePacketHeader;
+			using ReadKeyType = Key;
+
+			static bool IsAuthentic(const Key& remoteKey, const HeaderType& securePacketHeader, const Packet& childPacket) {
+				Hash256 childPacketHash;
+				crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&childPacket), childPacket.Size }, childPacketHash);
+
+				if (!crypto::Verify(remoteKey, childPacketHash, securePacketHeader.Signature)) {
+					CATAPULT_LOG(warning) << "packet from " << utils::HexFormat(remoteKey) << " has invalid signature";
+					return false;
+				}
+
+				return true;
+			}
+		};
+
+		struct SessionTraits {
+			using HeaderType = SecureSessionPacketHeader;
+			using ReadKeyType = Hash256;
+
+			static bool IsAuthentic(const Hash256& readKey, const HeaderType& securePacketHeader, const Packet& childPacket) {
+				auto childPacketMac = CalculatePacketMac(readKey, childPacket);
+				if (!AreMacsEqual(childPacketMac, securePacketHeader.Mac)) {
+					CATAPULT_LOG(warning) << "packet has invalid session mac";
+					return false;
+				}
+
+				return true;
+			}
+		};
+
+		template<typename TTraits>
 		class VerifyingReadCallback {
+		private:
+			using SecureHeaderType = typename TTraits::HeaderType;
+
 		public:
-			VerifyingReadCallback(const Key& remoteKey, PacketIo::ReadCallback callback)
-					: m_remoteKey(remoteKey)
+			VerifyingReadCallback(const typename TTraits::ReadKeyType& readKey, PacketIo::ReadCallback callback)
+					: m_readKey(readKey)
 					, m_callback(callback)
 			{}
 
@@ -59,31 +133,61 @@ namespace catapult { namespace ionet {
 					return m_callback(code, nullptr);
 
 				// cannot use CoercePacket because Size is variable
-				auto minPacketSize = sizeof(SecurePacketHeader) + sizeof(PacketHeader);
-				if (pPacket->Type != SecurePacketHeader::Packet_Type || minPacketSize > pPacket->Size)
+				auto minPacketSize = sizeof(SecureHeaderType) + sizeof(PacketHeader);
+				if (pPacket->Type != SecureHeaderType::Packet_Type || minPacketSize > pPacket->Size)
 					return m_callback(SocketOperationCode::Malformed_Data, nullptr);
 
-				auto& securePacketHeader = static_cast<const SecurePacketHeader&>(*pPacket);
+				auto& securePacketHeader = static_cast<const SecureHeaderType&>(*pPacket);
 				auto& childPacket = static_cast<const Packet&>(*(&securePacketHeader + 1));
-				if (securePacketHeader.Size - sizeof(SecurePacketHeader) != childPacket.Size)
+				if (securePacketHeader.Size - sizeof(SecureHeaderType) != childPacket.Size)
 					return m_callback(SocketOperationCode::Malformed_Data, nullptr);
 
-				Hash256 childPacketHash;
-				crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&childPacket), childPacket.Size }, childPacketHash);
-
-				if (!crypto::Verify(m_remoteKey, childPacketHash, securePacketHeader.Signature)) {
-					CATAPULT_LOG(warning) << "packet from " << utils::HexFormat(m_remoteKey) << " has invalid signature";
+				if (!TTraits::IsAuthentic(m_readKey, securePacketHeader, childPacket))
 					return m_callback(SocketOperationCode::Security_Error, nullptr);
-				}
 
 				m_callback(code, &childPacket);
 			}
 
 		private:
-			const Key& m_remoteKey;
+			const typename TTraits::ReadKeyType& m_readKey;
 			PacketIo::ReadCallback m_callback;
 		};
 
+		template<typename TTraits>
+		class SecureBatchPacketReader
+				: public BatchPacketReader
+				, public std::enable_shared_from_this<SecureBatchPacketReader<TTraits>> {
+		public:
+			SecureBatchPacketReader(const std::shared_ptr<BatchPacketReader>& pReader, const typename TTraits::ReadKeyType& readKey)
+					: m_pReader(pReader)
+					, m_readKey(readKey)
+			{}
+
+		public:
+			void readMultiple(const PacketIo::ReadCallback& callback) override {
+				m_pReader->readMultiple([pThis = this->shared_from_this(), callback](auto code, const auto* pPacket) {
+					VerifyingReadCallback<TTraits>(pThis->m_readKey, callback)(code, pPacket);
+				});
+			}
+
+		private:
+			std::shared_ptr<BatchPacketReader> m_pReader;
+			typename TTraits::ReadKeyType m_readKey;
+		};
+
+		bool IsPayloadValid(const PacketPayload& payload, uint32_t maxPacketDataSize, const PacketIo::WriteCallback& callback) {
+			if (IsPacketDataSizeValid(payload.header(), maxPacketDataSize))
+				return true;
+
+			CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
+			callback(SocketOperationCode::Malformed_Data);
+			return false;
+		}
+	}
+
+	// region signed
+
+	namespace {
 		class SecureSignedPacketIo
 				: public PacketIo
 				, public std::enable_shared_from_this<SecureSignedPacketIo> {
@@ -101,11 +205,8 @@ namespace catapult { namespace ionet {
 
 		public:
 			void write(const PacketPayload& payload, const WriteCallback& callback) override {
-				if (!IsPacketDataSizeValid(payload.header(), m_maxSignedPacketDataSize)) {
-					CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
-					callback(SocketOperationCode::Malformed_Data);
+				if (!IsPayloadValid(payload, m_maxSignedPacketDataSize, callback))
 					return;
-				}
 
 				auto payloadHash = CalculatePayloadHash(payload);
 				auto pSecurePacketHeader = CreateSharedPacket<SecurePacketHeader>(0);
@@ -116,7 +217,7 @@ namespace catapult { namespace ionet {
 
 			void read(const ReadCallback& callback) override {
 				m_pIo->read([pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
-					VerifyingReadCallback(pThis->m_remoteKey, callback)(code, pPacket);
+					VerifyingReadCallback<SignedTraits>(pThis->m_remoteKey, callback)(code, pPacket);
 				});
 			}
 
@@ -136,32 +237,78 @@ namespace catapult { namespace ionet {
 		return std::make_shared<SecureSignedPacketIo>(pIo, sourceKeyPair, remoteKey, maxSignedPacketDataSize);
 	}
 
+	std::shared_ptr<BatchPacketReader> CreateSecureSignedBatchPacketReader(
+			const std::shared_ptr<BatchPacketReader>& pReader,
+			const Key& remoteKey) {
+		return std::make_shared<SecureBatchPacketReader<SignedTraits>>(pReader, remoteKey);
+	}
+
+	// endregion
+
+	// region session
+
 	namespace {
-		class SecureSignedBatchPacketReader
-				: public BatchPacketReader
-				, public std::enable_shared_from_this<SecureSignedBatchPacketReader> {
+		class SecureSessionPacketIo
+				: public PacketIo
+				, public std::enable_shared_from_this<SecureSessionPacketIo> {
 		public:
-			SecureSignedBatchPacketReader(const std::shared_ptr<BatchPacketReader>& pReader, const Key& remoteKey)
-					: m_pReader(pReader)
-					, m_remoteKey(remoteKey)
+			SecureSessionPacketIo(
+					const std::shared_ptr<PacketIo>& pIo,
+					const SessionKeys& sessionKeys,
+					uint32_t maxSignedPacketDataSize)
+					: m_pIo(pIo)
+					, m_sessionKeys(sessionKeys)
+					, m_maxSignedPacketDataSize(maxSignedPacketDataSize)
 			{}
 
 		public:
-			void readMultiple(const PacketIo::ReadCallback& callback) override {
-				m_pReader->readMultiple([pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
-					VerifyingReadCallback(pThis->m_remoteKey, callback)(code, pPacket);
+			void write(const PacketPayload& payload, const WriteCallback& callback) override {
+				if (!IsPayloadValid(payload, m_maxSignedPacketDataSize, callback))
+					return;
+
+				auto pSecurePacketHeader = CreateSharedPacket<SecureSessionPacketHeader>(0);
+				pSecurePacketHeader->Mac = CalculatePayloadMac(m_sessionKeys.WriteKey, payload);
+
+				m_pIo->write(PacketPayload::Merge(pSecurePacketHeader, payload), callback);
+			}
+
+			void read(const ReadCallback& callback) override {
+				m_pIo->read([pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
+					VerifyingReadCallback<SessionTraits>(pThis->m_sessionKeys.ReadKey, callback)(code, pPacket);
 				});
 			}
 
 		private:
-			std::shared_ptr<BatchPacketReader> m_pReader;
-			Key m_remoteKey;
+			std::shared_ptr<PacketIo> m_pIo;
+			SessionKeys m_sessionKeys;
+			uint32_t m_maxSignedPacketDataSize;
 		};
+
+		Hash256 DeriveSessionKey(const Hash256& sessionSecret, const Key& writerPublicKey) {
+			Hash256 sessionKey;
+			crypto::Sha3_256_Builder hashBuilder;
+			hashBuilder.update({ sessionSecret, writerPublicKey });
+			hashBuilder.final(sessionKey);
+			return sessionKey;
+		}
 	}
 
-	std::shared_ptr<BatchPacketReader> CreateSecureSignedBatchPacketReader(
+	SessionKeys DeriveSessionKeys(const Hash256& sessionSecret, const Key& sourcePublicKey, const Key& remotePublicKey) {
+		return { DeriveSessionKey(sessionSecret, sourcePublicKey), DeriveSessionKey(sessionSecret, remotePublicKey) };
+	}
+
+	std::shared_ptr<PacketIo> CreateSecureSessionPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			const SessionKeys& sessionKeys,
+			uint32_t maxSignedPacketDataSize) {
+		return std::make_shared<SecureSessionPacketIo>(pIo, sessionKeys, maxSignedPacketDataSize);
+	}
+
+	std::shared_ptr<BatchPacketReader> CreateSecureSessionBatchPacketReader(
 			const std::shared_ptr<BatchPacketReader>& pReader,
-			const Key& remoteKey) {
-		return std::make_shared<SecureSignedBatchPacketReader>(pReader, remoteKey);
+			const SessionKeys& sessionKeys) {
+		return std::make_shared<SecureBatchPacketReader<SessionTraits>>(pReader, sessionKeys.ReadKey);
 	}
+
+	// endregion
 }}
@@ -47,4 +47,32 @@ namespace catapult { namespace ionet {
 	std::shared_ptr<BatchPacketReader> CreateSecureSignedBatchPacketReader(
 			const std::shared_ptr<BatchPacketReader>& pReader,
 			const Key& remoteKey);
+
+	/// Keys used to authenticate packets of a session.
+	struct SessionKeys {
+		/// Key used to authenticate written packets.
+		Hash256 WriteKey;
+
+		/// Key used to authenticate read packets.
+		Hash256 ReadKey;
+	};
+
+	/// Derives session keys for a connection from \a sourcePublicKey to \a remotePublicKey given a shared \a sessionSecret.
+	/// \note The remote peer derives the same keys with read and write keys swapped.
+	SessionKeys DeriveSessionKeys(const Hash256& sessionSecret, const Key& sourcePublicKey, const Key& remotePublicKey);
+
+	/// Adds session authentication to all packets read from and written to \a pIo.
+	/// - All written packets are wrapped in a session packet, authenticated by the session write key (\a sessionKeys) and must have
+	///   a max packet data size of \a maxSignedPacketDataSize.
+	/// - All read packets are validated to be authenticated by the session read key (\a sessionKeys).
+	std::shared_ptr<PacketIo> CreateSecureSessionPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			const SessionKeys& sessionKeys,
+			uint32_t maxSignedPacketDataSize);
+
+	/// Adds session authentication to all packets read from \a pReader.
+	/// - All read packets are validated to be authenticated by the session read key (\a sessionKeys).
+	std::shared_ptr<BatchPacketReader> CreateSecureSessionBatchPacketReader(
+			const std::shared_ptr<BatchPacketReader>& pReader,
+			const SessionKeys& sessionKeys);
 }}
@@ -19,24 +19,86 @@
 **/
 
 #include "WorkingBuffer.h"
+#include "catapult/exceptions.h"
+#include <cstring>
 
 namespace catapult { namespace ionet {
 
+	namespace {
+		// only a few chunks are needed per connection because chunks are only retained while shared packets reference them
+		constexpr size_t Max_Pooled_Chunks = 4;
+	}
+
 	WorkingBuffer::WorkingBuffer(const PacketSocketOptions& options)
 			: m_options(options)
+			, m_chunkPool(m_options.WorkingBufferSize, Max_Pooled_Chunks)
+			, m_pChunk(m_chunkPool.acquire(m_options.WorkingBufferSize))
+			, m_dataOffset(0)
 			, m_numDataSizeSamples(0)
-			, m_maxDataSize(0) {
-		m_data.reserve(m_options.WorkingBufferSize);
-	}
+			, m_maxDataSize(0)
+	{}
 
 	AppendContext WorkingBuffer::prepareAppend() {
-		AppendContext appendContext(m_data, m_options.WorkingBufferSize);
+		// reuse a chunk when all of its data has been consumed
+		if (0 != m_dataOffset && 0 == size())
+			recycleChunk();
+
 		checkMemoryUsage();
-		return appendContext;
+
+		// append in place when the chunk has room for at least half of the append size (like AppendContext) or for the
+		// remainder of a partially received packet
+		auto appendSize = m_options.WorkingBufferSize;
+		auto remainingCapacity = m_pChunk->capacity() - m_pChunk->size();
+		if (remainingCapacity >= appendSize / 2)
+			return AppendContext(*m_pChunk, std::min(appendSize, remainingCapacity));
+
+		auto pendingPacketSize = calculatePendingPacketSize();
+		if (0 != pendingPacketSize && remainingCapacity >= pendingPacketSize)
+			return AppendContext(*m_pChunk, remainingCapacity);
+
+		// otherwise, move the unconsumed data into a new chunk that is large enough to hold the entire pending packet
+		// so that large packets are only copied once
+		relocate(std::max(size() + std::max(appendSize / 2, pendingPacketSize), m_chunkPool.chunkSize()));
+		return AppendContext(*m_pChunk, std::min(appendSize, m_pChunk->capacity() - m_pChunk->size()));
 	}
 
 	PacketExtractor WorkingBuffer::preparePacketExtractor() {
-		return PacketExtractor(m_data, m_options.MaxPacketDataSize);
+		return PacketExtractor(*m_pChunk, m_dataOffset, m_options.MaxPacketDataSize);
+	}
+
+	std::shared_ptr<const Packet> WorkingBuffer::share(const Packet& packet) const {
+		auto pPacketData = reinterpret_cast<const uint8_t*>(&packet);
+		if (pPacketData < m_pChunk->data() || pPacketData + packet.Size > m_pChunk->data() + m_pChunk->size())
+			CATAPULT_THROW_INVALID_ARGUMENT("cannot share packet that is not backed by working buffer");
+
+		return std::shared_ptr<const Packet>(m_pChunk, &packet);
+	}
+
+	size_t WorkingBuffer::calculatePendingPacketSize() const {
+		if (size() < sizeof(PacketHeader))
+			return 0;
+
+		const auto& header = reinterpret_cast<const PacketHeader&>(*data());
+		if (header.Size <= size() || !IsPacketDataSizeValid(header, m_options.MaxPacketDataSize))
+			return 0;
+
+		return header.Size - size();
+	}
+
+	void WorkingBuffer::recycleChunk() {
+		// release the chunk before acquiring a new one so that the pool can reuse it if it is not shared
+		m_pChunk.reset();
+		m_pChunk = m_chunkPool.acquire(m_options.WorkingBufferSize);
+		m_dataOffset = 0;
+	}
+
+	void WorkingBuffer::relocate(size_t capacity) {
+		auto pChunk = m_chunkPool.acquire(capacity);
+		pChunk->resize(size());
+		std::memcpy(pChunk->data(), data(), size());
+
+		m_pChunk = std::move(pChunk);
+		m_dataOffset = 0;
 	}
 
 	void WorkingBuffer::checkMemoryUsage() {
@@ -45,23 +107,24 @@ namespace catapult { namespace ionet {
 			return;
 
 		// record a sample but only check at intervals to minimize impact
-		m_maxDataSize = std::max(m_maxDataSize, m_data.size());
+		m_maxDataSize = std::max(m_maxDataSize, size());
 		if (++m_numDataSizeSamples != m_options.WorkingBufferSensitivity)
 			return;
 
-		// ignore if savings is less than WorkingBufferSize
+		// large buffers (allocated for large packets) only need to be retained while large packets are being received
 		auto maxDataSize = m_maxDataSize;
 		m_numDataSizeSamples = 0;
 		m_maxDataSize = 0;
-		if (m_data.capacity() - maxDataSize < m_options.WorkingBufferSize)
+		if (maxDataSize > m_chunkPool.chunkSize() / 2)
 			return;
 
-		CATAPULT_LOG(debug) << "reclaiming memory, decreasing buffer capacity from " << m_data.capacity() << " to " << maxDataSize;
+		if (m_pChunk->capacity() > m_chunkPool.chunkSize()) {
+			CATAPULT_LOG(debug)
+					<< "reclaiming memory, decreasing buffer capacity from " << m_pChunk->capacity()
+					<< " to " << m_chunkPool.chunkSize();
+			relocate(m_chunkPool.chunkSize());
+		}
 
-		ByteBuffer dataCopy;
-		dataCopy.reserve(maxDataSize);
-		dataCopy.resize(m_data.size());
-		std::memcpy(dataCopy.data(), m_data.data(), m_data.size());
-		std::swap(m_data, dataCopy);
+		m_chunkPool.releaseLargeBuffer();
 	}
 }}
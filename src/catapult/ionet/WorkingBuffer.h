@@ -20,6 +20,7 @@
 
 #pragma once
 #include "AppendContext.h"
+#include "BufferChunkPool.h"
 #include "IoTypes.h"
 #include "PacketExtractor.h"
 #include "PacketSocketOptions.h"
@@ -27,6 +28,7 @@
 namespace catapult { namespace ionet {
 
 	/// A buffer for storing working data.
+	/// \note All unconsumed data is stored contiguously in a single chunk that is acquired from a per-buffer chunk pool.
 	class WorkingBuffer {
 	public:
 		/// Creates an empty working buffer around \a options.
@@ -35,27 +37,27 @@ namespace catapult { namespace ionet {
 	public:
 		/// Returns a const iterator to the beginning of the buffer
 		inline auto begin() const {
-			return m_data.cbegin();
+			return m_pChunk->cbegin() + static_cast<ByteBuffer::difference_type>(m_dataOffset);
 		}
 
 		/// Returns a const iterator to the end of the buffer.
 		inline auto end() const {
-			return m_data.cend();
+			return m_pChunk->cend();
 		}
 
 		/// Returns the size of the buffer.
 		inline auto size() const {
-			return m_data.size();
+			return m_pChunk->size() - m_dataOffset;
 		}
 
 		/// Returns a const pointer to the raw buffer.
 		inline auto data() const {
-			return m_data.data();
+			return m_pChunk->data() + m_dataOffset;
 		}
 
 		/// Returns the capacity of the raw buffer.
 		inline auto capacity() const {
-			return m_data.capacity();
+			return m_pChunk->capacity();
 		}
 
 	public:
@@ -65,12 +67,24 @@ namespace catapult { namespace ionet {
 		/// Creates a packet extractor that can be used to extract packets from the working buffer.
 		PacketExtractor preparePacketExtractor();
 
+		/// Shares ownership of \a packet, which must have been extracted from this buffer, without copying it.
+		/// \note The chunk backing \a packet is not reused until all shared packets referencing it have been destroyed.
+		std::shared_ptr<const Packet> share(const Packet& packet) const;
+
 	private:
+		size_t calculatePendingPacketSize() const;
+
+		void recycleChunk();
+
+		void relocate(size_t capacity);
+
 		void checkMemoryUsage();
 
 	private:
 		PacketSocketOptions m_options;
-		ByteBuffer m_data;
+		BufferChunkPool m_chunkPool;
+		std::shared_ptr<ByteBuffer> m_pChunk;
+		size_t m_dataOffset;
 		size_t m_numDataSizeSamples;
 		size_t m_maxDataSize;
 	};
@@ -19,6 +19,7 @@
 **/
 
 #include "BasicLocalNode.h"
+#include "CacheDatabaseCounters.h"
 #include "MemoryCounters.h"
 #include "NodeUtils.h"
 #include "catapult/extensions/ConfigurationUtils.h"
@@ -51,7 +52,7 @@ namespace catapult { namespace local {
 					, m_config(m_pBootstrapper->config())
 					, m_nodes(m_config.Node.MaxTrackedNodes, m_pBootstrapper->extensionManager().networkTimeSupplier())
 					, m_catapultCache({}) // note that subcaches are added in boot
-					, m_storage(m_pBootstrapper->subscriptionManager().createBlockStorage())
+					, m_storage(m_pBootstrapper->subscriptionManager().createBlockStorage(), m_config.Node.MaxBlockStorageCacheSize)
 					, m_pUtCache(m_pBootstrapper->subscriptionManager().createUtCache(extensions::GetUtCacheOptions(m_config.Node)))
 					, m_pTransactionStatusSubscriber(m_pBootstrapper->subscriptionManager().createTransactionStatusSubscriber())
 					, m_pStateChangeSubscriber(m_pBootstrapper->subscriptionManager().createStateChangeSubscriber())
@@ -120,6 +121,9 @@ namespace catapult { namespace local {
 
 			void registerCounters() {
 				AddMemoryCounters(m_counters);
+				if (m_pluginManager.cacheDatabaseResources())
+					AddCacheDatabaseCounters(m_counters, m_pluginManager.cacheDatabaseResources());
+
 				m_counters.emplace_back(utils::DiagnosticCounterId("TOT CONF TXES"), [&state = m_catapultState]() {
 					return state.NumTotalTransactions;
 				});
@@ -128,6 +132,16 @@ namespace catapult { namespace local {
 				m_counters.emplace_back(utils::DiagnosticCounterId("UT CACHE"), [&source = *m_pUtCache]() {
 					return source.view().size();
 				});
+
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLK C"), [&storage = m_storage]() {
+					return storage.statistics().NumCachedBlocks;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLK C HIT"), [&storage = m_storage]() {
+					return storage.statistics().NumHits;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLK C MISS"), [&storage = m_storage]() {
+					return storage.statistics().NumMisses;
+				});
 			}
 
 		public:
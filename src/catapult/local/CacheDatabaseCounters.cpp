@@ -0,0 +1,56 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "CacheDatabaseCounters.h"
+#include "catapult/cache_db/RocksSharedResources.h"
+#include "catapult/utils/DiagnosticCounter.h"
+
+namespace catapult { namespace local {
+
+	namespace {
+		utils::DiagnosticCounterId MakeId(const char* name) {
+			return utils::DiagnosticCounterId(std::string("RDB ") + name);
+		}
+
+		uint64_t ToMegabytes(uint64_t numBytes) {
+			return utils::FileSize::FromBytes(numBytes).megabytes();
+		}
+	}
+
+	void AddCacheDatabaseCounters(
+			std::vector<utils::DiagnosticCounter>& counters,
+			const std::shared_ptr<const cache::RocksSharedResources>& pResources) {
+		using cache::RocksStatistic;
+
+		counters.emplace_back(MakeId("BC USE"), [pResources]() { return pResources->blockCacheUsage().megabytes(); });
+		counters.emplace_back(MakeId("BC HIT"), [pResources]() { return pResources->statistic(RocksStatistic::Block_Cache_Hit); });
+		counters.emplace_back(MakeId("BC MISS"), [pResources]() { return pResources->statistic(RocksStatistic::Block_Cache_Miss); });
+		counters.emplace_back(MakeId("BF USEFUL"), [pResources]() { return pResources->statistic(RocksStatistic::Bloom_Filter_Useful); });
+		counters.emplace_back(MakeId("MT USE"), [pResources]() { return pResources->writeBufferUsage().megabytes(); });
+		counters.emplace_back(MakeId("MT HIT"), [pResources]() { return pResources->statistic(RocksStatistic::Memtable_Hit); });
+		counters.emplace_back(MakeId("MT MISS"), [pResources]() { return pResources->statistic(RocksStatistic::Memtable_Miss); });
+		counters.emplace_back(MakeId("READ MB"), [pResources]() {
+			return ToMegabytes(pResources->statistic(RocksStatistic::Bytes_Read));
+		});
+		counters.emplace_back(MakeId("WRITE MB"), [pResources]() {
+			return ToMegabytes(pResources->statistic(RocksStatistic::Bytes_Written));
+		});
+	}
+}}
@@ -55,6 +55,24 @@ namespace catapult { namespace model {
 		return entityHash;
 	}
 
+	std::vector<Hash256> CalculateHashes(
+			const TransactionRegistry& transactionRegistry,
+			const std::vector<const Transaction*>& transactions) {
+		// each hash is calculated over the "R" part of a signature, public key and data buffer (see CalculateHash)
+		std::vector<RawBuffer> buffers;
+		buffers.reserve(3 * transactions.size());
+		for (const auto* pTransaction : transactions) {
+			const auto& plugin = *transactionRegistry.findPlugin(pTransaction->Type);
+			buffers.push_back({ pTransaction->Signature.data(), Signature_Size / 2 });
+			buffers.push_back(pTransaction->Signer);
+			buffers.push_back(plugin.dataBuffer(*pTransaction));
+		}
+
+		std::vector<Hash256> hashes(transactions.size());
+		crypto::Sha3_256_Multi(buffers.data(), 3, transactions.size(), hashes.data());
+		return hashes;
+	}
+
 	Hash256 CalculateMerkleComponentHash(
 			const Transaction& transaction,
 			const Hash256& transactionHash,
@@ -39,6 +39,12 @@ namespace catapult { namespace model {
 	/// Calculates the hash for the given \a entity with data \a buffer.
 	Hash256 CalculateHash(const VerifiableEntity& entity, const RawBuffer& buffer);
 
+	/// Calculates the hashes for all \a transactions using transaction information from \a transactionRegistry.
+	/// \note Independent transaction hashes are calculated in parallel using multi-buffer hashing.
+	std::vector<Hash256> CalculateHashes(
+			const TransactionRegistry& transactionRegistry,
+			const std::vector<const Transaction*>& transactions);
+
 	/// Calculates the merkle component hash for the given \a transaction with \a transactionHash
 	/// using transaction information from \a transactionRegistry.
 	Hash256 CalculateMerkleComponentHash(
@@ -19,7 +19,10 @@
 **/
 
 #include "Challenge.h"
+#include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/KeyPair.h"
+#include "catapult/crypto/SecureZero.h"
+#include "catapult/crypto/SharedKey.h"
 #include "catapult/crypto/Signer.h"
 #include "catapult/utils/Casting.h"
 #include "catapult/utils/HexFormatter.h"
@@ -91,4 +94,24 @@ namespace catapult { namespace net {
 	bool VerifyClientChallengeResponse(const ClientChallengeResponse& response, const Key& serverPublicKey, const Challenge& challenge) {
 		return VerifyChallenge(serverPublicKey, { challenge }, response.Signature);
 	}
+
+	bool TryCalculateSessionSecret(
+			const crypto::KeyPair& keyPair,
+			const Key& remotePublicKey,
+			const Challenge& serverChallenge,
+			const Challenge& clientChallenge,
+			Hash256& sessionSecret) {
+		Key sharedKey;
+		if (!crypto::TryDeriveSharedKey(keyPair, remotePublicKey, sharedKey)) {
+			CATAPULT_LOG(warning) << "unable to derive shared key with " << utils::HexFormat(remotePublicKey);
+			return false;
+		}
+
+		// bind the secret to the challenges so that every connection uses a different secret
+		crypto::Sha3_256_Builder builder;
+		builder.update({ sharedKey, serverChallenge, clientChallenge });
+		builder.final(sessionSecret);
+		crypto::SecureZero(sharedKey);
+		return true;
+	}
 }}
@@ -89,4 +89,14 @@ namespace catapult { namespace net {
 	/// Verifies a server's \a response to \a challenge assuming the server has a public key
 	/// of \a serverPublicKey.
 	bool VerifyClientChallengeResponse(const ClientChallengeResponse& response, const Key& serverPublicKey, const Challenge& challenge);
+
+	/// Calculates a secret (\a sessionSecret) shared by \a keyPair and the owner of \a remotePublicKey that is bound
+	/// to the exchanged \a serverChallenge and \a clientChallenge.
+	/// Returns \c false if a shared key cannot be derived from \a remotePublicKey.
+	bool TryCalculateSessionSecret(
+			const crypto::KeyPair& keyPair,
+			const Key& remotePublicKey,
+			const Challenge& serverChallenge,
+			const Challenge& clientChallenge,
+			Hash256& sessionSecret);
 }}
@@ -39,6 +39,10 @@ namespace catapult { namespace net {
 	// SERVER -> ClientChallengeResponse -> CLIENT
 
 	namespace {
+		bool IsSessionSecurityMode(ionet::ConnectionSecurityMode securityMode) {
+			return ionet::ConnectionSecurityMode::Signed_Session == securityMode;
+		}
+
 		class VerifyClientHandler : public std::enable_shared_from_this<VerifyClientHandler> {
 		public:
 			VerifyClientHandler(
@@ -85,6 +89,13 @@ namespace catapult { namespace net {
 				if (!VerifyServerChallengeResponse(*pResponse, m_pRequest->Challenge))
 					return invokeCallback(VerifyResult::Failure_Challenge, clientPeerInfo);
 
+				if (IsSessionSecurityMode(clientPeerInfo.SecurityMode)) {
+					const auto& serverChallenge = m_pRequest->Challenge;
+					const auto& clientChallenge = pResponse->Challenge;
+					if (!TryCalculateSessionSecret(m_keyPair, clientPeerInfo.PublicKey, serverChallenge, clientChallenge, clientPeerInfo.SessionSecret))
+						return invokeCallback(VerifyResult::Failure_Challenge, clientPeerInfo);
+				}
+
 				auto pServerResponse = GenerateClientChallengeResponse(*pResponse, m_keyPair);
 				m_pIo->write(ionet::PacketPayload(pServerResponse), [pThis = shared_from_this(), clientPeerInfo](auto writeCode) {
 					pThis->handleClientChallengeReponseWrite(writeCode, clientPeerInfo);
@@ -156,13 +167,14 @@ namespace catapult { namespace net {
 				if (!pRequest)
 					return invokeCallback(VerifyResult::Malformed_Data);
 
+				m_serverChallenge = pRequest->Challenge;
 				m_pRequest = GenerateServerChallengeResponse(*pRequest, m_keyPair, m_serverPeerInfo.SecurityMode);
 				m_pIo->write(ionet::PacketPayload(m_pRequest), [pThis = shared_from_this()](auto writeCode) {
 					pThis->handleServerChallengeResponseWrite(writeCode);
 				});
 			}
 
-			void handleServerChallengeResponseWrite(ionet::SocketOperationCode code) const {
+			void handleServerChallengeResponseWrite(ionet::SocketOperationCode code) {
 				if (ionet::SocketOperationCode::Success != code)
 					return invokeCallback(VerifyResult::Io_Error_ServerChallengeResponse);
 
@@ -171,7 +183,7 @@ namespace catapult { namespace net {
 				});
 			}
 
-			void handleClientChallengeReponseRead(ionet::SocketOperationCode code, const ionet::Packet* pPacket) const {
+			void handleClientChallengeReponseRead(ionet::SocketOperationCode code, const ionet::Packet* pPacket) {
 				if (ionet::SocketOperationCode::Success != code)
 					return invokeCallback(VerifyResult::Io_Error_ClientChallengeResponse);
 
@@ -180,6 +192,12 @@ namespace catapult { namespace net {
 					return invokeCallback(VerifyResult::Malformed_Data);
 
 				auto isVerified = VerifyClientChallengeResponse(*pResponse, m_serverPeerInfo.PublicKey, m_pRequest->Challenge);
+				if (isVerified && IsSessionSecurityMode(m_serverPeerInfo.SecurityMode)) {
+					const auto& clientChallenge = m_pRequest->Challenge;
+					auto& sessionSecret = m_serverPeerInfo.SessionSecret;
+					isVerified = TryCalculateSessionSecret(m_keyPair, m_serverPeerInfo.PublicKey, m_serverChallenge, clientChallenge, sessionSecret);
+				}
+
 				invokeCallback(isVerified ? VerifyResult::Success: VerifyResult::Failure_Challenge);
 			}
 
@@ -194,6 +212,7 @@ namespace catapult { namespace net {
 			VerifiedPeerInfo m_serverPeerInfo;
 			const crypto::KeyPair& m_keyPair;
 			VerifyCallback m_callback;
+			Challenge m_serverChallenge;
 			std::shared_ptr<ServerChallengeResponse> m_pRequest;
 		};
 	}
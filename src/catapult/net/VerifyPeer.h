@@ -67,6 +67,9 @@ namespace catapult { namespace net {
 
 		/// Security mode established.
 		ionet::ConnectionSecurityMode SecurityMode;
+
+		/// Secret shared by both peers (only set when a session security mode is established).
+		Hash256 SessionSecret{};
 	};
 
 	/// Insertion operator for outputting \a value to \a out.
@@ -19,6 +19,7 @@
 **/
 
 #include "PluginManager.h"
+#include "catapult/cache_db/RocksSharedResources.h"
 #include <boost/filesystem/path.hpp>
 
 namespace catapult { namespace plugins {
@@ -26,6 +27,11 @@ namespace catapult { namespace plugins {
 	PluginManager::PluginManager(const model::BlockChainConfiguration& config, const StorageConfiguration& storageConfig)
 			: m_config(config)
 			, m_storageConfig(storageConfig)
+			, m_pCacheDatabaseResources(m_storageConfig.PreferCacheDatabase
+					? std::make_shared<cache::RocksSharedResources>(
+							m_storageConfig.CacheDatabaseBlockCacheSize,
+							m_storageConfig.CacheDatabaseWriteBufferBudget)
+					: nullptr)
 	{}
 
 	// region config
@@ -42,10 +48,19 @@ namespace catapult { namespace plugins {
 		if (!m_storageConfig.PreferCacheDatabase)
 			return cache::CacheConfiguration();
 
-		return cache::CacheConfiguration(
+		auto cacheConfig = cache::CacheConfiguration(
 				(boost::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / name).generic_string(),
 				m_storageConfig.MaxCacheDatabaseWriteBatchSize,
-				m_config.ShouldEnableVerifiableState ? cache::PatriciaTreeStorageMode::Enabled : cache::PatriciaTreeStorageMode::Disabled);
+				m_config.ShouldEnableVerifiableState ? cache::PatriciaTreeStorageMode::Enabled : cache::PatriciaTreeStorageMode::Disabled,
+				m_pCacheDatabaseResources);
+		cacheConfig.PatriciaTreeNodeCacheOptions.MaxSize = m_storageConfig.MaxPatriciaTreeNodeCacheSize;
+		cacheConfig.PatriciaTreeNodeCacheOptions.NumPinnedLevels = m_storageConfig.PatriciaTreeNodeCachePinnedLevels;
+		cacheConfig.PatriciaTreeNumRetainedRoots = m_storageConfig.PatriciaTreeRetainedRoots;
+		return cacheConfig;
+	}
+
+	std::shared_ptr<cache::RocksSharedResources> PluginManager::cacheDatabaseResources() const {
+		return m_pCacheDatabaseResources;
 	}
 
 	// endregion
@@ -212,6 +227,21 @@ namespace catapult { namespace plugins {
 
 	// endregion
 
+	// region prefetch
+
+	void PluginManager::addPrefetchKeysExtractor(const PrefetchKeysExtractor& extractor) {
+		m_prefetchKeysExtractors.push_back(extractor);
+	}
+
+	PluginManager::PrefetchKeysExtractor PluginManager::createPrefetchKeysExtractor() const {
+		return [extractors = m_prefetchKeysExtractors](const auto& notification, const auto& resolvers, auto& keys) {
+			for (const auto& extractor : extractors)
+				extractor(notification, resolvers, keys);
+		};
+	}
+
+	// endregion
+
 	// region publisher
 
 	PluginManager::PublisherPointer PluginManager::createNotificationPublisher(model::PublicationMode mode) const {
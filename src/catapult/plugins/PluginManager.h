@@ -21,6 +21,7 @@
 #pragma once
 #include "catapult/cache/CacheConfiguration.h"
 #include "catapult/cache/CatapultCacheBuilder.h"
+#include "catapult/cache/PrefetchKeys.h"
 #include "catapult/ionet/PacketHandlers.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NotificationPublisher.h"
@@ -44,6 +45,21 @@ namespace catapult { namespace plugins {
 
 		/// Maximum cache database write batch size.
 		utils::FileSize MaxCacheDatabaseWriteBatchSize;
+
+		/// Size of the block cache shared by all cache databases.
+		utils::FileSize CacheDatabaseBlockCacheSize;
+
+		/// Memtable budget shared by all cache databases.
+		utils::FileSize CacheDatabaseWriteBufferBudget;
+
+		/// Maximum number of decoded nodes cached in front of each patricia tree database column.
+		uint32_t MaxPatriciaTreeNodeCacheSize = 0;
+
+		/// Number of top patricia tree levels pinned in each decoded node cache.
+		uint32_t PatriciaTreeNodeCachePinnedLevels = 0;
+
+		/// Number of most recent patricia tree generations whose roots remain fully stored (\c 0 disables stale node removal).
+		uint32_t PatriciaTreeRetainedRoots = 0;
 	};
 
 	/// A manager for registering plugins.
@@ -69,6 +85,8 @@ namespace catapult { namespace plugins {
 		using AggregateMosaicResolver = AggregateResolver<UnresolvedMosaicId, MosaicId>;
 		using AggregateAddressResolver = AggregateResolver<UnresolvedAddress, Address>;
 
+		using PrefetchKeysExtractor = consumer<const model::Notification&, const model::ResolverContext&, cache::PrefetchKeys&>;
+
 		using PublisherPointer = std::unique_ptr<model::NotificationPublisher>;
 
 	public:
@@ -87,6 +105,9 @@ namespace catapult { namespace plugins {
 		/// Gets the cache configuration for cache with \a name.
 		cache::CacheConfiguration cacheConfig(const std::string& name) const;
 
+		/// Gets the database resources shared by all caches (\c nullptr when cache database is not preferred).
+		std::shared_ptr<cache::RocksSharedResources> cacheDatabaseResources() const;
+
 		// endregion
 
 		// region transactions
@@ -192,6 +213,26 @@ namespace catapult { namespace plugins {
 
 		// endregion
 
+		// region prefetch
+
+		/// Adds a prefetch keys \a extractor.
+		void addPrefetchKeysExtractor(const PrefetchKeysExtractor& extractor);
+
+		/// Adds a prefetch keys \a extractor that is invoked only when matching notifications are processed.
+		template<typename TNotification>
+		void addPrefetchKeysExtractor(
+				const consumer<const TNotification&, const model::ResolverContext&, cache::PrefetchKeys&>& extractor) {
+			addPrefetchKeysExtractor([extractor](const auto& notification, const auto& resolvers, auto& keys) {
+				if (model::AreEqualExcludingChannel(TNotification::Notification_Type, notification.Type))
+					extractor(static_cast<const TNotification&>(notification), resolvers, keys);
+			});
+		}
+
+		/// Creates a prefetch keys extractor that forwards to all registered extractors.
+		PrefetchKeysExtractor createPrefetchKeysExtractor() const;
+
+		// endregion
+
 		// region publisher
 
 		/// Creates a notification publisher for the specified \a mode.
@@ -202,6 +243,7 @@ namespace catapult { namespace plugins {
 	private:
 		model::BlockChainConfiguration m_config;
 		StorageConfiguration m_storageConfig;
+		std::shared_ptr<cache::RocksSharedResources> m_pCacheDatabaseResources;
 		model::TransactionRegistry m_transactionRegistry;
 		cache::CatapultCacheBuilder m_cacheBuilder;
 
@@ -215,6 +257,8 @@ namespace catapult { namespace plugins {
 
 		std::vector<MosaicResolver> m_mosaicResolvers;
 		std::vector<AddressResolver> m_addressResolvers;
+
+		std::vector<PrefetchKeysExtractor> m_prefetchKeysExtractors;
 	};
 }}
 
@@ -0,0 +1,118 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "AsyncBlockChangeSubscriber.h"
+#include "catapult/utils/MemoryUtils.h"
+#include <cstring>
+
+namespace catapult { namespace subscribers {
+
+	namespace {
+		bool IsDrop(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+			return !pBlockElement;
+		}
+	}
+
+	AsyncBlockChangeSubscriber::AsyncBlockChangeSubscriber(
+			std::unique_ptr<io::BlockChangeSubscriber>&& pSubscriber,
+			size_t maxPendingEvents)
+			: m_pSubscriber(std::move(pSubscriber))
+			, m_queue(
+					maxPendingEvents,
+					[&subscriber = *m_pSubscriber](auto& event) {
+						if (IsDrop(event.pBlockElement))
+							subscriber.notifyDropBlocksAfter(event.DropHeight);
+						else
+							subscriber.notifyBlock(*event.pBlockElement);
+					},
+					[](auto& pendingEvents, auto& event) {
+						if (!IsDrop(event.pBlockElement))
+							return false;
+
+						// pending blocks above the drop height are superseded by the drop
+						while (!pendingEvents.empty()) {
+							const auto& lastEvent = pendingEvents.back();
+							if (IsDrop(lastEvent.pBlockElement) || lastEvent.pBlockElement->Block.Height <= event.DropHeight)
+								break;
+
+							pendingEvents.pop_back();
+						}
+
+						// consecutive drops can be merged into the lowest one
+						if (pendingEvents.empty() || !IsDrop(pendingEvents.back().pBlockElement))
+							return false;
+
+						auto& lastDropHeight = pendingEvents.back().DropHeight;
+						lastDropHeight = std::min(lastDropHeight, event.DropHeight);
+						return true;
+					})
+	{}
+
+	AsyncSubscriberQueueStatistics AsyncBlockChangeSubscriber::statistics() const {
+		return m_queue.statistics();
+	}
+
+	void AsyncBlockChangeSubscriber::flush() {
+		m_queue.flush();
+	}
+
+	void AsyncBlockChangeSubscriber::notifyBlock(const model::BlockElement& blockElement) {
+		m_queue.push({ CopyBlockElement(blockElement), Height() });
+	}
+
+	void AsyncBlockChangeSubscriber::notifyDropBlocksAfter(Height height) {
+		m_queue.push({ nullptr, height });
+	}
+
+	std::shared_ptr<const model::BlockElement> CopyBlockElement(const model::BlockElement& blockElement) {
+		// allocate memory for both the element and the block in one shot (block data is appended)
+		auto blockSize = blockElement.Block.Size;
+		auto pData = utils::MakeUniqueWithSize<uint8_t>(sizeof(model::BlockElement) + blockSize);
+
+		auto pBlockData = pData.get() + sizeof(model::BlockElement);
+		std::memcpy(pBlockData, &blockElement.Block, blockSize);
+
+		// create the block element and transfer ownership from pData to pBlockElement
+		auto pBlockElementRaw = new (pData.get()) model::BlockElement(*reinterpret_cast<model::Block*>(pBlockData));
+		auto pBlockElement = std::shared_ptr<model::BlockElement>(pBlockElementRaw);
+		pData.release();
+
+		pBlockElement->EntityHash = blockElement.EntityHash;
+		pBlockElement->GenerationHash = blockElement.GenerationHash;
+		pBlockElement->SubCacheMerkleRoots = blockElement.SubCacheMerkleRoots;
+		pBlockElement->OptionalStatement = blockElement.OptionalStatement;
+
+		// transaction elements need to reference the copied transactions
+		auto sourceIter = blockElement.Transactions.cbegin();
+		for (const auto& transaction : pBlockElement->Block.Transactions()) {
+			if (blockElement.Transactions.cend() == sourceIter)
+				CATAPULT_THROW_INVALID_ARGUMENT("block element has fewer transaction elements than block transactions");
+
+			pBlockElement->Transactions.emplace_back(transaction);
+			auto& transactionElement = pBlockElement->Transactions.back();
+			transactionElement.EntityHash = sourceIter->EntityHash;
+			transactionElement.MerkleComponentHash = sourceIter->MerkleComponentHash;
+			transactionElement.OptionalExtractedAddresses = sourceIter->OptionalExtractedAddresses;
+			++sourceIter;
+		}
+
+		return std::move(pBlockElement);
+	}
+}}
@@ -0,0 +1,61 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "AsyncSubscriberQueue.h"
+#include "catapult/io/BlockChangeSubscriber.h"
+#include <memory>
+
+namespace catapult { namespace subscribers {
+
+	/// Block change subscriber decorator that forwards notifications to a subscriber on a background thread.
+	/// \note Block elements are copied before they are queued, so the originating block can be released immediately.
+	class AsyncBlockChangeSubscriber : public io::BlockChangeSubscriber {
+	private:
+		struct BlockChangeEvent {
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+			Height DropHeight;
+		};
+
+	public:
+		/// Creates a subscriber that forwards notifications to \a pSubscriber while allowing at most \a maxPendingEvents pending events.
+		AsyncBlockChangeSubscriber(std::unique_ptr<io::BlockChangeSubscriber>&& pSubscriber, size_t maxPendingEvents);
+
+	public:
+		/// Gets the queue diagnostic counters.
+		AsyncSubscriberQueueStatistics statistics() const;
+
+		/// Blocks until all pending notifications have been forwarded.
+		void flush();
+
+	public:
+		void notifyBlock(const model::BlockElement& blockElement) override;
+
+		void notifyDropBlocksAfter(Height height) override;
+
+	private:
+		// order is important because the queue needs to be destroyed before the subscriber
+		std::unique_ptr<io::BlockChangeSubscriber> m_pSubscriber;
+		AsyncSubscriberQueue<BlockChangeEvent> m_queue;
+	};
+
+	/// Copies \a blockElement, including the underlying block, into a self-contained block element.
+	std::shared_ptr<const model::BlockElement> CopyBlockElement(const model::BlockElement& blockElement);
+}}
@@ -0,0 +1,85 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "AsyncStateChangeSubscriber.h"
+
+namespace catapult { namespace subscribers {
+
+	namespace {
+		template<typename TEvent>
+		bool IsScoreChange(const TEvent& event) {
+			return !event.pStateChange;
+		}
+
+		template<typename TEvents, typename TEvent>
+		auto FindLastEventOfSameType(TEvents& events, const TEvent& event) {
+			auto isScoreChange = IsScoreChange(event);
+			return std::find_if(events.rbegin(), events.rend(), [isScoreChange](const auto& pendingEvent) {
+				return isScoreChange == IsScoreChange(pendingEvent);
+			});
+		}
+	}
+
+	AsyncStateChangeSubscriber::AsyncStateChangeSubscriber(
+			std::unique_ptr<CapturingStateChangeSubscriber>&& pSubscriber,
+			size_t maxPendingEvents)
+			: m_pSubscriber(std::move(pSubscriber))
+			, m_queue(
+					maxPendingEvents,
+					[&subscriber = *m_pSubscriber](auto& event) {
+						if (IsScoreChange(event))
+							subscriber.notifyScoreChange(event.ChainScore);
+						else
+							subscriber.notifyStateChange(*event.pStateChange);
+					},
+					[](auto& pendingEvents, auto& event) {
+						auto iter = FindLastEventOfSameType(pendingEvents, event);
+						if (pendingEvents.rend() == iter)
+							return false;
+
+						if (!IsScoreChange(event))
+							return iter->pStateChange->tryMerge(*event.pStateChange);
+
+						// only the latest chain score is relevant
+						iter->ChainScore = event.ChainScore;
+						return true;
+					})
+	{}
+
+	AsyncSubscriberQueueStatistics AsyncStateChangeSubscriber::statistics() const {
+		return m_queue.statistics();
+	}
+
+	void AsyncStateChangeSubscriber::flush() {
+		m_queue.flush();
+	}
+
+	void AsyncStateChangeSubscriber::notifyScoreChange(const model::ChainScore& chainScore) {
+		m_queue.push({ chainScore, nullptr });
+	}
+
+	void AsyncStateChangeSubscriber::notifyStateChange(const consumers::StateChangeInfo& stateChangeInfo) {
+		auto pStateChange = m_pSubscriber->captureStateChange(stateChangeInfo);
+		if (!pStateChange)
+			CATAPULT_THROW_RUNTIME_ERROR("capturing subscriber did not capture state change");
+
+		m_queue.push({ model::ChainScore(), std::move(pStateChange) });
+	}
+}}
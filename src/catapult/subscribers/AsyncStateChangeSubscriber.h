@@ -0,0 +1,88 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "AsyncSubscriberQueue.h"
+#include "StateChangeSubscriber.h"
+#include "catapult/model/ChainScore.h"
+#include <memory>
+
+namespace catapult { namespace subscribers {
+
+	/// State change data that was captured while the originating cache delta was still alive.
+	class CapturedStateChange {
+	public:
+		virtual ~CapturedStateChange() = default;
+
+	public:
+		/// Tries to merge \a laterChange, which was captured after this change, into this change.
+		/// \note Returns \c false if the changes must be processed separately.
+		virtual bool tryMerge(CapturedStateChange& laterChange) = 0;
+	};
+
+	/// State change subscriber that splits state change processing into a synchronous capture and a deferred notification.
+	class CapturingStateChangeSubscriber {
+	public:
+		virtual ~CapturingStateChangeSubscriber() = default;
+
+	public:
+		/// Indicates chain score was changed to \a chainScore.
+		virtual void notifyScoreChange(const model::ChainScore& chainScore) = 0;
+
+		/// Captures all data needed to process \a stateChangeInfo.
+		/// \note This is called on the notifying thread before the cache delta is committed.
+		virtual std::unique_ptr<CapturedStateChange> captureStateChange(const consumers::StateChangeInfo& stateChangeInfo) = 0;
+
+		/// Indicates state was changed with change information captured in \a stateChange.
+		virtual void notifyStateChange(CapturedStateChange& stateChange) = 0;
+	};
+
+	/// State change subscriber decorator that forwards notifications to a capturing subscriber on a background thread.
+	/// \note When the background thread lags, score changes are collapsed into the latest one and consecutive
+	///       state changes are merged, so score and state changes are coalesced independently of each other.
+	class AsyncStateChangeSubscriber : public StateChangeSubscriber {
+	private:
+		struct StateChangeEvent {
+			model::ChainScore ChainScore;
+			std::unique_ptr<CapturedStateChange> pStateChange;
+		};
+
+	public:
+		/// Creates a subscriber that forwards notifications to \a pSubscriber while allowing at most \a maxPendingEvents pending events.
+		AsyncStateChangeSubscriber(std::unique_ptr<CapturingStateChangeSubscriber>&& pSubscriber, size_t maxPendingEvents);
+
+	public:
+		/// Gets the queue diagnostic counters.
+		AsyncSubscriberQueueStatistics statistics() const;
+
+		/// Blocks until all pending notifications have been forwarded.
+		void flush();
+
+	public:
+		void notifyScoreChange(const model::ChainScore& chainScore) override;
+
+		void notifyStateChange(const consumers::StateChangeInfo& stateChangeInfo) override;
+
+	private:
+		// order is important because the queue needs to be destroyed before the subscriber
+		std::unique_ptr<CapturingStateChangeSubscriber> m_pSubscriber;
+		AsyncSubscriberQueue<StateChangeEvent> m_queue;
+	};
+}}
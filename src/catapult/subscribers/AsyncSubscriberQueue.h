@@ -0,0 +1,167 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/Logging.h"
+#include "catapult/exceptions.h"
+#include "catapult/functions.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace catapult { namespace subscribers {
+
+	/// Diagnostic counters of an async subscriber queue.
+	struct AsyncSubscriberQueueStatistics {
+		/// Number of events waiting to be processed.
+		size_t NumPendingEvents;
+
+		/// Maximum number of events that were waiting to be processed at any one time.
+		size_t MaxPendingEvents;
+
+		/// Number of events that were processed.
+		size_t NumProcessedEvents;
+
+		/// Number of events that were coalesced with other events.
+		size_t NumCoalescedEvents;
+	};
+
+	/// Bounded queue that forwards events to a handler on a dedicated background thread.
+	/// \note Pushing blocks while the queue is full so that a slow handler applies backpressure on the producer.
+	template<typename TEvent>
+	class AsyncSubscriberQueue {
+	public:
+		/// Handler that processes a single event.
+		using EventHandler = consumer<TEvent&>;
+
+		/// Coalescer that is allowed to merge a new event into (or drop superseded events from) the pending events.
+		/// Returns \c true if the new event was absorbed and should not be queued.
+		using EventCoalescer = std::function<bool (std::deque<TEvent>&, TEvent&)>;
+
+	public:
+		/// Creates a queue that holds at most \a maxPendingEvents events and forwards them to \a handler.
+		/// When the handler lags, \a coalescer is given a chance to merge each new event into the pending events.
+		AsyncSubscriberQueue(size_t maxPendingEvents, const EventHandler& handler, const EventCoalescer& coalescer)
+				: m_maxPendingEvents(maxPendingEvents)
+				, m_handler(handler)
+				, m_coalescer(coalescer)
+				, m_statistics()
+				, m_isProcessing(false)
+				, m_isStopped(false) {
+			if (0 == m_maxPendingEvents)
+				CATAPULT_THROW_INVALID_ARGUMENT("async subscriber queue must allow at least one pending event");
+
+			m_thread = std::thread([this]() { this->work(); });
+		}
+
+		/// Destroys the queue after all pending events have been processed.
+		~AsyncSubscriberQueue() {
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_isStopped = true;
+			}
+
+			m_condition.notify_all();
+			m_thread.join();
+		}
+
+	public:
+		/// Gets the current diagnostic counters.
+		AsyncSubscriberQueueStatistics statistics() const {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto statistics = m_statistics;
+			statistics.NumPendingEvents = m_events.size();
+			return statistics;
+		}
+
+	public:
+		/// Queues \a event for processing.
+		void push(TEvent&& event) {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			auto numEventsBeforeCoalescing = m_events.size();
+			if (!m_events.empty() && m_coalescer(m_events, event)) {
+				m_statistics.NumCoalescedEvents += numEventsBeforeCoalescing - m_events.size() + 1;
+				return;
+			}
+
+			m_statistics.NumCoalescedEvents += numEventsBeforeCoalescing - m_events.size();
+			m_condition.wait(lock, [this]() { return m_events.size() < m_maxPendingEvents; });
+
+			m_events.push_back(std::move(event));
+			m_statistics.MaxPendingEvents = std::max(m_statistics.MaxPendingEvents, m_events.size());
+			lock.unlock();
+			m_condition.notify_all();
+		}
+
+		/// Blocks until all pending events have been processed.
+		void flush() {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [this]() { return m_events.empty() && !m_isProcessing; });
+		}
+
+	private:
+		void work() {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			for (;;) {
+				m_condition.wait(lock, [this]() { return !m_events.empty() || m_isStopped; });
+				if (m_events.empty())
+					return;
+
+				auto event = std::move(m_events.front());
+				m_events.pop_front();
+				m_isProcessing = true;
+				lock.unlock();
+				m_condition.notify_all();
+
+				process(event);
+
+				lock.lock();
+				m_isProcessing = false;
+				++m_statistics.NumProcessedEvents;
+				m_condition.notify_all();
+			}
+		}
+
+		void process(TEvent& event) {
+			// there is no caller to propagate an exception to, so log it and keep processing subsequent events
+			try {
+				m_handler(event);
+			} catch (const std::exception& ex) {
+				CATAPULT_LOG(error) << "async subscriber failed to process event: " << ex.what();
+			}
+		}
+
+	private:
+		const size_t m_maxPendingEvents;
+		EventHandler m_handler;
+		EventCoalescer m_coalescer;
+
+		AsyncSubscriberQueueStatistics m_statistics;
+		std::deque<TEvent> m_events;
+		bool m_isProcessing;
+		bool m_isStopped;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::thread m_thread;
+	};
+}}
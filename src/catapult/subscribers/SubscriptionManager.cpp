@@ -29,12 +29,35 @@
 #include "catapult/cache/AggregateUtCache.h"
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/io/AggregateBlockStorage.h"
+#include "catapult/io/BlockStorageConverter.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/PackedFileBlockStorage.h"
+#include "catapult/utils/Logging.h"
 
 namespace catapult { namespace subscribers {
 
+	namespace {
+		std::unique_ptr<io::BlockStorage> CreateFileStorage(const config::LocalNodeConfiguration& config) {
+			const auto& dataDirectory = config.User.DataDirectory;
+			if (!config.Node.ShouldUsePackedBlockStorage)
+				return std::make_unique<io::FileBlockStorage>(dataDirectory);
+
+			// when packed storage is empty, import all blocks (e.g. seeded nemesis block) stored one file per block
+			// (this is only done once because later rollbacks of the packed storage are not reflected in the legacy storage)
+			auto pStorage = std::make_unique<io::PackedFileBlockStorage>(dataDirectory);
+			if (Height(0) == pStorage->chainHeight()) {
+				io::FileBlockStorage legacyStorage(dataDirectory);
+				CATAPULT_LOG(info) << "converting blocks up to height " << legacyStorage.chainHeight() << " to packed block storage";
+				io::ConvertBlockStorage(legacyStorage, *pStorage);
+			}
+
+			return pStorage;
+		}
+	}
+
 	SubscriptionManager::SubscriptionManager(const config::LocalNodeConfiguration& config)
 			: m_config(config)
-			, m_pStorage(std::make_unique<io::FileBlockStorage>(m_config.User.DataDirectory)) {
+			, m_pStorage(CreateFileStorage(m_config)) {
 		m_subscriberUsedFlags.fill(false);
 	}
 
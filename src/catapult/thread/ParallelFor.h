@@ -20,34 +20,46 @@
 
 #pragma once
 #include "Future.h"
+#include "catapult/utils/SpinLock.h"
 #include <boost/asio.hpp>
+#include <algorithm>
+#include <vector>
 
 namespace catapult { namespace thread {
 
-	/// Uses \a service to process \a items in \a numPartitions batches and calls \a callback for each partition.
-	/// A future is returned that is resolved when all items have been processed.
-	template<typename TItems, typename TWorkCallback>
-	thread::future<bool> ParallelForPartition(
-			boost::asio::io_service& service,
-			TItems& items,
-			size_t numPartitions,
-			TWorkCallback callback) {
+	/// Strategies for distributing items across workers.
+	enum class ParallelForStrategy {
+		/// Items are statically split into equally sized partitions, one per worker.
+		Static_Partition,
+
+		/// Items are initially split into equally sized partitions, one per worker, but idle workers steal
+		/// unprocessed items from busy workers.
+		Work_Stealing
+	};
+
+	namespace detail {
 		// region ParallelContext
+
+		/// Context shared by all operations of a single parallel for invocation.
 		class ParallelContext {
 		public:
+			/// Creates a context.
 			ParallelContext() : m_numOutstandingOperations(1) // note that the work partitioning is the initial operation
 			{}
 
 		public:
+			/// Gets a future that is resolved when all operations have completed.
 			auto future() {
 				return m_promise.get_future();
 			}
 
 		public:
+			/// Increments the number of outstanding operations.
 			void incrementOutstandingOperations() {
 				++m_numOutstandingOperations;
 			}
 
+			/// Decrements the number of outstanding operations and resolves the future when none remain.
 			void decrementOutstandingOperations() {
 				if (0 != --m_numOutstandingOperations)
 					return;
@@ -64,11 +76,14 @@ namespace catapult { namespace thread {
 
 		// region DecrementGuard
 
+		/// Guard that completes an operation of a parallel context when destroyed.
 		class DecrementGuard {
 		public:
+			/// Creates a guard around \a context.
 			explicit DecrementGuard(ParallelContext& context) : m_context(context)
 			{}
 
+			/// Completes an operation.
 			~DecrementGuard() {
 				m_context.decrementOutstandingOperations();
 			}
@@ -79,7 +94,116 @@ namespace catapult { namespace thread {
 
 		// endregion
 
-		auto pParallelContext = std::make_shared<ParallelContext>();
+		// region WorkStealingRange
+
+		/// Range of item indexes owned by a single work stealing worker.
+		/// \note Owner takes items from the front and thieves take items from the back.
+		class WorkStealingRange {
+		public:
+			/// Creates an empty range.
+			WorkStealingRange() : m_begin(0), m_end(0)
+			{}
+
+		public:
+			/// Sets the range to [\a begin, \a end).
+			void reset(size_t begin, size_t end) {
+				utils::SpinLockGuard guard(m_lock);
+				m_begin = begin;
+				m_end = end;
+			}
+
+			/// Tries to take the first index in the range and, on success, sets \a index to it.
+			bool tryPopFront(size_t& index) {
+				utils::SpinLockGuard guard(m_lock);
+				if (m_begin == m_end)
+					return false;
+
+				index = m_begin++;
+				return true;
+			}
+
+			/// Tries to take the back half of the range and, on success, sets [\a begin, \a end) to the stolen indexes.
+			bool trySteal(size_t& begin, size_t& end) {
+				utils::SpinLockGuard guard(m_lock);
+				if (m_begin == m_end)
+					return false;
+
+				end = m_end;
+				begin = m_end - (m_end - m_begin + 1) / 2;
+				m_end = begin;
+				return true;
+			}
+
+		private:
+			utils::SpinLock m_lock;
+			size_t m_begin;
+			size_t m_end;
+		};
+
+		// endregion
+
+		// region WorkStealingContext
+
+		/// Context shared by all workers of a single work stealing parallel for invocation.
+		class WorkStealingContext : public ParallelContext {
+		public:
+			/// Creates a context for \a numItems items split across \a numWorkers workers.
+			WorkStealingContext(size_t numItems, size_t numWorkers)
+					: m_ranges(numWorkers)
+					, m_isAborted(false) {
+				for (auto i = 0u; i < numWorkers; ++i)
+					m_ranges[i].reset(numItems * i / numWorkers, numItems * (i + 1) / numWorkers);
+			}
+
+		public:
+			/// Tries to get the index of the next item to be processed by the worker with index \a workerIndex.
+			/// On success, sets \a index to the item index.
+			bool tryNext(size_t workerIndex, size_t& index) {
+				if (m_isAborted)
+					return false;
+
+				auto& range = m_ranges[workerIndex];
+				if (range.tryPopFront(index))
+					return true;
+
+				// own range is exhausted, so steal work from other workers (starting with the closest one)
+				for (auto i = 1u; i < m_ranges.size(); ++i) {
+					size_t begin, end;
+					if (!m_ranges[(workerIndex + i) % m_ranges.size()].trySteal(begin, end))
+						continue;
+
+					index = begin;
+					range.reset(begin + 1, end);
+					return true;
+				}
+
+				return false;
+			}
+
+			/// Stops all workers from processing additional items.
+			void abort() {
+				m_isAborted = true;
+			}
+
+		private:
+			std::vector<WorkStealingRange> m_ranges;
+			std::atomic_bool m_isAborted;
+		};
+
+		// endregion
+	}
+
+	/// Uses \a service to process \a items in \a numPartitions batches and calls \a callback for each partition.
+	/// A future is returned that is resolved when all items have been processed.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> ParallelForPartition(
+			boost::asio::io_service& service,
+			TItems& items,
+			size_t numPartitions,
+			TWorkCallback callback) {
+		using detail::DecrementGuard;
+
+		auto pParallelContext = std::make_shared<detail::ParallelContext>();
 		DecrementGuard mainOperationGuard(*pParallelContext);
 
 		auto numRemainingPartitions = numPartitions;
@@ -123,4 +247,54 @@ namespace catapult { namespace thread {
 			});
 		});
 	}
+
+	/// Uses \a service to process \a items with \a numWorkers workers and calls \a callback for each item.
+	/// Each worker starts with an equally sized partition of items and, when done, steals remaining items from other workers.
+	/// A future is returned that is resolved when all items have been processed.
+	/// \note Processing of all items is stopped as soon as \a callback returns \c false for any item.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> WorkStealingParallelFor(
+			boost::asio::io_service& service,
+			TItems& items,
+			size_t numWorkers,
+			TWorkCallback callback) {
+		using detail::DecrementGuard;
+
+		auto numItems = items.size();
+		numWorkers = std::min(numWorkers, numItems);
+		auto pContext = std::make_shared<detail::WorkStealingContext>(numItems, numWorkers);
+		DecrementGuard mainOperationGuard(*pContext);
+
+		for (auto workerIndex = 0u; workerIndex < numWorkers; ++workerIndex) {
+			// each thread captures pContext by value, which keeps that object alive
+			pContext->incrementOutstandingOperations();
+			service.post([callback, pContext, itBegin = items.begin(), workerIndex]() {
+				DecrementGuard threadOperationGuard(*pContext);
+
+				size_t index;
+				while (pContext->tryNext(workerIndex, index)) {
+					auto iter = itBegin;
+					std::advance(iter, static_cast<typename decltype(iter)::difference_type>(index));
+					if (!callback(*iter, index))
+						pContext->abort();
+				}
+			});
+		}
+
+		return pContext->future();
+	}
+
+	/// Uses \a service to process \a items in \a numPartitions batches using \a strategy and calls \a callback for each item.
+	/// A future is returned that is resolved when all items have been processed.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<bool> ParallelFor(
+			boost::asio::io_service& service,
+			TItems& items,
+			size_t numPartitions,
+			ParallelForStrategy strategy,
+			TWorkCallback callback) {
+		return ParallelForStrategy::Work_Stealing == strategy
+				? WorkStealingParallelFor(service, items, numPartitions, callback)
+				: ParallelFor(service, items, numPartitions, callback);
+	}
 }}
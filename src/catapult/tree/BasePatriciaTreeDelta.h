@@ -34,6 +34,11 @@ namespace catapult { namespace tree {
 	private:
 		using KeyType = typename TEncoder::KeyType;
 		using ValueType = typename TEncoder::ValueType;
+		using TreeType = PatriciaTree<TEncoder, ReadThroughMemoryDataSource<TDataSource>>;
+
+	public:
+		/// Pairs of keys and pointers to their new values (\c nullptr when a key should be removed).
+		using Changes = typename TreeType::Changes;
 
 	public:
 		/// Creates a tree around a \a dataSource with root \a rootHash.
@@ -76,6 +81,11 @@ namespace catapult { namespace tree {
 			return m_tree.unset(key);
 		}
 
+		/// Applies all \a changes to the tree.
+		void update(const Changes& changes) {
+			m_tree.update(changes);
+		}
+
 	public:
 		/// Marks all nodes reachable at this point.
 		void setCheckpoint() {
@@ -107,6 +117,6 @@ namespace catapult { namespace tree {
 	private:
 		ReadThroughMemoryDataSource<TDataSource> m_dataSource;
 		Hash256 m_baseRootHash;
-		PatriciaTree<TEncoder, ReadThroughMemoryDataSource<TDataSource>> m_tree;
+		TreeType m_tree;
 	};
 }}
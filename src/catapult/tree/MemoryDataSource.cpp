@@ -31,9 +31,10 @@ namespace catapult { namespace tree {
 		return m_nodes.size();
 	}
 
-	std::unique_ptr<const TreeNode> MemoryDataSource::get(const Hash256& hash) const {
+	std::shared_ptr<const TreeNode> MemoryDataSource::get(const Hash256& hash) const {
+		// saved nodes are immutable, so they can be shared instead of copied
 		auto iter = m_nodes.find(hash);
-		return m_nodes.cend() != iter ? std::make_unique<const TreeNode>(iter->second->copy()) : nullptr;
+		return m_nodes.cend() != iter ? iter->second : nullptr;
 	}
 
 	void MemoryDataSource::forEach(const consumer<const TreeNode&>& consumer) const {
@@ -39,7 +39,7 @@ namespace catapult { namespace tree {
 
 	public:
 		/// Gets the tree node associated with \a hash.
-		std::unique_ptr<const TreeNode> get(const Hash256& hash) const;
+		std::shared_ptr<const TreeNode> get(const Hash256& hash) const;
 
 		/// Gets all nodes and passes them to \a consumer.
 		void forEach(const consumer<const TreeNode&>& consumer) const;
@@ -60,11 +60,11 @@ namespace catapult { namespace tree {
 			// explicitly call hash() before emplace to ensure cached value is used
 			// (and avoid undefined behavior of parameter evaluation order)
 			auto nodeHash = node.hash();
-			m_nodes.emplace(nodeHash, std::make_unique<TreeNode>(node));
+			m_nodes.emplace(nodeHash, std::make_shared<const TreeNode>(node));
 		}
 
 	private:
 		bool m_isVerbose;
-		std::unordered_map<Hash256, std::unique_ptr<TreeNode>, utils::ArrayHasher<Hash256>> m_nodes;
+		std::unordered_map<Hash256, std::shared_ptr<const TreeNode>, utils::ArrayHasher<Hash256>> m_nodes;
 	};
 }}
@@ -20,6 +20,8 @@
 
 #pragma once
 #include "TreeNode.h"
+#include <algorithm>
+#include <vector>
 
 namespace catapult { namespace tree {
 
@@ -30,14 +32,28 @@ namespace catapult { namespace tree {
 		using KeyType = typename TEncoder::KeyType;
 		using ValueType = typename TEncoder::ValueType;
 
+		/// Pairs of keys and pointers to their new values (\c nullptr when a key should be removed).
+		using Changes = std::vector<std::pair<KeyType, const ValueType*>>;
+
+		/// Minimum number of changes in a single update that triggers parallel hashing of the root subtrees.
+		static constexpr size_t Min_Parallel_Hash_Changes = 1000;
+
 	public:
 		/// Creates a tree around a \a dataSource.
-		explicit PatriciaTree(TDataSource& dataSource) : m_dataSource(dataSource)
+		explicit PatriciaTree(TDataSource& dataSource)
+				: m_dataSource(dataSource)
+				, m_shouldHashInParallel(false)
 		{}
 
 	public:
 		/// Gets the root hash that uniquely identifies this tree.
 		Hash256 root() const {
+			if (m_shouldHashInParallel) {
+				m_shouldHashInParallel = false;
+				if (m_rootNode.isBranch())
+					return m_rootNode.asBranchNode().parallelHash();
+			}
+
 			return m_rootNode.hash();
 		}
 
@@ -151,6 +167,168 @@ namespace catapult { namespace tree {
 
 		// endregion
 
+		// region update
+
+	public:
+		/// Applies all \a changes to the tree.
+		/// \note When a key is changed multiple times, only its last change is applied.
+		/// \note All changed nodes are rebuilt once and are only hashed when the root hash is requested or the tree is saved.
+		void update(const Changes& changes) {
+			// 1. encode all changes and order them by path (stable sort so that the last change of each path can be found)
+			std::vector<EncodedChange> encodedChanges;
+			encodedChanges.reserve(changes.size());
+			for (const auto& change : changes) {
+				auto keyPath = TreeNodePath(TEncoder::EncodeKey(change.first));
+				if (change.second)
+					encodedChanges.push_back({ { keyPath, TEncoder::EncodeValue(*change.second) }, true });
+				else
+					encodedChanges.push_back({ { keyPath, Hash256() }, false });
+			}
+
+			std::stable_sort(encodedChanges.begin(), encodedChanges.end(), [](const auto& lhs, const auto& rhs) {
+				return IsPathLess(lhs.Pair.Path, rhs.Pair.Path);
+			});
+
+			// 2. split the last change of each path into sets and unsets
+			std::vector<PathValuePair> setPairs;
+			std::vector<TreeNodePath> unsetPaths;
+			for (auto iter = encodedChanges.cbegin(); encodedChanges.cend() != iter; ++iter) {
+				auto nextIter = std::next(iter);
+				if (encodedChanges.cend() != nextIter && nextIter->Pair.Path == iter->Pair.Path)
+					continue;
+
+				if (iter->IsSet)
+					setPairs.push_back(iter->Pair);
+				else
+					unsetPaths.push_back(iter->Pair.Path);
+			}
+
+			// 3. apply all sets in a single pass over the tree and then apply unsets, which can collapse branches, individually
+			if (!setPairs.empty())
+				m_rootNode = setAll(m_rootNode, std::move(setPairs));
+
+			for (const auto& unsetPath : unsetPaths) {
+				auto canMerge = true;
+				unset(m_rootNode, unsetPath, m_rootNode, canMerge);
+			}
+
+			if (changes.size() >= Min_Parallel_Hash_Changes)
+				m_shouldHashInParallel = true;
+		}
+
+	private:
+		struct PathValuePair {
+			TreeNodePath Path;
+			Hash256 Value;
+		};
+
+		struct EncodedChange {
+			PathValuePair Pair;
+			bool IsSet;
+		};
+
+		using PathValuePairs = std::vector<PathValuePair>;
+
+	private:
+		static bool IsPathLess(const TreeNodePath& lhs, const TreeNodePath& rhs) {
+			auto differenceIndex = FindFirstDifferenceIndex(lhs, rhs);
+			if (differenceIndex == lhs.size() || differenceIndex == rhs.size())
+				return lhs.size() < rhs.size();
+
+			return lhs.nibbleAt(differenceIndex) < rhs.nibbleAt(differenceIndex);
+		}
+
+		template<typename TAction>
+		static void ForEachLinkGroup(const PathValuePairs& pairs, size_t nibbleIndex, TAction action) {
+			// pairs are sorted and share all nibbles before nibbleIndex, so all pairs with the same link index are adjacent
+			auto iter = pairs.cbegin();
+			while (pairs.cend() != iter) {
+				auto linkIndex = iter->Path.nibbleAt(nibbleIndex);
+
+				PathValuePairs groupPairs;
+				for (; pairs.cend() != iter && linkIndex == iter->Path.nibbleAt(nibbleIndex); ++iter)
+					groupPairs.push_back({ iter->Path.subpath(nibbleIndex + 1), iter->Value });
+
+				action(linkIndex, std::move(groupPairs));
+			}
+		}
+
+		// pairs must be sorted by path and unique
+		TreeNode setAll(const TreeNode& node, PathValuePairs&& pairs) {
+			if (1 == pairs.size())
+				return set(node, { pairs[0].Path, pairs[0].Value });
+
+			if (node.empty())
+				return createSubtree(std::move(pairs));
+
+			if (node.isLeaf()) {
+				// the leaf needs to be merged into the new subtree unless its value is being changed
+				const auto& leafNode = node.asLeafNode();
+				auto iter = std::lower_bound(pairs.begin(), pairs.end(), leafNode.path(), [](const auto& pair, const auto& path) {
+					return IsPathLess(pair.Path, path);
+				});
+
+				if (pairs.end() == iter || iter->Path != leafNode.path())
+					pairs.insert(iter, { leafNode.path(), leafNode.value() });
+
+				return createSubtree(std::move(pairs));
+			}
+
+			// the current node is a branch node that needs updating
+			auto branchNode = BranchTreeNode(node.asBranchNode());
+			const auto& branchPath = node.path();
+			auto differenceIndex = branchPath.size();
+			for (const auto& pair : pairs)
+				differenceIndex = std::min(differenceIndex, FindFirstDifferenceIndex(branchPath, pair.Path));
+
+			// if the path of the existing branch node is completely shared with all new pairs, update its links
+			if (differenceIndex == branchPath.size()) {
+				ForEachLinkGroup(pairs, differenceIndex, [this, &branchNode](auto linkIndex, auto&& groupPairs) {
+					auto pLinkedNode = this->getLinkedNode(branchNode, linkIndex);
+					auto updatedLinkedNode = pLinkedNode
+							? this->setAll(*pLinkedNode, std::move(groupPairs))
+							: this->createSubtree(std::move(groupPairs));
+					this->setLink(branchNode, updatedLinkedNode, linkIndex);
+				});
+
+				return TreeNode(branchNode);
+			}
+
+			// otherwise, split the branch at the shared path and connect the (truncated) original branch to the new branch
+			auto newBranchNode = BranchTreeNode(branchPath.subpath(0, differenceIndex));
+			auto branchLinkIndex = branchPath.nibbleAt(differenceIndex);
+			branchNode.setPath(branchPath.subpath(differenceIndex + 1));
+			setLink(newBranchNode, branchNode, branchLinkIndex);
+
+			ForEachLinkGroup(pairs, differenceIndex, [this, &newBranchNode, &branchNode, branchLinkIndex](
+					auto linkIndex,
+					auto&& groupPairs) {
+				auto updatedLinkedNode = branchLinkIndex == linkIndex
+						? this->setAll(TreeNode(branchNode), std::move(groupPairs))
+						: this->createSubtree(std::move(groupPairs));
+				this->setLink(newBranchNode, updatedLinkedNode, linkIndex);
+			});
+
+			return TreeNode(newBranchNode);
+		}
+
+		// pairs must be sorted by path, unique and not empty
+		TreeNode createSubtree(PathValuePairs&& pairs) {
+			if (1 == pairs.size())
+				return TreeNode(LeafTreeNode(pairs[0].Path, pairs[0].Value));
+
+			// sorted paths of the same length share the prefix shared by the first and last paths
+			auto sharedPathSize = FindFirstDifferenceIndex(pairs.front().Path, pairs.back().Path);
+			auto branchNode = BranchTreeNode(pairs.front().Path.subpath(0, sharedPathSize));
+			ForEachLinkGroup(pairs, sharedPathSize, [this, &branchNode](auto linkIndex, auto&& groupPairs) {
+				this->setLink(branchNode, this->createSubtree(std::move(groupPairs)), linkIndex);
+			});
+
+			return TreeNode(branchNode);
+		}
+
+		// endregion
+
 		// region unset
 
 	public:
@@ -284,8 +462,12 @@ namespace catapult { namespace tree {
 	public:
 		/// Saves all tree nodes to the underlying data source.
 		void saveAll() {
-			if (!m_rootNode.empty())
-				saveAll(m_rootNode);
+			if (m_rootNode.empty())
+				return;
+
+			// calculate all pending hashes (potentially in parallel) before saving
+			root();
+			saveAll(m_rootNode);
 		}
 
 	private:
@@ -321,10 +503,10 @@ namespace catapult { namespace tree {
 	private:
 		// region links
 
-		std::unique_ptr<const TreeNode> getLinkedNode(const BranchTreeNode& branchNode, size_t index) const {
-			// copy from memory, if available; otherwise, copy from data source
+		std::shared_ptr<const TreeNode> getLinkedNode(const BranchTreeNode& branchNode, size_t index) const {
+			// copy from memory, if available; otherwise, share from data source
 			auto pLinkedNode = branchNode.linkedNode(index);
-			return pLinkedNode ? std::move(pLinkedNode) : m_dataSource.get(branchNode.link(index));
+			return pLinkedNode ? std::shared_ptr<const TreeNode>(std::move(pLinkedNode)) : m_dataSource.get(branchNode.link(index));
 		}
 
 		void setLink(BranchTreeNode& branchNode, const TreeNode& node, size_t index) {
@@ -341,6 +523,7 @@ namespace catapult { namespace tree {
 	private:
 		TDataSource& m_dataSource;
 		TreeNode m_rootNode;
+		mutable bool m_shouldHashInParallel;
 	};
 }}
 
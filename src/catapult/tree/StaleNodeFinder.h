@@ -0,0 +1,109 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TreeNode.h"
+#include "catapult/utils/ArraySet.h"
+#include "catapult/functions.h"
+#include <vector>
+
+namespace catapult { namespace tree {
+
+	namespace detail {
+		template<typename TNodePointer, typename TAction>
+		void ForEachLink(const TNodePointer& pNode, TAction action) {
+			if (!pNode->isBranch())
+				return;
+
+			const auto& branchNode = pNode->asBranchNode();
+			for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
+				if (branchNode.hasLink(i))
+					action(branchNode.link(i));
+			}
+		}
+	}
+
+	/// Finds all nodes in \a dataSource that became unreachable when the root of a tree changed from \a oldRootHash
+	/// to \a newRootHash and passes them to \a sink. \a savedNodeHashes contains the hashes of all nodes saved by the change.
+	/// \note Saved nodes that are not reachable from \a newRootHash (e.g. nodes of intermediate checkpoints) are also stale.
+	/// \note Nodes are identified by hash, so a node shared by both trees is never stale.
+	template<typename TDataSource>
+	void FindStaleNodes(
+			const TDataSource& dataSource,
+			const Hash256& oldRootHash,
+			const Hash256& newRootHash,
+			const utils::HashSet& savedNodeHashes,
+			const consumer<const TreeNode&>& sink) {
+		// 1. find all nodes reachable from the new root; only saved nodes need to be visited because
+		//    all other reachable nodes are roots of subtrees that are shared with the old tree
+		utils::HashSet liveHashes;
+		std::vector<Hash256> pendingHashes;
+		if (Hash256() != newRootHash)
+			pendingHashes.push_back(newRootHash);
+
+		while (!pendingHashes.empty()) {
+			auto hash = pendingHashes.back();
+			pendingHashes.pop_back();
+			if (!liveHashes.insert(hash).second || savedNodeHashes.cend() == savedNodeHashes.find(hash))
+				continue;
+
+			detail::ForEachLink(dataSource.get(hash), [&pendingHashes](const auto& link) {
+				pendingHashes.push_back(link);
+			});
+		}
+
+		// 2. all saved nodes that are not reachable from the new root are stale
+		utils::HashSet staleHashes;
+		auto markStale = [&staleHashes, &sink](const auto& pNode) {
+			if (staleHashes.insert(pNode->hash()).second)
+				sink(*pNode);
+		};
+
+		for (const auto& hash : savedNodeHashes) {
+			if (liveHashes.cend() != liveHashes.find(hash))
+				continue;
+
+			auto pNode = dataSource.get(hash);
+			if (pNode)
+				markStale(pNode);
+		}
+
+		// 3. walk the old tree and stop at (the roots of) subtrees that are still reachable
+		utils::HashSet visitedHashes;
+		if (Hash256() != oldRootHash)
+			pendingHashes.push_back(oldRootHash);
+
+		while (!pendingHashes.empty()) {
+			auto hash = pendingHashes.back();
+			pendingHashes.pop_back();
+			if (liveHashes.cend() != liveHashes.find(hash) || !visitedHashes.insert(hash).second)
+				continue;
+
+			auto pNode = dataSource.get(hash);
+			if (!pNode)
+				continue;
+
+			markStale(pNode);
+			detail::ForEachLink(pNode, [&pendingHashes](const auto& link) {
+				pendingHashes.push_back(link);
+			});
+		}
+	}
+}}
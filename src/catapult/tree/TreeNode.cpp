@@ -22,6 +22,7 @@
 #include "catapult/crypto/Hashes.h"
 #include "catapult/utils/IntegerMath.h"
 #include "catapult/exceptions.h"
+#include <future>
 
 namespace catapult { namespace tree {
 
@@ -62,7 +63,7 @@ namespace catapult { namespace tree {
 	LeafTreeNode::LeafTreeNode(const TreeNodePath& path, const Hash256& value)
 			: m_path(path)
 			, m_value(value)
-			, m_hash(CalculateLeafTreeNodeHash(m_path, m_value))
+			, m_isDirty(true)
 	{}
 
 	const TreeNodePath& LeafTreeNode::path() const {
@@ -74,6 +75,11 @@ namespace catapult { namespace tree {
 	}
 
 	const Hash256& LeafTreeNode::hash() const {
+		if (m_isDirty) {
+			m_hash = CalculateLeafTreeNodeHash(m_path, m_value);
+			m_isDirty = false;
+		}
+
 		return m_hash;
 	}
 
@@ -127,6 +133,25 @@ namespace catapult { namespace tree {
 		return m_hash;
 	}
 
+	const Hash256& BranchTreeNode::parallelHash() const {
+		if (m_isDirty) {
+			std::vector<std::future<void>> futures;
+			for (const auto& pLinkedNode : m_linkedNodes) {
+				if (!pLinkedNode)
+					continue;
+
+				futures.push_back(std::async(std::launch::async, [pLinkedNode]() {
+					pLinkedNode->hash();
+				}));
+			}
+
+			for (auto& future : futures)
+				future.get();
+		}
+
+		return hash();
+	}
+
 	void BranchTreeNode::setPath(const TreeNodePath& path) {
 		m_path = path;
 		m_isDirty = true;
@@ -49,7 +49,8 @@ namespace catapult { namespace tree {
 	private:
 		TreeNodePath m_path;
 		Hash256 m_value;
-		Hash256 m_hash;
+		mutable Hash256 m_hash;
+		mutable bool m_isDirty;
 	};
 
 	// endregion
@@ -88,6 +89,10 @@ namespace catapult { namespace tree {
 		/// Gets the hash representation of this node.
 		const Hash256& hash() const;
 
+		/// Gets the hash representation of this node after calculating the hashes of all linked nodes in parallel.
+		/// \note Linked subtrees are independent, so each one is hashed on a separate thread.
+		const Hash256& parallelHash() const;
+
 	public:
 		/// Sets the branch node \a path.
 		void setPath(const TreeNodePath& path);
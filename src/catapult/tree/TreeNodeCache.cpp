@@ -0,0 +1,201 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TreeNodeCache.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/SpinLock.h"
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+
+namespace catapult { namespace tree {
+
+	class TreeNodeCache::Shard {
+	private:
+		using NodeList = std::list<NodePointer>;
+		using NodeMap = std::unordered_map<Hash256, NodePointer, utils::ArrayHasher<Hash256>>;
+
+	public:
+		explicit Shard(size_t maxSize)
+				: m_maxSize(maxSize)
+				, m_numHits(0)
+				, m_numMisses(0)
+		{}
+
+	public:
+		TreeNodeCacheStatistics statistics() const {
+			utils::SpinLockGuard guard(m_lock);
+			return { m_nodes.size() + m_pinnedNodes.size(), m_pinnedNodes.size(), m_numHits, m_numMisses };
+		}
+
+	public:
+		// note: find and add are const because they are called by (concurrent) readers; the lru state is guarded by m_lock
+		NodePointer find(const Hash256& hash) const {
+			utils::SpinLockGuard guard(m_lock);
+			auto pinnedIter = m_pinnedNodes.find(hash);
+			if (m_pinnedNodes.cend() != pinnedIter) {
+				++m_numHits;
+				return pinnedIter->second;
+			}
+
+			auto iter = m_hashToNodeIter.find(hash);
+			if (m_hashToNodeIter.cend() == iter) {
+				++m_numMisses;
+				return nullptr;
+			}
+
+			++m_numHits;
+			m_nodes.splice(m_nodes.begin(), m_nodes, iter->second);
+			return *iter->second;
+		}
+
+		NodePointer add(const Hash256& hash, const NodePointer& pNode) const {
+			utils::SpinLockGuard guard(m_lock);
+			return addUnlocked(hash, pNode);
+		}
+
+		void pin(const std::vector<NodePointer>& nodes) {
+			utils::SpinLockGuard guard(m_lock);
+			NodeMap pinnedNodes;
+			for (const auto& pNode : nodes) {
+				const auto& hash = pNode->hash();
+				auto iter = m_hashToNodeIter.find(hash);
+				if (m_hashToNodeIter.cend() != iter)
+					remove(iter->second);
+
+				pinnedNodes.emplace(hash, pNode);
+			}
+
+			// demote nodes that are no longer pinned so that they are not reloaded immediately
+			auto previousPinnedNodes = std::move(m_pinnedNodes);
+			m_pinnedNodes = std::move(pinnedNodes);
+			for (const auto& pair : previousPinnedNodes)
+				addUnlocked(pair.first, pair.second);
+		}
+
+		void clear() {
+			utils::SpinLockGuard guard(m_lock);
+			m_nodes.clear();
+			m_hashToNodeIter.clear();
+			m_pinnedNodes.clear();
+		}
+
+	private:
+		NodePointer addUnlocked(const Hash256& hash, const NodePointer& pNode) const {
+			auto pinnedIter = m_pinnedNodes.find(hash);
+			if (m_pinnedNodes.cend() != pinnedIter)
+				return pinnedIter->second;
+
+			auto iter = m_hashToNodeIter.find(hash);
+			if (m_hashToNodeIter.cend() != iter) {
+				// another reader loaded the same node concurrently, so keep the cached node
+				m_nodes.splice(m_nodes.begin(), m_nodes, iter->second);
+				return *iter->second;
+			}
+
+			if (0 == m_maxSize)
+				return pNode;
+
+			m_nodes.push_front(pNode);
+			m_hashToNodeIter.emplace(hash, m_nodes.begin());
+
+			while (m_nodes.size() > m_maxSize)
+				remove(std::prev(m_nodes.end()));
+
+			return pNode;
+		}
+
+		void remove(NodeList::iterator iter) const {
+			m_hashToNodeIter.erase((*iter)->hash());
+			m_nodes.erase(iter);
+		}
+
+	private:
+		size_t m_maxSize;
+
+		// most recently used nodes are at the front
+		mutable NodeList m_nodes;
+		mutable std::unordered_map<Hash256, NodeList::iterator, utils::ArrayHasher<Hash256>> m_hashToNodeIter;
+		NodeMap m_pinnedNodes;
+		mutable uint64_t m_numHits;
+		mutable uint64_t m_numMisses;
+		mutable utils::SpinLock m_lock;
+	};
+
+	TreeNodeCache::TreeNodeCache(const TreeNodeCacheOptions& options) : m_options(options) {
+		m_options.NumShards = std::max<size_t>(1, m_options.NumShards);
+
+		auto maxShardSize = (m_options.MaxSize + m_options.NumShards - 1) / m_options.NumShards;
+		for (auto i = 0u; i < m_options.NumShards; ++i)
+			m_shards.push_back(std::make_unique<Shard>(maxShardSize));
+	}
+
+	TreeNodeCache::~TreeNodeCache() = default;
+
+	const TreeNodeCacheOptions& TreeNodeCache::options() const {
+		return m_options;
+	}
+
+	TreeNodeCacheStatistics TreeNodeCache::statistics() const {
+		TreeNodeCacheStatistics statistics{ 0, 0, 0, 0 };
+		for (const auto& pShard : m_shards) {
+			auto shardStatistics = pShard->statistics();
+			statistics.NumCachedNodes += shardStatistics.NumCachedNodes;
+			statistics.NumPinnedNodes += shardStatistics.NumPinnedNodes;
+			statistics.NumHits += shardStatistics.NumHits;
+			statistics.NumMisses += shardStatistics.NumMisses;
+		}
+
+		return statistics;
+	}
+
+	TreeNodeCache::NodePointer TreeNodeCache::find(const Hash256& hash) const {
+		return shard(hash).find(hash);
+	}
+
+	TreeNodeCache::NodePointer TreeNodeCache::add(const NodePointer& pNode) const {
+		// calculate the (cached) hash before the node is shared with other threads
+		const auto& hash = pNode->hash();
+		return shard(hash).add(hash, pNode);
+	}
+
+	void TreeNodeCache::pin(const std::vector<NodePointer>& nodes) {
+		std::vector<std::vector<NodePointer>> shardNodes(m_shards.size());
+		for (const auto& pNode : nodes)
+			shardNodes[shardIndex(pNode->hash())].push_back(pNode);
+
+		for (auto i = 0u; i < m_shards.size(); ++i)
+			m_shards[i]->pin(shardNodes[i]);
+	}
+
+	void TreeNodeCache::clear() {
+		for (const auto& pShard : m_shards)
+			pShard->clear();
+	}
+
+	size_t TreeNodeCache::shardIndex(const Hash256& hash) const {
+		// use the last hash byte because the leading bytes are used for bucketing by ArrayHasher
+		return hash[Hash256_Size - 1] % m_shards.size();
+	}
+
+	TreeNodeCache::Shard& TreeNodeCache::shard(const Hash256& hash) const {
+		return *m_shards[shardIndex(hash)];
+	}
+}}
@@ -0,0 +1,104 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "TreeNode.h"
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace tree {
+
+	/// Tree node cache options.
+	struct TreeNodeCacheOptions {
+		/// Maximum number of (unpinned) nodes retained by the cache.
+		size_t MaxSize = 0;
+
+		/// Number of top tree levels that should be pinned.
+		size_t NumPinnedLevels = 0;
+
+		/// Number of independently locked shards.
+		size_t NumShards = 16;
+
+		/// Returns \c true if these options enable a cache.
+		bool isEnabled() const {
+			return 0 != MaxSize || 0 != NumPinnedLevels;
+		}
+	};
+
+	/// Tree node cache statistics.
+	struct TreeNodeCacheStatistics {
+		/// Number of cached nodes, including pinned nodes.
+		size_t NumCachedNodes;
+
+		/// Number of pinned nodes.
+		size_t NumPinnedNodes;
+
+		/// Number of lookups served by the cache.
+		uint64_t NumHits;
+
+		/// Number of lookups not served by the cache.
+		uint64_t NumMisses;
+	};
+
+	/// A bounded, sharded cache of immutable tree nodes keyed by node hash.
+	/// \note Unpinned nodes are evicted in least recently used order; pinned nodes are only released by a subsequent pin.
+	class TreeNodeCache {
+	public:
+		using NodePointer = std::shared_ptr<const TreeNode>;
+
+	public:
+		/// Creates a cache with \a options.
+		explicit TreeNodeCache(const TreeNodeCacheOptions& options);
+
+		/// Destroys the cache.
+		~TreeNodeCache();
+
+	public:
+		/// Gets the options used to create the cache.
+		const TreeNodeCacheOptions& options() const;
+
+		/// Gets the cache statistics.
+		TreeNodeCacheStatistics statistics() const;
+
+	public:
+		/// Finds the node with \a hash or returns \c nullptr if it is not cached.
+		NodePointer find(const Hash256& hash) const;
+
+		/// Adds \a pNode to the cache and returns the cached node with the same hash.
+		/// \note Node hash is calculated before the node is shared, so it is safe to access from multiple threads.
+		NodePointer add(const NodePointer& pNode) const;
+
+		/// Replaces all pinned nodes with \a nodes.
+		/// \note Previously pinned nodes that are not repinned are demoted to least recently used nodes.
+		void pin(const std::vector<NodePointer>& nodes);
+
+		/// Removes all nodes from the cache.
+		void clear();
+
+	private:
+		class Shard;
+		size_t shardIndex(const Hash256& hash) const;
+		Shard& shard(const Hash256& hash) const;
+
+	private:
+		TreeNodeCacheOptions m_options;
+		std::vector<std::unique_ptr<Shard>> m_shards;
+	};
+}}
@@ -0,0 +1,169 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ShortHashSketch.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr size_t Min_Cell_Count = 60;
+		constexpr uint32_t Checksum_Seed = 0x9E3779B9;
+		constexpr uint32_t Hash_Function_Seeds[ShortHashSketch::Num_Hash_Functions] = { 0x85EBCA6B, 0xC2B2AE35, 0x27D4EB2F };
+
+		uint32_t Mix(uint32_t value) {
+			// murmur3 finalizer
+			value ^= value >> 16;
+			value *= 0x85EBCA6B;
+			value ^= value >> 13;
+			value *= 0xC2B2AE35;
+			value ^= value >> 16;
+			return value;
+		}
+
+		uint32_t CalculateChecksum(const ShortHash& shortHash) {
+			return Mix(shortHash.unwrap() ^ Checksum_Seed);
+		}
+
+		size_t RoundUpCellCount(size_t numCells) {
+			constexpr auto Num_Hash_Functions = ShortHashSketch::Num_Hash_Functions;
+			auto numCellsPerHashFunction = std::max<size_t>(1, (numCells + Num_Hash_Functions - 1) / Num_Hash_Functions);
+			return numCellsPerHashFunction * Num_Hash_Functions;
+		}
+
+		template<typename TAction>
+		void ForEachCellIndex(const ShortHash& shortHash, size_t numCells, TAction action) {
+			// each hash function maps into its own partition so that every short hash is mapped to distinct cells
+			auto numCellsPerHashFunction = numCells / ShortHashSketch::Num_Hash_Functions;
+			for (auto i = 0u; i < ShortHashSketch::Num_Hash_Functions; ++i)
+				action(i * numCellsPerHashFunction + Mix(shortHash.unwrap() ^ Hash_Function_Seeds[i]) % numCellsPerHashFunction);
+		}
+
+		void Update(ShortHashSketchCell& cell, const ShortHash& shortHash, uint32_t checksum, int32_t countDelta) {
+			cell.Count += countDelta;
+			cell.KeySum = ShortHash(cell.KeySum.unwrap() ^ shortHash.unwrap());
+			cell.ChecksumSum ^= checksum;
+		}
+
+		void Update(std::vector<ShortHashSketchCell>& cells, const ShortHash& shortHash, int32_t countDelta) {
+			auto checksum = CalculateChecksum(shortHash);
+			ForEachCellIndex(shortHash, cells.size(), [&cells, &shortHash, checksum, countDelta](auto index) {
+				Update(cells[index], shortHash, checksum, countDelta);
+			});
+		}
+
+		bool IsPure(const ShortHashSketchCell& cell) {
+			return (1 == cell.Count || -1 == cell.Count) && CalculateChecksum(cell.KeySum) == cell.ChecksumSum;
+		}
+
+		bool IsEmpty(const ShortHashSketchCell& cell) {
+			return 0 == cell.Count && ShortHash() == cell.KeySum && 0 == cell.ChecksumSum;
+		}
+	}
+
+	ShortHashSketch::ShortHashSketch(size_t numCells) : m_cells(RoundUpCellCount(numCells), ShortHashSketchCell())
+	{}
+
+	ShortHashSketch::ShortHashSketch(std::vector<ShortHashSketchCell>&& cells) : m_cells(std::move(cells)) {
+		if (!IsValidCellCount(m_cells.size()))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("sketch cell count must be a nonzero multiple of hash functions", m_cells.size());
+	}
+
+	size_t ShortHashSketch::CalculateCellCount(size_t maxDifference) {
+		// peeling succeeds with high probability when there are at least ~1.23 cells per short hash,
+		// but small sketches need proportionally more headroom
+		return RoundUpCellCount(maxDifference + maxDifference / 2 + Min_Cell_Count);
+	}
+
+	bool ShortHashSketch::IsValidCellCount(size_t numCells) {
+		return 0 != numCells && 0 == numCells % Num_Hash_Functions;
+	}
+
+	size_t ShortHashSketch::size() const {
+		return m_cells.size();
+	}
+
+	const std::vector<ShortHashSketchCell>& ShortHashSketch::cells() const {
+		return m_cells;
+	}
+
+	void ShortHashSketch::insert(const ShortHash& shortHash) {
+		Update(m_cells, shortHash, 1);
+	}
+
+	void ShortHashSketch::remove(const ShortHash& shortHash) {
+		Update(m_cells, shortHash, -1);
+	}
+
+	void ShortHashSketch::insertDistinct(std::vector<ShortHash>&& shortHashes) {
+		std::sort(shortHashes.begin(), shortHashes.end());
+		auto endIter = std::unique(shortHashes.begin(), shortHashes.end());
+		for (auto iter = shortHashes.cbegin(); endIter != iter; ++iter)
+			insert(*iter);
+	}
+
+	void ShortHashSketch::subtract(const ShortHashSketch& sketch) {
+		if (m_cells.size() != sketch.m_cells.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_2("cannot subtract sketches of different sizes", m_cells.size(), sketch.m_cells.size());
+
+		for (auto i = 0u; i < m_cells.size(); ++i) {
+			auto& cell = m_cells[i];
+			const auto& otherCell = sketch.m_cells[i];
+			cell.Count -= otherCell.Count;
+			cell.KeySum = ShortHash(cell.KeySum.unwrap() ^ otherCell.KeySum.unwrap());
+			cell.ChecksumSum ^= otherCell.ChecksumSum;
+		}
+	}
+
+	bool ShortHashSketch::tryDecode(ShortHashesSet& insertedShortHashes, ShortHashesSet& removedShortHashes) const {
+		auto cells = m_cells;
+		std::vector<size_t> candidateIndexes(cells.size());
+		for (auto i = 0u; i < cells.size(); ++i)
+			candidateIndexes[i] = i;
+
+		// a decodable sketch cannot contain more short hashes than cells, which bounds the work for malicious sketches
+		size_t numDecodedShortHashes = 0;
+		while (!candidateIndexes.empty()) {
+			auto index = candidateIndexes.back();
+			candidateIndexes.pop_back();
+
+			const auto& cell = cells[index];
+			if (!IsPure(cell))
+				continue;
+
+			if (++numDecodedShortHashes > cells.size())
+				return false;
+
+			auto shortHash = cell.KeySum;
+			auto count = cell.Count;
+			auto& shortHashes = 1 == count ? insertedShortHashes : removedShortHashes;
+			shortHashes.insert(shortHash);
+
+			auto checksum = cell.ChecksumSum;
+			ForEachCellIndex(shortHash, cells.size(), [&cells, &candidateIndexes, &shortHash, checksum, count](auto cellIndex) {
+				Update(cells[cellIndex], shortHash, checksum, -count);
+				candidateIndexes.push_back(cellIndex);
+			});
+		}
+
+		return std::all_of(cells.cbegin(), cells.cend(), IsEmpty);
+	}
+}}
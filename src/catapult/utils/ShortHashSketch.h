@@ -0,0 +1,96 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "ShortHash.h"
+#include <vector>
+
+namespace catapult { namespace utils {
+
+#pragma pack(push, 1)
+
+	/// A short hash sketch cell.
+	struct ShortHashSketchCell {
+		/// Number of short hashes inserted into the cell less the number of short hashes removed from the cell.
+		int32_t Count;
+
+		/// Xor of all short hashes mapped to the cell.
+		ShortHash KeySum;
+
+		/// Xor of the checksums of all short hashes mapped to the cell.
+		uint32_t ChecksumSum;
+	};
+
+#pragma pack(pop)
+
+	/// An invertible bloom lookup table of short hashes.
+	/// \note Subtracting the sketch of one set from the sketch of another set allows the (small) difference between the two sets
+	///       to be recovered independently of the (large) size of the sets.
+	class ShortHashSketch {
+	public:
+		/// Number of cells each short hash is mapped to.
+		static constexpr size_t Num_Hash_Functions = 3;
+
+	public:
+		/// Creates an empty sketch with (at least) \a numCells cells.
+		/// \note \a numCells is rounded up to a nonzero multiple of Num_Hash_Functions.
+		explicit ShortHashSketch(size_t numCells);
+
+		/// Creates a sketch around \a cells.
+		explicit ShortHashSketch(std::vector<ShortHashSketchCell>&& cells);
+
+	public:
+		/// Calculates the number of cells required to decode (with high probability) up to \a maxDifference short hashes.
+		static size_t CalculateCellCount(size_t maxDifference);
+
+		/// Returns \c true if a sketch can be created around \a numCells cells.
+		static bool IsValidCellCount(size_t numCells);
+
+	public:
+		/// Gets the number of cells.
+		size_t size() const;
+
+		/// Gets the cells.
+		const std::vector<ShortHashSketchCell>& cells() const;
+
+	public:
+		/// Inserts \a shortHash into the sketch.
+		void insert(const ShortHash& shortHash);
+
+		/// Removes \a shortHash from the sketch.
+		void remove(const ShortHash& shortHash);
+
+		/// Inserts all distinct short hashes in \a shortHashes into the sketch.
+		/// \note A short hash inserted more than once cannot be decoded, so duplicates are skipped.
+		void insertDistinct(std::vector<ShortHash>&& shortHashes);
+
+		/// Subtracts \a sketch from this sketch.
+		/// \note Both sketches must have the same number of cells.
+		void subtract(const ShortHashSketch& sketch);
+
+		/// Tries to decode the sketch into short hashes that were inserted (\a insertedShortHashes)
+		/// and short hashes that were removed (\a removedShortHashes).
+		/// \note \c false is returned when the sketch contains too many short hashes to be fully decoded.
+		bool tryDecode(ShortHashesSet& insertedShortHashes, ShortHashesSet& removedShortHashes) const;
+
+	private:
+		std::vector<ShortHashSketchCell> m_cells;
+	};
+}}
@@ -146,9 +146,12 @@ namespace catapult { namespace validators {
 				: public ParallelValidationPolicy
 				, public std::enable_shared_from_this<DefaultParallelValidationPolicy> {
 		public:
-			explicit DefaultParallelValidationPolicy(const std::shared_ptr<thread::IoServiceThreadPool>& pPool)
+			DefaultParallelValidationPolicy(
+					const std::shared_ptr<thread::IoServiceThreadPool>& pPool,
+					thread::ParallelForStrategy strategy)
 					: m_pPool(pPool)
-					, m_service(pPool->service()) {
+					, m_service(pPool->service())
+					, m_strategy(strategy) {
 				CATAPULT_LOG(trace) << "DefaultParallelValidationPolicy created with " << pPool->numWorkerThreads() << " worker threads";
 			}
 
@@ -157,7 +160,7 @@ namespace catapult { namespace validators {
 			auto validateT(const model::WeakEntityInfos& entityInfos, const ValidationFunctions& validationFunctions) const {
 				auto pWork = std::make_shared<ValidationWork<TTraits>>(shared_from_this(), validationFunctions, entityInfos);
 				return thread::compose(
-						thread::ParallelFor(m_service, pWork->entityInfos(), m_pPool->numWorkerThreads(), [pWork](
+						thread::ParallelFor(m_service, pWork->entityInfos(), m_pPool->numWorkerThreads(), m_strategy, [pWork](
 								const auto& entityInfo,
 								auto index) {
 							return pWork->validateEntity(entityInfo, index);
@@ -184,11 +187,18 @@ namespace catapult { namespace validators {
 		private:
 			std::shared_ptr<const thread::IoServiceThreadPool> m_pPool;
 			boost::asio::io_service& m_service;
+			thread::ParallelForStrategy m_strategy;
 		};
 	}
 
 	std::shared_ptr<const ParallelValidationPolicy> CreateParallelValidationPolicy(
 			const std::shared_ptr<thread::IoServiceThreadPool>& pPool) {
-		return std::make_shared<const DefaultParallelValidationPolicy>(pPool);
+		return CreateParallelValidationPolicy(pPool, thread::ParallelForStrategy::Static_Partition);
+	}
+
+	std::shared_ptr<const ParallelValidationPolicy> CreateParallelValidationPolicy(
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool,
+			thread::ParallelForStrategy strategy) {
+		return std::make_shared<const DefaultParallelValidationPolicy>(pPool, strategy);
 	}
 }}
@@ -22,7 +22,12 @@
 #include "ValidatorTypes.h"
 #include "catapult/thread/Future.h"
 
-namespace catapult { namespace thread { class IoServiceThreadPool; } }
+namespace catapult {
+	namespace thread {
+		class IoServiceThreadPool;
+		enum class ParallelForStrategy;
+	}
+}
 
 namespace catapult { namespace validators {
 
@@ -46,4 +51,9 @@ namespace catapult { namespace validators {
 	/// Creates a parallel validation policy using \a pPool for parallelization.
 	std::shared_ptr<const ParallelValidationPolicy> CreateParallelValidationPolicy(
 			const std::shared_ptr<thread::IoServiceThreadPool>& pPool);
+
+	/// Creates a parallel validation policy using \a pPool for parallelization with entities distributed using \a strategy.
+	std::shared_ptr<const ParallelValidationPolicy> CreateParallelValidationPolicy(
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool,
+			thread::ParallelForStrategy strategy);
 }}
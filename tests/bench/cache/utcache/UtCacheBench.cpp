@@ -0,0 +1,133 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/MemoryUtCache.h"
+#include "catapult/cache/MemoryUtCacheUtils.h"
+#include "catapult/model/EntityInfo.h"
+#include "catapult/model/FeeUtils.h"
+#include "tests/test/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr uint32_t Num_Block_Transactions = 1000;
+
+		// region cache seeding
+
+		std::unique_ptr<MemoryUtCache> CreateSeededMemoryUtCache(size_t count) {
+			auto pUtCache = std::make_unique<MemoryUtCache>(MemoryCacheOptions(1024 * 1024, count));
+			auto modifier = pUtCache->modifier();
+			for (auto i = 0u; i < count; ++i) {
+				auto pTransaction = std::make_shared<model::Transaction>();
+				test::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), sizeof(model::Transaction) });
+				pTransaction->Size = sizeof(model::Transaction);
+				pTransaction->MaxFee = Amount(pTransaction->Size * static_cast<uint16_t>(test::Random()));
+
+				model::TransactionInfo transactionInfo(std::move(pTransaction));
+				test::FillWithRandomData(transactionInfo.EntityHash);
+				modifier.add(transactionInfo);
+			}
+
+			return pUtCache;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		bool IsMaxFeeMultiplierGreater(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) {
+			return model::CalculateTransactionMaxFeeMultiplier(*pLhs->pEntity) > model::CalculateTransactionMaxFeeMultiplier(*pRhs->pEntity);
+		}
+
+		void BenchmarkSelectCandidatesSorted(benchmark::State& state) {
+			// Arrange:
+			auto pUtCache = CreateSeededMemoryUtCache(static_cast<size_t>(state.range(0)));
+
+			// Act: sort the entire cache on every selection (original harvesting behavior)
+			for (auto _ : state) {
+				auto utCacheView = pUtCache->view();
+				auto candidates = GetFirstTransactionInfoPointers(utCacheView, Num_Block_Transactions, IsMaxFeeMultiplierGreater, [](
+						const auto&) {
+					return true;
+				});
+				benchmark::DoNotOptimize(candidates);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		void BenchmarkSelectCandidatesIndexed(benchmark::State& state) {
+			// Arrange:
+			auto pUtCache = CreateSeededMemoryUtCache(static_cast<size_t>(state.range(0)));
+
+			// Act: walk the max fee multiplier index
+			for (auto _ : state) {
+				auto utCacheView = pUtCache->view();
+				auto candidates = GetFirstTransactionInfoPointers(utCacheView, Num_Block_Transactions, MaxFeeMultiplierOrder::Descending, [](
+						const auto&) {
+					return true;
+				});
+				benchmark::DoNotOptimize(candidates);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		void BenchmarkAddRemove(benchmark::State& state) {
+			// Arrange:
+			auto pUtCache = CreateSeededMemoryUtCache(static_cast<size_t>(state.range(0)));
+			auto transactionInfos = pUtCache->modifier().removeAll();
+
+			// Act: measure the index maintenance cost
+			for (auto _ : state) {
+				auto modifier = pUtCache->modifier();
+				for (const auto& transactionInfo : transactionInfos)
+					modifier.add(transactionInfo);
+
+				for (const auto& transactionInfo : transactionInfos)
+					modifier.remove(transactionInfo.EntityHash);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(transactionInfos.size() * state.iterations()));
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 1'000, 10'000, 100'000, 500'000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) AddDefaultArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME))
+
+		void RegisterTests() {
+			REGISTER_BENCHMARK(BenchmarkSelectCandidatesSorted);
+			REGISTER_BENCHMARK(BenchmarkSelectCandidatesIndexed);
+			REGISTER_BENCHMARK(BenchmarkAddRemove);
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::cache::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
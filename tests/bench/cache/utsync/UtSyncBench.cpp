@@ -0,0 +1,147 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/MemoryUtCache.h"
+#include "catapult/model/EntityInfo.h"
+#include "catapult/utils/ShortHashSketch.h"
+#include "tests/test/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr uint32_t Num_Cache_Transactions = 100'000;
+
+		// region test context
+
+		class BenchContext {
+		public:
+			explicit BenchContext(size_t numDifferences) : m_utCache(MemoryCacheOptions(1024 * 1024, Num_Cache_Transactions)) {
+				{
+					auto modifier = m_utCache.modifier();
+					for (auto i = 0u; i < Num_Cache_Transactions; ++i) {
+						auto pTransaction = std::make_shared<model::Transaction>();
+						test::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), sizeof(model::Transaction) });
+						pTransaction->Size = sizeof(model::Transaction);
+
+						model::TransactionInfo transactionInfo(std::move(pTransaction));
+						test::FillWithRandomData(transactionInfo.EntityHash);
+						modifier.add(transactionInfo);
+					}
+				}
+
+				// the (local) client knows all but numDifferences of the (remote) server transactions
+				auto shortHashes = m_utCache.view().shortHashes();
+				m_clientShortHashes.assign(shortHashes.data() + numDifferences, shortHashes.data() + shortHashes.size());
+			}
+
+		public:
+			const MemoryUtCache& utCache() const {
+				return m_utCache;
+			}
+
+			const std::vector<utils::ShortHash>& clientShortHashes() const {
+				return m_clientShortHashes;
+			}
+
+		private:
+			MemoryUtCache m_utCache;
+			std::vector<utils::ShortHash> m_clientShortHashes;
+		};
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkPullShortHashes(benchmark::State& state) {
+			// Arrange:
+			BenchContext context(static_cast<size_t>(state.range(0)));
+			const auto& clientShortHashes = context.clientShortHashes();
+
+			// Act: send all client short hashes and scan all server transactions (original behavior)
+			size_t numTransactions = 0;
+			for (auto _ : state) {
+				utils::ShortHashesSet shortHashesSet(clientShortHashes.cbegin(), clientShortHashes.cend());
+				auto transactions = context.utCache().view().unknownTransactions(BlockFeeMultiplier(), shortHashesSet);
+				numTransactions = transactions.size();
+				benchmark::DoNotOptimize(transactions);
+			}
+
+			state.counters["RequestBytes"] = static_cast<double>(clientShortHashes.size() * sizeof(utils::ShortHash));
+			state.counters["Transactions"] = static_cast<double>(numTransactions);
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		void BenchmarkPullSketch(benchmark::State& state) {
+			// Arrange:
+			auto numDifferences = static_cast<size_t>(state.range(0));
+			BenchContext context(numDifferences);
+			const auto& clientShortHashes = context.clientShortHashes();
+
+			// Act: send a sketch sized for the difference, which is decoded by the server
+			size_t numCells = 0;
+			size_t numTransactions = 0;
+			for (auto _ : state) {
+				// - client
+				utils::ShortHashSketch clientSketch(utils::ShortHashSketch::CalculateCellCount(numDifferences));
+				clientSketch.insertDistinct(std::vector<utils::ShortHash>(clientShortHashes));
+
+				// - server
+				auto view = context.utCache().view();
+				auto sketch = view.shortHashSketch(clientSketch.size());
+				sketch.subtract(clientSketch);
+
+				utils::ShortHashesSet serverShortHashes;
+				utils::ShortHashesSet clientOnlyShortHashes;
+				if (!sketch.tryDecode(serverShortHashes, clientOnlyShortHashes))
+					state.SkipWithError("sketch could not be decoded");
+
+				auto transactions = view.transactionsWithShortHashes(BlockFeeMultiplier(), serverShortHashes);
+				numCells = clientSketch.size();
+				numTransactions = transactions.size();
+				benchmark::DoNotOptimize(transactions);
+			}
+
+			state.counters["RequestBytes"] = static_cast<double>(numCells * sizeof(utils::ShortHashSketchCell));
+			state.counters["Transactions"] = static_cast<double>(numTransactions);
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 10, 100, 1'000, 10'000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) AddDefaultArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME))
+
+		void RegisterTests() {
+			REGISTER_BENCHMARK(BenchmarkPullShortHashes);
+			REGISTER_BENCHMARK(BenchmarkPullSketch);
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::cache::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
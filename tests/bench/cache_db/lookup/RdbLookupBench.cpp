@@ -0,0 +1,235 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/cache_db/RocksInclude.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <map>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr size_t Value_Size = 128;
+
+		// region keys
+
+		uint64_t Mix(uint64_t value) {
+			// splitmix64 finalizer
+			value += 0x9E3779B97F4A7C15;
+			value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+			value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+			return value ^ (value >> 31);
+		}
+
+		// keys are derived from indexes so that they don't need to be stored; indexes >= num accounts produce missing keys
+		Address MakeKey(uint64_t index) {
+			Address key;
+			uint64_t seed = index;
+			for (auto i = 0u; i < key.size(); ++i) {
+				if (0 == i % sizeof(uint64_t))
+					seed = Mix(seed);
+
+				key[i] = static_cast<uint8_t>(seed >> (8 * (i % sizeof(uint64_t))));
+			}
+
+			return key;
+		}
+
+		rocksdb::Slice ToSlice(const Address& key) {
+			return rocksdb::Slice(reinterpret_cast<const char*>(key.data()), key.size());
+		}
+
+		// endregion
+
+		// region database setup
+
+		enum class ColumnSetup { Untuned, Tuned };
+
+		RocksDatabaseSettings CreateSettings(const std::string& directory, ColumnSetup setup) {
+			// untuned setup matches the original configuration (default column options and per database resources)
+			if (ColumnSetup::Untuned == setup)
+				return RocksDatabaseSettings(directory, { "default" }, utils::FileSize::FromMegabytes(5), FilterPruningMode::Disabled);
+
+			auto pResources = std::make_shared<RocksSharedResources>(utils::FileSize::FromMegabytes(256), utils::FileSize::FromMegabytes(128));
+			return RocksDatabaseSettings(
+					directory,
+					{ "default" },
+					{ RocksColumnProfile::Point_Lookup },
+					utils::FileSize::FromMegabytes(5),
+					FilterPruningMode::Disabled,
+					pResources);
+		}
+
+		void Seed(RocksDatabase& database, size_t numAccounts) {
+			std::string value(Value_Size, '\0');
+			for (auto i = 0u; i < numAccounts; ++i) {
+				test::FillWithRandomData({ reinterpret_cast<uint8_t*>(&value[0]), value.size() });
+				database.put(0, ToSlice(MakeKey(i)), value);
+			}
+
+			database.flush();
+		}
+
+		// bloom filters are only written when sst files are built, so each setup needs its own seeded database
+		std::string GetSeededDatabaseDirectory(size_t numAccounts, ColumnSetup setup) {
+			static std::map<std::pair<size_t, ColumnSetup>, std::unique_ptr<test::TempDirectoryGuard>> directoryGuards;
+
+			auto key = std::make_pair(numAccounts, setup);
+			auto iter = directoryGuards.find(key);
+			if (directoryGuards.cend() != iter)
+				return iter->second->name();
+
+			auto directoryName = "bench_rdb_lookup_" + std::to_string(numAccounts) + "_" + std::to_string(static_cast<int>(setup));
+			auto pGuard = std::make_unique<test::TempDirectoryGuard>(directoryName);
+			{
+				RocksDatabase database(CreateSettings(pGuard->name(), setup));
+				Seed(database, numAccounts);
+			}
+
+			auto name = pGuard->name();
+			directoryGuards.emplace(key, std::move(pGuard));
+			return name;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		enum class LookupMode { Existing, Missing };
+
+		void RunLookupBenchmark(benchmark::State& state, ColumnSetup setup, LookupMode mode) {
+			// Arrange:
+			auto numAccounts = static_cast<size_t>(state.range(0));
+			RocksDatabase database(CreateSettings(GetSeededDatabaseDirectory(numAccounts, setup), setup));
+			auto indexOffset = LookupMode::Existing == mode ? 0 : numAccounts;
+
+			// Act:
+			RdbDataIterator iter;
+			for (auto _ : state) {
+				auto key = MakeKey(indexOffset + test::Random() % numAccounts);
+				database.get(0, ToSlice(key), iter);
+				benchmark::DoNotOptimize(iter.buffer().pData);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		void BenchmarkExistingKeyLookups_Untuned(benchmark::State& state) {
+			RunLookupBenchmark(state, ColumnSetup::Untuned, LookupMode::Existing);
+		}
+
+		void BenchmarkExistingKeyLookups_Tuned(benchmark::State& state) {
+			RunLookupBenchmark(state, ColumnSetup::Tuned, LookupMode::Existing);
+		}
+
+		void BenchmarkMissingKeyLookups_Untuned(benchmark::State& state) {
+			RunLookupBenchmark(state, ColumnSetup::Untuned, LookupMode::Missing);
+		}
+
+		void BenchmarkMissingKeyLookups_Tuned(benchmark::State& state) {
+			RunLookupBenchmark(state, ColumnSetup::Tuned, LookupMode::Missing);
+		}
+
+		// endregion
+
+		// region block benchmarks
+
+		// seeded database is large enough (~1.3GB of values) that random lookups mostly miss the block cache,
+		// which approximates the state accesses of a block executed on a node with a cold cache
+		constexpr size_t Num_Block_Benchmark_Accounts = 10'000'000;
+
+		enum class BlockLookupMode { Sequential, Batched };
+
+		void RunBlockLookupBenchmark(benchmark::State& state, BlockLookupMode mode) {
+			// Arrange:
+			auto setup = ColumnSetup::Tuned;
+			RocksDatabase database(CreateSettings(GetSeededDatabaseDirectory(Num_Block_Benchmark_Accounts, setup), setup));
+			auto numKeysPerBlock = static_cast<size_t>(state.range(0));
+
+			std::vector<Address> keys(numKeysPerBlock);
+			std::vector<rocksdb::Slice> keySlices(numKeysPerBlock);
+			std::vector<RdbDataIterator> iters(numKeysPerBlock);
+
+			// Act:
+			for (auto _ : state) {
+				state.PauseTiming();
+				for (auto i = 0u; i < numKeysPerBlock; ++i) {
+					keys[i] = MakeKey(test::Random() % Num_Block_Benchmark_Accounts);
+					keySlices[i] = ToSlice(keys[i]);
+				}
+
+				state.ResumeTiming();
+
+				if (BlockLookupMode::Sequential == mode) {
+					for (auto i = 0u; i < numKeysPerBlock; ++i)
+						database.get(0, keySlices[i], iters[i]);
+				} else {
+					database.multiGet(0, keySlices, iters);
+				}
+
+				benchmark::DoNotOptimize(iters.back().buffer().pData);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numKeysPerBlock));
+		}
+
+		void BenchmarkBlockKeyLookups_Sequential(benchmark::State& state) {
+			RunBlockLookupBenchmark(state, BlockLookupMode::Sequential);
+		}
+
+		void BenchmarkBlockKeyLookups_Batched(benchmark::State& state) {
+			RunBlockLookupBenchmark(state, BlockLookupMode::Batched);
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 1'000'000, 10'000'000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+		void AddBlockArguments(benchmark::internal::Benchmark& benchmark) {
+			// number of distinct keys touched by a block
+			for (auto arg : { 100, 1'000, 10'000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) AddDefaultArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME))
+#define REGISTER_BLOCK_BENCHMARK(BENCH_NAME) AddBlockArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME))
+
+		void RegisterTests() {
+			REGISTER_BENCHMARK(BenchmarkExistingKeyLookups_Untuned);
+			REGISTER_BENCHMARK(BenchmarkExistingKeyLookups_Tuned);
+			REGISTER_BENCHMARK(BenchmarkMissingKeyLookups_Untuned);
+			REGISTER_BENCHMARK(BenchmarkMissingKeyLookups_Tuned);
+			REGISTER_BLOCK_BENCHMARK(BenchmarkBlockKeyLookups_Sequential);
+			REGISTER_BLOCK_BENCHMARK(BenchmarkBlockKeyLookups_Batched);
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::cache::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,205 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/PatriciaTreeRdbDataSource.h"
+#include "catapult/cache_db/RocksSharedResources.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "catapult/exceptions.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <map>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		// region BenchEncoder
+
+		class BenchEncoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = uint64_t;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static Hash256 EncodeValue(const ValueType& value) {
+				Hash256 valueHash;
+				crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&value), sizeof(ValueType) }, valueHash);
+				return valueHash;
+			}
+		};
+
+		using BenchTree = tree::PatriciaTree<BenchEncoder, PatriciaTreeRdbDataSource>;
+
+		// keys are derived from indexes so that they don't need to be stored
+		Hash256 MakeKey(uint64_t index) {
+			Hash256 key;
+			crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&index), sizeof(uint64_t) }, key);
+			return key;
+		}
+
+		// endregion
+
+		// region database setup
+
+		RocksDatabaseSettings CreateSettings(const std::string& directory) {
+			auto pResources = std::make_shared<RocksSharedResources>(utils::FileSize::FromMegabytes(256), utils::FileSize::FromMegabytes(128));
+			return RocksDatabaseSettings(
+					directory,
+					{ "default" },
+					{ RocksColumnProfile::Patricia_Tree },
+					utils::FileSize::FromMegabytes(5),
+					FilterPruningMode::Disabled,
+					pResources);
+		}
+
+		struct SeededTree {
+			std::unique_ptr<test::TempDirectoryGuard> pDirectoryGuard;
+			Hash256 RootHash;
+		};
+
+		Hash256 Seed(RocksDatabase& database, size_t numAccounts) {
+			PatriciaTreeContainer container(database, 0);
+			PatriciaTreeRdbDataSource dataSource(container);
+			BenchTree tree(dataSource);
+
+			// insert in batches and reload the saved root after each batch to bound the number of nodes kept in memory
+			constexpr size_t Batch_Size = 100'000;
+			std::vector<Hash256> keys(Batch_Size);
+			std::vector<uint64_t> values(Batch_Size);
+			for (auto i = 0u; i < numAccounts; i += Batch_Size) {
+				BenchTree::Changes changes;
+				for (auto j = 0u; j < Batch_Size && i + j < numAccounts; ++j) {
+					keys[j] = MakeKey(i + j);
+					values[j] = test::Random();
+					changes.emplace_back(keys[j], &values[j]);
+				}
+
+				tree.update(changes);
+				tree.saveAll();
+				database.flush();
+				tree.tryLoad(tree.root());
+			}
+
+			return tree.root();
+		}
+
+		const SeededTree& GetSeededTree(size_t numAccounts) {
+			static std::map<size_t, SeededTree> seededTrees;
+
+			auto iter = seededTrees.find(numAccounts);
+			if (seededTrees.cend() != iter)
+				return iter->second;
+
+			SeededTree seededTree;
+			seededTree.pDirectoryGuard = std::make_unique<test::TempDirectoryGuard>("bench_rdb_patricia_" + std::to_string(numAccounts));
+			{
+				RocksDatabase database(CreateSettings(seededTree.pDirectoryGuard->name()));
+				seededTree.RootHash = Seed(database, numAccounts);
+			}
+
+			return seededTrees.emplace(numAccounts, std::move(seededTree)).first->second;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		enum class NodeCacheMode { Disabled, Enabled, Pinned };
+
+		tree::TreeNodeCacheOptions CreateNodeCacheOptions(NodeCacheMode mode) {
+			tree::TreeNodeCacheOptions options;
+			if (NodeCacheMode::Disabled != mode)
+				options.MaxSize = 100'000;
+
+			if (NodeCacheMode::Pinned == mode)
+				options.NumPinnedLevels = 3;
+
+			return options;
+		}
+
+		void RunMerklePathBenchmark(benchmark::State& state, NodeCacheMode mode) {
+			// Arrange:
+			auto numAccounts = static_cast<size_t>(state.range(0));
+			const auto& seededTree = GetSeededTree(numAccounts);
+
+			RocksDatabase database(CreateSettings(seededTree.pDirectoryGuard->name()));
+			PatriciaTreeContainer container(database, 0);
+			PatriciaTreeRdbDataSource dataSource(container, CreateNodeCacheOptions(mode));
+			BenchTree tree(dataSource);
+			if (!tree.tryLoad(seededTree.RootHash))
+				CATAPULT_THROW_RUNTIME_ERROR("unable to load seeded tree");
+
+			dataSource.pin(seededTree.RootHash);
+
+			// Act: generate merkle proofs (node paths) for random existing keys, like the state path handler
+			std::vector<tree::TreeNode> nodePath;
+			for (auto _ : state) {
+				nodePath.clear();
+				auto result = tree.lookup(MakeKey(test::Random() % numAccounts), nodePath);
+				benchmark::DoNotOptimize(result);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+			if (dataSource.nodeCache()) {
+				auto statistics = dataSource.nodeCache()->statistics();
+				state.counters["hits"] = static_cast<double>(statistics.NumHits);
+				state.counters["misses"] = static_cast<double>(statistics.NumMisses);
+			}
+		}
+
+		void BenchmarkMerklePath_NoCache(benchmark::State& state) {
+			RunMerklePathBenchmark(state, NodeCacheMode::Disabled);
+		}
+
+		void BenchmarkMerklePath_NodeCache(benchmark::State& state) {
+			RunMerklePathBenchmark(state, NodeCacheMode::Enabled);
+		}
+
+		void BenchmarkMerklePath_NodeCacheWithPinnedLevels(benchmark::State& state) {
+			RunMerklePathBenchmark(state, NodeCacheMode::Pinned);
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 100'000, 1'000'000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) AddDefaultArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME))
+
+		void RegisterTests() {
+			REGISTER_BENCHMARK(BenchmarkMerklePath_NoCache);
+			REGISTER_BENCHMARK(BenchmarkMerklePath_NodeCache);
+			REGISTER_BENCHMARK(BenchmarkMerklePath_NodeCacheWithPinnedLevels);
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::cache::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
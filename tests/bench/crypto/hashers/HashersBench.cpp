@@ -79,6 +79,29 @@ namespace catapult { namespace crypto {
 			state.SetBytesProcessed(static_cast<int64_t>(data.size() * state.iterations()));
 		}
 
+		void BenchmarkSha3_256_Multi(benchmark::State& state) {
+			// hash many independent small messages, which is the typical multi-buffer use case
+			constexpr auto Num_Messages = 256u;
+			std::vector<std::vector<uint8_t>> messages(Num_Messages, std::vector<uint8_t>(static_cast<size_t>(state.range(0))));
+			std::vector<RawBuffer> buffers(messages.cbegin(), messages.cend());
+			std::vector<Hash256> hashes(Num_Messages);
+			auto maxLanes = static_cast<HashLanes>(state.range(1));
+			for (auto _ : state) {
+				state.PauseTiming();
+				for (auto& message : messages)
+					test::FillWithRandomData(message);
+
+				state.ResumeTiming();
+
+				Sha3_256_Multi(buffers.data(), 1, buffers.size(), hashes.data(), maxLanes);
+			}
+
+			state.SetLabel("max lanes " + std::to_string(state.range(1)) + " (supported "
+					+ std::to_string(static_cast<uint16_t>(GetMaxSupportedHashLanes())) + ")");
+			state.SetItemsProcessed(static_cast<int64_t>(Num_Messages * state.iterations()));
+			state.SetBytesProcessed(static_cast<int64_t>(Num_Messages * messages[0].size() * state.iterations()));
+		}
+
 		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
 			for (auto arg : { 256, 1024, 4096, 16384})
 				benchmark.UseRealTime()->Arg(arg);
@@ -96,6 +119,12 @@ namespace catapult { namespace crypto {
 			CATAPULT_REGISTER_HASHER_BENCHMARK(Sha3_512_Traits);
 			CATAPULT_REGISTER_HASHER_BENCHMARK(Keccak_256_Traits);
 			CATAPULT_REGISTER_HASHER_BENCHMARK(Keccak_512_Traits);
+
+			auto* pMultiBenchmark = REGISTER_BENCHMARK(BenchmarkSha3_256_Multi)->UseRealTime();
+			for (auto size : { 64, 128, 256 }) {
+				for (auto lanes : { HashLanes::One, HashLanes::Four, HashLanes::Eight })
+					pMultiBenchmark->Args({ size, static_cast<int>(lanes) });
+			}
 		}
 	}
 }}
@@ -42,6 +42,57 @@ namespace catapult { namespace crypto {
 			state.SetBytesProcessed(static_cast<int64_t>(data.size() * state.iterations()));
 		}
 
+		struct SignedData {
+			std::vector<Key> Keys;
+			std::vector<std::vector<uint8_t>> Data;
+			std::vector<Signature> Signatures;
+			std::vector<SignatureInput> SignatureInputs;
+		};
+
+		void PrepareSignedData(SignedData& signedData, size_t count) {
+			signedData = SignedData();
+			signedData.Keys.resize(count);
+			signedData.Data.resize(count);
+			signedData.Signatures.resize(count);
+			for (auto i = 0u; i < count; ++i) {
+				auto keyPair = KeyPair::FromPrivate(PrivateKey::Generate(test::RandomByte));
+				signedData.Keys[i] = keyPair.publicKey();
+				signedData.Data[i].resize(279);
+				test::FillWithRandomData(signedData.Data[i]);
+				crypto::Sign(keyPair, signedData.Data[i], signedData.Signatures[i]);
+				signedData.SignatureInputs.push_back({ signedData.Keys[i], signedData.Data[i], signedData.Signatures[i] });
+			}
+		}
+
+		void BenchmarkVerifyEach(benchmark::State& state) {
+			auto count = static_cast<size_t>(state.range(0));
+			SignedData signedData;
+			for (auto _ : state) {
+				state.PauseTiming();
+				PrepareSignedData(signedData, count);
+				state.ResumeTiming();
+
+				for (const auto& signatureInput : signedData.SignatureInputs)
+					crypto::Verify(signatureInput.Signer, signatureInput.Data, signatureInput.Signature);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(count * state.iterations()));
+		}
+
+		void BenchmarkVerifyMulti(benchmark::State& state) {
+			auto count = static_cast<size_t>(state.range(0));
+			SignedData signedData;
+			for (auto _ : state) {
+				state.PauseTiming();
+				PrepareSignedData(signedData, count);
+				state.ResumeTiming();
+
+				crypto::VerifyMulti(signedData.SignatureInputs.data(), signedData.SignatureInputs.size());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(count * state.iterations()));
+		}
+
 		void RegisterTests() {
 			benchmark::RegisterBenchmark("BenchmarkVerify", BenchmarkVerify)
 					->UseRealTime()
@@ -49,6 +100,17 @@ namespace catapult { namespace crypto {
 					->Threads(2)
 					->Threads(4)
 					->Threads(8);
+
+			for (auto benchmarkPair : {
+				std::make_pair("BenchmarkVerifyEach", BenchmarkVerifyEach),
+				std::make_pair("BenchmarkVerifyMulti", BenchmarkVerifyMulti)
+			}) {
+				benchmark::RegisterBenchmark(benchmarkPair.first, benchmarkPair.second)
+						->UseRealTime()
+						->Arg(8)
+						->Arg(64)
+						->Arg(256);
+			}
 		}
 	}
 }}
@@ -0,0 +1,195 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/deltaset/BaseSet.h"
+#include "catapult/deltaset/BaseSetDelta.h"
+#include "catapult/deltaset/PersistentHashMap.h"
+#include "catapult/utils/SpinReaderWriterLock.h"
+#include "tests/test/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <unordered_map>
+
+namespace catapult { namespace deltaset {
+
+	namespace {
+		constexpr uint32_t Num_Changes_Per_Commit = 1'000;
+
+		// region element + set types
+
+		struct BenchElement {
+			uint64_t Key;
+			uint64_t Value;
+		};
+
+		struct BenchElementToKeyConverter {
+			static uint64_t ToKey(const BenchElement& element) {
+				return element.Key;
+			}
+		};
+
+		template<typename TMap>
+		using BenchBaseSet = BaseSet<MutableTypeTraits<BenchElement>, MapStorageTraits<TMap, BenchElementToKeyConverter>>;
+
+		using UnorderedMapBaseSet = BenchBaseSet<std::unordered_map<uint64_t, BenchElement>>;
+		using PersistentBaseSet = BenchBaseSet<PersistentHashMap<uint64_t, BenchElement>>;
+
+		// endregion
+
+		// region bench context
+
+		// when RequiresLock is set, locking emulates SynchronizedCache, which applies commits to the shared set under a writer lock
+		template<typename TBaseSet, bool RequiresLock>
+		class BenchContext {
+		public:
+			explicit BenchContext(uint64_t numElements)
+					: m_numElements(numElements)
+					, m_numCommits(0)
+					, m_isStopped(false) {
+				{
+					auto pDelta = m_set.rebase();
+					for (auto i = 0u; i < numElements; ++i)
+						pDelta->insert(BenchElement{ i, 0 });
+
+					m_set.commit();
+				}
+
+				m_writer = std::thread([this]() { commitAll(); });
+			}
+
+			~BenchContext() {
+				m_isStopped = true;
+				m_writer.join();
+			}
+
+		public:
+			uint64_t numElements() const {
+				return m_numElements;
+			}
+
+			size_t numCommits() const {
+				return m_numCommits;
+			}
+
+			bool contains(uint64_t key) {
+				if (!RequiresLock)
+					return m_set.contains(key);
+
+				auto readLock = m_lock.acquireReader();
+				return m_set.contains(key);
+			}
+
+		private:
+			void commitAll() {
+				auto pDelta = m_set.rebase();
+				uint64_t value = 0;
+				while (!m_isStopped) {
+					++value;
+					if (RequiresLock) {
+						auto readLock = m_lock.acquireReader();
+						updateElements(*pDelta, value);
+
+						auto writeLock = readLock.promoteToWriter();
+						m_set.commit();
+					} else {
+						updateElements(*pDelta, value);
+						m_set.commit();
+					}
+
+					++m_numCommits;
+				}
+			}
+
+			void updateElements(typename TBaseSet::DeltaType& delta, uint64_t value) {
+				for (auto i = 0u; i < Num_Changes_Per_Commit; ++i)
+					delta.insert(BenchElement{ test::Random() % m_numElements, value });
+			}
+
+		private:
+			uint64_t m_numElements;
+			TBaseSet m_set;
+			utils::SpinReaderWriterLock m_lock;
+			std::atomic<size_t> m_numCommits;
+			std::atomic<bool> m_isStopped;
+			std::thread m_writer;
+		};
+
+		// endregion
+
+		// region benchmarks
+
+		template<typename TBaseSet, bool RequiresLock>
+		void BenchmarkReadDuringCommits(benchmark::State& state) {
+			// Arrange: start committing changes in the background
+			BenchContext<TBaseSet, RequiresLock> context(static_cast<uint64_t>(state.range(0)));
+
+			// Act: look up elements and measure the latency of each individual lookup
+			uint64_t key = 0;
+			std::vector<int64_t> latencies;
+			for (auto _ : state) {
+				auto start = std::chrono::steady_clock::now();
+				auto contains = context.contains(key++ % context.numElements());
+				auto end = std::chrono::steady_clock::now();
+
+				benchmark::DoNotOptimize(contains);
+				latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+			}
+
+			std::sort(latencies.begin(), latencies.end());
+			state.counters["P50LatencyNs"] = static_cast<double>(latencies[latencies.size() / 2]);
+			state.counters["P99LatencyNs"] = static_cast<double>(latencies[latencies.size() * 99 / 100]);
+			state.counters["MaxLatencyNs"] = static_cast<double>(latencies.back());
+			state.counters["Commits"] = static_cast<double>(context.numCommits());
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		void BenchmarkUnorderedMapReadDuringCommits(benchmark::State& state) {
+			BenchmarkReadDuringCommits<UnorderedMapBaseSet, true>(state);
+		}
+
+		void BenchmarkPersistentReadDuringCommits(benchmark::State& state) {
+			BenchmarkReadDuringCommits<PersistentBaseSet, false>(state);
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 10'000, 100'000, 1'000'000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) AddDefaultArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME))
+
+		void RegisterTests() {
+			REGISTER_BENCHMARK(BenchmarkUnorderedMapReadDuringCommits);
+			REGISTER_BENCHMARK(BenchmarkPersistentReadDuringCommits);
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::deltaset::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,211 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/Hashes.h"
+#include "catapult/disruptor/ConsumerDispatcher.h"
+#include "catapult/utils/SpinLock.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		ConsumerWaitStrategy ToWaitStrategy(int64_t value) {
+			switch (value) {
+			case 0:
+				return ConsumerWaitStrategy::Busy_Spin;
+			case 1:
+				return ConsumerWaitStrategy::Spin_Then_Yield;
+			default:
+				return ConsumerWaitStrategy::Blocking;
+			}
+		}
+
+		ConsumerDispatcherOptions CreateOptions(size_t disruptorSize) {
+			// disable element tracing so that logging does not dominate measurements
+			auto options = ConsumerDispatcherOptions("bench dispatcher", disruptorSize);
+			options.ElementTraceInterval = std::numeric_limits<size_t>::max();
+			return options;
+		}
+
+		void BenchmarkElementLatency(benchmark::State& state) {
+			auto options = CreateOptions(1024);
+			options.WaitStrategy = ToWaitStrategy(state.range(0));
+
+			std::vector<DisruptorConsumer> consumers(static_cast<size_t>(state.range(1)), [](const auto&) {
+				return ConsumerResult::Continue();
+			});
+			ConsumerDispatcher dispatcher(options, consumers);
+
+			std::atomic_bool isComplete(false);
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto range = test::CreateBlockEntityRange(1);
+				isComplete = false;
+				state.ResumeTiming();
+
+				// measure time from push until the element has passed all consumers
+				dispatcher.processElement(ConsumerInput(std::move(range)), [&isComplete](auto, const auto&) {
+					isComplete = true;
+				});
+
+				while (!isComplete)
+					;
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		// region producer contention
+
+		class ProducerContext {
+		public:
+			ProducerContext()
+					: m_dispatcher(CreateProducerOptions(), { [](const auto&) { return ConsumerResult::Continue(); } })
+			{}
+
+		public:
+			void process(bool shouldSerializeProducers) {
+				auto range = test::CreateBlockEntityRange(1);
+				if (!shouldSerializeProducers) {
+					processRetryIfFull(std::move(range));
+					return;
+				}
+
+				// emulate a dispatcher that serializes all producers with a spin lock
+				utils::SpinLockGuard guard(m_spinLock);
+				processRetryIfFull(std::move(range));
+			}
+
+		private:
+			void processRetryIfFull(model::BlockRange&& range) {
+				while (0 == m_dispatcher.processElement(ConsumerInput(model::BlockRange::CopyRange(range))))
+					;
+			}
+
+		private:
+			static ConsumerDispatcherOptions CreateProducerOptions() {
+				auto options = CreateOptions(64 * 1024);
+				options.ShouldThrowIfFull = false;
+				return options;
+			}
+
+		private:
+			ConsumerDispatcher m_dispatcher;
+			utils::SpinLock m_spinLock;
+		};
+
+		void BenchmarkProducers(benchmark::State& state, ProducerContext& context, bool shouldSerializeProducers) {
+			for (auto _ : state)
+				context.process(shouldSerializeProducers);
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		// endregion
+
+		// region parallel stage
+
+		void BenchmarkParallelStageThroughput(benchmark::State& state) {
+			// Arrange: emulate an expensive first stage (e.g. hash calculation) followed by a cheap sequential stage
+			constexpr auto Num_Elements = 1000u;
+			constexpr auto Num_Hash_Rounds = 100u;
+			auto hashConsumer = [](const auto& input) {
+				Hash256 hash;
+				const auto& block = input.blocks()[0].Block;
+				crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&block), block.Size }, hash);
+				for (auto i = 1u; i < Num_Hash_Rounds; ++i)
+					crypto::Sha3_256(hash, hash);
+
+				benchmark::DoNotOptimize(hash);
+				return ConsumerResult::Continue();
+			};
+
+			std::vector<DisruptorConsumerStage> stages{
+				{ hashConsumer, static_cast<size_t>(state.range(0)) },
+				{ [](const auto&) { return ConsumerResult::Continue(); }, 1 }
+			};
+			ConsumerDispatcher dispatcher(CreateOptions(2 * Num_Elements), stages, [](const auto&, const auto&) {});
+
+			std::atomic<size_t> numCompletedElements(0);
+			for (auto _ : state) {
+				state.PauseTiming();
+				std::vector<model::BlockRange> ranges;
+				for (auto i = 0u; i < Num_Elements; ++i)
+					ranges.push_back(test::CreateBlockEntityRange(1));
+
+				numCompletedElements = 0;
+				state.ResumeTiming();
+
+				// Act: measure time until all elements have passed all stages
+				for (auto& range : ranges) {
+					dispatcher.processElement(ConsumerInput(std::move(range)), [&numCompletedElements](auto, const auto&) {
+						++numCompletedElements;
+					});
+				}
+
+				while (Num_Elements != numCompletedElements)
+					;
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * Num_Elements));
+		}
+
+		// endregion
+
+		void RegisterTests() {
+			auto* pBenchmark = benchmark::RegisterBenchmark("BenchmarkElementLatency", BenchmarkElementLatency)
+					->UseRealTime()
+					->ArgNames({ "strategy", "consumers" });
+
+			// strategy: 0 - busy spin, 1 - spin then yield, 2 - blocking
+			for (auto waitStrategy : { 0, 1, 2 }) {
+				for (auto numConsumers : { 1, 4, 8 })
+					pBenchmark->Args({ waitStrategy, numConsumers });
+			}
+
+			benchmark::RegisterBenchmark("BenchmarkParallelStageThroughput", BenchmarkParallelStageThroughput)
+					->UseRealTime()
+					->ArgNames({ "threads" })
+					->Arg(1)
+					->Arg(2)
+					->Arg(4)
+					->Arg(8);
+
+			// context is shared by all producer threads and outlives all benchmarks
+			static ProducerContext producerContext;
+			for (auto shouldSerializeProducers : { false, true }) {
+				auto name = shouldSerializeProducers ? "BenchmarkProducers_SpinLock" : "BenchmarkProducers_LockFree";
+				benchmark::RegisterBenchmark(name, BenchmarkProducers, std::ref(producerContext), shouldSerializeProducers)
+						->UseRealTime()
+						->Threads(1)
+						->Threads(2)
+						->Threads(4)
+						->Threads(8);
+			}
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::disruptor::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,170 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "filechain/src/MultiBlockLoader.h"
+#include "catapult/extensions/LocalNodeChainScore.h"
+#include "catapult/extensions/LocalNodeStateRef.h"
+#include "catapult/io/BlockStorageCache.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/plugins/PluginManager.h"
+#include "catapult/state/CatapultState.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/mocks/MockMemoryBlockStorage.h"
+#include "tests/test/local/LocalTestUtils.h"
+#include <benchmark/benchmark.h>
+#include <thread>
+
+namespace catapult { namespace filechain {
+
+	namespace {
+		constexpr auto Num_Blocks = 500u;
+		constexpr auto Load_Delay = std::chrono::microseconds(100);
+		constexpr auto Execute_Delay = std::chrono::microseconds(100);
+
+		// region DelayedBlockStorage
+
+		// simulates a block storage backed by a slow disk
+		class DelayedBlockStorage : public io::BlockStorage {
+		public:
+			explicit DelayedBlockStorage(std::unique_ptr<io::BlockStorage>&& pStorage) : m_pStorage(std::move(pStorage))
+			{}
+
+		public:
+			Height chainHeight() const override {
+				return m_pStorage->chainHeight();
+			}
+
+			model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override {
+				return m_pStorage->loadHashesFrom(height, maxHashes);
+			}
+
+			void saveBlock(const model::BlockElement& blockElement) override {
+				m_pStorage->saveBlock(blockElement);
+			}
+
+			void dropBlocksAfter(Height height) override {
+				m_pStorage->dropBlocksAfter(height);
+			}
+
+		public:
+			std::shared_ptr<const model::Block> loadBlock(Height height) const override {
+				std::this_thread::sleep_for(Load_Delay);
+				return m_pStorage->loadBlock(height);
+			}
+
+			std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override {
+				std::this_thread::sleep_for(Load_Delay);
+				return m_pStorage->loadBlockElement(height);
+			}
+
+			std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override {
+				return m_pStorage->loadBlockStatementData(height);
+			}
+
+		private:
+			std::unique_ptr<io::BlockStorage> m_pStorage;
+		};
+
+		// endregion
+
+		// region SpinningNotificationObserver
+
+		// simulates cpu bound block execution
+		class SpinningNotificationObserver : public observers::NotificationObserver {
+		public:
+			SpinningNotificationObserver() : m_name("SpinningNotificationObserver")
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			void notify(const model::Notification& notification, observers::ObserverContext&) const override {
+				if (model::Core_Block_Notification != notification.Type)
+					return;
+
+				auto endTime = std::chrono::steady_clock::now() + Execute_Delay;
+				while (std::chrono::steady_clock::now() < endTime)
+				{}
+			}
+
+		private:
+			std::string m_name;
+		};
+
+		// endregion
+
+		std::unique_ptr<io::BlockStorageCache> CreateStorage() {
+			auto pStorage = std::make_unique<io::BlockStorageCache>(
+					std::make_unique<DelayedBlockStorage>(std::make_unique<mocks::MockMemoryBlockStorage>()));
+			auto modifier = pStorage->modifier();
+			for (auto height = Height(2); height <= Height(Num_Blocks + 1); height = height + Height(1)) {
+				auto pBlock = test::GenerateBlockWithTransactions(0, height, Timestamp(height.unwrap() * 3000));
+				modifier.saveBlock(test::BlockToBlockElement(*pBlock));
+			}
+
+			return pStorage;
+		}
+
+		void BenchmarkLoadBlockChain(benchmark::State& state) {
+			auto pStorage = CreateStorage();
+			auto config = test::CreatePrototypicalLocalNodeConfiguration();
+			plugins::PluginManager pluginManager(model::BlockChainConfiguration::Uninitialized(), plugins::StorageConfiguration());
+			auto observerFactory = [](const auto&) { return std::make_unique<SpinningNotificationObserver>(); };
+
+			BlockChainLoadOptions options;
+			options.MaxPrefetchBlocks = static_cast<uint32_t>(state.range(0));
+			options.StateHashInterval = static_cast<uint32_t>(state.range(1));
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto cache = test::CreateEmptyCatapultCache();
+				state::CatapultState catapultState;
+				extensions::LocalNodeChainScore score;
+				extensions::LocalNodeStateRef stateRef(config, catapultState, cache, *pStorage, score);
+				state.ResumeTiming();
+
+				LoadBlockChain(observerFactory, pluginManager, stateRef, Height(2), options);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * Num_Blocks));
+		}
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			// { max prefetch blocks, state hash interval }
+			for (const auto& args : std::vector<std::vector<int64_t>>{ { 0, 1 }, { 4, 1 }, { 16, 1 }, { 16, 10 } })
+				benchmark.UseRealTime()->Args(args);
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME)
+
+		void RegisterTests() {
+			AddDefaultArguments(*REGISTER_BENCHMARK(BenchmarkLoadBlockChain));
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::filechain::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,137 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "filechain/src/LocalNodeStateStorage.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache/SupplementalData.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/BlockDifficultyCache.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/AccountStateTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace filechain {
+
+	namespace {
+		constexpr auto Num_Difficulty_Infos = 1'000'000u;
+		constexpr auto Num_Mosaics_Per_Account = 2u;
+
+		// region cache generation
+
+		cache::CatapultCache CreateCache() {
+			return test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+		}
+
+		cache::CatapultCache CreatePopulatedCache(size_t numAccounts) {
+			auto cache = CreateCache();
+			{
+				auto delta = cache.createDelta();
+				auto& accountStateCacheDelta = delta.sub<cache::AccountStateCache>();
+				for (auto i = 0u; i < numAccounts; ++i) {
+					auto publicKey = test::GenerateRandomData<Key_Size>();
+					accountStateCacheDelta.addAccount(publicKey, Height(1));
+					test::RandomFillAccountData(i, accountStateCacheDelta.find(publicKey).get(), Num_Mosaics_Per_Account);
+				}
+
+				auto& blockDifficultyCacheDelta = delta.sub<cache::BlockDifficultyCache>();
+				for (auto i = 0u; i < Num_Difficulty_Infos; ++i)
+					blockDifficultyCacheDelta.insert(Height(i + 1), Timestamp(2 * i + 1), Difficulty(3 * i + 1));
+
+				cache.commit(Height(1));
+			}
+
+			return cache;
+		}
+
+		StateStorageOptions CreateOptions(const benchmark::State& state) {
+			StateStorageOptions options;
+			options.NumThreads = static_cast<uint32_t>(state.range(1));
+			options.BufferSize = static_cast<size_t>(state.range(2)) * 1024;
+			return options;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkSaveState(benchmark::State& state) {
+			test::TempDirectoryGuard tempDir;
+			auto cache = CreatePopulatedCache(static_cast<size_t>(state.range(0)));
+			auto options = CreateOptions(state);
+
+			for (auto _ : state)
+				SaveState(tempDir.name(), cache, cache::SupplementalData(), options);
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+		}
+
+		void BenchmarkLoadState(benchmark::State& state) {
+			test::TempDirectoryGuard tempDir;
+			{
+				auto cache = CreatePopulatedCache(static_cast<size_t>(state.range(0)));
+				SaveState(tempDir.name(), cache, cache::SupplementalData());
+			}
+
+			auto options = CreateOptions(state);
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto pCache = std::make_unique<cache::CatapultCache>(CreateCache());
+				cache::SupplementalData supplementalData;
+				state.ResumeTiming();
+
+				if (!LoadState(tempDir.name(), *pCache, supplementalData, options))
+					state.SkipWithError("state could not be loaded");
+
+				// destroy the cache outside of the timed region
+				state.PauseTiming();
+				pCache.reset();
+				state.ResumeTiming();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			// { number of accounts, number of threads, buffer size (KB) }
+			for (auto numAccounts : { 1'000'000, 3'000'000 }) {
+				for (const auto& options : std::vector<std::pair<int64_t, int64_t>>{ { 1, 4 }, { 1, 1024 }, { 4, 1024 } })
+					benchmark.UseRealTime()->Unit(benchmark::kMillisecond)->Args({ numAccounts, options.first, options.second });
+			}
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME)
+
+		void RegisterTests() {
+			AddDefaultArguments(*REGISTER_BENCHMARK(BenchmarkSaveState));
+			AddDefaultArguments(*REGISTER_BENCHMARK(BenchmarkLoadState));
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::filechain::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
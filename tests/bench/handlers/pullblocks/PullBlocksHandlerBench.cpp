@@ -0,0 +1,202 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/api/ChainPackets.h"
+#include "catapult/handlers/ChainHandlers.h"
+#include "catapult/io/BlockStorageCache.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/PackedFileBlockStorage.h"
+#include "catapult/io/RawFile.h"
+#include "catapult/ionet/PacketPayloadFactory.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <boost/filesystem.hpp>
+#include <atomic>
+
+namespace catapult { namespace handlers {
+
+	namespace {
+		constexpr auto Num_Blocks = 500u;
+		constexpr auto Num_Transactions_Per_Block = 50u;
+		constexpr auto Transaction_Size = 200u;
+		constexpr auto Num_Request_Blocks = 100u;
+		constexpr auto Num_Response_Bytes = 10u * 1024 * 1024;
+
+		// region traits
+
+		struct FileTraits {
+			static std::unique_ptr<io::BlockStorage> CreateStorage(const std::string& directory) {
+				// file storage reports height one (nemesis) when no blocks have been saved
+				// and expects the first hashes file to contain (placeholder) hashes for heights zero and one
+				boost::filesystem::create_directories(boost::filesystem::path(directory) / "00000");
+				io::RawFile hashFile((boost::filesystem::path(directory) / "00000" / "hashes.dat").generic_string(), io::OpenMode::Read_Write);
+				hashFile.write(std::vector<uint8_t>(2 * Hash256_Size));
+				return std::make_unique<io::FileBlockStorage>(directory);
+			}
+		};
+
+		struct PackedTraits {
+			static std::unique_ptr<io::BlockStorage> CreateStorage(const std::string& directory) {
+				// align the initial height with file storage so that both start saving at height two
+				auto pStorage = std::make_unique<io::PackedFileBlockStorage>(directory);
+				pStorage->dropBlocksAfter(Height(1));
+				return pStorage;
+			}
+		};
+
+		// endregion
+
+		// region BenchContext
+
+		void SaveRandomBlocks(io::BlockStorage& storage) {
+			std::vector<uint8_t> buffer(sizeof(model::Block) + Num_Transactions_Per_Block * Transaction_Size);
+			test::FillWithRandomData(buffer);
+
+			auto& block = reinterpret_cast<model::Block&>(*buffer.data());
+			block.Size = static_cast<uint32_t>(buffer.size());
+			for (auto i = 0u; i < Num_Transactions_Per_Block; ++i)
+				reinterpret_cast<model::Transaction&>(buffer[sizeof(model::Block) + i * Transaction_Size]).Size = Transaction_Size;
+
+			for (auto height = Height(2); height <= Height(Num_Blocks); height = height + Height(1)) {
+				block.Height = height;
+
+				model::BlockElement element(block);
+				for (const auto& transaction : block.Transactions())
+					element.Transactions.emplace_back(transaction);
+
+				storage.saveBlock(element);
+			}
+		}
+
+		// storage is shared by all benchmark threads, so it is created once per traits
+		template<typename TTraits>
+		class BenchContext {
+		public:
+			BenchContext() {
+				boost::filesystem::create_directories(m_tempDir.name());
+				auto pStorage = TTraits::CreateStorage(m_tempDir.name());
+				SaveRandomBlocks(*pStorage);
+				m_pStorageCache = std::make_unique<io::BlockStorageCache>(std::move(pStorage));
+
+				RegisterPullBlocksHandler(m_handlers, *m_pStorageCache, { Num_Request_Blocks, Num_Response_Bytes });
+			}
+
+		public:
+			static BenchContext& Instance() {
+				static BenchContext context;
+				return context;
+			}
+
+		public:
+			const io::BlockStorageCache& storage() const {
+				return *m_pStorageCache;
+			}
+
+			const ionet::ServerPacketHandlers& handlers() const {
+				return m_handlers;
+			}
+
+		private:
+			test::TempDirectoryGuard m_tempDir;
+			std::unique_ptr<io::BlockStorageCache> m_pStorageCache;
+			ionet::ServerPacketHandlers m_handlers;
+		};
+
+		uint32_t NextSeed() {
+			static std::atomic<uint32_t> nextSeed(0);
+			return nextSeed++;
+		}
+
+		Height NextRequestHeight(uint32_t& seed) {
+			// simple linear congruential generator so that threads request different ranges without contending on a shared generator
+			seed = seed * 1664525 + 1013904223;
+			return Height(2 + seed % (Num_Blocks - Num_Request_Blocks));
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		template<typename TTraits>
+		void BenchmarkPullBlocksHandler(benchmark::State& state) {
+			const auto& context = BenchContext<TTraits>::Instance();
+			auto pRequest = ionet::CreateSharedPacket<api::PullBlocksRequest>();
+			pRequest->NumBlocks = Num_Request_Blocks;
+			pRequest->NumResponseBytes = Num_Response_Bytes;
+
+			auto seed = NextSeed();
+			for (auto _ : state) {
+				pRequest->Height = NextRequestHeight(seed);
+
+				ionet::ServerPacketHandlerContext handlerContext({}, "");
+				context.handlers().process(*pRequest, handlerContext);
+				benchmark::DoNotOptimize(handlerContext.response());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * Num_Request_Blocks));
+		}
+
+		// reference implementation that loads blocks one at a time (as the handler did before range loads were supported)
+		template<typename TTraits>
+		void BenchmarkPullBlocksPerBlockLoads(benchmark::State& state) {
+			const auto& context = BenchContext<TTraits>::Instance();
+
+			auto seed = NextSeed();
+			for (auto _ : state) {
+				auto startHeight = NextRequestHeight(seed);
+
+				auto storageView = context.storage().view();
+				std::vector<std::shared_ptr<const model::Block>> blocks;
+				for (auto i = 0u; i < Num_Request_Blocks; ++i)
+					blocks.push_back(storageView.loadBlock(startHeight + Height(i)));
+
+				auto payload = ionet::PacketPayloadFactory::FromEntities(ionet::PacketType::Pull_Blocks, blocks);
+				benchmark::DoNotOptimize(payload);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * Num_Request_Blocks));
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto numThreads : { 1, 4, 16 })
+				benchmark.UseRealTime()->Threads(numThreads);
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME)
+
+#define CATAPULT_REGISTER_STORAGE_BENCHMARK(BENCH_NAME) \
+	AddDefaultArguments(*REGISTER_BENCHMARK(BENCH_NAME<FileTraits>)); \
+	AddDefaultArguments(*REGISTER_BENCHMARK(BENCH_NAME<PackedTraits>))
+
+		void RegisterTests() {
+			CATAPULT_REGISTER_STORAGE_BENCHMARK(BenchmarkPullBlocksHandler);
+			CATAPULT_REGISTER_STORAGE_BENCHMARK(BenchmarkPullBlocksPerBlockLoads);
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::handlers::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,165 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/PackedFileBlockStorage.h"
+#include "catapult/io/RawFile.h"
+#include "catapult/model/Elements.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr auto Num_Preloaded_Blocks = 100u;
+		constexpr auto Transaction_Size = 200u;
+
+		// region traits
+
+		struct FileTraits {
+			static std::unique_ptr<BlockStorage> CreateStorage(const std::string& directory) {
+				// file storage reports height one (nemesis) when no blocks have been saved
+				// and expects the first hashes file to contain (placeholder) hashes for heights zero and one
+				boost::filesystem::create_directories(boost::filesystem::path(directory) / "00000");
+				RawFile hashFile((boost::filesystem::path(directory) / "00000" / "hashes.dat").generic_string(), OpenMode::Read_Write);
+				hashFile.write(std::vector<uint8_t>(2 * Hash256_Size));
+				return std::make_unique<FileBlockStorage>(directory);
+			}
+		};
+
+		struct PackedTraits {
+			static std::unique_ptr<BlockStorage> CreateStorage(const std::string& directory) {
+				// align the initial height with file storage so that both start saving at height two
+				auto pStorage = std::make_unique<PackedFileBlockStorage>(directory);
+				pStorage->dropBlocksAfter(Height(1));
+				return pStorage;
+			}
+		};
+
+		// endregion
+
+		// region block generation
+
+		class BlockGenerator {
+		public:
+			explicit BlockGenerator(uint32_t numTransactions)
+					: m_buffer(sizeof(model::Block) + numTransactions * Transaction_Size) {
+				test::FillWithRandomData(m_buffer);
+
+				auto& block = reinterpret_cast<model::Block&>(*m_buffer.data());
+				block.Size = static_cast<uint32_t>(m_buffer.size());
+				for (auto i = 0u; i < numTransactions; ++i) {
+					auto& transaction = reinterpret_cast<model::Transaction&>(m_buffer[sizeof(model::Block) + i * Transaction_Size]);
+					transaction.Size = Transaction_Size;
+				}
+			}
+
+		public:
+			model::BlockElement next(Height height) {
+				auto& block = reinterpret_cast<model::Block&>(*m_buffer.data());
+				block.Height = height;
+
+				model::BlockElement element(block);
+				test::FillWithRandomData(element.EntityHash);
+				test::FillWithRandomData(element.GenerationHash);
+				for (const auto& transaction : block.Transactions()) {
+					element.Transactions.emplace_back(transaction);
+					test::FillWithRandomData(element.Transactions.back().EntityHash);
+					test::FillWithRandomData(element.Transactions.back().MerkleComponentHash);
+				}
+
+				element.SubCacheMerkleRoots.resize(3);
+				return element;
+			}
+
+		private:
+			std::vector<uint8_t> m_buffer;
+		};
+
+		// endregion
+
+		// region benchmarks
+
+		template<typename TTraits>
+		void BenchmarkSaveBlock(benchmark::State& state) {
+			test::TempDirectoryGuard tempDir;
+			boost::filesystem::create_directories(tempDir.name());
+			auto pStorage = TTraits::CreateStorage(tempDir.name());
+
+			BlockGenerator generator(static_cast<uint32_t>(state.range(0)));
+			auto height = Height(2);
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto element = generator.next(height);
+				state.ResumeTiming();
+
+				pStorage->saveBlock(element);
+				height = height + Height(1);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		template<typename TTraits>
+		void BenchmarkLoadBlockElement(benchmark::State& state) {
+			test::TempDirectoryGuard tempDir;
+			boost::filesystem::create_directories(tempDir.name());
+			auto pStorage = TTraits::CreateStorage(tempDir.name());
+
+			BlockGenerator generator(static_cast<uint32_t>(state.range(0)));
+			for (auto i = 0u; i < Num_Preloaded_Blocks; ++i)
+				pStorage->saveBlock(generator.next(Height(2 + i)));
+
+			auto i = 0u;
+			for (auto _ : state) {
+				auto pBlockElement = pStorage->loadBlockElement(Height(2 + i++ % Num_Preloaded_Blocks));
+				benchmark::DoNotOptimize(pBlockElement);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 0, 10, 100, 1000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME)
+
+#define CATAPULT_REGISTER_STORAGE_BENCHMARK(BENCH_NAME) \
+	AddDefaultArguments(*REGISTER_BENCHMARK(BENCH_NAME<FileTraits>)); \
+	AddDefaultArguments(*REGISTER_BENCHMARK(BENCH_NAME<PackedTraits>))
+
+		void RegisterTests() {
+			CATAPULT_REGISTER_STORAGE_BENCHMARK(BenchmarkSaveBlock);
+			CATAPULT_REGISTER_STORAGE_BENCHMARK(BenchmarkLoadBlockElement);
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::io::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,236 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/KeyPair.h"
+#include "catapult/ionet/ConnectionSecurityMode.h"
+#include "catapult/ionet/Node.h"
+#include "catapult/ionet/PacketPayloadFactory.h"
+#include "catapult/ionet/PacketSocket.h"
+#include "catapult/ionet/SecurePacketSocketDecorator.h"
+#include "catapult/model/Transaction.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/utils/FileSize.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/test/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <future>
+#include <thread>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		constexpr auto Transaction_Size = 200u;
+		constexpr auto Max_Packet_Data_Size = utils::FileSize::FromMegabytes(150);
+
+		// region BenchContext
+
+		PacketSocketOptions CreatePacketSocketOptions() {
+			PacketSocketOptions options;
+			options.WorkingBufferSize = 16 * 1024;
+			options.WorkingBufferSensitivity = 1;
+			options.MaxPacketDataSize = Max_Packet_Data_Size.bytes();
+			return options;
+		}
+
+		crypto::KeyPair GenerateKeyPair() {
+			return crypto::KeyPair::FromPrivate(crypto::PrivateKey::Generate(test::RandomByte));
+		}
+
+		std::vector<PacketPayload> CreateTransactionPayloads(size_t count) {
+			std::vector<PacketPayload> payloads;
+			for (auto i = 0u; i < count; ++i) {
+				std::shared_ptr<model::Transaction> pTransaction = utils::MakeUniqueWithSize<model::Transaction>(Transaction_Size);
+				test::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), Transaction_Size });
+				pTransaction->Size = Transaction_Size;
+				payloads.push_back(PacketPayloadFactory::FromEntity(PacketType::Push_Transactions, pTransaction));
+			}
+
+			return payloads;
+		}
+
+		/// Connects two packet sockets over loopback and secures both ends with the same security mode.
+		class BenchContext {
+		public:
+			explicit BenchContext(ConnectionSecurityMode securityMode)
+					: m_pPool(thread::CreateIoServiceThreadPool(2, "secureio bench"))
+					, m_acceptor(m_pPool->service(), boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0))
+					, m_serverKeyPair(GenerateKeyPair())
+					, m_clientKeyPair(GenerateKeyPair())
+			{
+				m_pPool->start();
+
+				std::promise<std::shared_ptr<PacketSocket>> acceptPromise;
+				Accept(m_acceptor, CreatePacketSocketOptions(), [&acceptPromise](const auto& socketInfo) {
+					acceptPromise.set_value(socketInfo.socket());
+				});
+
+				std::promise<std::shared_ptr<PacketSocket>> connectPromise;
+				auto endpoint = NodeEndpoint{ "127.0.0.1", m_acceptor.local_endpoint().port() };
+				Connect(m_pPool->service(), CreatePacketSocketOptions(), endpoint, [&connectPromise](auto, const auto& pSocket) {
+					connectPromise.set_value(pSocket);
+				});
+
+				// - both sides share a session secret, which is normally calculated during the challenge handshake
+				Hash256 sessionSecret;
+				test::FillWithRandomData(sessionSecret);
+				m_pServerSocket = Secure(
+						acceptPromise.get_future().get(),
+						securityMode,
+						m_serverKeyPair,
+						m_clientKeyPair.publicKey(),
+						sessionSecret,
+						Max_Packet_Data_Size);
+				m_pClientSocket = Secure(
+						connectPromise.get_future().get(),
+						securityMode,
+						m_clientKeyPair,
+						m_serverKeyPair.publicKey(),
+						sessionSecret,
+						Max_Packet_Data_Size);
+			}
+
+			~BenchContext() {
+				m_pServerSocket->close();
+				m_pClientSocket->close();
+				m_pPool->service().post([this]() {
+					boost::system::error_code ignored_ec;
+					m_acceptor.close(ignored_ec);
+				});
+
+				m_pServerSocket.reset();
+				m_pClientSocket.reset();
+				m_pPool->join();
+			}
+
+		public:
+			PacketIo& writer() {
+				return *m_pClientSocket;
+			}
+
+			PacketIo& reader() {
+				return *m_pServerSocket;
+			}
+
+		private:
+			std::unique_ptr<thread::IoServiceThreadPool> m_pPool;
+			boost::asio::ip::tcp::acceptor m_acceptor;
+			crypto::KeyPair m_serverKeyPair;
+			crypto::KeyPair m_clientKeyPair;
+			std::shared_ptr<PacketSocket> m_pServerSocket;
+			std::shared_ptr<PacketSocket> m_pClientSocket;
+		};
+
+		// endregion
+
+		struct ReadState {
+			std::atomic<size_t> NumReadPackets{ 0 };
+			std::atomic<size_t> NumFailedOperations{ 0 };
+			std::atomic<bool> IsDone{ false };
+		};
+
+		void ReadAll(PacketIo& io, ReadState& readState, size_t numExpectedPackets) {
+			io.read([&io, &readState, numExpectedPackets](auto code, const auto*) {
+				if (SocketOperationCode::Success != code) {
+					++readState.NumFailedOperations;
+					readState.IsDone = true;
+					return;
+				}
+
+				if (++readState.NumReadPackets == numExpectedPackets) {
+					readState.IsDone = true;
+					return;
+				}
+
+				ReadAll(io, readState, numExpectedPackets);
+			});
+		}
+
+		void RunRoundtripBenchmark(benchmark::State& state, ConnectionSecurityMode securityMode) {
+			// Arrange:
+			auto numPayloads = static_cast<size_t>(state.range(0));
+			auto payloads = CreateTransactionPayloads(numPayloads);
+			BenchContext context(securityMode);
+
+			// Act: write all payloads at once (like a broadcast) and wait until they have all been read (and authenticated)
+			std::atomic<size_t> numFailedWrites(0);
+			size_t numFailedReads = 0;
+			for (auto _ : state) {
+				ReadState readState;
+				ReadAll(context.reader(), readState, numPayloads);
+
+				for (const auto& payload : payloads) {
+					context.writer().write(payload, [&numFailedWrites](auto code) {
+						if (SocketOperationCode::Success != code)
+							++numFailedWrites;
+					});
+				}
+
+				while (!readState.IsDone)
+					std::this_thread::yield();
+
+				numFailedReads += readState.NumFailedOperations;
+				if (0 != numFailedReads)
+					break;
+			}
+
+			if (0 != numFailedWrites || 0 != numFailedReads)
+				state.SkipWithError("at least one operation failed");
+
+			auto payloadSize = payloads.front().header().Size;
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numPayloads));
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * numPayloads * payloadSize));
+		}
+
+		// each packet is signed by the writer and verified by the reader
+		void BenchmarkSignedRoundtrip(benchmark::State& state) {
+			RunRoundtripBenchmark(state, ConnectionSecurityMode::Signed);
+		}
+
+		// each packet is authenticated with a session key derived mac
+		void BenchmarkSignedSessionRoundtrip(benchmark::State& state) {
+			RunRoundtripBenchmark(state, ConnectionSecurityMode::Signed_Session);
+		}
+
+		// packets are not authenticated (baseline)
+		void BenchmarkUnsecuredRoundtrip(benchmark::State& state) {
+			RunRoundtripBenchmark(state, ConnectionSecurityMode::None);
+		}
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 10, 100, 1'000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) AddDefaultArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME))
+
+		void RegisterTests() {
+			REGISTER_BENCHMARK(BenchmarkSignedRoundtrip);
+			REGISTER_BENCHMARK(BenchmarkSignedSessionRoundtrip);
+			REGISTER_BENCHMARK(BenchmarkUnsecuredRoundtrip);
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::ionet::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,191 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/PacketPayloadFactory.h"
+#include "catapult/ionet/PacketSocket.h"
+#include "catapult/model/Transaction.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/test/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <future>
+#include <thread>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		constexpr auto Transaction_Size = 200u;
+		constexpr auto Read_Buffer_Size = 64u * 1024;
+
+		// region BenchContext
+
+		PacketSocketOptions CreatePacketSocketOptions() {
+			PacketSocketOptions options;
+			options.WorkingBufferSize = 16 * 1024;
+			options.WorkingBufferSensitivity = 1;
+			options.MaxPacketDataSize = 150 * 1024 * 1024;
+			return options;
+		}
+
+		std::vector<PacketPayload> CreateTransactionPayloads(size_t count) {
+			std::vector<PacketPayload> payloads;
+			for (auto i = 0u; i < count; ++i) {
+				std::shared_ptr<model::Transaction> pTransaction = utils::MakeUniqueWithSize<model::Transaction>(Transaction_Size);
+				test::FillWithRandomData({ reinterpret_cast<uint8_t*>(pTransaction.get()), Transaction_Size });
+				pTransaction->Size = Transaction_Size;
+				payloads.push_back(PacketPayloadFactory::FromEntity(PacketType::Push_Transactions, pTransaction));
+			}
+
+			return payloads;
+		}
+
+		/// Connects a (server) packet socket to a (client) raw socket over loopback and drains all data sent to the client.
+		class BenchContext {
+		public:
+			BenchContext()
+					: m_pPool(thread::CreateIoServiceThreadPool(2, "socketwrite bench"))
+					, m_acceptor(m_pPool->service(), boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0))
+					, m_clientStrand(m_pPool->service())
+					, m_clientSocket(m_pPool->service())
+					, m_readBuffer(Read_Buffer_Size)
+			{
+				m_pPool->start();
+
+				std::promise<std::shared_ptr<PacketSocket>> promise;
+				Accept(m_acceptor, CreatePacketSocketOptions(), [&promise](const auto& socketInfo) {
+					promise.set_value(socketInfo.socket());
+				});
+
+				m_clientSocket.connect(m_acceptor.local_endpoint());
+				m_pServerSocket = promise.get_future().get();
+				m_pServerIo = m_pServerSocket->buffered();
+
+				m_clientStrand.post([this]() { this->drain(); });
+			}
+
+			~BenchContext() {
+				m_pServerSocket->close();
+				m_clientStrand.post([this]() {
+					boost::system::error_code ignored_ec;
+					m_clientSocket.close(ignored_ec);
+				});
+				m_pPool->service().post([this]() {
+					boost::system::error_code ignored_ec;
+					m_acceptor.close(ignored_ec);
+				});
+
+				m_pServerIo.reset();
+				m_pServerSocket.reset();
+				m_pPool->join();
+			}
+
+		public:
+			PacketIo& io() {
+				return *m_pServerIo;
+			}
+
+		private:
+			void drain() {
+				m_clientSocket.async_read_some(boost::asio::buffer(m_readBuffer), m_clientStrand.wrap([this](const auto& ec, auto) {
+					if (!ec)
+						this->drain();
+				}));
+			}
+
+		private:
+			std::unique_ptr<thread::IoServiceThreadPool> m_pPool;
+			boost::asio::ip::tcp::acceptor m_acceptor;
+			boost::asio::strand m_clientStrand;
+			boost::asio::ip::tcp::socket m_clientSocket;
+			std::vector<uint8_t> m_readBuffer;
+			std::shared_ptr<PacketSocket> m_pServerSocket;
+			std::shared_ptr<PacketIo> m_pServerIo;
+		};
+
+		// endregion
+
+		void WaitForAll(std::atomic<size_t>& numCompletedWrites, size_t numExpectedWrites) {
+			while (numCompletedWrites < numExpectedWrites)
+				std::this_thread::yield();
+		}
+
+		void RunBroadcastBenchmark(benchmark::State& state, bool waitForEachWrite) {
+			// Arrange:
+			auto numPayloads = static_cast<size_t>(state.range(0));
+			auto payloads = CreateTransactionPayloads(numPayloads);
+			BenchContext context;
+
+			// Act:
+			std::atomic<size_t> numFailedWrites(0);
+			for (auto _ : state) {
+				std::atomic<size_t> numCompletedWrites(0);
+				for (const auto& payload : payloads) {
+					context.io().write(payload, [&numCompletedWrites, &numFailedWrites](auto code) {
+						if (SocketOperationCode::Success != code)
+							++numFailedWrites;
+
+						++numCompletedWrites;
+					});
+
+					if (waitForEachWrite)
+						WaitForAll(numCompletedWrites, static_cast<size_t>(&payload - &payloads[0] + 1));
+				}
+
+				WaitForAll(numCompletedWrites, numPayloads);
+			}
+
+			if (0 != numFailedWrites)
+				state.SkipWithError("at least one write failed");
+
+			auto payloadSize = payloads.front().header().Size;
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numPayloads));
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * numPayloads * payloadSize));
+		}
+
+		// each write is completed before the next one is started, so no writes can be coalesced
+		void BenchmarkSequentialWrites(benchmark::State& state) {
+			RunBroadcastBenchmark(state, true);
+		}
+
+		// all writes are started at once (like a broadcast), so pending writes can be coalesced
+		void BenchmarkBroadcastWrites(benchmark::State& state) {
+			RunBroadcastBenchmark(state, false);
+		}
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 10, 100, 1'000, 10'000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) AddDefaultArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME))
+
+		void RegisterTests() {
+			REGISTER_BENCHMARK(BenchmarkSequentialWrites);
+			REGISTER_BENCHMARK(BenchmarkBroadcastWrites);
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::ionet::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
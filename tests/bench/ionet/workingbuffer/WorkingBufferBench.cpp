@@ -0,0 +1,139 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/WorkingBuffer.h"
+#include "tests/test/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstring>
+#include <new>
+
+namespace {
+	std::atomic<size_t> Num_Allocations(0);
+}
+
+void* operator new(size_t size) {
+	++Num_Allocations;
+	if (auto* pMemory = std::malloc(size))
+		return pMemory;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pMemory) noexcept {
+	std::free(pMemory);
+}
+
+void operator delete(void* pMemory, size_t) noexcept {
+	std::free(pMemory);
+}
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		constexpr auto Working_Buffer_Size = 16u * 1024;
+		constexpr auto Stream_Size = 16u * 1024 * 1024;
+
+		PacketSocketOptions CreatePacketSocketOptions() {
+			PacketSocketOptions options;
+			options.WorkingBufferSize = Working_Buffer_Size;
+			options.WorkingBufferSensitivity = 100;
+			options.MaxPacketDataSize = 150 * 1024 * 1024;
+			return options;
+		}
+
+		/// Creates a stream of (approximately) \a streamSize bytes composed of packets of size \a packetSize.
+		ByteBuffer CreatePacketStream(uint32_t packetSize, size_t streamSize) {
+			auto numPackets = std::max<size_t>(1, streamSize / packetSize);
+			ByteBuffer stream(numPackets * packetSize);
+			test::FillWithRandomData(stream);
+			for (auto i = 0u; i < numPackets; ++i) {
+				auto& header = reinterpret_cast<PacketHeader&>(stream[i * packetSize]);
+				header.Size = packetSize;
+				header.Type = PacketType::Push_Transactions;
+			}
+
+			return stream;
+		}
+
+		/// Feeds \a stream into \a buffer in reads of at most \a readSize bytes (like async_read_some) and extracts all packets.
+		size_t ReceiveStream(WorkingBuffer& buffer, const ByteBuffer& stream) {
+			size_t numPackets = 0;
+			size_t streamOffset = 0;
+			while (streamOffset < stream.size()) {
+				auto appendContext = buffer.prepareAppend();
+				auto appendBuffer = appendContext.buffer();
+				auto readSize = std::min(boost::asio::buffer_size(appendBuffer), stream.size() - streamOffset);
+				std::memcpy(boost::asio::buffer_cast<uint8_t*>(appendBuffer), &stream[streamOffset], readSize);
+				appendContext.commit(readSize);
+				streamOffset += readSize;
+
+				auto extractor = buffer.preparePacketExtractor();
+				const Packet* pPacket;
+				while (PacketExtractResult::Success == extractor.tryExtractNextPacket(pPacket)) {
+					benchmark::DoNotOptimize(pPacket->Type);
+					++numPackets;
+				}
+
+				extractor.consume();
+			}
+
+			return numPackets;
+		}
+
+		void BenchmarkExtractPackets(benchmark::State& state) {
+			// Arrange:
+			auto packetSize = static_cast<uint32_t>(state.range(0));
+			auto stream = CreatePacketStream(packetSize, Stream_Size);
+			WorkingBuffer buffer(CreatePacketSocketOptions());
+
+			// Act:
+			size_t numPackets = 0;
+			auto numAllocationsStart = Num_Allocations.load();
+			for (auto _ : state)
+				numPackets += ReceiveStream(buffer, stream);
+
+			auto numAllocations = Num_Allocations - numAllocationsStart;
+
+			auto numBytes = static_cast<double>(state.iterations() * stream.size());
+			state.counters["allocs_per_MB"] = static_cast<double>(numAllocations) / (numBytes / (1024 * 1024));
+			state.SetItemsProcessed(static_cast<int64_t>(numPackets));
+			state.SetBytesProcessed(static_cast<int64_t>(numBytes));
+		}
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			// small transaction packets, packets larger than the working buffer size and large block packets
+			for (auto arg : { 200, 2'000, 50'000, 1'000'000, 8'000'000 })
+				benchmark.Arg(arg);
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) AddDefaultArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME))
+
+		void RegisterTests() {
+			REGISTER_BENCHMARK(BenchmarkExtractPackets);
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::ionet::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,93 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <thread>
+
+namespace catapult { namespace thread {
+
+	namespace {
+		constexpr auto Num_Items = 1000u;
+		constexpr auto Base_Item_Cost = 1000u;
+
+		// skewed workloads emulate blocks containing a few expensive (e.g. aggregate) transactions among many cheap ones;
+		// expensive items are clustered at the start so that they all land in the first static partition
+		std::vector<uint32_t> CreateItemCosts(bool isSkewed) {
+			std::vector<uint32_t> itemCosts(Num_Items, Base_Item_Cost);
+			if (isSkewed) {
+				for (auto i = 0u; i < Num_Items / 100; ++i)
+					itemCosts[i] = 100 * Base_Item_Cost;
+			}
+
+			return itemCosts;
+		}
+
+		void Spin(uint32_t cost) {
+			auto value = 0u;
+			for (auto i = 0u; i < cost; ++i) {
+				value += i;
+				benchmark::DoNotOptimize(value);
+			}
+		}
+
+		void BenchmarkParallelFor(benchmark::State& state) {
+			auto strategy = 0 == state.range(0) ? ParallelForStrategy::Static_Partition : ParallelForStrategy::Work_Stealing;
+			auto itemCosts = CreateItemCosts(0 != state.range(1));
+			auto pPool = CreateIoServiceThreadPool(std::max<size_t>(2, std::thread::hardware_concurrency()), "bench");
+			pPool->start();
+
+			for (auto _ : state) {
+				ParallelFor(pPool->service(), itemCosts, pPool->numWorkerThreads(), strategy, [](auto cost, auto) {
+					Spin(cost);
+					return true;
+				}).get();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * Num_Items));
+			pPool->join();
+		}
+
+		void RegisterTests() {
+			// strategy: 0 - static partition, 1 - work stealing; skew: 0 - uniform, 1 - skewed
+			// (repetitions are used to report tail latency across iterations)
+			auto* pBenchmark = benchmark::RegisterBenchmark("BenchmarkParallelFor", BenchmarkParallelFor)
+					->UseRealTime()
+					->ArgNames({ "strategy", "skew" })
+					->Repetitions(10)
+					->ComputeStatistics("max", [](const auto& values) {
+						return *std::max_element(values.cbegin(), values.cend());
+					});
+
+			for (auto strategy : { 0, 1 }) {
+				for (auto skew : { 0, 1 })
+					pBenchmark->Args({ strategy, skew });
+			}
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::thread::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
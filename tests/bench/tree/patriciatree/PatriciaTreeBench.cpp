@@ -0,0 +1,161 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "catapult/crypto/Hashes.h"
+#include "tests/test/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace tree {
+
+	namespace {
+		constexpr uint32_t Num_Seed_Values = 10'000;
+
+		// region BenchEncoder
+
+		class BenchEncoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = uint64_t;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static Hash256 EncodeValue(const ValueType& value) {
+				Hash256 valueHash;
+				crypto::Sha3_256({ reinterpret_cast<const uint8_t*>(&value), sizeof(ValueType) }, valueHash);
+				return valueHash;
+			}
+		};
+
+		using BenchTree = PatriciaTree<BenchEncoder, MemoryDataSource>;
+
+		// endregion
+
+		// region test context
+
+		class BenchContext {
+		public:
+			explicit BenchContext(size_t numChanges) {
+				// half of the changes modify seeded keys and half of the changes add new keys
+				m_keys.resize(Num_Seed_Values + numChanges / 2);
+				for (auto& key : m_keys)
+					test::FillWithRandomData(key);
+
+				m_values.resize(m_keys.size() + numChanges);
+				for (auto& value : m_values)
+					value = test::Random();
+
+				for (auto i = 0u; i < numChanges; ++i) {
+					auto keyIndex = 0 == i % 2 ? Num_Seed_Values + i / 2 : (i / 2) % Num_Seed_Values;
+					m_changes.emplace_back(m_keys[keyIndex], &m_values[m_keys.size() + i]);
+				}
+			}
+
+		public:
+			const BenchTree::Changes& changes() const {
+				return m_changes;
+			}
+
+		public:
+			std::unique_ptr<BenchTree> createSeededTree() {
+				auto pTree = std::make_unique<BenchTree>(m_dataSource);
+
+				BenchTree::Changes seedChanges;
+				for (auto i = 0u; i < Num_Seed_Values; ++i)
+					seedChanges.emplace_back(m_keys[i], &m_values[i]);
+
+				pTree->update(seedChanges);
+				pTree->root();
+				return pTree;
+			}
+
+		private:
+			MemoryDataSource m_dataSource;
+			std::vector<Hash256> m_keys;
+			std::vector<uint64_t> m_values;
+			BenchTree::Changes m_changes;
+		};
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkStateHashIndividualSets(benchmark::State& state) {
+			// Arrange:
+			BenchContext context(static_cast<size_t>(state.range(0)));
+
+			// Act: apply each change individually (original state hash calculation)
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto pTree = context.createSeededTree();
+				state.ResumeTiming();
+
+				for (const auto& change : context.changes())
+					pTree->set(change.first, *change.second);
+
+				benchmark::DoNotOptimize(pTree->root());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(context.changes().size() * state.iterations()));
+		}
+
+		void BenchmarkStateHashBatchedUpdate(benchmark::State& state) {
+			// Arrange:
+			BenchContext context(static_cast<size_t>(state.range(0)));
+
+			// Act: apply all changes in a single batch
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto pTree = context.createSeededTree();
+				state.ResumeTiming();
+
+				pTree->update(context.changes());
+
+				benchmark::DoNotOptimize(pTree->root());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(context.changes().size() * state.iterations()));
+		}
+
+		// endregion
+
+		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
+			for (auto arg : { 1'000, 10'000, 100'000 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) AddDefaultArguments(*benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME))
+
+		void RegisterTests() {
+			REGISTER_BENCHMARK(BenchmarkStateHashIndividualSets);
+			REGISTER_BENCHMARK(BenchmarkStateHashBatchedUpdate);
+		}
+	}
+}}
+
+int main(int argc, char **argv) {
+	catapult::tree::RegisterTests();
+	benchmark::Initialize(&argc, argv);
+	benchmark::RunSpecifiedBenchmarks();
+}
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/api/RemoteTransactionApi.h"
+#include "catapult/api/ChainPackets.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/other/RemoteApiFactory.h"
 #include "tests/test/other/RemoteApiTestUtils.h"
@@ -102,6 +103,67 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct UtSketchTraits {
+			static constexpr uint32_t Request_Data_Header_Size = sizeof(BlockFeeMultiplier);
+			static constexpr uint32_t Request_Data_Size = 6 * sizeof(utils::ShortHashSketchCell);
+
+			static utils::ShortHashSketch KnownShortHashesSketch() {
+				utils::ShortHashSketch sketch(6);
+				for (auto value : { 123, 234, 345 })
+					sketch.insert(utils::ShortHash(value));
+
+				return sketch;
+			}
+
+			static auto Invoke(const RemoteTransactionApi& api) {
+				return api.unconfirmedTransactions(BlockFeeMultiplier(17), KnownShortHashesSketch());
+			}
+
+			static auto CreateValidResponsePacket() {
+				// prepend the number of differences
+				auto pTransactionsPacket = CreatePacketWithTransactions(3);
+				auto transactionsSize = pTransactionsPacket->Size - sizeof(ionet::Packet);
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(sizeof(uint32_t) + transactionsSize);
+				pResponsePacket->Type = ionet::PacketType::Pull_Transactions_Sketch;
+				reinterpret_cast<uint32_t&>(*pResponsePacket->Data()) = 7;
+				std::memcpy(pResponsePacket->Data() + sizeof(uint32_t), pTransactionsPacket->Data(), transactionsSize);
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial transaction
+				auto pResponsePacket = CreateValidResponsePacket();
+				--pResponsePacket->Size;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_EQ(ionet::PacketType::Pull_Transactions_Sketch, packet.Type);
+				ASSERT_EQ(sizeof(ionet::Packet) + Request_Data_Header_Size + Request_Data_Size, packet.Size);
+				EXPECT_EQ(BlockFeeMultiplier(17), reinterpret_cast<const BlockFeeMultiplier&>(*packet.Data()));
+				EXPECT_EQ_MEMORY(packet.Data() + sizeof(BlockFeeMultiplier), KnownShortHashesSketch().cells().data(), Request_Data_Size);
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const UnconfirmedTransactionsSketchResult& result) {
+				EXPECT_TRUE(result.IsDecoded);
+				EXPECT_EQ(7u, result.NumDifferences);
+				ASSERT_EQ(3u, result.Transactions.size());
+
+				auto pExpectedData = response.Data() + sizeof(uint32_t);
+				auto parsedIter = result.Transactions.cbegin();
+				for (auto i = 0u; i < result.Transactions.size(); ++i) {
+					std::string message = "comparing transactions at " + std::to_string(i);
+					const auto& expectedTransaction = reinterpret_cast<const TransactionType&>(*pExpectedData);
+					const auto& actualTransaction = *parsedIter;
+					ASSERT_EQ(expectedTransaction.Size, actualTransaction.Size) << message;
+					EXPECT_EQ(Timestamp(5 * i), actualTransaction.Deadline) << message;
+					EXPECT_EQ(expectedTransaction, actualTransaction) << message;
+					++parsedIter;
+					pExpectedData += expectedTransaction.Size;
+				}
+			}
+		};
+
 		struct RemoteTransactionApiTraits {
 			static auto Create(ionet::PacketIo& packetIo, const Key& remotePublicKey) {
 				auto registry = mocks::CreateDefaultTransactionRegistry();
@@ -116,4 +178,51 @@ namespace catapult { namespace api {
 
 	DEFINE_REMOTE_API_TESTS(RemoteTransactionApi)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, Ut)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteTransactionApi, UtSketch)
+
+	// region unconfirmedTransactions (sketch)
+
+	namespace {
+		auto InvokeSketchApiWithResponse(const std::shared_ptr<ionet::Packet>& pResponsePacket) {
+			auto pPacketIo = std::make_shared<mocks::MockPacketIo>();
+			pPacketIo->queueWrite(ionet::SocketOperationCode::Success);
+			pPacketIo->queueRead(ionet::SocketOperationCode::Success, [pResponsePacket](const auto*) { return pResponsePacket; });
+			auto pApi = RemoteTransactionApiTraits::Create(*pPacketIo);
+			return UtSketchTraits::Invoke(*pApi).get();
+		}
+
+		auto CreateSketchResponsePacket(uint32_t numDifferences, uint32_t numAdditionalBytes) {
+			auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(sizeof(uint32_t) + numAdditionalBytes);
+			pResponsePacket->Type = ionet::PacketType::Pull_Transactions_Sketch;
+			reinterpret_cast<uint32_t&>(*pResponsePacket->Data()) = numDifferences;
+			return pResponsePacket;
+		}
+	}
+
+	TEST(RemoteTransactionApiTests, UtSketchResponseWithoutTransactionsIsConsideredValid) {
+		// Act:
+		auto result = InvokeSketchApiWithResponse(CreateSketchResponsePacket(5, 0));
+
+		// Assert:
+		EXPECT_TRUE(result.IsDecoded);
+		EXPECT_EQ(5u, result.NumDifferences);
+		EXPECT_TRUE(result.Transactions.empty());
+	}
+
+	TEST(RemoteTransactionApiTests, UtSketchResponseIndicatingUndecodableSketchIsConsideredValid) {
+		// Act:
+		auto result = InvokeSketchApiWithResponse(CreateSketchResponsePacket(Undecodable_Sketch_Num_Differences, 0));
+
+		// Assert:
+		EXPECT_FALSE(result.IsDecoded);
+		EXPECT_EQ(0u, result.NumDifferences);
+		EXPECT_TRUE(result.Transactions.empty());
+	}
+
+	TEST(RemoteTransactionApiTests, UtSketchResponseIndicatingUndecodableSketchWithDataIsMalformed) {
+		// Act + Assert:
+		EXPECT_THROW(InvokeSketchApiWithResponse(CreateSketchResponsePacket(Undecodable_Sketch_Num_Differences, 1)), catapult_api_error);
+	}
+
+	// endregion
 }}
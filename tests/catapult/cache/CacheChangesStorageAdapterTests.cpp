@@ -0,0 +1,277 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/CacheChangesStorageAdapter.h"
+#include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS CacheChangesStorageAdapterTests
+
+	namespace {
+		// region TestCache / TestCacheDelta
+
+		using Operations = std::vector<std::pair<std::string, uint32_t>>;
+
+		class TestCacheDelta {
+		public:
+			std::vector<const uint32_t*> addedElements() const {
+				return ToPointers(Added);
+			}
+
+			std::vector<const uint32_t*> modifiedElements() const {
+				return ToPointers(Modified);
+			}
+
+			std::vector<const uint32_t*> removedElements() const {
+				return ToPointers(Removed);
+			}
+
+		public:
+			std::vector<uint32_t> Added;
+			std::vector<uint32_t> Modified;
+			std::vector<uint32_t> Removed;
+			Operations AppliedOperations;
+
+		private:
+			static std::vector<const uint32_t*> ToPointers(const std::vector<uint32_t>& values) {
+				std::vector<const uint32_t*> pointers;
+				for (const auto& value : values)
+					pointers.push_back(&value);
+
+				return pointers;
+			}
+		};
+
+		struct TestCache {
+			static constexpr size_t Id = 0;
+			static constexpr auto Name = "TestCache";
+
+			using CacheDeltaType = TestCacheDelta;
+		};
+
+		struct TestCacheStorageTraits {
+			using ValueType = uint32_t;
+			using DestinationType = TestCacheDelta;
+
+			static void Save(uint32_t value, io::OutputStream& output) {
+				io::Write32(output, value);
+			}
+
+			static uint32_t Load(io::InputStream& input) {
+				return io::Read32(input);
+			}
+
+			static void LoadInto(uint32_t value, TestCacheDelta& delta) {
+				delta.AppliedOperations.emplace_back("load", value);
+			}
+
+			static void Purge(uint32_t value, TestCacheDelta& delta) {
+				delta.AppliedOperations.emplace_back("purge", value);
+			}
+		};
+
+		// endregion
+
+		// region TestSubCacheView
+
+		class TestSubCacheView : public SubCacheView {
+		public:
+			explicit TestSubCacheView(TestCacheDelta& delta) : m_delta(delta)
+			{}
+
+		public:
+			const SubCacheViewIdentifier& id() const override {
+				return m_id;
+			}
+
+			const void* get() const override {
+				return &m_delta;
+			}
+
+			void* get() override {
+				return &m_delta;
+			}
+
+			bool supportsMerkleRoot() const override {
+				return false;
+			}
+
+			bool tryGetMerkleRoot(Hash256&) const override {
+				return false;
+			}
+
+			bool trySetMerkleRoot(const Hash256&) override {
+				return false;
+			}
+
+			void updateMerkleRoot(Height) override
+			{}
+
+			const void* asReadOnly() const override {
+				return nullptr;
+			}
+
+			void prefetch(const PrefetchKeys&) const override
+			{}
+
+		private:
+			TestCacheDelta& m_delta;
+			SubCacheViewIdentifier m_id;
+		};
+
+		CatapultCacheDelta CreateCatapultCacheDelta(TestCacheDelta& delta) {
+			std::vector<std::unique_ptr<SubCacheView>> subViews;
+			subViews.push_back(std::make_unique<TestSubCacheView>(delta));
+			return CatapultCacheDelta(std::move(subViews));
+		}
+
+		// endregion
+
+		using TestCacheChangesStorageAdapter = CacheChangesStorageAdapter<TestCache, TestCacheStorageTraits>;
+
+		std::vector<uint8_t> SerializeValues(const std::vector<uint32_t>& removedValues, const std::vector<uint32_t>& updatedValues) {
+			std::vector<uint8_t> buffer;
+			mocks::MockMemoryStream stream("", buffer);
+			io::Write64(stream, removedValues.size());
+			for (auto value : removedValues)
+				io::Write32(stream, value);
+
+			io::Write64(stream, updatedValues.size());
+			for (auto value : updatedValues)
+				io::Write32(stream, value);
+
+			return buffer;
+		}
+	}
+
+	TEST(TEST_CLASS, CanGetNameFromChangesStorageAdapter) {
+		// Arrange:
+		TestCacheChangesStorageAdapter storage;
+
+		// Act:
+		const auto& name = storage.name();
+
+		// Assert:
+		EXPECT_EQ("TestCache", name);
+	}
+
+	TEST(TEST_CLASS, CanSaveEmptyChangesViaChangesStorageAdapter) {
+		// Arrange:
+		TestCacheDelta delta;
+		auto cacheDelta = CreateCatapultCacheDelta(delta);
+		TestCacheChangesStorageAdapter storage;
+
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		storage.saveAll(cacheDelta, stream);
+
+		// Assert:
+		EXPECT_EQ(SerializeValues({}, {}), buffer);
+	}
+
+	TEST(TEST_CLASS, CanSaveChangesViaChangesStorageAdapter) {
+		// Arrange:
+		TestCacheDelta delta;
+		delta.Added = { 11, 12 };
+		delta.Modified = { 21, 22, 23 };
+		delta.Removed = { 31, 32, 33 };
+		auto cacheDelta = CreateCatapultCacheDelta(delta);
+		TestCacheChangesStorageAdapter storage;
+
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		storage.saveAll(cacheDelta, stream);
+
+		// Assert: removed values are reversed and modified values precede added values
+		EXPECT_EQ(SerializeValues({ 33, 32, 31 }, { 21, 22, 23, 11, 12 }), buffer);
+		EXPECT_TRUE(delta.AppliedOperations.empty());
+	}
+
+	TEST(TEST_CLASS, CanLoadEmptyChangesViaChangesStorageAdapter) {
+		// Arrange:
+		TestCacheDelta delta;
+		auto cacheDelta = CreateCatapultCacheDelta(delta);
+		TestCacheChangesStorageAdapter storage;
+
+		auto buffer = SerializeValues({}, {});
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		storage.loadAll(stream, cacheDelta);
+
+		// Assert:
+		EXPECT_TRUE(delta.AppliedOperations.empty());
+	}
+
+	TEST(TEST_CLASS, CanLoadChangesViaChangesStorageAdapter) {
+		// Arrange:
+		TestCacheDelta delta;
+		auto cacheDelta = CreateCatapultCacheDelta(delta);
+		TestCacheChangesStorageAdapter storage;
+
+		auto buffer = SerializeValues({ 33, 32 }, { 21, 11 });
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		storage.loadAll(stream, cacheDelta);
+
+		// Assert: removed values are purged and updated values are purged before being loaded
+		Operations expectedOperations{
+			{ "purge", 33 }, { "purge", 32 },
+			{ "purge", 21 }, { "load", 21 },
+			{ "purge", 11 }, { "load", 11 }
+		};
+		EXPECT_EQ(expectedOperations, delta.AppliedOperations);
+	}
+
+	TEST(TEST_CLASS, SavedChangesRoundtripViaChangesStorageAdapter) {
+		// Arrange:
+		TestCacheDelta sourceDelta;
+		sourceDelta.Added = { 11 };
+		sourceDelta.Modified = { 21 };
+		sourceDelta.Removed = { 31, 32 };
+		auto sourceCacheDelta = CreateCatapultCacheDelta(sourceDelta);
+
+		TestCacheDelta destinationDelta;
+		auto destinationCacheDelta = CreateCatapultCacheDelta(destinationDelta);
+		TestCacheChangesStorageAdapter storage;
+
+		std::vector<uint8_t> buffer;
+		mocks::MockMemoryStream stream("", buffer);
+
+		// Act:
+		storage.saveAll(sourceCacheDelta, stream);
+		storage.loadAll(stream, destinationCacheDelta);
+
+		// Assert:
+		Operations expectedOperations{
+			{ "purge", 32 }, { "purge", 31 },
+			{ "purge", 21 }, { "load", 21 },
+			{ "purge", 11 }, { "load", 11 }
+		};
+		EXPECT_EQ(expectedOperations, destinationDelta.AppliedOperations);
+	}
+}}
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/cache/CacheConfiguration.h"
+#include "catapult/cache_db/RocksSharedResources.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -34,6 +35,9 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
 		EXPECT_EQ(utils::FileSize(), config.MaxCacheDatabaseWriteBatchSize);
 		EXPECT_FALSE(config.ShouldStorePatriciaTrees);
+		EXPECT_FALSE(!!config.DatabaseResources);
+		EXPECT_FALSE(config.PatriciaTreeNodeCacheOptions.isEnabled());
+		EXPECT_EQ(0u, config.PatriciaTreeNumRetainedRoots);
 	}
 
 	TEST(TEST_CLASS, CanCreateConfigurationWithPathButNotPatriciaTreeStorage) {
@@ -45,6 +49,9 @@ namespace catapult { namespace cache {
 		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(4), config.MaxCacheDatabaseWriteBatchSize);
 		EXPECT_FALSE(config.ShouldStorePatriciaTrees);
+		EXPECT_FALSE(!!config.DatabaseResources);
+		EXPECT_FALSE(config.PatriciaTreeNodeCacheOptions.isEnabled());
+		EXPECT_EQ(0u, config.PatriciaTreeNumRetainedRoots);
 	}
 
 	TEST(TEST_CLASS, CanCreateConfigurationWithPathAndPatriciaTreeStorage) {
@@ -56,5 +63,25 @@ namespace catapult { namespace cache {
 		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(4), config.MaxCacheDatabaseWriteBatchSize);
 		EXPECT_TRUE(config.ShouldStorePatriciaTrees);
+		EXPECT_FALSE(!!config.DatabaseResources);
+		EXPECT_FALSE(config.PatriciaTreeNodeCacheOptions.isEnabled());
+		EXPECT_EQ(0u, config.PatriciaTreeNumRetainedRoots);
+	}
+
+	TEST(TEST_CLASS, CanCreateConfigurationWithPathAndDatabaseResources) {
+		// Arrange:
+		auto pResources = std::make_shared<RocksSharedResources>(utils::FileSize(), utils::FileSize());
+
+		// Act:
+		CacheConfiguration config("xyz", utils::FileSize::FromMegabytes(4), PatriciaTreeStorageMode::Enabled, pResources);
+
+		// Assert:
+		EXPECT_TRUE(config.ShouldUseCacheDatabase);
+		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
+		EXPECT_EQ(utils::FileSize::FromMegabytes(4), config.MaxCacheDatabaseWriteBatchSize);
+		EXPECT_TRUE(config.ShouldStorePatriciaTrees);
+		EXPECT_EQ(pResources, config.DatabaseResources);
+		EXPECT_FALSE(config.PatriciaTreeNodeCacheOptions.isEnabled());
+		EXPECT_EQ(0u, config.PatriciaTreeNumRetainedRoots);
 	}
 }}
@@ -33,7 +33,11 @@ namespace catapult { namespace cache {
 					const CacheConfiguration& config,
 					const std::vector<std::string>& columnFamilyNames,
 					FilterPruningMode pruningMode = FilterPruningMode::Disabled)
-					: CacheDatabaseMixin(config, columnFamilyNames, pruningMode)
+					: CacheDatabaseMixin(
+							config,
+							columnFamilyNames,
+							std::vector<RocksColumnProfile>(columnFamilyNames.size(), RocksColumnProfile::Point_Lookup),
+							pruningMode)
 			{}
 
 		public:
@@ -123,6 +127,24 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(deltaset::ConditionalContainerMode::Storage, decltype(mixin)::GetContainerMode(config));
 	}
 
+	TEST(TEST_CLASS, CanInitializeDatabaseWithPatriciaTreeSupportAndSharedResources) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto pResources = std::make_shared<RocksSharedResources>(utils::FileSize::FromMegabytes(8), utils::FileSize::FromMegabytes(4));
+		CacheConfiguration config(dbDirGuard.name(), utils::FileSize(), PatriciaTreeStorageMode::Enabled, pResources);
+
+		// Act:
+		ConcreteCacheDatabaseMixin mixin(config, { "default", "foo", "bar" });
+
+		// Assert:
+		EXPECT_TRUE(mixin.hasPatriciaTreeSupport());
+
+		EXPECT_EQ((std::vector<std::string>{ "default", "foo", "bar", "patricia_tree" }), mixin.database().columnFamilyNames());
+		EXPECT_FALSE(mixin.database().canPrune());
+
+		EXPECT_EQ(deltaset::ConditionalContainerMode::Storage, decltype(mixin)::GetContainerMode(config));
+	}
+
 	TEST(TEST_CLASS, CanFlushWhenCacheDatabaseIsDisabled) {
 		// Arrange:
 		CacheConfiguration config;
@@ -244,4 +244,117 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region enabled - node cache
+
+	namespace {
+		tree::TreeNodeCacheOptions CreateNodeCacheOptions(size_t numPinnedLevels) {
+			tree::TreeNodeCacheOptions options;
+			options.MaxSize = 100;
+			options.NumPinnedLevels = numPinnedLevels;
+			return options;
+		}
+	}
+
+	TEST(TEST_CLASS, Enabled_NodeCacheIsDisabledByDefault) {
+		// Arrange:
+		CacheDatabaseHolder holder;
+
+		// Act:
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+
+		// Assert:
+		EXPECT_FALSE(!!tree.nodeCache());
+	}
+
+	TEST(TEST_CLASS, Enabled_InitializationPinsRootNodeInDb) {
+		// Arrange:
+		CacheDatabaseHolder holder;
+
+		tree::LeafTreeNode leafNode(tree::TreeNodePath(0x01'23'4A'B6'78), test::GenerateRandomData<Hash256_Size>());
+		auto rootHash = leafNode.hash();
+		auto serializedLeafNode = tree::PatriciaTreeSerializer::SerializeValue(tree::TreeNode(leafNode));
+
+		holder.database().put(1, "root", HashToString(rootHash));
+		holder.database().put(1, HashToString(rootHash), serializedLeafNode);
+
+		// Act:
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1, CreateNodeCacheOptions(2));
+
+		// Assert:
+		ASSERT_TRUE(!!tree.nodeCache());
+		EXPECT_EQ(1u, tree.nodeCache()->statistics().NumPinnedNodes);
+		EXPECT_TRUE(!!tree.nodeCache()->find(rootHash));
+	}
+
+	TEST(TEST_CLASS, Enabled_CommitPinsTopLevels) {
+		// Arrange:
+		CacheDatabaseHolder holder;
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1, CreateNodeCacheOptions(2));
+
+		// Act: root branch with two leaves
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x01'23'4A'B6, "alpha");
+		pDeltaTree->set(0x01'23'4A'99, "beta");
+		tree.commit();
+
+		// Assert:
+		ASSERT_TRUE(!!tree.nodeCache());
+		EXPECT_EQ(3u, tree.nodeCache()->statistics().NumPinnedNodes);
+		EXPECT_TRUE(!!tree.nodeCache()->find(tree.get()->root()));
+	}
+
+	// endregion
+
+	// region enabled - garbage collection
+
+	TEST(TEST_CLASS, Enabled_GarbageCollectionIsDisabledByDefault) {
+		// Arrange:
+		CacheDatabaseHolder holder;
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x01'23'4A'B6, "alpha");
+		tree.commit();
+
+		// Act:
+		pDeltaTree->set(0x01'23'4A'B6, "beta");
+		tree.commit();
+
+		// Assert:
+		auto statistics = tree.garbageStatistics();
+		EXPECT_EQ(0u, statistics.NumPendingNodes);
+		EXPECT_EQ(0u, statistics.NumRemovedNodes);
+		EXPECT_EQ(0u, statistics.NumReclaimedBytes);
+	}
+
+	TEST(TEST_CLASS, Enabled_CommitRemovesNodesNoLongerReachableFromRetainedRoots) {
+		// Arrange: retain two roots
+		CacheDatabaseHolder holder;
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1, tree::TreeNodeCacheOptions(), 2);
+
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x01'23'4A'B6, "alpha");
+		tree.commit();
+
+		// Act: each commit replaces the single leaf (root) node
+		pDeltaTree->set(0x01'23'4A'B6, "beta");
+		tree.commit();
+		auto statistics1 = tree.garbageStatistics();
+
+		pDeltaTree->set(0x01'23'4A'B6, "gamma");
+		tree.commit();
+		auto statistics2 = tree.garbageStatistics();
+
+		// Assert: the first leaf is pending until its root falls out of the window
+		EXPECT_EQ(1u, statistics1.NumPendingNodes);
+		EXPECT_EQ(0u, statistics1.NumRemovedNodes);
+		EXPECT_EQ(0u, statistics1.NumReclaimedBytes);
+
+		EXPECT_EQ(1u, statistics2.NumPendingNodes);
+		EXPECT_EQ(1u, statistics2.NumRemovedNodes);
+		EXPECT_LT(Hash256_Size, statistics2.NumReclaimedBytes);
+	}
+
+	// endregion
 }}
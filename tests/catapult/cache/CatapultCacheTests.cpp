@@ -25,6 +25,7 @@
 #include "catapult/crypto/Hashes.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
+#include "tests/test/core/AddressTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/TestHarness.h"
 
@@ -362,6 +363,28 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetchDelegatesToSubCaches) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+		auto delta = cache.createDelta();
+
+		PrefetchKeys keys;
+		for (auto i = 0u; i < 3; ++i)
+			keys.Addresses.insert(test::GenerateRandomAddress());
+
+		// Act:
+		delta.prefetch(keys);
+
+		// Assert:
+		EXPECT_EQ(3u, delta.sub<test::SimpleCacheT<2>>().numPrefetchedAddresses());
+		EXPECT_EQ(3u, delta.sub<test::SimpleCacheT<4>>().numPrefetchedAddresses());
+		EXPECT_EQ(3u, delta.sub<test::SimpleCacheT<6>>().numPrefetchedAddresses());
+	}
+
+	// endregion
+
 	// region toReadOnly
 
 	TEST(TEST_CLASS, CanAcquireReadOnlyViewOfView) {
@@ -508,6 +508,111 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEach (max fee multiplier)
+
+	namespace {
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithMaxFeeMultipliers(const std::vector<uint32_t>& multipliers) {
+			// notice that deadlines are one-based and sorted by insertion order
+			auto transactionInfos = test::CreateTransactionInfos(multipliers.size());
+			for (auto i = 0u; i < multipliers.size(); ++i) {
+				const auto& transaction = *transactionInfos[i].pEntity;
+				const_cast<Amount&>(transaction.MaxFee) = Amount(transaction.Size * multipliers[i]);
+			}
+
+			return transactionInfos;
+		}
+
+		std::vector<Timestamp::ValueType> ExtractDeadlines(
+				const MemoryUtCache& cache,
+				MaxFeeMultiplierOrder order,
+				size_t numRequested = std::numeric_limits<size_t>::max()) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			cache.view().forEach(order, [numRequested, &rawDeadlines](const auto& info) {
+				rawDeadlines.push_back(info.pEntity->Deadline.unwrap());
+				return numRequested != rawDeadlines.size();
+			});
+
+			return rawDeadlines;
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachByMaxFeeMultiplierForwardsNoTransactionInfosIfCacheIsEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act + Assert:
+		EXPECT_TRUE(ExtractDeadlines(cache, MaxFeeMultiplierOrder::Ascending).empty());
+		EXPECT_TRUE(ExtractDeadlines(cache, MaxFeeMultiplierOrder::Descending).empty());
+	}
+
+	TEST(TEST_CLASS, ForEachByMaxFeeMultiplierForwardsAllTransactionsInAscendingOrder) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithMaxFeeMultipliers({ 30, 10, 20, 10, 30, 5 }));
+
+		// Act:
+		auto rawDeadlines = ExtractDeadlines(cache, MaxFeeMultiplierOrder::Ascending);
+
+		// Assert: equal multipliers are ordered from oldest to newest
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 6, 2, 4, 3, 1, 5 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByMaxFeeMultiplierForwardsAllTransactionsInDescendingOrder) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithMaxFeeMultipliers({ 30, 10, 20, 10, 30, 5 }));
+
+		// Act:
+		auto rawDeadlines = ExtractDeadlines(cache, MaxFeeMultiplierOrder::Descending);
+
+		// Assert: equal multipliers are ordered from oldest to newest
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 5, 3, 2, 4, 6 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByMaxFeeMultiplierForwardsSubsetOfTransactionsIfShortCircuited) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithMaxFeeMultipliers({ 30, 10, 20, 10, 30, 5 }));
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 6, 2, 4 }), ExtractDeadlines(cache, MaxFeeMultiplierOrder::Ascending, 3));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 5, 3 }), ExtractDeadlines(cache, MaxFeeMultiplierOrder::Descending, 3));
+	}
+
+	TEST(TEST_CLASS, ForEachByMaxFeeMultiplierReflectsRemovedAndAddedTransactions) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithMaxFeeMultipliers({ 30, 10, 20, 10, 30, 5, 10 });
+		{
+			auto modifier = cache.modifier();
+			for (auto i = 0u; i < 6; ++i)
+				modifier.add(transactionInfos[i]);
+		}
+
+		// Act: remove (1, 30x) and (3, 20x) and add (7, 10x)
+		test::RemoveAll(cache, { transactionInfos[0].EntityHash, transactionInfos[2].EntityHash });
+		cache.modifier().add(transactionInfos[6]);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 6, 2, 4, 7, 5 }), ExtractDeadlines(cache, MaxFeeMultiplierOrder::Ascending));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 5, 2, 4, 7, 6 }), ExtractDeadlines(cache, MaxFeeMultiplierOrder::Descending));
+	}
+
+	TEST(TEST_CLASS, ForEachByMaxFeeMultiplierForwardsNoTransactionInfosAfterRemoveAll) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithMaxFeeMultipliers({ 30, 10, 20 }));
+
+		// Act:
+		cache.modifier().removeAll();
+
+		// Assert:
+		EXPECT_TRUE(ExtractDeadlines(cache, MaxFeeMultiplierOrder::Ascending).empty());
+		EXPECT_TRUE(ExtractDeadlines(cache, MaxFeeMultiplierOrder::Descending).empty());
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	TEST(TEST_CLASS, ShortHashesReturnsAllShortHashes) {
@@ -646,6 +751,123 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region shortHashSketch
+
+	TEST(TEST_CLASS, ShortHashSketchContainsAllShortHashes) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(10);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto sketch = cache.view().shortHashSketch(300);
+
+		// Assert:
+		EXPECT_EQ(300u, sketch.size());
+
+		utils::ShortHashesSet expectedShortHashes;
+		for (const auto& transactionInfo : transactionInfos)
+			expectedShortHashes.insert(utils::ToShortHash(transactionInfo.EntityHash));
+
+		utils::ShortHashesSet insertedShortHashes;
+		utils::ShortHashesSet removedShortHashes;
+		EXPECT_TRUE(sketch.tryDecode(insertedShortHashes, removedShortHashes));
+		EXPECT_EQ(expectedShortHashes, insertedShortHashes);
+		EXPECT_TRUE(removedShortHashes.empty());
+	}
+
+	TEST(TEST_CLASS, ShortHashSketchIncludesTransactionsWithAnyFeeMultiplier) {
+		// Arrange: zero fee transactions are never returned when filtering by fee multiplier but must be in the sketch
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		for (auto& transactionInfo : transactionInfos)
+			const_cast<Amount&>(transactionInfo.pEntity->MaxFee) = Amount();
+
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto sketch = cache.view().shortHashSketch(90);
+
+		// Assert:
+		utils::ShortHashesSet insertedShortHashes;
+		utils::ShortHashesSet removedShortHashes;
+		EXPECT_TRUE(sketch.tryDecode(insertedShortHashes, removedShortHashes));
+		EXPECT_EQ(3u, insertedShortHashes.size());
+	}
+
+	TEST(TEST_CLASS, ShortHashSketchContainsSharedShortHashOnce) {
+		// Arrange: let the first two transactions share a short hash
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		std::memcpy(transactionInfos[1].EntityHash.data(), transactionInfos[0].EntityHash.data(), sizeof(utils::ShortHash));
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		auto sketch = cache.view().shortHashSketch(90);
+
+		// Assert:
+		utils::ShortHashesSet insertedShortHashes;
+		utils::ShortHashesSet removedShortHashes;
+		EXPECT_TRUE(sketch.tryDecode(insertedShortHashes, removedShortHashes));
+		EXPECT_EQ(2u, insertedShortHashes.size());
+		EXPECT_CONTAINS(insertedShortHashes, utils::ToShortHash(transactionInfos[0].EntityHash));
+		EXPECT_CONTAINS(insertedShortHashes, utils::ToShortHash(transactionInfos[2].EntityHash));
+	}
+
+	// endregion
+
+	// region transactionsWithShortHashes
+
+	TEST(TEST_CLASS, TransactionsWithShortHashesReturnsNothingWhenNoShortHashesAreRequested) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, test::CreateTransactionInfos(5));
+
+		// Act:
+		auto transactions = cache.view().transactionsWithShortHashes(BlockFeeMultiplier(), {});
+
+		// Assert:
+		EXPECT_TRUE(transactions.empty());
+	}
+
+	TEST(TEST_CLASS, TransactionsWithShortHashesReturnsOnlyTransactionsWithRequestedShortHashes) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		utils::ShortHashesSet shortHashes;
+		shortHashes.insert(utils::ToShortHash(transactionInfos[1].EntityHash));
+		shortHashes.insert(utils::ToShortHash(transactionInfos[3].EntityHash));
+		shortHashes.insert(utils::ToShortHash(test::GenerateRandomData<Hash256_Size>()));
+
+		// Act:
+		auto transactions = cache.view().transactionsWithShortHashes(BlockFeeMultiplier(10), shortHashes);
+
+		// Assert:
+		AssertDeadlines(transactions, { 2, 4 });
+	}
+
+	TEST(TEST_CLASS, TransactionsWithShortHashesFiltersTransactionsByFeeMultiplier) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		const_cast<Amount&>(transactionInfos[3].pEntity->MaxFee) = Amount();
+		test::AddAll(cache, transactionInfos);
+
+		utils::ShortHashesSet shortHashes;
+		for (const auto& transactionInfo : transactionInfos)
+			shortHashes.insert(utils::ToShortHash(transactionInfo.EntityHash));
+
+		// Act:
+		auto transactions = cache.view().transactionsWithShortHashes(BlockFeeMultiplier(1), shortHashes);
+
+		// Assert:
+		AssertDeadlines(transactions, { 1, 2, 3, 5 });
+	}
+
+	// endregion
+
 	// region max size
 
 	namespace {
@@ -210,4 +210,80 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region MaxFeeMultiplierOrdered
+
+	namespace {
+		std::unique_ptr<MemoryUtCache> CreateMemoryUtCacheWithMaxFeeMultipliers(const std::vector<uint32_t>& multipliers) {
+			auto transactionInfos = test::CreateTransactionInfos(multipliers.size());
+			for (auto i = 0u; i < multipliers.size(); ++i) {
+				const auto& transaction = *transactionInfos[i].pEntity;
+				const_cast<Amount&>(transaction.MaxFee) = Amount(transaction.Size * multipliers[i]);
+			}
+
+			auto pUtCache = std::make_unique<MemoryUtCache>(MemoryCacheOptions(1000, 1000));
+			test::AddAll(*pUtCache, transactionInfos);
+			return pUtCache;
+		}
+
+		void AssertDeadlines(
+				const std::vector<Timestamp::ValueType>& expectedDeadlines,
+				const std::vector<const model::TransactionInfo*>& transactionInfos) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			for (const auto* pTransactionInfo : transactionInfos)
+				rawDeadlines.push_back(pTransactionInfo->pEntity->Deadline.unwrap());
+
+			EXPECT_EQ(expectedDeadlines, rawDeadlines);
+		}
+
+		void AssertMaxFeeMultiplierOrdering(
+				MaxFeeMultiplierOrder order,
+				uint32_t count,
+				const std::vector<Timestamp::ValueType>& expectedDeadlines) {
+			// Arrange:
+			auto pUtCache = CreateMemoryUtCacheWithMaxFeeMultipliers({ 30, 10, 20, 10, 30, 5 });
+			auto utCacheView = pUtCache->view();
+
+			// Act:
+			auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, count, order, [](const auto&) { return true; });
+
+			// Assert:
+			AssertDeadlines(expectedDeadlines, transactionInfos);
+		}
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersReturnsNoTransactionInfosIfZeroAreRequested_MaxFeeMultiplierOrdered) {
+		// Assert:
+		AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder::Ascending, 0, {});
+		AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder::Descending, 0, {});
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesAscendingOrdering_MaxFeeMultiplierOrdered) {
+		// Assert:
+		AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder::Ascending, 4, { 6, 2, 4, 3 });
+		AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder::Ascending, 10, { 6, 2, 4, 3, 1, 5 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesDescendingOrdering_MaxFeeMultiplierOrdered) {
+		// Assert:
+		AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder::Descending, 4, { 1, 5, 3, 2 });
+		AssertMaxFeeMultiplierOrdering(MaxFeeMultiplierOrder::Descending, 10, { 1, 5, 3, 2, 4, 6 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesOrderingAndFiltering_MaxFeeMultiplierOrdered) {
+		// Arrange:
+		auto pUtCache = CreateMemoryUtCacheWithMaxFeeMultipliers({ 30, 10, 20, 10, 30, 5 });
+		auto utCacheView = pUtCache->view();
+
+		// Act: filter odd deadline txes
+		auto order = MaxFeeMultiplierOrder::Descending;
+		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 2, order, [](const auto& transactionInfo) {
+			return 0 == transactionInfo.pEntity->Deadline.unwrap() % 2;
+		});
+
+		// Assert: (2, 4) should be returned; if count was applied first, wrong (2) would be returned
+		AssertDeadlines({ 2, 4 }, transactionInfos);
+	}
+
+	// endregion
 }}
@@ -22,6 +22,7 @@
 #include "catapult/cache/CatapultCache.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
+#include "tests/test/core/AddressTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/TestHarness.h"
 
@@ -416,6 +417,42 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region prefetch
+
+	namespace {
+		cache::PrefetchKeys CreatePrefetchKeys(size_t numAddresses) {
+			cache::PrefetchKeys keys;
+			for (auto i = 0u; i < numAddresses; ++i)
+				keys.Addresses.insert(test::GenerateRandomAddress());
+
+			return keys;
+		}
+	}
+
+	TEST(TEST_CLASS, CanPrefetchWhenSupported) {
+		// Arrange:
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(5));
+		auto pDelta = adapter.createDelta();
+
+		// Act:
+		pDelta->prefetch(CreatePrefetchKeys(3));
+		pDelta->prefetch(CreatePrefetchKeys(4));
+
+		// Assert:
+		EXPECT_EQ(7u, static_cast<const test::SimpleCacheDelta*>(pDelta->get())->numPrefetchedAddresses());
+	}
+
+	TEST(TEST_CLASS, PrefetchIsNoOpWhenUnsupported) {
+		// Arrange:
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(5));
+		auto pView = adapter.createView();
+
+		// Act + Assert: view does not support prefetching, so no exception is thrown
+		EXPECT_NO_THROW(pView->prefetch(CreatePrefetchKeys(3)));
+	}
+
+	// endregion
+
 	// region createDetachedDelta
 
 	TEST(TEST_CLASS, CanAccessDetachedDelta) {
@@ -571,6 +608,32 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region createChangesStorage
+
+	TEST(TEST_CLASS, CannotAccessChangesStorageWhenStorageTraitsDoNotSupportPurge) {
+		// Arrange:
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(0, test::SimpleCacheViewMode::Iterable));
+
+		// Act:
+		auto pCacheChangesStorage = adapter.createChangesStorage();
+
+		// Assert:
+		EXPECT_FALSE(!!pCacheChangesStorage);
+	}
+
+	TEST(TEST_CLASS, CannotAccessChangesStorageWhenCacheDoesNotSupportIteration) {
+		// Arrange:
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(0, test::SimpleCacheViewMode::Basic));
+
+		// Act:
+		auto pCacheChangesStorage = adapter.createChangesStorage();
+
+		// Assert:
+		EXPECT_FALSE(!!pCacheChangesStorage);
+	}
+
+	// endregion
+
 	// region general cache synchronization tests
 
 	namespace {
@@ -62,4 +62,55 @@ namespace catapult { namespace cache {
 		originalAccountState.Balances.optimize(Default_Cache_Options.CurrencyMosaicId);
 		test::AssertEqual(originalAccountState, loadedAccountState);
 	}
+
+	namespace {
+		void LoadIntoCache(AccountStateCache& cache, const std::vector<state::AccountState>& accountStates) {
+			auto delta = cache.createDelta();
+			for (const auto& accountState : accountStates)
+				AccountStateCacheStorage::LoadInto(accountState, *delta);
+
+			cache.commit();
+		}
+	}
+
+	TEST(TEST_CLASS, CanPurgeValueFromCache) {
+		// Arrange:
+		state::AccountState accountState1(test::GenerateRandomAddress(), Height(111));
+		accountState1.PublicKey = test::GenerateRandomData<Key_Size>();
+		accountState1.PublicKeyHeight = Height(222);
+		state::AccountState accountState2(test::GenerateRandomAddress(), Height(333));
+
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		LoadIntoCache(cache, { accountState1, accountState2 });
+
+		// Act: purge using a value with different heights
+		auto delta = cache.createDelta();
+		AccountStateCacheStorage::Purge(state::AccountState(accountState1.Address, Height(999)), *delta);
+		cache.commit();
+
+		// Assert: both the address and public key lookups were removed
+		auto view = cache.createView();
+		EXPECT_EQ(1u, view->size());
+		EXPECT_FALSE(view->contains(accountState1.Address));
+		EXPECT_FALSE(view->contains(accountState1.PublicKey));
+		EXPECT_TRUE(view->contains(accountState2.Address));
+	}
+
+	TEST(TEST_CLASS, PurgeIsNoOpWhenValueIsNotContained) {
+		// Arrange:
+		state::AccountState accountState(test::GenerateRandomAddress(), Height(111));
+
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		LoadIntoCache(cache, { accountState });
+
+		// Act:
+		auto delta = cache.createDelta();
+		AccountStateCacheStorage::Purge(state::AccountState(test::GenerateRandomAddress(), Height(111)), *delta);
+		cache.commit();
+
+		// Assert:
+		auto view = cache.createView();
+		EXPECT_EQ(1u, view->size());
+		EXPECT_TRUE(view->contains(accountState.Address));
+	}
 }}
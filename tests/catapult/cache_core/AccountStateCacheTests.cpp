@@ -1154,6 +1154,33 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetchDoesNotChangeCacheDelta) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		auto address = AddRandomAccount<AddressTraits>(cache);
+		auto publicKey = AddRandomAccount<PublicKeyTraits>(cache);
+		auto delta = cache.createDelta();
+
+		PrefetchKeys keys;
+		keys.Addresses.insert(address);
+		keys.Addresses.insert(test::GenerateRandomAddress());
+		keys.PublicKeys.insert(publicKey);
+		keys.PublicKeys.insert(GenerateRandomPublicKey());
+
+		// Act:
+		delta->prefetch(keys);
+
+		// Assert:
+		EXPECT_EQ(2u, delta->size());
+		EXPECT_TRUE(delta->contains(address));
+		EXPECT_TRUE(delta->contains(publicKey));
+		EXPECT_TRUE(delta->modifiedElements().empty());
+	}
+
+	// endregion
+
 	// region cache init
 
 	TEST(TEST_CLASS, CanSpecifyInitialValuesViaInit) {
@@ -85,6 +85,53 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	// region delta elements
+
+	namespace {
+		template<typename TPointerContainer>
+		std::vector<Height> CollectHeights(const TPointerContainer& infos) {
+			std::vector<Height> heights;
+			for (const auto* pInfo : infos)
+				heights.push_back(pInfo->BlockHeight);
+
+			return heights;
+		}
+	}
+
+	TEST(TEST_CLASS, DeltaElementsReturnsAddedElementsInHeightOrder) {
+		// Arrange:
+		BlockDifficultyCache cache(300);
+		SeedCache(cache, 3);
+		auto delta = cache.createDelta();
+
+		// Act:
+		for (auto i = 4u; i <= 7; ++i)
+			delta->insert(CreateInfo(i));
+
+		// Assert:
+		EXPECT_EQ(std::vector<Height>({ Height(4), Height(5), Height(6), Height(7) }), CollectHeights(delta->addedElements()));
+		EXPECT_TRUE(delta->modifiedElements().empty());
+		EXPECT_TRUE(delta->removedElements().empty());
+	}
+
+	TEST(TEST_CLASS, DeltaElementsReturnsRemovedElementsInHeightOrder) {
+		// Arrange:
+		BlockDifficultyCache cache(300);
+		SeedCache(cache, 7);
+		auto delta = cache.createDelta();
+
+		// Act:
+		for (auto i = 7u; i >= 5; --i)
+			delta->remove(Height(i));
+
+		// Assert:
+		EXPECT_TRUE(delta->addedElements().empty());
+		EXPECT_TRUE(delta->modifiedElements().empty());
+		EXPECT_EQ(std::vector<Height>({ Height(5), Height(6), Height(7) }), CollectHeights(delta->removedElements()));
+	}
+
+	// endregion
+
 	// region insert
 
 	TEST(TEST_CLASS, InsertThrowsIfElementHasUnexpectedHeight) {
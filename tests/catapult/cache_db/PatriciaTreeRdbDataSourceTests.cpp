@@ -46,7 +46,7 @@ namespace catapult { namespace cache {
 				return m_dataSource.size();
 			}
 
-			std::unique_ptr<const tree::TreeNode> get(const Hash256& hash) {
+			std::shared_ptr<const tree::TreeNode> get(const Hash256& hash) {
 				return m_dataSource.get(hash);
 			}
 
@@ -73,4 +73,353 @@ namespace catapult { namespace cache {
 	}
 
 	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(RocksDataSourceTraits)
+
+	// region node cache
+
+	namespace {
+		class NodeCacheTestContext {
+		public:
+			explicit NodeCacheTestContext(size_t maxSize, size_t numPinnedLevels = 0)
+					: m_db(DefaultSettings(m_dbDirGuard.name()))
+					, m_container(m_db, 0)
+					, m_dataSource(m_container, CreateOptions(maxSize, numPinnedLevels)) {
+				m_container.setSize(0);
+			}
+
+		public:
+			PatriciaTreeContainer& container() {
+				return m_container;
+			}
+
+			PatriciaTreeRdbDataSource& dataSource() {
+				return m_dataSource;
+			}
+
+			tree::TreeNodeCacheStatistics statistics() const {
+				return m_dataSource.nodeCache()->statistics();
+			}
+
+		private:
+			static tree::TreeNodeCacheOptions CreateOptions(size_t maxSize, size_t numPinnedLevels) {
+				tree::TreeNodeCacheOptions options;
+				options.MaxSize = maxSize;
+				options.NumPinnedLevels = numPinnedLevels;
+				return options;
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			RocksDatabase m_db;
+			PatriciaTreeContainer m_container;
+			PatriciaTreeRdbDataSource m_dataSource;
+		};
+
+		tree::LeafTreeNode CreateLeafNode(uint8_t nibble) {
+			return tree::LeafTreeNode(tree::TreeNodePath(static_cast<uint64_t>(nibble)), test::GenerateRandomData<Hash256_Size>());
+		}
+	}
+
+	TEST(TEST_CLASS, NodeCacheIsDisabledByDefault) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		RocksDatabase db(DefaultSettings(dbDirGuard.name()));
+		PatriciaTreeContainer container(db, 0);
+
+		// Act:
+		PatriciaTreeRdbDataSource dataSource(container);
+
+		// Assert:
+		EXPECT_FALSE(!!dataSource.nodeCache());
+	}
+
+	TEST(TEST_CLASS, GetSharesDecodedNodeAcrossCalls) {
+		// Arrange: bypass the data source so that the node is only in the database
+		NodeCacheTestContext context(10);
+		auto node = tree::TreeNode(CreateLeafNode(0x12));
+		context.container().insert(std::make_pair(node.hash(), node.copy()));
+
+		// Act:
+		auto pNode1 = context.dataSource().get(node.hash());
+		auto pNode2 = context.dataSource().get(node.hash());
+
+		// Assert: the first lookup decodes the node and the second lookup shares it
+		ASSERT_TRUE(!!pNode1);
+		EXPECT_EQ(node.hash(), pNode1->hash());
+		EXPECT_EQ(pNode1, pNode2);
+
+		auto statistics = context.statistics();
+		EXPECT_EQ(1u, statistics.NumCachedNodes);
+		EXPECT_EQ(1u, statistics.NumHits);
+		EXPECT_EQ(1u, statistics.NumMisses);
+	}
+
+	TEST(TEST_CLASS, GetDoesNotCacheUnknownNode) {
+		// Arrange:
+		NodeCacheTestContext context(10);
+
+		// Act:
+		auto pNode = context.dataSource().get(test::GenerateRandomData<Hash256_Size>());
+
+		// Assert:
+		EXPECT_FALSE(!!pNode);
+
+		auto statistics = context.statistics();
+		EXPECT_EQ(0u, statistics.NumCachedNodes);
+		EXPECT_EQ(0u, statistics.NumHits);
+		EXPECT_EQ(1u, statistics.NumMisses);
+	}
+
+	TEST(TEST_CLASS, SetAddsNodeToNodeCache) {
+		// Arrange:
+		NodeCacheTestContext context(10);
+		auto node = CreateLeafNode(0x12);
+
+		// Act:
+		context.dataSource().set(node);
+		auto pNode = context.dataSource().get(node.hash());
+
+		// Assert:
+		ASSERT_TRUE(!!pNode);
+		EXPECT_EQ(node.hash(), pNode->hash());
+
+		auto statistics = context.statistics();
+		EXPECT_EQ(1u, statistics.NumCachedNodes);
+		EXPECT_EQ(1u, statistics.NumHits);
+		EXPECT_EQ(0u, statistics.NumMisses);
+	}
+
+	TEST(TEST_CLASS, PinPinsConfiguredNumberOfTopLevels) {
+		// Arrange: root -> { branch -> { leaf, leaf }, leaf }
+		NodeCacheTestContext context(10, 2);
+		auto leafNode1 = CreateLeafNode(0x01);
+		auto leafNode2 = CreateLeafNode(0x02);
+		auto leafNode3 = CreateLeafNode(0x03);
+
+		tree::BranchTreeNode childBranchNode(tree::TreeNodePath(0x04));
+		childBranchNode.setLink(leafNode1.hash(), 1);
+		childBranchNode.setLink(leafNode2.hash(), 2);
+
+		tree::BranchTreeNode rootNode(tree::TreeNodePath(0x05));
+		rootNode.setLink(childBranchNode.hash(), 4);
+		rootNode.setLink(leafNode3.hash(), 7);
+
+		for (const auto& leafNode : { leafNode1, leafNode2, leafNode3 })
+			context.dataSource().set(leafNode);
+
+		context.dataSource().set(childBranchNode);
+		context.dataSource().set(rootNode);
+
+		// Act:
+		context.dataSource().pin(rootNode.hash());
+
+		// Assert: root and both of its children are pinned
+		auto statistics = context.statistics();
+		EXPECT_EQ(5u, statistics.NumCachedNodes);
+		EXPECT_EQ(3u, statistics.NumPinnedNodes);
+	}
+
+	// endregion
+
+	// region garbage collection
+
+	namespace {
+		class GarbageTestContext {
+		public:
+			explicit GarbageTestContext(size_t numRetainedRoots)
+					: m_numRetainedRoots(numRetainedRoots)
+					, m_db(DefaultSettings(m_dbDirGuard.name()))
+					, m_container(m_db, 0) {
+				m_container.setSize(0);
+				reload();
+			}
+
+		public:
+			PatriciaTreeRdbDataSource& dataSource() {
+				return *m_pDataSource;
+			}
+
+			bool contains(const Hash256& hash) const {
+				return m_container.cend() != m_container.find(hash);
+			}
+
+		public:
+			// saves a root branch node linking all leaf nodes and collects garbage
+			Hash256 commit(const Hash256& oldRootHash, const std::vector<tree::LeafTreeNode>& leafNodes) {
+				tree::BranchTreeNode rootNode(tree::TreeNodePath(0x05));
+				for (const auto& leafNode : leafNodes) {
+					m_pDataSource->set(leafNode);
+					rootNode.setLink(leafNode.hash(), leafNode.path().nibbleAt(leafNode.path().size() - 1));
+				}
+
+				m_pDataSource->set(rootNode);
+				m_pDataSource->collectGarbage(oldRootHash, rootNode.hash());
+				return rootNode.hash();
+			}
+
+			void reload() {
+				m_pDataSource.reset();
+				m_pDataSource = std::make_unique<PatriciaTreeRdbDataSource>(m_container, tree::TreeNodeCacheOptions(), m_numRetainedRoots);
+			}
+
+		private:
+			size_t m_numRetainedRoots;
+			test::TempDirectoryGuard m_dbDirGuard;
+			RocksDatabase m_db;
+			PatriciaTreeContainer m_container;
+			std::unique_ptr<PatriciaTreeRdbDataSource> m_pDataSource;
+		};
+
+		uint64_t GetStoredSize(const tree::TreeNode& node) {
+			return Hash256_Size + tree::PatriciaTreeSerializer::SerializeValue(node).size();
+		}
+
+		void AssertGarbageStatistics(
+				const PatriciaTreeRdbDataSource& dataSource,
+				size_t numPendingNodes,
+				uint64_t numRemovedNodes,
+				uint64_t numReclaimedBytes) {
+			auto statistics = dataSource.garbageStatistics();
+			EXPECT_EQ(numPendingNodes, statistics.NumPendingNodes);
+			EXPECT_EQ(numRemovedNodes, statistics.NumRemovedNodes);
+			EXPECT_EQ(numReclaimedBytes, statistics.NumReclaimedBytes);
+		}
+	}
+
+	TEST(TEST_CLASS, CollectGarbageHasNoEffectWhenDisabled) {
+		// Arrange:
+		GarbageTestContext context(0);
+		auto leafNode1 = CreateLeafNode(0x01);
+		auto leafNode2 = CreateLeafNode(0x02);
+		auto rootHash1 = context.commit(Hash256(), { leafNode1 });
+
+		// Act:
+		auto rootHash2 = context.commit(rootHash1, { leafNode2 });
+
+		// Assert:
+		for (const auto& hash : { leafNode1.hash(), leafNode2.hash(), rootHash1, rootHash2 })
+			EXPECT_TRUE(context.contains(hash));
+
+		AssertGarbageStatistics(context.dataSource(), 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CollectGarbageRemovesStaleNodesImmediatelyWhenSingleRootIsRetained) {
+		// Arrange:
+		GarbageTestContext context(1);
+		auto leafNode1 = CreateLeafNode(0x01);
+		auto leafNode2 = CreateLeafNode(0x02);
+		auto leafNode3 = CreateLeafNode(0x03);
+		auto rootHash1 = context.commit(Hash256(), { leafNode1, leafNode2 });
+		auto pRootNode1 = context.dataSource().get(rootHash1);
+
+		// Act:
+		auto rootHash2 = context.commit(rootHash1, { leafNode1, leafNode3 });
+
+		// Assert:
+		EXPECT_FALSE(context.contains(rootHash1));
+		EXPECT_FALSE(context.contains(leafNode2.hash()));
+		for (const auto& hash : { leafNode1.hash(), leafNode3.hash(), rootHash2 })
+			EXPECT_TRUE(context.contains(hash));
+
+		auto expectedReclaimedBytes = GetStoredSize(*pRootNode1) + GetStoredSize(tree::TreeNode(leafNode2));
+		AssertGarbageStatistics(context.dataSource(), 0, 2, expectedReclaimedBytes);
+	}
+
+	TEST(TEST_CLASS, CollectGarbageRetainsStaleNodesUntilTheirRootIsNoLongerRetained) {
+		// Arrange:
+		GarbageTestContext context(2);
+		auto leafNode1 = CreateLeafNode(0x01);
+		auto leafNode2 = CreateLeafNode(0x02);
+		auto leafNode3 = CreateLeafNode(0x03);
+		auto leafNode4 = CreateLeafNode(0x04);
+		auto rootHash1 = context.commit(Hash256(), { leafNode1, leafNode2 });
+		auto pRootNode1 = context.dataSource().get(rootHash1);
+		auto rootHash2 = context.commit(rootHash1, { leafNode1, leafNode3 });
+
+		// Sanity: nodes that became stale are still stored
+		EXPECT_TRUE(context.contains(rootHash1));
+		EXPECT_TRUE(context.contains(leafNode2.hash()));
+		AssertGarbageStatistics(context.dataSource(), 2, 0, 0);
+
+		// Act:
+		context.commit(rootHash2, { leafNode1, leafNode4 });
+
+		// Assert: nodes only reachable from the first root are removed
+		EXPECT_FALSE(context.contains(rootHash1));
+		EXPECT_FALSE(context.contains(leafNode2.hash()));
+		EXPECT_TRUE(context.contains(rootHash2));
+		EXPECT_TRUE(context.contains(leafNode3.hash()));
+
+		auto expectedReclaimedBytes = GetStoredSize(*pRootNode1) + GetStoredSize(tree::TreeNode(leafNode2));
+		AssertGarbageStatistics(context.dataSource(), 2, 2, expectedReclaimedBytes);
+	}
+
+	TEST(TEST_CLASS, CollectGarbageDoesNotRemoveStaleNodesThatAreSavedAgain) {
+		// Arrange:
+		GarbageTestContext context(2);
+		auto leafNode1 = CreateLeafNode(0x01);
+		auto leafNode2 = CreateLeafNode(0x02);
+		auto leafNode3 = CreateLeafNode(0x03);
+		auto rootHash1 = context.commit(Hash256(), { leafNode1, leafNode2 });
+		auto rootHash2 = context.commit(rootHash1, { leafNode1, leafNode3 });
+
+		// Act: revert to the first tree
+		context.commit(rootHash2, { leafNode1, leafNode2 });
+
+		// Assert: nodes of the first tree are live again
+		for (const auto& hash : { leafNode1.hash(), leafNode2.hash(), rootHash1, rootHash2, leafNode3.hash() })
+			EXPECT_TRUE(context.contains(hash));
+
+		AssertGarbageStatistics(context.dataSource(), 2, 0, 0);
+	}
+
+	TEST(TEST_CLASS, PendingStaleNodesAreRestoredOnLoad) {
+		// Arrange:
+		GarbageTestContext context(2);
+		auto leafNode1 = CreateLeafNode(0x01);
+		auto leafNode2 = CreateLeafNode(0x02);
+		auto leafNode3 = CreateLeafNode(0x03);
+		auto leafNode4 = CreateLeafNode(0x04);
+		auto rootHash1 = context.commit(Hash256(), { leafNode1, leafNode2 });
+		auto pRootNode1 = context.dataSource().get(rootHash1);
+		auto rootHash2 = context.commit(rootHash1, { leafNode1, leafNode3 });
+
+		// Act:
+		context.reload();
+		auto statistics = context.dataSource().garbageStatistics();
+		context.commit(rootHash2, { leafNode1, leafNode4 });
+
+		// Assert: pending nodes journaled before reload are removed after reload
+		EXPECT_EQ(2u, statistics.NumPendingNodes);
+		EXPECT_FALSE(context.contains(rootHash1));
+		EXPECT_FALSE(context.contains(leafNode2.hash()));
+		EXPECT_TRUE(context.contains(rootHash2));
+
+		auto expectedReclaimedBytes = GetStoredSize(*pRootNode1) + GetStoredSize(tree::TreeNode(leafNode2));
+		AssertGarbageStatistics(context.dataSource(), 2, 2, expectedReclaimedBytes);
+	}
+
+	TEST(TEST_CLASS, SavedAgainStateIsRestoredOnLoad) {
+		// Arrange:
+		GarbageTestContext context(2);
+		auto leafNode1 = CreateLeafNode(0x01);
+		auto leafNode2 = CreateLeafNode(0x02);
+		auto leafNode3 = CreateLeafNode(0x03);
+		auto leafNode4 = CreateLeafNode(0x04);
+		auto rootHash1 = context.commit(Hash256(), { leafNode1, leafNode2 });
+		auto rootHash2 = context.commit(rootHash1, { leafNode1, leafNode3 });
+		context.commit(rootHash2, { leafNode1, leafNode2 });
+
+		// Act: journal rewritten when first tree was reverted must be loaded
+		context.reload();
+		context.commit(rootHash1, { leafNode1, leafNode4 });
+
+		// Assert: nodes of the second tree are removed but reverted nodes of the first tree are not
+		EXPECT_FALSE(context.contains(rootHash2));
+		EXPECT_FALSE(context.contains(leafNode3.hash()));
+		EXPECT_TRUE(context.contains(leafNode1.hash()));
+		EXPECT_TRUE(context.contains(leafNode2.hash()));
+		EXPECT_TRUE(context.contains(rootHash1));
+	}
+
+	// endregion
 }}
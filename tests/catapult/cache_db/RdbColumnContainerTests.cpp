@@ -37,6 +37,10 @@ namespace catapult { namespace cache {
 				RdbColumnContainer::find(key, iterator);
 			}
 
+			void find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				RdbColumnContainer::find(keys, iterators);
+			}
+
 			void insert(const RawBuffer& key, const std::string& value) {
 				RdbColumnContainer::insert(key, value);
 			}
@@ -241,6 +245,28 @@ namespace catapult { namespace cache {
 		test::AssertIteratorValue("world", iter);
 	}
 
+	TEST(TEST_CLASS, BulkFindForwardsToMultiGet) {
+		// Arrange:
+		auto key1 = test::GenerateRandomData<10>();
+		auto key2 = test::GenerateRandomData<10>();
+		auto key3 = test::GenerateRandomData<10>();
+		test::RdbTestContext context(DefaultSettings(), [&key1, &key3](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key1), "hello");
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key3), "world");
+		});
+		TestColumnContainer container(context.database(), 0);
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		container.find({ key1, key2, key3 }, iters);
+
+		// Assert:
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("hello", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("world", iters[2]);
+	}
+
 	TEST(TEST_CLASS, InsertForwardsToPut) {
 		// Arrange:
 		auto key = test::GenerateRandomData<10>();
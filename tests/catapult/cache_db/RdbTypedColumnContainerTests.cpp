@@ -114,6 +114,11 @@ namespace catapult { namespace cache {
 				iterator.setFound(IsKeyFound);
 			}
 
+			void find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				BulkFindKeys.push_back(keys);
+				iterators.resize(keys.size());
+			}
+
 			auto prune(uint64_t pruningBoundary) {
 				PruneParams.push(pruningBoundary);
 				return NumPruned;
@@ -128,6 +133,7 @@ namespace catapult { namespace cache {
 
 			test::ParamsCapture<InsertParamsType> InsertParams;
 			mutable test::ParamsCapture<FindParamsType> FindParams;
+			mutable std::vector<std::vector<RawBuffer>> BulkFindKeys;
 			test::ParamsCapture<PruneParamsType> PruneParams;
 			test::ParamsCapture<RemoveParamsType> RemoveParams;
 		};
@@ -151,6 +157,10 @@ namespace catapult { namespace cache {
 				m_db.find(key, iterator);
 			}
 
+			void find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				m_db.find(keys, iterators);
+			}
+
 			size_t prune(uint64_t pruningBoundary) {
 				return m_db.prune(pruningBoundary);
 			}
@@ -235,6 +245,40 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(&iter.dbIterator(), params.pIterator);
 	}
 
+	TEST(TEST_CLASS, PrefetchWithNoKeysDoesNotForwardToContainer) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+
+		// Act:
+		container.prefetch(std::vector<test::StringKey>());
+
+		// Assert:
+		EXPECT_TRUE(db.BulkFindKeys.empty());
+		EXPECT_TRUE(db.FindParams.params().empty());
+	}
+
+	TEST(TEST_CLASS, PrefetchSerializesKeysAndForwardsToContainer) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+
+		// Act:
+		std::vector<test::StringKey> keys{ test::StringKey("hello"), test::StringKey("world"), test::StringKey("amazing") };
+		container.prefetch(keys);
+
+		// Assert: all keys were forwarded in a single bulk find
+		ASSERT_EQ(1u, db.BulkFindKeys.size());
+		EXPECT_TRUE(db.FindParams.params().empty());
+
+		const auto& bulkKeys = db.BulkFindKeys[0];
+		ASSERT_EQ(3u, bulkKeys.size());
+		for (auto i = 0u; i < keys.size(); ++i) {
+			EXPECT_EQ(test::AsBytePointer(keys[i].data()), bulkKeys[i].pData) << "key at " << i;
+			EXPECT_EQ(keys[i].size(), bulkKeys[i].Size) << "key at " << i;
+		}
+	}
+
 	TEST(TEST_CLASS, PruneExtractsBoundaryFromKeyAndForwardsToContainer) {
 		// Arrange:
 		MockDb db;
@@ -58,6 +58,28 @@ namespace catapult { namespace cache {
 		auto MultiColumnSettings() {
 			return CreateSettings({ "default", "beta", "gamma" });
 		}
+
+		auto ProfiledSettings(const std::vector<RocksColumnProfile>& profiles, const std::shared_ptr<RocksSharedResources>& pResources) {
+			return RocksDatabaseSettings(
+					test::TempDirectoryGuard::DefaultName(),
+					{ "default", "beta", "gamma" },
+					profiles,
+					utils::FileSize(),
+					FilterPruningMode::Disabled,
+					pResources);
+		}
+
+		auto AllProfiles() {
+			return std::vector<RocksColumnProfile>{
+				RocksColumnProfile::Default,
+				RocksColumnProfile::Point_Lookup,
+				RocksColumnProfile::Patricia_Tree
+			};
+		}
+
+		auto CreateSharedResources() {
+			return std::make_shared<RocksSharedResources>(utils::FileSize::FromMegabytes(8), utils::FileSize::FromMegabytes(4));
+		}
 	}
 
 	// region constructor
@@ -122,6 +144,39 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(database.canPrune());
 	}
 
+	TEST(TEST_CLASS, RdbThrowsIfColumnProfilesDoNotMatchColumns) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto profiles = std::vector<RocksColumnProfile>{ RocksColumnProfile::Default, RocksColumnProfile::Point_Lookup };
+
+		// Act + Assert:
+		EXPECT_THROW(RocksDatabase(ProfiledSettings(profiles, nullptr)), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanOpenDatabaseWithColumnProfiles) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+
+		// Act:
+		RocksDatabase database(ProfiledSettings(AllProfiles(), nullptr));
+
+		// Assert:
+		EXPECT_EQ((std::vector<std::string>{ "default", "beta", "gamma" }), database.columnFamilyNames());
+		EXPECT_FALSE(database.canPrune());
+	}
+
+	TEST(TEST_CLASS, CanOpenDatabaseWithColumnProfilesAndSharedResources) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+
+		// Act:
+		RocksDatabase database(ProfiledSettings(AllProfiles(), CreateSharedResources()));
+
+		// Assert:
+		EXPECT_EQ((std::vector<std::string>{ "default", "beta", "gamma" }), database.columnFamilyNames());
+		EXPECT_FALSE(database.canPrune());
+	}
+
 	TEST(TEST_CLASS, CanCreatePlaceholderDatabase) {
 		// Act:
 		RocksDatabase database;
@@ -325,6 +380,72 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region column profiles
+
+	namespace {
+		// use hash-sized keys so that they are in the domain of the patricia tree prefix extractor
+		std::string MakeHashKey(char ch) {
+			return std::string(Hash256_Size, ch);
+		}
+	}
+
+	TEST(TEST_CLASS, CanReadFromDb_ProfiledColumns) {
+		// Arrange:
+		auto key = MakeHashKey('h');
+		test::RdbTestContext context(ProfiledSettings(AllProfiles(), CreateSharedResources()), [&key](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], key, "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[1], key, "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[2], key, "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		auto iters = GetKeyFromColumns(database, key, 3);
+
+		// Assert:
+		test::AssertIteratorValue("amazing", iters[0]);
+		test::AssertIteratorValue("awesome", iters[1]);
+		test::AssertIteratorValue("incredible", iters[2]);
+	}
+
+	TEST(TEST_CLASS, CanWriteToDb_ProfiledColumns) {
+		// Arrange:
+		auto key = MakeHashKey('h');
+		test::RdbTestContext context(ProfiledSettings(AllProfiles(), CreateSharedResources()));
+		auto& database = context.database();
+
+		// Act:
+		database.put(0, key, "amazing");
+		database.put(1, key, "awesome");
+		database.put(2, key, "incredible");
+		database.flush();
+
+		// Assert:
+		auto iters = GetKeyFromColumns(database, key, 3);
+
+		test::AssertIteratorValue("amazing", iters[0]);
+		test::AssertIteratorValue("awesome", iters[1]);
+		test::AssertIteratorValue("incredible", iters[2]);
+	}
+
+	TEST(TEST_CLASS, ReadingNonExistentKeyFromProfiledColumnsReturnsSentinelValue) {
+		// Arrange:
+		test::RdbTestContext context(ProfiledSettings(AllProfiles(), CreateSharedResources()), [](auto& db, const auto& columns) {
+			for (auto* pColumn : columns)
+				db.Put(rocksdb::WriteOptions(), pColumn, MakeHashKey('h'), "amazing");
+		});
+		auto& database = context.database();
+
+		// Act:
+		auto iters = GetKeyFromColumns(database, MakeHashKey('x'), 3);
+
+		// Assert:
+		for (const auto& iter : iters)
+			EXPECT_EQ(RdbDataIterator::End(), iter);
+	}
+
+	// endregion
+
 	// region multiple values
 
 	TEST(TEST_CLASS, CanReadFromDb_MultipleValues) {
@@ -392,6 +513,103 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region multiGet
+
+	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowMultiGet) {
+		// Arrange:
+		RocksDatabase database;
+
+		// Act + Assert:
+		std::vector<RdbDataIterator> iters;
+		EXPECT_THROW(database.multiGet(0, { "hello" }, iters), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, MultiGetWithNoKeysReturnsNoResults) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings());
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters(3);
+		database.multiGet(0, {}, iters);
+
+		// Assert:
+		EXPECT_TRUE(iters.empty());
+	}
+
+	TEST(TEST_CLASS, CanMultiGetFromDb_DefaultColumn) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "world", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[0], "apple", "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "world", "nonexistent", "hello" }, iters);
+
+		// Assert:
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("amazing", iters[2]);
+	}
+
+	TEST(TEST_CLASS, CanMultiGetFromDb_DifferentColumns) {
+		// Arrange:
+		test::RdbTestContext context(MultiColumnSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[1], "hello", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[1], "world", "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(1, { "hello", "world" }, iters);
+
+		// Assert:
+		ASSERT_EQ(2u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		test::AssertIteratorValue("incredible", iters[1]);
+	}
+
+	TEST(TEST_CLASS, MultiGetReturnsSameValuesAsGet) {
+		// Arrange:
+		test::RdbTestContext context(ProfiledSettings(AllProfiles(), CreateSharedResources()));
+		auto& database = context.database();
+		std::vector<std::string> keys;
+		for (auto i = 0u; i < 20; ++i) {
+			keys.push_back("key" + std::to_string(i));
+			if (0 == i % 3)
+				database.put(2, keys.back(), "value" + std::to_string(i));
+		}
+
+		database.flush();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(2, std::vector<rocksdb::Slice>(keys.cbegin(), keys.cend()), iters);
+
+		// Assert:
+		ASSERT_EQ(keys.size(), iters.size());
+		for (auto i = 0u; i < keys.size(); ++i) {
+			RdbDataIterator iter;
+			database.get(2, keys[i], iter);
+
+			if (0 == i % 3)
+				test::AssertIteratorValue("value" + std::to_string(i), iters[i]);
+			else
+				EXPECT_EQ(RdbDataIterator::End(), iters[i]) << "key " << keys[i];
+
+			EXPECT_EQ(iter, iters[i]) << "key " << keys[i];
+		}
+	}
+
+	// endregion
+
 	// region iterators
 
 	namespace {
@@ -0,0 +1,130 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/RocksSharedResources.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "tests/catapult/cache_db/test/RdbTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS RocksSharedResourcesTests
+
+	namespace {
+		RocksDatabaseSettings CreateSettings(const std::string& directory, const std::shared_ptr<RocksSharedResources>& pResources) {
+			return RocksDatabaseSettings(
+					directory,
+					{ "default" },
+					{ RocksColumnProfile::Point_Lookup },
+					utils::FileSize(),
+					FilterPruningMode::Disabled,
+					pResources);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateResourcesWithSharedBlockCacheAndWriteBufferBudget) {
+		// Act:
+		RocksSharedResources resources(utils::FileSize::FromMegabytes(8), utils::FileSize::FromMegabytes(4));
+
+		// Assert:
+		EXPECT_TRUE(!!resources.blockCache());
+		EXPECT_EQ(utils::FileSize::FromMegabytes(8), resources.blockCacheCapacity());
+	}
+
+	TEST(TEST_CLASS, CanCreateResourcesWithoutSharedBlockCacheAndWriteBufferBudget) {
+		// Act:
+		RocksSharedResources resources(utils::FileSize(), utils::FileSize());
+
+		// Assert:
+		EXPECT_FALSE(!!resources.blockCache());
+		EXPECT_EQ(utils::FileSize(), resources.blockCacheCapacity());
+		EXPECT_EQ(utils::FileSize(), resources.blockCacheUsage());
+		EXPECT_EQ(utils::FileSize(), resources.writeBufferUsage());
+	}
+
+	TEST(TEST_CLASS, StatisticsAreInitiallyZero) {
+		// Act:
+		RocksSharedResources resources(utils::FileSize::FromMegabytes(8), utils::FileSize::FromMegabytes(4));
+
+		// Assert:
+		for (auto statistic : {
+			RocksStatistic::Block_Cache_Hit,
+			RocksStatistic::Block_Cache_Miss,
+			RocksStatistic::Bloom_Filter_Useful,
+			RocksStatistic::Memtable_Hit,
+			RocksStatistic::Memtable_Miss,
+			RocksStatistic::Bytes_Read,
+			RocksStatistic::Bytes_Written
+		}) {
+			EXPECT_EQ(0u, resources.statistic(statistic)) << static_cast<uint16_t>(statistic);
+		}
+	}
+
+	// endregion
+
+	// region sharing
+
+	TEST(TEST_CLASS, StatisticsAreAccumulatedAcrossDatabases) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard1("db1");
+		test::TempDirectoryGuard dbDirGuard2("db2");
+		auto pResources = std::make_shared<RocksSharedResources>(utils::FileSize::FromMegabytes(8), utils::FileSize::FromMegabytes(4));
+		RocksDatabase database1(CreateSettings(dbDirGuard1.name(), pResources));
+		RocksDatabase database2(CreateSettings(dbDirGuard2.name(), pResources));
+
+		database1.put(0, "alpha", "amazing");
+		database1.flush();
+		database2.put(0, "beta", "awesome");
+		database2.flush();
+
+		// Act:
+		RdbDataIterator iter1;
+		database1.get(0, "alpha", iter1);
+		RdbDataIterator iter2;
+		database2.get(0, "beta", iter2);
+		RdbDataIterator iter3;
+		database2.get(0, "gamma", iter3);
+
+		// Assert:
+		EXPECT_EQ(2u, pResources->statistic(RocksStatistic::Memtable_Hit));
+		EXPECT_EQ(1u, pResources->statistic(RocksStatistic::Memtable_Miss));
+	}
+
+	TEST(TEST_CLASS, WriteBufferUsageIsAccumulatedAcrossDatabases) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard1("db1");
+		test::TempDirectoryGuard dbDirGuard2("db2");
+		auto pResources = std::make_shared<RocksSharedResources>(utils::FileSize::FromMegabytes(8), utils::FileSize::FromMegabytes(4));
+		RocksDatabase database1(CreateSettings(dbDirGuard1.name(), pResources));
+		auto usageWithOneDatabase = pResources->writeBufferUsage();
+
+		// Act:
+		RocksDatabase database2(CreateSettings(dbDirGuard2.name(), pResources));
+		auto usageWithTwoDatabases = pResources->writeBufferUsage();
+
+		// Assert: memtables of both databases are charged against the shared budget
+		EXPECT_LT(utils::FileSize(), usageWithOneDatabase);
+		EXPECT_LT(usageWithOneDatabase, usageWithTwoDatabases);
+	}
+
+	// endregion
+}}
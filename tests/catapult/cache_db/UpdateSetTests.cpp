@@ -231,4 +231,48 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
-}}
+
+	// region prefetch set
+
+	namespace {
+		struct PrefetchColumnDescriptor {
+		public:
+			using KeyType = test::StringKey;
+			using ValueType = int;
+			using StorageType = int;
+		};
+
+		struct PrefetchMockContainer {
+		public:
+			PrefetchMockContainer(std::vector<std::vector<RawBuffer>>& bulkFindKeys, size_t) : m_bulkFindKeys(bulkFindKeys)
+			{}
+
+		public:
+			void find(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				m_bulkFindKeys.push_back(keys);
+				iterators.resize(keys.size());
+			}
+
+		private:
+			std::vector<std::vector<RawBuffer>>& m_bulkFindKeys;
+		};
+	}
+
+	TEST(TEST_CLASS, PrefetchSetForwardsToStorage) {
+		// Arrange:
+		std::vector<std::vector<RawBuffer>> bulkFindKeys;
+		RdbTypedColumnContainer<PrefetchColumnDescriptor, PrefetchMockContainer> container(bulkFindKeys, 0);
+
+		// Act:
+		std::vector<test::StringKey> keys{ test::StringKey("alpha"), test::StringKey("beta") };
+		PrefetchSet(container, keys);
+
+		// Assert: all keys were forwarded to storage in a single bulk find
+		ASSERT_EQ(1u, bulkFindKeys.size());
+		ASSERT_EQ(2u, bulkFindKeys[0].size());
+		EXPECT_EQ(test::AsBytePointer(keys[0].data()), bulkFindKeys[0][0].pData);
+		EXPECT_EQ(test::AsBytePointer(keys[1].data()), bulkFindKeys[0][1].pData);
+	}
+
+	// endregion
+}}
\ No newline at end of file
@@ -0,0 +1,336 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/chain/BlockDownloadScheduler.h"
+#include "catapult/model/Block.h"
+#include "catapult/model/EntityRange.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS BlockDownloadSchedulerTests
+
+	namespace {
+		model::BlockRange CreateBlockRange(Height startHeight, uint32_t numBlocks) {
+			std::vector<std::unique_ptr<model::Block>> blocks;
+			std::vector<const model::Block*> rawBlocks;
+			for (auto i = 0u; i < numBlocks; ++i) {
+				blocks.push_back(test::GenerateBlockWithTransactionsAtHeight(startHeight + Height(i)));
+				rawBlocks.push_back(blocks.back().get());
+			}
+
+			return test::CreateEntityRange(rawBlocks);
+		}
+
+		BlockDownloadRequest NextRequest(BlockDownloadScheduler& scheduler, size_t peerId) {
+			BlockDownloadRequest request;
+			EXPECT_TRUE(scheduler.tryNext(peerId, request));
+			return request;
+		}
+
+		bool Complete(BlockDownloadScheduler& scheduler, size_t peerId, const BlockDownloadRequest& request) {
+			return scheduler.complete(peerId, request, CreateBlockRange(request.StartHeight, request.NumBlocks));
+		}
+
+		void AssertRequest(Height expectedStartHeight, uint32_t expectedNumBlocks, const BlockDownloadRequest& request) {
+			EXPECT_EQ(expectedStartHeight, request.StartHeight);
+			EXPECT_EQ(expectedNumBlocks, request.NumBlocks);
+		}
+
+		void AssertRanges(const std::vector<std::pair<Height, size_t>>& expectedRanges, const std::vector<model::BlockRange>& ranges) {
+			ASSERT_EQ(expectedRanges.size(), ranges.size());
+
+			for (auto i = 0u; i < ranges.size(); ++i) {
+				const auto& range = ranges[i];
+				ASSERT_EQ(expectedRanges[i].second, range.size()) << "range at " << i;
+				EXPECT_EQ(expectedRanges[i].first, range.cbegin()->Height) << "range at " << i;
+			}
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateScheduler) {
+		// Act:
+		BlockDownloadScheduler scheduler(Height(11), 25, 10);
+
+		// Assert:
+		EXPECT_EQ(Height(11), scheduler.nextHeight());
+		EXPECT_FALSE(scheduler.isComplete());
+		EXPECT_TRUE(scheduler.takeReadyRanges().empty());
+	}
+
+	TEST(TEST_CLASS, SchedulerWithoutBlocksIsComplete) {
+		// Act:
+		BlockDownloadScheduler scheduler(Height(11), 0, 10);
+
+		// Assert:
+		EXPECT_EQ(Height(11), scheduler.nextHeight());
+		EXPECT_TRUE(scheduler.isComplete());
+
+		BlockDownloadRequest request;
+		EXPECT_FALSE(scheduler.tryNext(0, request));
+	}
+
+	// endregion
+
+	// region tryNext
+
+	TEST(TEST_CLASS, TryNextSplitsHeightRangeIntoRequests) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 25, 10);
+
+		// Act:
+		auto request1 = NextRequest(scheduler, 0);
+		auto request2 = NextRequest(scheduler, 1);
+		auto request3 = NextRequest(scheduler, 2);
+
+		// Assert:
+		AssertRequest(Height(11), 10, request1);
+		AssertRequest(Height(21), 10, request2);
+		AssertRequest(Height(31), 5, request3);
+	}
+
+	TEST(TEST_CLASS, TryNextDuplicatesLowestOutstandingRequestWhenAllRequestsAreAssigned) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 20, 10);
+		NextRequest(scheduler, 0);
+		NextRequest(scheduler, 1);
+
+		// Act: peer 1 is assigned the request of the (slower) peer 0
+		auto request = NextRequest(scheduler, 1);
+
+		// Assert:
+		AssertRequest(Height(11), 10, request);
+	}
+
+	TEST(TEST_CLASS, TryNextDoesNotDuplicateRequestsMoreThanOnce) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 10, 10);
+		NextRequest(scheduler, 0);
+		NextRequest(scheduler, 1);
+
+		// Act:
+		BlockDownloadRequest request;
+		auto result0 = scheduler.tryNext(0, request);
+		auto result2 = scheduler.tryNext(2, request);
+
+		// Assert:
+		EXPECT_FALSE(result0);
+		EXPECT_FALSE(result2);
+	}
+
+	TEST(TEST_CLASS, TryNextDoesNotAssignCompletedRequests) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 10, 10);
+		Complete(scheduler, 0, NextRequest(scheduler, 0));
+
+		// Act:
+		BlockDownloadRequest request;
+		auto result = scheduler.tryNext(1, request);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_TRUE(scheduler.isComplete());
+	}
+
+	// endregion
+
+	// region complete / takeReadyRanges
+
+	TEST(TEST_CLASS, CompletedRangesAreReadyInHeightOrder) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 25, 10);
+		auto request1 = NextRequest(scheduler, 0);
+		auto request2 = NextRequest(scheduler, 1);
+		auto request3 = NextRequest(scheduler, 2);
+
+		// Act + Assert: out of order responses are held back until all lower blocks are available
+		EXPECT_TRUE(Complete(scheduler, 2, request3));
+		EXPECT_TRUE(scheduler.takeReadyRanges().empty());
+
+		EXPECT_TRUE(Complete(scheduler, 0, request1));
+		AssertRanges({ { Height(11), 10 } }, scheduler.takeReadyRanges());
+		EXPECT_EQ(Height(21), scheduler.nextHeight());
+		EXPECT_FALSE(scheduler.isComplete());
+
+		EXPECT_TRUE(Complete(scheduler, 1, request2));
+		AssertRanges({ { Height(21), 10 }, { Height(31), 5 } }, scheduler.takeReadyRanges());
+		EXPECT_EQ(Height(36), scheduler.nextHeight());
+		EXPECT_TRUE(scheduler.isComplete());
+	}
+
+	TEST(TEST_CLASS, PartialResponseSchedulesRemainingBlocks) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 10, 10);
+		auto request = NextRequest(scheduler, 0);
+
+		// Act:
+		auto result = scheduler.complete(0, request, CreateBlockRange(Height(11), 4));
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_FALSE(scheduler.isComplete());
+		AssertRanges({ { Height(11), 4 } }, scheduler.takeReadyRanges());
+		AssertRequest(Height(15), 6, NextRequest(scheduler, 1));
+	}
+
+	TEST(TEST_CLASS, EmptyResponseFromAuthoritativePeerEndsDownload) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 30, 10);
+		auto request1 = NextRequest(scheduler, 1);
+		auto request2 = NextRequest(scheduler, 0);
+		auto request3 = NextRequest(scheduler, 2);
+		EXPECT_TRUE(Complete(scheduler, 2, request3));
+
+		// Act:
+		auto result = scheduler.complete(0, request2, model::BlockRange());
+		Complete(scheduler, 1, request1);
+
+		// Assert: all blocks at and above the empty response are discarded
+		EXPECT_TRUE(result);
+		EXPECT_TRUE(scheduler.isComplete());
+		AssertRanges({ { Height(11), 10 } }, scheduler.takeReadyRanges());
+	}
+
+	TEST(TEST_CLASS, EmptyResponseFromOtherPeerIsRejected) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 10, 10);
+		auto request = NextRequest(scheduler, 1);
+
+		// Act:
+		auto result = scheduler.complete(1, request, model::BlockRange());
+
+		// Assert: the request can be reassigned
+		EXPECT_FALSE(result);
+		EXPECT_FALSE(scheduler.isComplete());
+		AssertRequest(Height(11), 10, NextRequest(scheduler, 0));
+	}
+
+	namespace {
+		void AssertInvalidResponseIsRejected(Height startHeight, uint32_t numBlocks) {
+			// Arrange:
+			BlockDownloadScheduler scheduler(Height(11), 10, 10);
+			auto request = NextRequest(scheduler, 0);
+
+			// Act:
+			auto result = scheduler.complete(0, request, CreateBlockRange(startHeight, numBlocks));
+
+			// Assert: the request can be reassigned
+			EXPECT_FALSE(result);
+			EXPECT_FALSE(scheduler.isComplete());
+			EXPECT_TRUE(scheduler.takeReadyRanges().empty());
+			AssertRequest(Height(11), 10, NextRequest(scheduler, 1));
+		}
+	}
+
+	TEST(TEST_CLASS, ResponseStartingAtWrongHeightIsRejected) {
+		// Assert:
+		AssertInvalidResponseIsRejected(Height(12), 5);
+	}
+
+	TEST(TEST_CLASS, ResponseWithTooManyBlocksIsRejected) {
+		// Assert:
+		AssertInvalidResponseIsRejected(Height(11), 11);
+	}
+
+	TEST(TEST_CLASS, ResponseWithNonContiguousBlocksIsRejected) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 10, 10);
+		auto request = NextRequest(scheduler, 0);
+
+		auto pBlock1 = test::GenerateBlockWithTransactionsAtHeight(Height(11));
+		auto pBlock2 = test::GenerateBlockWithTransactionsAtHeight(Height(13));
+		auto range = test::CreateEntityRange(std::vector<const model::Block*>{ pBlock1.get(), pBlock2.get() });
+
+		// Act:
+		auto result = scheduler.complete(0, request, std::move(range));
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_TRUE(scheduler.takeReadyRanges().empty());
+	}
+
+	TEST(TEST_CLASS, FirstResponseToDuplicatedRequestIsUsed) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 10, 10);
+		auto request = NextRequest(scheduler, 0);
+		NextRequest(scheduler, 1);
+
+		// Act:
+		auto result1 = scheduler.complete(1, request, CreateBlockRange(Height(11), 10));
+		auto result2 = scheduler.complete(0, request, CreateBlockRange(Height(11), 3));
+
+		// Assert:
+		EXPECT_TRUE(result1);
+		EXPECT_TRUE(result2);
+		AssertRanges({ { Height(11), 10 } }, scheduler.takeReadyRanges());
+	}
+
+	TEST(TEST_CLASS, ResponseFromUnassignedPeerIsIgnored) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 10, 10);
+		auto request = NextRequest(scheduler, 0);
+
+		// Act:
+		auto result = Complete(scheduler, 1, request);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_FALSE(scheduler.isComplete());
+		EXPECT_TRUE(scheduler.takeReadyRanges().empty());
+	}
+
+	// endregion
+
+	// region fail
+
+	TEST(TEST_CLASS, FailedRequestCanBeReassigned) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 20, 10);
+		auto request1 = NextRequest(scheduler, 0);
+		NextRequest(scheduler, 1);
+
+		// Act:
+		scheduler.fail(0, request1);
+
+		// Assert:
+		AssertRequest(Height(11), 10, NextRequest(scheduler, 2));
+	}
+
+	TEST(TEST_CLASS, FailedDuplicatedRequestIsStillAssignedToOtherPeer) {
+		// Arrange:
+		BlockDownloadScheduler scheduler(Height(11), 10, 10);
+		auto request = NextRequest(scheduler, 0);
+		NextRequest(scheduler, 1);
+
+		// Act:
+		scheduler.fail(1, request);
+
+		// Assert: the request is assigned to peer 0 and can only be duplicated
+		AssertRequest(Height(11), 10, NextRequest(scheduler, 2));
+
+		BlockDownloadRequest otherRequest;
+		EXPECT_FALSE(scheduler.tryNext(3, otherRequest));
+	}
+
+	// endregion
+}}
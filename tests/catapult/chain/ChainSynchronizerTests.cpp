@@ -24,6 +24,7 @@
 #include "catapult/model/BlockUtils.h"
 #include "catapult/model/ChainScore.h"
 #include "catapult/model/EntityRange.h"
+#include "catapult/utils/StackTimer.h"
 #include "tests/catapult/chain/test/MockChainApi.h"
 #include "tests/test/core/HashTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
@@ -677,4 +678,211 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region parallel download
+
+	namespace {
+		class ParallelTestContext {
+		public:
+			explicit ParallelTestContext(size_t numHelpers) : m_context(CreateDefaultTestContext(9, 10)) {
+				// each peer returns exactly the requested number of blocks (MaxBlocksPerSyncAttempt)
+				m_context.pChainApi->setNumBlocksPerBlocksFromRequest({ 5 });
+				for (auto i = 0u; i < numHelpers; ++i) {
+					auto pHelperChainApi = std::make_shared<MockChainApi>(ChainScore(11), Default_Height);
+					pHelperChainApi->setNumBlocksPerBlocksFromRequest({ 5 });
+					m_helperChainApis.push_back(pHelperChainApi);
+				}
+			}
+
+		public:
+			MockChainApi& chainApi() {
+				return *m_context.pChainApi;
+			}
+
+			MockChainApi& helperChainApi(size_t index) {
+				return *m_helperChainApis[index];
+			}
+
+			const std::vector<Height>& consumedHeights() const {
+				return m_consumedHeights;
+			}
+
+			const TestContext& context() const {
+				return m_context;
+			}
+
+		public:
+			auto synchronize() {
+				auto pLocal = std::make_shared<MockChainApi>(
+						m_context.LocalScore,
+						test::GenerateVerifiableBlockAtHeight(Default_Height),
+						m_context.LocalHashes);
+
+				auto helperChainApisSupplier = [helperChainApis = m_helperChainApis]() {
+					return std::vector<std::shared_ptr<const api::RemoteChainApi>>(helperChainApis.cbegin(), helperChainApis.cend());
+				};
+
+				auto blockRangeConsumer = [this](const auto& range, const auto&) {
+					++m_context.BlockRangeConsumerCalls;
+					m_context.BlockRangeSourcePublicKeys.push_back(range.SourcePublicKey);
+					for (const auto& block : range.Range)
+						m_consumedHeights.push_back(block.Height);
+
+					return m_context.BlockRangeConsumerCalls;
+				};
+
+				auto synchronizer = CreateChainSynchronizer(pLocal, m_context.Config, helperChainApisSupplier, blockRangeConsumer);
+				return synchronizer(*m_context.pChainApi).get();
+			}
+
+		private:
+			TestContext m_context;
+			std::vector<std::shared_ptr<MockChainApi>> m_helperChainApis;
+			std::vector<Height> m_consumedHeights;
+		};
+
+		std::vector<Height> GenerateHeights(Height startHeight, size_t count) {
+			std::vector<Height> heights;
+			for (auto i = 0u; i < count; ++i)
+				heights.push_back(startHeight + Height(i));
+
+			return heights;
+		}
+
+		void AssertFirstRequestHeight(const MockChainApi& chainApi, Height expectedHeight) {
+			ASSERT_LE(1u, chainApi.blocksFromRequests().size());
+			const auto& params = chainApi.blocksFromRequests()[0];
+			EXPECT_EQ(expectedHeight, params.first);
+			EXPECT_EQ(5u, params.second.NumBlocks);
+			EXPECT_EQ(23u, params.second.NumBytes);
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadSplitsBlocksAcrossAllPeers) {
+		// Arrange:
+		ParallelTestContext context(2);
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert: each peer is initially assigned a different batch of blocks
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertFirstRequestHeight(context.chainApi(), Default_Height);
+		AssertFirstRequestHeight(context.helperChainApi(0), Default_Height + Height(5));
+		AssertFirstRequestHeight(context.helperChainApi(1), Default_Height + Height(10));
+
+		// - all blocks are forwarded in order as a single range attributed to the synchronizing peer
+		AssertSync(context.context(), 1);
+		EXPECT_EQ(GenerateHeights(Default_Height, 15), context.consumedHeights());
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadReassignsBlocksOfFailedPeer) {
+		// Arrange:
+		ParallelTestContext context(2);
+		context.helperChainApi(0).setError(MockChainApi::EntryPoint::Blocks_From);
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(1u, context.helperChainApi(0).blocksFromRequests().size());
+
+		AssertSync(context.context(), 1);
+		EXPECT_EQ(GenerateHeights(Default_Height, 15), context.consumedHeights());
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadReassignsBlocksOfPeerWithoutBlocks) {
+		// Arrange: the helper does not have the requested blocks
+		ParallelTestContext context(2);
+		context.helperChainApi(1).setNumBlocksPerBlocksFromRequest({ 0 });
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(1u, context.helperChainApi(1).blocksFromRequests().size());
+
+		AssertSync(context.context(), 1);
+		EXPECT_EQ(GenerateHeights(Default_Height, 15), context.consumedHeights());
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadDoesNotWaitForSlowPeer) {
+		// Arrange:
+		constexpr auto Delay_Millis = 2'000u;
+		ParallelTestContext context(2);
+		context.helperChainApi(1).setDelay(utils::TimeSpan::FromMilliseconds(Delay_Millis));
+
+		// Act:
+		utils::StackTimer stackTimer;
+		auto code = context.synchronize();
+		auto elapsedMillis = stackTimer.millis();
+
+		// Assert: the blocks assigned to the slow peer were requested from a different peer
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_GT(Delay_Millis, elapsedMillis);
+
+		AssertSync(context.context(), 1);
+		EXPECT_EQ(GenerateHeights(Default_Height, 15), context.consumedHeights());
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadCanUseSlowPeers) {
+		// Arrange: all peers are slow, so every peer contributes blocks
+		ParallelTestContext context(2);
+		context.chainApi().setDelay(utils::TimeSpan::FromMilliseconds(20));
+		context.helperChainApi(0).setDelay(utils::TimeSpan::FromMilliseconds(20));
+		context.helperChainApi(1).setDelay(utils::TimeSpan::FromMilliseconds(20));
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context.context(), 1);
+		EXPECT_EQ(GenerateHeights(Default_Height, 15), context.consumedHeights());
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadStopsAtEndOfRemoteChain) {
+		// Arrange: the synchronizing peer only has a single batch of blocks
+		ParallelTestContext context(1);
+		context.chainApi().setNumBlocksPerBlocksFromRequest({ 5, 0 });
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert: blocks above the end of the remote chain are ignored
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context.context(), 1);
+		EXPECT_EQ(GenerateHeights(Default_Height, 5), context.consumedHeights());
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadFailsWhenSynchronizingPeerFails) {
+		// Arrange:
+		ParallelTestContext context(2);
+		context.chainApi().setError(MockChainApi::EntryPoint::Blocks_From);
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		context.context().assertNoCalls();
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadIsBypassedWhenNoHelpersAreSupplied) {
+		// Arrange:
+		ParallelTestContext context(0);
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert: a single batch is pulled (as without parallel download)
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertSync(context.context(), 1);
+		EXPECT_EQ(GenerateHeights(Default_Height, 5), context.consumedHeights());
+		AssertDefaultSinglePullRequest(context.chainApi());
+	}
+
+	// endregion
 }}
@@ -0,0 +1,153 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/chain/StatePrefetcher.h"
+#include "catapult/cache/CatapultCacheBuilder.h"
+#include "tests/test/cache/SimpleCache.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/other/MockExecutionConfiguration.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS StatePrefetcherTests
+
+	namespace {
+		cache::CatapultCache CreateSimpleCatapultCache() {
+			cache::CatapultCacheBuilder builder;
+			builder.add<test::SimpleCacheStorageTraits>(std::make_unique<test::SimpleCacheT<2>>());
+			return builder.build();
+		}
+
+		class PrefetcherTestContext {
+		public:
+			PrefetcherTestContext()
+					: m_cache(CreateSimpleCatapultCache())
+					, m_numExtractorCalls(0) {
+				// simple cache does not contain the marker account, so use default resolvers
+				m_executionConfig.Config.ResolverContextFactory = [](const auto&) {
+					return model::ResolverContext();
+				};
+			}
+
+		public:
+			size_t numExtractorCalls() const {
+				return m_numExtractorCalls;
+			}
+
+			size_t numPublisherCalls() const {
+				return m_executionConfig.pNotificationPublisher->params().size();
+			}
+
+		public:
+			void setExtractor(size_t numAddressesPerNotification) {
+				m_executionConfig.Config.PrefetchKeysExtractor = [this, numAddressesPerNotification](
+						const auto& notification,
+						const auto&,
+						auto& keys) {
+					EXPECT_EQ(static_cast<model::NotificationType>(-1), notification.Type);
+					++m_numExtractorCalls;
+					for (auto i = 0u; i < numAddressesPerNotification; ++i)
+						keys.Addresses.insert(test::GenerateRandomAddress());
+				};
+			}
+
+			size_t prefetch(const model::WeakEntityInfos& entityInfos) {
+				auto prefetcher = CreateStatePrefetcher(m_executionConfig.Config);
+				auto delta = m_cache.createDelta();
+				prefetcher(entityInfos, delta);
+				return delta.sub<test::SimpleCacheT<2>>().numPrefetchedAddresses();
+			}
+
+		private:
+			test::MockExecutionConfiguration m_executionConfig;
+			cache::CatapultCache m_cache;
+			size_t m_numExtractorCalls;
+		};
+
+		model::WeakEntityInfos CreateEntityInfos(const model::Block& block) {
+			// use the entity itself as its fake hash since it will be alive
+			model::WeakEntityInfos entityInfos;
+			for (const auto& tx : block.Transactions())
+				entityInfos.push_back(model::WeakEntityInfo(tx, reinterpret_cast<const Hash256&>(tx)));
+
+			entityInfos.push_back(model::WeakEntityInfo(block, reinterpret_cast<const Hash256&>(block)));
+			return entityInfos;
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetcherIsNoOpWhenExtractorIsNotSet) {
+		// Arrange:
+		PrefetcherTestContext context;
+		auto pBlock = test::GenerateBlockWithTransactions(3);
+
+		// Act:
+		auto numPrefetchedAddresses = context.prefetch(CreateEntityInfos(*pBlock));
+
+		// Assert: no notifications were published
+		EXPECT_EQ(0u, context.numPublisherCalls());
+		EXPECT_EQ(0u, numPrefetchedAddresses);
+	}
+
+	TEST(TEST_CLASS, PrefetcherIsNoOpWhenThereAreNoEntities) {
+		// Arrange:
+		PrefetcherTestContext context;
+		context.setExtractor(2);
+
+		// Act:
+		auto numPrefetchedAddresses = context.prefetch({});
+
+		// Assert:
+		EXPECT_EQ(0u, context.numPublisherCalls());
+		EXPECT_EQ(0u, context.numExtractorCalls());
+		EXPECT_EQ(0u, numPrefetchedAddresses);
+	}
+
+	TEST(TEST_CLASS, PrefetcherDoesNotPrefetchWhenNoKeysAreExtracted) {
+		// Arrange:
+		PrefetcherTestContext context;
+		context.setExtractor(0);
+		auto pBlock = test::GenerateBlockWithTransactions(3);
+
+		// Act:
+		auto numPrefetchedAddresses = context.prefetch(CreateEntityInfos(*pBlock));
+
+		// Assert: each entity produces two notifications
+		EXPECT_EQ(4u, context.numPublisherCalls());
+		EXPECT_EQ(8u, context.numExtractorCalls());
+		EXPECT_EQ(0u, numPrefetchedAddresses);
+	}
+
+	TEST(TEST_CLASS, PrefetcherPrefetchesKeysExtractedFromAllNotifications) {
+		// Arrange:
+		PrefetcherTestContext context;
+		context.setExtractor(2);
+		auto pBlock = test::GenerateBlockWithTransactions(3);
+
+		// Act:
+		auto numPrefetchedAddresses = context.prefetch(CreateEntityInfos(*pBlock));
+
+		// Assert: each entity produces two notifications and each notification produces two addresses
+		EXPECT_EQ(4u, context.numPublisherCalls());
+		EXPECT_EQ(8u, context.numExtractorCalls());
+		EXPECT_EQ(16u, numPrefetchedAddresses);
+	}
+}}
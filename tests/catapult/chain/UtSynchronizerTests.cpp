@@ -92,4 +92,180 @@ namespace catapult { namespace chain {
 	}
 
 	DEFINE_ENTITIES_SYNCHRONIZER_TESTS(UtSynchronizer)
+
+	// region sketch synchronizer
+
+	namespace {
+		// few short hashes are always sent directly, so the sketch synchronizer should pass all basic tests
+		class UtSketchSynchronizerTraits : public UtSynchronizerTraits {
+		public:
+			static auto CreateSynchronizer(
+					const ShortHashesSupplier& shortHashesSupplier,
+					const handlers::TransactionRangeHandler& transactionRangeConsumer) {
+				return CreateUtSketchSynchronizer(BlockFeeMultiplier(17), shortHashesSupplier, transactionRangeConsumer);
+			}
+		};
+	}
+
+	DEFINE_ENTITIES_SYNCHRONIZER_TESTS(UtSketchSynchronizer)
+
+#define TEST_CLASS UtSketchSynchronizerTests
+
+	namespace {
+		constexpr uint32_t Num_Many_Short_Hashes = 100'000;
+
+		class SketchTestContext {
+		public:
+			explicit SketchTestContext(uint32_t numShortHashes, uint32_t numTransactions = 3)
+					: m_shortHashes(test::GenerateRandomDataVector<utils::ShortHash>(numShortHashes))
+					, m_pTransactionApi(std::make_unique<MockRemoteApi>(test::CreateTransactionEntityRange(numTransactions)))
+					, m_numConsumedTransactions(0)
+					, m_synchronizer(CreateUtSketchSynchronizer(
+							BlockFeeMultiplier(17),
+							[this]() {
+								const auto* pShortHashData = reinterpret_cast<const uint8_t*>(m_shortHashes.data());
+								return model::ShortHashRange::CopyFixed(pShortHashData, m_shortHashes.size());
+							},
+							[this](auto&& range) {
+								m_numConsumedTransactions += range.Range.size();
+							}))
+			{}
+
+		public:
+			auto& api() {
+				return *m_pTransactionApi;
+			}
+
+			const auto& api() const {
+				return *m_pTransactionApi;
+			}
+
+			auto numConsumedTransactions() const {
+				return m_numConsumedTransactions;
+			}
+
+			utils::ShortHashSketch createExpectedSketch(size_t numCells) const {
+				utils::ShortHashSketch sketch(numCells);
+				for (const auto& shortHash : utils::ShortHashesSet(m_shortHashes.cbegin(), m_shortHashes.cend()))
+					sketch.insert(shortHash);
+
+				return sketch;
+			}
+
+		public:
+			auto synchronize() {
+				return m_synchronizer(*m_pTransactionApi).get();
+			}
+
+		private:
+			std::vector<utils::ShortHash> m_shortHashes;
+			std::unique_ptr<MockRemoteApi> m_pTransactionApi;
+			size_t m_numConsumedTransactions;
+			RemoteNodeSynchronizer<api::RemoteTransactionApi> m_synchronizer;
+		};
+
+		size_t GetSketchRequestSize(const SketchTestContext& context, size_t index) {
+			return context.api().utSketchRequests()[index].second.size();
+		}
+	}
+
+	TEST(TEST_CLASS, SketchIsSentWhenSmallerThanShortHashes) {
+		// Arrange:
+		SketchTestContext context(Num_Many_Short_Hashes);
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(3u, context.numConsumedTransactions());
+
+		EXPECT_EQ(0u, context.api().utRequests().size());
+		ASSERT_EQ(1u, context.api().utSketchRequests().size());
+
+		const auto& request = context.api().utSketchRequests()[0];
+		auto expectedSketch = context.createExpectedSketch(request.second.size());
+		EXPECT_EQ(BlockFeeMultiplier(17), request.first);
+		EXPECT_GT(Num_Many_Short_Hashes * sizeof(utils::ShortHash), request.second.size() * sizeof(utils::ShortHashSketchCell));
+		EXPECT_EQ_MEMORY(expectedSketch.cells().data(), request.second.cells().data(), expectedSketch.size() * sizeof(utils::ShortHashSketchCell));
+	}
+
+	TEST(TEST_CLASS, ShortHashesAreSentWhenSketchIsNotSmaller) {
+		// Arrange:
+		SketchTestContext context(100);
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(3u, context.numConsumedTransactions());
+
+		ASSERT_EQ(1u, context.api().utRequests().size());
+		EXPECT_EQ(100u, context.api().utRequests()[0].second.size());
+		EXPECT_EQ(0u, context.api().utSketchRequests().size());
+	}
+
+	TEST(TEST_CLASS, UndecodableSketchResultsInNeutralInteractionAndLargerNextSketch) {
+		// Arrange:
+		SketchTestContext context(Num_Many_Short_Hashes);
+		context.api().setSketchResult(false, 0);
+
+		// Act:
+		auto code1 = context.synchronize();
+		auto code2 = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Neutral, code1);
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Neutral, code2);
+		EXPECT_EQ(0u, context.numConsumedTransactions());
+
+		ASSERT_EQ(2u, context.api().utSketchRequests().size());
+		EXPECT_LT(GetSketchRequestSize(context, 0), GetSketchRequestSize(context, 1));
+	}
+
+	TEST(TEST_CLASS, DecodedSketchSizesNextSketchByNumberOfDifferences) {
+		// Arrange:
+		SketchTestContext context(Num_Many_Short_Hashes);
+		context.api().setSketchResult(true, 100);
+
+		// Act:
+		context.synchronize();
+		context.synchronize();
+
+		// Assert: next sketch leaves room for twice as many differences
+		ASSERT_EQ(2u, context.api().utSketchRequests().size());
+		EXPECT_EQ(utils::ShortHashSketch::CalculateCellCount(200), GetSketchRequestSize(context, 1));
+	}
+
+	TEST(TEST_CLASS, ShortHashesAreSentWhenEstimatedDifferenceGrowsTooLarge) {
+		// Arrange: 20K short hashes (80KB) are more than the initial sketch but less than the sketch after a few failures
+		SketchTestContext context(20'000);
+		context.api().setSketchResult(false, 0);
+
+		// Act:
+		for (auto i = 0u; i < 5; ++i)
+			context.synchronize();
+
+		// Assert:
+		EXPECT_LT(0u, context.api().utSketchRequests().size());
+		EXPECT_LT(0u, context.api().utRequests().size());
+		EXPECT_EQ(5u, context.api().utSketchRequests().size() + context.api().utRequests().size());
+	}
+
+	TEST(TEST_CLASS, SketchApiExceptionResultsInFailedInteraction) {
+		// Arrange:
+		SketchTestContext context(Num_Many_Short_Hashes);
+		context.api().setError(MockRemoteApi::EntryPoint::Unconfirmed_Transactions_Sketch);
+
+		// Act:
+		auto code = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		EXPECT_EQ(0u, context.numConsumedTransactions());
+		EXPECT_EQ(1u, context.api().utSketchRequests().size());
+	}
+
+	// endregion
 }}
@@ -30,7 +30,8 @@ namespace catapult { namespace mocks {
 	public:
 		enum class EntryPoint {
 			None,
-			Unconfirmed_Transactions
+			Unconfirmed_Transactions,
+			Unconfirmed_Transactions_Sketch
 		};
 
 	public:
@@ -39,6 +40,8 @@ namespace catapult { namespace mocks {
 				: api::RemoteTransactionApi(test::GenerateRandomData<Key_Size>())
 				, m_transactions(model::TransactionRange::CopyRange(transactions))
 				, m_errorEntryPoint(EntryPoint::None)
+				, m_isSketchDecoded(true)
+				, m_numSketchDifferences(0)
 		{}
 
 	public:
@@ -47,11 +50,23 @@ namespace catapult { namespace mocks {
 			m_errorEntryPoint = entryPoint;
 		}
 
+		/// Sets the sketch decoding status returned by unconfirmed transactions sketch requests
+		/// to \a isDecoded and \a numDifferences.
+		void setSketchResult(bool isDecoded, uint32_t numDifferences) {
+			m_isSketchDecoded = isDecoded;
+			m_numSketchDifferences = numDifferences;
+		}
+
 		/// Returns a vector of parameters that were passed to the unconfirmed transactions requests.
 		const auto& utRequests() const {
 			return m_utRequests;
 		}
 
+		/// Returns a vector of parameters that were passed to the unconfirmed transactions sketch requests.
+		const auto& utSketchRequests() const {
+			return m_utSketchRequests;
+		}
+
 	public:
 		/// Returns the configured unconfirmed transactions and throws if the error entry point is set to Unconfirmed_Transactions.
 		/// \note The \a minFeeMultiplier and \a knownShortHashes parameters are captured.
@@ -65,6 +80,24 @@ namespace catapult { namespace mocks {
 			return thread::make_ready_future(model::TransactionRange::CopyRange(m_transactions));
 		}
 
+		/// Returns the configured sketch result and throws if the error entry point is set to Unconfirmed_Transactions_Sketch.
+		/// \note The \a minFeeMultiplier and \a knownShortHashesSketch parameters are captured.
+		thread::future<api::UnconfirmedTransactionsSketchResult> unconfirmedTransactions(
+				BlockFeeMultiplier minFeeMultiplier,
+				utils::ShortHashSketch&& knownShortHashesSketch) const override {
+			m_utSketchRequests.push_back(std::make_pair(minFeeMultiplier, std::move(knownShortHashesSketch)));
+			if (shouldRaiseException(EntryPoint::Unconfirmed_Transactions_Sketch))
+				return CreateFutureException<api::UnconfirmedTransactionsSketchResult>("unconfirmed transactions sketch error has been set");
+
+			api::UnconfirmedTransactionsSketchResult result;
+			result.IsDecoded = m_isSketchDecoded;
+			result.NumDifferences = m_numSketchDifferences;
+			if (m_isSketchDecoded)
+				result.Transactions = model::TransactionRange::CopyRange(m_transactions);
+
+			return thread::make_ready_future(std::move(result));
+		}
+
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
 			return m_errorEntryPoint == entryPoint;
@@ -78,6 +111,9 @@ namespace catapult { namespace mocks {
 	private:
 		model::TransactionRange m_transactions;
 		EntryPoint m_errorEntryPoint;
+		bool m_isSketchDecoded;
+		uint32_t m_numSketchDifferences;
 		mutable std::vector<std::pair<BlockFeeMultiplier, model::ShortHashRange>> m_utRequests;
+		mutable std::vector<std::pair<BlockFeeMultiplier, utils::ShortHashSketch>> m_utSketchRequests;
 	};
 }}
@@ -81,12 +81,14 @@ namespace catapult { namespace config {
 			EXPECT_FALSE(config.ShouldAllowAddressReuse);
 			EXPECT_FALSE(config.ShouldUseSingleThreadPool);
 			EXPECT_TRUE(config.ShouldUseCacheDatabaseStorage);
+			EXPECT_FALSE(config.ShouldUsePackedBlockStorage);
 
 			EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
 
 			EXPECT_EQ(400u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(4u, config.MaxSyncDownloadPeers);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -97,6 +99,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(model::TransactionSelectionStrategy::Oldest, config.TransactionSelectionStrategy);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.UnconfirmedTransactionsCacheMaxResponseSize);
 			EXPECT_EQ(1'000'000u, config.UnconfirmedTransactionsCacheMaxSize);
+			EXPECT_FALSE(config.ShouldUseTransactionSketchSync);
 
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.ConnectTimeout);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(60), config.SyncTimeout);
@@ -109,6 +112,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(1u, config.BlockElementTraceInterval);
 			EXPECT_EQ(16384u, config.TransactionDisruptorSize);
 			EXPECT_EQ(10u, config.TransactionElementTraceInterval);
+			EXPECT_EQ(1u, config.NumTransactionHashCalculatorThreads);
 
 			EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 			EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
@@ -118,6 +122,17 @@ namespace catapult { namespace config {
 			EXPECT_EQ(ionet::ConnectionSecurityMode::None, config.IncomingSecurityModes);
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.MaxCacheDatabaseWriteBatchSize);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(256), config.CacheDatabaseBlockCacheSize);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(128), config.CacheDatabaseWriteBufferBudget);
+			EXPECT_EQ(100'000u, config.MaxPatriciaTreeNodeCacheSize);
+			EXPECT_EQ(3u, config.PatriciaTreeNodeCachePinnedLevels);
+			EXPECT_EQ(100u, config.PatriciaTreeRetainedRoots);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(50), config.MaxBlockStorageCacheSize);
+			EXPECT_EQ(64u, config.BlockLoadPrefetchSize);
+			EXPECT_EQ(1u, config.BlockLoadStateHashInterval);
+			EXPECT_EQ(4u, config.NumStateStorageThreads);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(1), config.StateStorageBufferSize);
+			EXPECT_EQ(10u, config.StateChangeLogFlushInterval);
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
 
 			EXPECT_EQ("", config.Local.Host);
@@ -38,12 +38,14 @@ namespace catapult { namespace config {
 							{ "shouldAllowAddressReuse", "true" },
 							{ "shouldUseSingleThreadPool", "true" },
 							{ "shouldUseCacheDatabaseStorage", "true" },
+							{ "shouldUsePackedBlockStorage", "true" },
 
 							{ "shouldEnableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
 
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxSyncDownloadPeers", "6" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -54,6 +56,7 @@ namespace catapult { namespace config {
 							{ "transactionSelectionStrategy", "maximize-fee" },
 							{ "unconfirmedTransactionsCacheMaxResponseSize", "234KB" },
 							{ "unconfirmedTransactionsCacheMaxSize", "98'763" },
+							{ "shouldUseTransactionSketchSync", "true" },
 
 							{ "connectTimeout", "4m" },
 							{ "syncTimeout", "5m" },
@@ -66,6 +69,7 @@ namespace catapult { namespace config {
 							{ "blockElementTraceInterval", "34" },
 							{ "transactionDisruptorSize", "9876" },
 							{ "transactionElementTraceInterval", "98" },
+							{ "numTransactionHashCalculatorThreads", "3" },
 
 							{ "shouldAbortWhenDispatcherIsFull", "true" },
 							{ "shouldAuditDispatcherInputs", "true" },
@@ -75,6 +79,17 @@ namespace catapult { namespace config {
 							{ "incomingSecurityModes", "None, Signed" },
 
 							{ "maxCacheDatabaseWriteBatchSize", "17KB" },
+							{ "cacheDatabaseBlockCacheSize", "31MB" },
+							{ "cacheDatabaseWriteBufferBudget", "19MB" },
+							{ "maxPatriciaTreeNodeCacheSize", "4321" },
+							{ "patriciaTreeNodeCachePinnedLevels", "3" },
+							{ "patriciaTreeRetainedRoots", "25" },
+							{ "maxBlockStorageCacheSize", "23MB" },
+							{ "blockLoadPrefetchSize", "17" },
+							{ "blockLoadStateHashInterval", "9" },
+							{ "numStateStorageThreads", "3" },
+							{ "stateStorageBufferSize", "2MB" },
+							{ "stateChangeLogFlushInterval", "7" },
 							{ "maxTrackedNodes", "222" }
 						}
 					},
@@ -128,12 +143,14 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.ShouldAllowAddressReuse);
 				EXPECT_FALSE(config.ShouldUseSingleThreadPool);
 				EXPECT_FALSE(config.ShouldUseCacheDatabaseStorage);
+				EXPECT_FALSE(config.ShouldUsePackedBlockStorage);
 
 				EXPECT_FALSE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.MaxSyncDownloadPeers);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -144,6 +161,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(model::TransactionSelectionStrategy::Oldest, config.TransactionSelectionStrategy);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(0u, config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_FALSE(config.ShouldUseTransactionSketchSync);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SyncTimeout);
@@ -156,6 +174,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.BlockElementTraceInterval);
 				EXPECT_EQ(0u, config.TransactionDisruptorSize);
 				EXPECT_EQ(0u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(0u, config.NumTransactionHashCalculatorThreads);
 
 				EXPECT_FALSE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
@@ -165,6 +184,17 @@ namespace catapult { namespace config {
 				EXPECT_EQ(static_cast<ionet::ConnectionSecurityMode>(0), config.IncomingSecurityModes);
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxCacheDatabaseWriteBatchSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabaseBlockCacheSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabaseWriteBufferBudget);
+				EXPECT_EQ(0u, config.MaxPatriciaTreeNodeCacheSize);
+				EXPECT_EQ(0u, config.PatriciaTreeNodeCachePinnedLevels);
+				EXPECT_EQ(0u, config.PatriciaTreeRetainedRoots);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxBlockStorageCacheSize);
+				EXPECT_EQ(0u, config.BlockLoadPrefetchSize);
+				EXPECT_EQ(0u, config.BlockLoadStateHashInterval);
+				EXPECT_EQ(0u, config.NumStateStorageThreads);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.StateStorageBufferSize);
+				EXPECT_EQ(0u, config.StateChangeLogFlushInterval);
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
 
 				EXPECT_EQ("", config.Local.Host);
@@ -193,12 +223,14 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.ShouldAllowAddressReuse);
 				EXPECT_TRUE(config.ShouldUseSingleThreadPool);
 				EXPECT_TRUE(config.ShouldUseCacheDatabaseStorage);
+				EXPECT_TRUE(config.ShouldUsePackedBlockStorage);
 
 				EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(6u, config.MaxSyncDownloadPeers);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -209,6 +241,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(model::TransactionSelectionStrategy::Maximize_Fee, config.TransactionSelectionStrategy);
 				EXPECT_EQ(utils::FileSize::FromKilobytes(234), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(98'763u, config.UnconfirmedTransactionsCacheMaxSize);
+				EXPECT_TRUE(config.ShouldUseTransactionSketchSync);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(4), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.SyncTimeout);
@@ -221,6 +254,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(34u, config.BlockElementTraceInterval);
 				EXPECT_EQ(9876u, config.TransactionDisruptorSize);
 				EXPECT_EQ(98u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(3u, config.NumTransactionHashCalculatorThreads);
 
 				EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_TRUE(config.ShouldAuditDispatcherInputs);
@@ -230,6 +264,17 @@ namespace catapult { namespace config {
 				EXPECT_EQ(ionet::ConnectionSecurityMode::None | ionet::ConnectionSecurityMode::Signed, config.IncomingSecurityModes);
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.MaxCacheDatabaseWriteBatchSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(31), config.CacheDatabaseBlockCacheSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(19), config.CacheDatabaseWriteBufferBudget);
+				EXPECT_EQ(4321u, config.MaxPatriciaTreeNodeCacheSize);
+				EXPECT_EQ(3u, config.PatriciaTreeNodeCachePinnedLevels);
+				EXPECT_EQ(25u, config.PatriciaTreeRetainedRoots);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(23), config.MaxBlockStorageCacheSize);
+				EXPECT_EQ(17u, config.BlockLoadPrefetchSize);
+				EXPECT_EQ(9u, config.BlockLoadStateHashInterval);
+				EXPECT_EQ(3u, config.NumStateStorageThreads);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.StateStorageBufferSize);
+				EXPECT_EQ(7u, config.StateChangeLogFlushInterval);
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
 
 				EXPECT_EQ("alice.com", config.Local.Host);
@@ -114,6 +114,31 @@ namespace catapult { namespace consumers {
 
 		// endregion
 
+		// region MockStatePrefetcher
+
+		struct StatePrefetcherParams {
+		public:
+			StatePrefetcherParams(const model::WeakEntityInfos& entityInfos, const cache::CatapultCacheDelta& cache)
+					: EntityInfos(entityInfos)
+					, IsPassedMarkedCache(test::IsMarkedCache(cache))
+					, NumDifficultyInfos(cache.sub<cache::BlockDifficultyCache>().size())
+			{}
+
+		public:
+			const model::WeakEntityInfos EntityInfos;
+			const bool IsPassedMarkedCache;
+			const size_t NumDifficultyInfos;
+		};
+
+		class MockStatePrefetcher : public test::ParamsCapture<StatePrefetcherParams> {
+		public:
+			void operator()(const model::WeakEntityInfos& entityInfos, const cache::CatapultCacheDelta& cache) const {
+				const_cast<MockStatePrefetcher*>(this)->push(entityInfos, cache);
+			}
+		};
+
+		// endregion
+
 		// region MockBatchEntityProcessor
 
 		struct BatchEntityProcessorParams {
@@ -202,6 +227,9 @@ namespace catapult { namespace consumers {
 						[this](const auto& cache) {
 							return BlockHitPredicateFactory(cache);
 						},
+						[this](const auto& entityInfos, const auto& cache) {
+							StatePrefetcher(entityInfos, cache);
+						},
 						[this](auto height, auto timestamp, const auto& entities, auto& state) {
 							return BatchEntityProcessor(height, timestamp, entities, state);
 						},
@@ -213,6 +241,7 @@ namespace catapult { namespace consumers {
 
 			MockBlockHitPredicate BlockHitPredicate;
 			MockBlockHitPredicateFactory BlockHitPredicateFactory;
+			MockStatePrefetcher StatePrefetcher;
 			MockBatchEntityProcessor BatchEntityProcessor;
 			BlockChainProcessor Processor;
 
@@ -266,7 +295,26 @@ namespace catapult { namespace consumers {
 				}
 			}
 
+			void assertStatePrefetcherCalls(const BlockElements& elements) {
+				// state prefetcher is always called immediately before batch entity processor
+				const auto& allParams = StatePrefetcher.params();
+				ASSERT_EQ(BatchEntityProcessor.params().size(), allParams.size());
+
+				auto i = 0u;
+				for (auto params : allParams) {
+					auto message = "prefetcher at " + std::to_string(i);
+					auto expectedEntityInfos = ExtractEntityInfosFromBlock(elements[i]);
+
+					EXPECT_EQ(expectedEntityInfos, params.EntityInfos) << message;
+					EXPECT_TRUE(params.IsPassedMarkedCache) << message;
+					EXPECT_EQ(i, params.NumDifficultyInfos) << message;
+					++i;
+				}
+			}
+
 			void assertBatchEntityProcessorCalls(const BlockElements& elements) {
+				assertStatePrefetcherCalls(elements);
+
 				const auto& allParams = BatchEntityProcessor.params();
 				ASSERT_LE(allParams.size(), elements.size());
 
@@ -289,6 +337,7 @@ namespace catapult { namespace consumers {
 			void assertNoHandlerCalls() {
 				EXPECT_EQ(0u, BlockHitPredicate.params().size());
 				EXPECT_EQ(0u, BlockHitPredicateFactory.params().size());
+				EXPECT_EQ(0u, StatePrefetcher.params().size());
 				EXPECT_EQ(0u, BatchEntityProcessor.params().size());
 			}
 		};
@@ -192,12 +192,14 @@ namespace catapult { namespace consumers {
 					// all processing should have occurred before the state change notification,
 					// so the sentinel account should have been added
 					, IsPassedMarkedCache(changeInfo.CacheDelta.sub<cache::AccountStateCache>().contains(Sentinel_Processor_Public_Key))
+					, LastRecalculationHeight(changeInfo.State.LastRecalculationHeight)
 					, Height(changeInfo.Height)
 			{}
 
 		public:
 			model::ChainScore ScoreDelta;
 			bool IsPassedMarkedCache;
+			model::ImportanceHeight LastRecalculationHeight;
 			catapult::Height Height;
 		};
 
@@ -422,6 +424,7 @@ namespace catapult { namespace consumers {
 				const auto& stateChangeParams = StateChange.params()[0];
 				EXPECT_EQ(expectedScoreDelta, stateChangeParams.ScoreDelta);
 				EXPECT_TRUE(stateChangeParams.IsPassedMarkedCache);
+				EXPECT_EQ(Modified_Last_Recalculation_Height, stateChangeParams.LastRecalculationHeight);
 				EXPECT_EQ(chainHeight, stateChangeParams.Height);
 
 				// - transaction changes were announced
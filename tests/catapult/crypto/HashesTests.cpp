@@ -574,4 +574,116 @@ namespace catapult { namespace crypto {
 	}
 
 	// endregion
+
+	// region Sha3_256_Multi
+
+	namespace {
+		std::vector<Hash256> CalculateSingleHashes(const std::vector<std::vector<uint8_t>>& messages) {
+			std::vector<Hash256> hashes(messages.size());
+			for (auto i = 0u; i < messages.size(); ++i)
+				Sha3_256(messages[i], hashes[i]);
+
+			return hashes;
+		}
+
+		std::vector<std::vector<uint8_t>> GenerateMessages(const std::vector<size_t>& sizes) {
+			std::vector<std::vector<uint8_t>> messages;
+			for (auto size : sizes)
+				messages.push_back(test::GenerateRandomVector(size));
+
+			return messages;
+		}
+
+		void AssertMultiMatchesSingleCallVariant(const std::vector<size_t>& sizes, HashLanes maxLanes) {
+			// Arrange:
+			auto messages = GenerateMessages(sizes);
+			std::vector<RawBuffer> buffers;
+			for (const auto& message : messages)
+				buffers.push_back(message);
+
+			// Act:
+			std::vector<Hash256> hashes(messages.size());
+			Sha3_256_Multi(buffers.data(), 1, buffers.size(), hashes.data(), maxLanes);
+
+			// Assert:
+			EXPECT_EQ(CalculateSingleHashes(messages), hashes) << "lanes " << static_cast<uint16_t>(maxLanes);
+		}
+
+		void AssertMultiMatchesSingleCallVariantForAllLanes(const std::vector<size_t>& sizes) {
+			for (auto maxLanes : { HashLanes::One, HashLanes::Four, HashLanes::Eight })
+				AssertMultiMatchesSingleCallVariant(sizes, maxLanes);
+		}
+	}
+
+	TEST(TEST_CLASS, GetMaxSupportedHashLanesReturnsKnownValue) {
+		// Act:
+		auto lanes = GetMaxSupportedHashLanes();
+
+		// Assert:
+		EXPECT_TRUE(HashLanes::One == lanes || HashLanes::Four == lanes || HashLanes::Eight == lanes)
+				<< static_cast<uint16_t>(lanes);
+	}
+
+	TEST(TEST_CLASS, Sha3_256_MultiCanHashZeroMessages) {
+		// Act + Assert: no exception
+		for (auto maxLanes : { HashLanes::One, HashLanes::Four, HashLanes::Eight })
+			Sha3_256_Multi(nullptr, 1, 0, nullptr, maxLanes);
+	}
+
+	TEST(TEST_CLASS, Sha3_256_MultiEmptyStringHasExpectedHash) {
+		// Arrange:
+		std::vector<RawBuffer> buffers(9);
+		std::vector<Hash256> hashes(buffers.size());
+
+		// Act:
+		Sha3_256_Multi(buffers.data(), 1, buffers.size(), hashes.data());
+
+		// Assert:
+		auto expectedHash = test::ToArray<Hash256_Size>("A7FFC6F8BF1ED76651C14756A061D662F580FF4DE43B49FA82D80A4B80F8434A");
+		for (const auto& hash : hashes)
+			EXPECT_EQ(expectedHash, hash);
+	}
+
+	TEST(TEST_CLASS, Sha3_256_MultiMatchesSingleCallVariantForAllMessageCounts) {
+		for (auto count : { 1u, 2u, 3u, 4u, 5u, 7u, 8u, 9u, 15u, 16u, 17u })
+			AssertMultiMatchesSingleCallVariantForAllLanes(std::vector<size_t>(count, 64));
+	}
+
+	TEST(TEST_CLASS, Sha3_256_MultiMatchesSingleCallVariantAroundBlockBoundaries) {
+		AssertMultiMatchesSingleCallVariantForAllLanes({ 0, 1, 135, 136, 137, 271, 272, 273, 408, 1000 });
+	}
+
+	TEST(TEST_CLASS, Sha3_256_MultiMatchesSingleCallVariantForRandomSizes) {
+		// Arrange:
+		std::vector<size_t> sizes;
+		for (auto i = 0u; i < 50; ++i)
+			sizes.push_back(test::RandomByte() * 3u);
+
+		// Assert:
+		AssertMultiMatchesSingleCallVariantForAllLanes(sizes);
+	}
+
+	TEST(TEST_CLASS, Sha3_256_MultiHashesConcatenationOfBuffersPerMessage) {
+		// Arrange: split each message into three (possibly empty) parts
+		auto messages = GenerateMessages({ 0, 10, 136, 200, 300, 17, 50, 137, 90, 1 });
+		std::vector<RawBuffer> buffers;
+		for (const auto& message : messages) {
+			auto firstSize = message.size() / 3;
+			auto secondSize = message.size() / 2;
+			buffers.push_back({ message.data(), firstSize });
+			buffers.push_back({ message.data() + firstSize, secondSize });
+			buffers.push_back({ message.data() + firstSize + secondSize, message.size() - firstSize - secondSize });
+		}
+
+		for (auto maxLanes : { HashLanes::One, HashLanes::Four, HashLanes::Eight }) {
+			// Act:
+			std::vector<Hash256> hashes(messages.size());
+			Sha3_256_Multi(buffers.data(), 3, messages.size(), hashes.data(), maxLanes);
+
+			// Assert:
+			EXPECT_EQ(CalculateSingleHashes(messages), hashes) << "lanes " << static_cast<uint16_t>(maxLanes);
+		}
+	}
+
+	// endregion
 }}
@@ -0,0 +1,125 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/SharedKey.h"
+#include "catapult/crypto/KeyPair.h"
+#include "catapult/crypto/KeyUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS SharedKeyTests
+
+	namespace {
+		KeyPair GenerateKeyPair() {
+			return KeyPair::FromPrivate(PrivateKey::Generate(test::RandomByte));
+		}
+
+		Key DeriveSharedKey(const KeyPair& keyPair, const Key& otherPublicKey) {
+			Key sharedKey;
+			EXPECT_TRUE(TryDeriveSharedKey(keyPair, otherPublicKey, sharedKey));
+			return sharedKey;
+		}
+
+		void AssertCannotDeriveSharedKey(const Key& otherPublicKey) {
+			// Arrange:
+			auto keyPair = GenerateKeyPair();
+
+			// Act:
+			Key sharedKey;
+			auto result = TryDeriveSharedKey(keyPair, otherPublicKey, sharedKey);
+
+			// Assert:
+			EXPECT_FALSE(result);
+		}
+	}
+
+	TEST(TEST_CLASS, BothPartiesDeriveSameSharedKey) {
+		// Arrange:
+		auto keyPair1 = GenerateKeyPair();
+		auto keyPair2 = GenerateKeyPair();
+
+		// Act:
+		auto sharedKey1 = DeriveSharedKey(keyPair1, keyPair2.publicKey());
+		auto sharedKey2 = DeriveSharedKey(keyPair2, keyPair1.publicKey());
+
+		// Assert:
+		EXPECT_EQ(sharedKey1, sharedKey2);
+		EXPECT_NE(keyPair1.publicKey(), sharedKey1);
+		EXPECT_NE(keyPair2.publicKey(), sharedKey1);
+	}
+
+	TEST(TEST_CLASS, SharedKeyDerivationIsDeterministic) {
+		// Arrange:
+		auto keyPair1 = GenerateKeyPair();
+		auto keyPair2 = GenerateKeyPair();
+
+		// Act:
+		auto sharedKey1 = DeriveSharedKey(keyPair1, keyPair2.publicKey());
+		auto sharedKey2 = DeriveSharedKey(keyPair1, keyPair2.publicKey());
+
+		// Assert:
+		EXPECT_EQ(sharedKey1, sharedKey2);
+	}
+
+	TEST(TEST_CLASS, DifferentPartiesDeriveDifferentSharedKeys) {
+		// Arrange:
+		auto keyPair1 = GenerateKeyPair();
+		auto keyPair2 = GenerateKeyPair();
+		auto keyPair3 = GenerateKeyPair();
+
+		// Act:
+		auto sharedKey12 = DeriveSharedKey(keyPair1, keyPair2.publicKey());
+		auto sharedKey13 = DeriveSharedKey(keyPair1, keyPair3.publicKey());
+		auto sharedKey23 = DeriveSharedKey(keyPair2, keyPair3.publicKey());
+
+		// Assert:
+		EXPECT_NE(sharedKey12, sharedKey13);
+		EXPECT_NE(sharedKey12, sharedKey23);
+		EXPECT_NE(sharedKey13, sharedKey23);
+	}
+
+	TEST(TEST_CLASS, SharedKeyWithBasePointIsNegatedPublicKey) {
+		// Arrange: the shared key is the (negated) product of the private scalar and the other point,
+		//          so using the base point yields the negated public key
+		auto keyPair = GenerateKeyPair();
+		auto basePoint = ParseKey("5866666666666666666666666666666666666666666666666666666666666666");
+
+		auto expectedSharedKey = keyPair.publicKey();
+		expectedSharedKey[Key_Size - 1] ^= 0x80;
+
+		// Act:
+		auto sharedKey = DeriveSharedKey(keyPair, basePoint);
+
+		// Assert:
+		EXPECT_EQ(expectedSharedKey, sharedKey);
+	}
+
+	TEST(TEST_CLASS, CannotDeriveSharedKeyFromSmallOrderPublicKey) {
+		// Assert: identity and point of order two
+		AssertCannotDeriveSharedKey(ParseKey("0100000000000000000000000000000000000000000000000000000000000000"));
+		AssertCannotDeriveSharedKey(ParseKey("ECFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7F"));
+	}
+
+	TEST(TEST_CLASS, CannotDeriveSharedKeyFromPublicKeyNotOnCurve) {
+		// Assert: y = 2 does not correspond to a point on the curve
+		AssertCannotDeriveSharedKey(ParseKey("0200000000000000000000000000000000000000000000000000000000000000"));
+	}
+}}
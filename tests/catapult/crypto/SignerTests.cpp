@@ -20,6 +20,7 @@
 
 #include "catapult/crypto/Signer.h"
 #include "tests/TestHarness.h"
+#include <algorithm>
 #include <numeric>
 
 namespace catapult { namespace crypto {
@@ -393,4 +394,161 @@ namespace catapult { namespace crypto {
 			EXPECT_EQ(properSignature, result);
 		}
 	}
+
+	// region VerifyMulti
+
+	namespace {
+		struct SignedPayloads {
+			std::vector<KeyPair> KeyPairs;
+			std::vector<std::vector<uint8_t>> Payloads;
+			std::vector<Signature> Signatures;
+
+		public:
+			std::vector<SignatureInput> toSignatureInputs() const {
+				std::vector<SignatureInput> signatureInputs;
+				for (auto i = 0u; i < Payloads.size(); ++i)
+					signatureInputs.push_back({ KeyPairs[i].publicKey(), Payloads[i], Signatures[i] });
+
+				return signatureInputs;
+			}
+		};
+
+		SignedPayloads GenerateSignedPayloads(size_t count) {
+			SignedPayloads signedPayloads;
+			for (auto i = 0u; i < count; ++i) {
+				signedPayloads.KeyPairs.push_back(KeyPair::FromPrivate(PrivateKey::Generate(test::RandomByte)));
+				signedPayloads.Payloads.push_back(test::GenerateRandomVector(100 + i));
+				signedPayloads.Signatures.push_back(SignPayload(signedPayloads.KeyPairs.back(), signedPayloads.Payloads.back()));
+			}
+
+			return signedPayloads;
+		}
+
+		void AssertVerifyMultiResults(const SignedPayloads& signedPayloads, const std::vector<bool>& expectedResults) {
+			// Act:
+			auto signatureInputs = signedPayloads.toSignatureInputs();
+			std::vector<bool> results;
+			auto areAllVerified = VerifyMulti(signatureInputs.data(), signatureInputs.size(), results);
+			auto areAllVerifiedShortCircuit = VerifyMulti(signatureInputs.data(), signatureInputs.size());
+
+			// Assert:
+			auto expectedAreAllVerified = std::all_of(expectedResults.cbegin(), expectedResults.cend(), [](auto result) {
+				return result;
+			});
+			EXPECT_EQ(expectedAreAllVerified, areAllVerified);
+			EXPECT_EQ(expectedAreAllVerified, areAllVerifiedShortCircuit);
+			EXPECT_EQ(expectedResults, results);
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsForEmptyInput) {
+		// Act:
+		std::vector<bool> results;
+		auto areAllVerified = VerifyMulti(nullptr, 0, results);
+
+		// Assert:
+		EXPECT_TRUE(areAllVerified);
+		EXPECT_TRUE(VerifyMulti(nullptr, 0));
+		EXPECT_TRUE(results.empty());
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenAllSignaturesAreValid) {
+		// Assert: check single signature, single batch and multiple batches
+		for (auto count : { 1u, 2u, 10u, 300u })
+			AssertVerifyMultiResults(GenerateSignedPayloads(count), std::vector<bool>(count, true));
+	}
+
+	TEST(TEST_CLASS, VerifyMultiLocatesSignaturesWithModifiedPayload) {
+		// Arrange:
+		auto signedPayloads = GenerateSignedPayloads(150);
+		std::vector<bool> expectedResults(150, true);
+		for (auto index : { 0u, 17u, 128u, 149u }) {
+			signedPayloads.Payloads[index][5] ^= 0xFF;
+			expectedResults[index] = false;
+		}
+
+		// Assert:
+		AssertVerifyMultiResults(signedPayloads, expectedResults);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiLocatesSignaturesWithModifiedRAndSParts) {
+		// Arrange:
+		auto signedPayloads = GenerateSignedPayloads(20);
+		std::vector<bool> expectedResults(20, true);
+		for (auto index : { 3u, 11u }) {
+			signedPayloads.Signatures[index][index] ^= 0xFF;
+			expectedResults[index] = false;
+		}
+
+		for (auto index : { 7u, 15u }) {
+			signedPayloads.Signatures[index][Signature_Size / 2 + 1] ^= 0x01;
+			expectedResults[index] = false;
+		}
+
+		// Assert:
+		AssertVerifyMultiResults(signedPayloads, expectedResults);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiDetectsSwappedSignatures) {
+		// Arrange: each signature in the batch is valid for some other payload in the batch
+		auto signedPayloads = GenerateSignedPayloads(10);
+		std::swap(signedPayloads.Signatures[2], signedPayloads.Signatures[6]);
+
+		std::vector<bool> expectedResults(10, true);
+		expectedResults[2] = expectedResults[6] = false;
+
+		// Assert:
+		AssertVerifyMultiResults(signedPayloads, expectedResults);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiRejectsNonCanonicalSignature) {
+		// Arrange:
+		auto signedPayloads = GenerateSignedPayloads(10);
+		ScalarAddGroupOrder(signedPayloads.Signatures[4].data() + Signature_Size / 2);
+
+		std::vector<bool> expectedResults(10, true);
+		expectedResults[4] = false;
+
+		// Assert:
+		AssertVerifyMultiResults(signedPayloads, expectedResults);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiRejectsInvalidPublicKeys) {
+		// Arrange:
+		auto signedPayloads = GenerateSignedPayloads(10);
+		auto& zeroPublicKey = const_cast<Key&>(signedPayloads.KeyPairs[2].publicKey());
+		std::fill(zeroPublicKey.begin(), zeroPublicKey.end(), static_cast<uint8_t>(0));
+
+		// - small order (identity) public key
+		auto& identityPublicKey = const_cast<Key&>(signedPayloads.KeyPairs[5].publicKey());
+		std::fill(identityPublicKey.begin(), identityPublicKey.end(), static_cast<uint8_t>(0));
+		identityPublicKey[0] = 0x01;
+
+		// - public key not on a curve
+		auto& invalidPublicKey = const_cast<Key&>(signedPayloads.KeyPairs[8].publicKey());
+		std::fill(invalidPublicKey.begin(), invalidPublicKey.end(), static_cast<uint8_t>(0));
+		invalidPublicKey.back() = 0x01;
+
+		std::vector<bool> expectedResults(10, true);
+		expectedResults[2] = expectedResults[5] = expectedResults[8] = false;
+
+		// Assert:
+		AssertVerifyMultiResults(signedPayloads, expectedResults);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiPassesTestVectors) {
+		// Arrange:
+		auto input = GetTestVectorsInput();
+		SignedPayloads signedPayloads;
+		for (auto i = 0u; i < input.InputData.size(); ++i) {
+			signedPayloads.KeyPairs.push_back(KeyPair::FromString(input.PrivateKeys[i]));
+			signedPayloads.Payloads.push_back(test::ToVector(input.InputData[i]));
+			signedPayloads.Signatures.push_back(SignPayload(signedPayloads.KeyPairs.back(), signedPayloads.Payloads.back()));
+		}
+
+		// Assert:
+		AssertVerifyMultiResults(signedPayloads, std::vector<bool>(input.InputData.size(), true));
+	}
+
+	// endregion
 }}
@@ -136,6 +136,25 @@ namespace catapult { namespace test {
 			return element < pruningBoundary.value();
 		});
 	}
+
+	// custom PrefetchSet overloads to track prefetch forwarding
+	struct PrefetchCounters {
+		static size_t NumStorageSetKeys;
+		static size_t NumMemorySetKeys;
+	};
+
+	size_t PrefetchCounters::NumStorageSetKeys = 0;
+	size_t PrefetchCounters::NumMemorySetKeys = 0;
+
+	void PrefetchSet(const StorageSetType&, const std::vector<MutableTestElement>& keys);
+	void PrefetchSet(const StorageSetType&, const std::vector<MutableTestElement>& keys) {
+		PrefetchCounters::NumStorageSetKeys += keys.size();
+	}
+
+	void PrefetchSet(const MemorySetType&, const std::vector<MutableTestElement>& keys);
+	void PrefetchSet(const MemorySetType&, const std::vector<MutableTestElement>& keys) {
+		PrefetchCounters::NumMemorySetKeys += keys.size();
+	}
 }}
 
 namespace catapult { namespace deltaset {
@@ -270,7 +289,7 @@ namespace catapult { namespace deltaset {
 
 	// endregion
 
-	// region set traits based pruning test
+	// region set traits based pruning + prefetch tests
 
 #define TRAITS_BASED_SET_TEST(TEST_NAME) \
 	template<ConditionalContainerMode Mode, typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
@@ -324,6 +343,42 @@ namespace catapult { namespace deltaset {
 		EXPECT_TRUE(TTraits::Contains(container, "zeta", 100));
 	}
 
+	namespace {
+		template<ConditionalContainerMode Mode, typename TTraits, typename TPrefetch>
+		void AssertPrefetchIsForwardedOnlyToStorageSet(TPrefetch prefetch) {
+			// Arrange:
+			auto container = CreateContainerSeededForPruningTest<Mode, TTraits>();
+			test::PrefetchCounters::NumStorageSetKeys = 0;
+			test::PrefetchCounters::NumMemorySetKeys = 0;
+
+			// Act:
+			prefetch(container, std::vector<test::MutableTestElement>{
+				TTraits::MakeKey("alpha", 5), TTraits::MakeKey("omega", 11), TTraits::MakeKey("gamma", 7)
+			});
+
+			// Assert: memory set is always fully loaded, so only storage set is prefetched
+			EXPECT_EQ(StorageMode == Mode ? 3u : 0u, test::PrefetchCounters::NumStorageSetKeys);
+			EXPECT_EQ(0u, test::PrefetchCounters::NumMemorySetKeys);
+
+			// - container is unchanged
+			EXPECT_EQ(4u, container.size());
+			EXPECT_TRUE(TTraits::Contains(container, "alpha", 5));
+			EXPECT_TRUE(TTraits::Contains(container, "gamma", 7));
+		}
+	}
+
+	TRAITS_BASED_SET_TEST(CanPrefetchElements) {
+		AssertPrefetchIsForwardedOnlyToStorageSet<Mode, TTraits>([](const auto& container, const auto& keys) {
+			container.prefetch(keys);
+		});
+	}
+
+	TRAITS_BASED_SET_TEST(CanPrefetchElementsViaFreeFunction) {
+		AssertPrefetchIsForwardedOnlyToStorageSet<Mode, TTraits>([](const auto& container, const auto& keys) {
+			PrefetchSet(container, keys);
+		});
+	}
+
 	// endregion
 
 	// region constructor arguments
@@ -115,4 +115,51 @@ namespace catapult { namespace deltaset {
 
 	DEFINE_DELTA_ELEMENTS_MIXIN_TESTS(MutableTraits, _Mutable)
 	DEFINE_DELTA_ELEMENTS_MIXIN_TESTS(MutablePointerTraits, _MutablePointer)
+
+	// region set-based
+
+	namespace {
+		using OrderedSetImmutableTraits = test::BaseSetTraits<
+			test::ImmutableElementValueTraits,
+			test::OrderedSetTraits<test::SetElementType<test::ImmutableElementValueTraits>>>;
+
+		template<typename TPointerContainer>
+		std::vector<unsigned int> CollectValues(const TPointerContainer& elements) {
+			std::vector<unsigned int> values;
+			for (const auto* pElement : elements)
+				values.push_back(pElement->Value);
+
+			return values;
+		}
+	}
+
+	TEST(TEST_CLASS, SetBasedElementsAreReturnedInSetOrder) {
+		// Arrange:
+		using ElementType = test::ImmutableTestElement;
+		OrderedSetImmutableTraits::Type set;
+		{
+			auto pDelta = set.rebase();
+			for (auto value : { 10u, 11u, 12u, 13u })
+				pDelta->insert(ElementType("TestElement", value));
+
+			set.commit();
+		}
+
+		auto pDelta = set.rebase();
+		DeltaElementsMixin<OrderedSetImmutableTraits::DeltaType> mixin(*pDelta);
+
+		// Act:
+		for (auto value : { 7u, 15u, 3u, 14u })
+			pDelta->insert(ElementType("TestElement", value));
+
+		for (auto value : { 12u, 10u, 13u })
+			pDelta->remove(ElementType("TestElement", value));
+
+		// Assert:
+		EXPECT_EQ(std::vector<unsigned int>({ 3, 7, 14, 15 }), CollectValues(mixin.addedElements()));
+		EXPECT_EQ(std::vector<unsigned int>(), CollectValues(mixin.modifiedElements()));
+		EXPECT_EQ(std::vector<unsigned int>({ 10, 12, 13 }), CollectValues(mixin.removedElements()));
+	}
+
+	// endregion
 }}
@@ -0,0 +1,438 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "catapult/deltaset/PersistentHashMap.h"
+#include "tests/TestHarness.h"
+#include <atomic>
+#include <set>
+#include <thread>
+#include <unordered_map>
+
+namespace catapult { namespace deltaset {
+
+#define TEST_CLASS PersistentHashMapTests
+
+	namespace {
+		// all keys share the same hash, so all values are stored in a single leaf
+		struct ConstantHasher {
+			size_t operator()(uint32_t) const {
+				return 0x1234;
+			}
+		};
+
+		// keys only differ in the highest hash bits, so leaves are stored at the maximum depth
+		struct HighBitsHasher {
+			size_t operator()(uint32_t key) const {
+				return static_cast<size_t>(key) << (sizeof(size_t) * 8 - 4);
+			}
+		};
+
+		template<typename THasher = std::hash<uint32_t>>
+		using MapType = PersistentHashMap<uint32_t, std::string, THasher>;
+
+		template<typename THasher = std::hash<uint32_t>>
+		MapType<THasher> CreateMap(uint32_t count) {
+			MapType<THasher> map;
+			for (auto i = 0u; i < count; ++i)
+				map.insert(std::make_pair(i, std::to_string(i)));
+
+			return map;
+		}
+
+		template<typename TMap>
+		std::unordered_map<uint32_t, std::string> ToStlMap(const TMap& map) {
+			std::unordered_map<uint32_t, std::string> stlMap;
+			for (const auto& pair : map)
+				EXPECT_TRUE(stlMap.emplace(pair.first, pair.second).second) << "duplicate key " << pair.first;
+
+			return stlMap;
+		}
+
+		template<typename TMap>
+		void AssertContents(const TMap& map, uint32_t start, uint32_t end) {
+			// Assert: all values can be found
+			EXPECT_EQ(end - start, map.size());
+			EXPECT_EQ(start == end, map.empty());
+			for (auto i = start; i < end; ++i) {
+				auto iter = map.find(i);
+				ASSERT_NE(map.cend(), iter) << "key " << i;
+				EXPECT_EQ(std::to_string(i), iter->second) << "key " << i;
+			}
+
+			// - all values are iterated exactly once
+			auto stlMap = ToStlMap(map);
+			EXPECT_EQ(end - start, stlMap.size());
+			for (auto i = start; i < end; ++i)
+				EXPECT_EQ(std::to_string(i), stlMap[i]) << "key " << i;
+		}
+	}
+
+	// region traits
+
+	TEST(TEST_CLASS, PersistentHashMapIsPersistentSet) {
+		// Assert:
+		EXPECT_TRUE(IsPersistentSet<MapType<>>::value);
+		EXPECT_FALSE((IsPersistentSet<std::unordered_map<uint32_t, std::string>>::value));
+	}
+
+	// endregion
+
+	// region construction
+
+	TEST(TEST_CLASS, CanCreateEmptyMap) {
+		// Act:
+		MapType<> map;
+
+		// Assert:
+		EXPECT_TRUE(map.empty());
+		EXPECT_EQ(0u, map.size());
+		EXPECT_EQ(map.cend(), map.cbegin());
+		EXPECT_EQ(map.cend(), map.find(0));
+		EXPECT_EQ(0u, map.count(0));
+	}
+
+	// endregion
+
+	// region insert
+
+	namespace {
+		template<typename THasher>
+		void AssertCanInsertValues(uint32_t count) {
+			// Act:
+			auto map = CreateMap<THasher>(count);
+
+			// Assert:
+			AssertContents(map, 0, count);
+			EXPECT_EQ(map.cend(), map.find(count));
+		}
+	}
+
+	TEST(TEST_CLASS, CanInsertSingleValue) {
+		// Act:
+		MapType<> map;
+		auto result = map.insert(std::make_pair(7u, std::string("7")));
+
+		// Assert:
+		EXPECT_TRUE(result.second);
+		EXPECT_EQ(7u, result.first->first);
+		EXPECT_EQ("7", result.first->second);
+		AssertContents(map, 7, 8);
+	}
+
+	TEST(TEST_CLASS, CanInsertManyValues) {
+		AssertCanInsertValues<std::hash<uint32_t>>(5000);
+	}
+
+	TEST(TEST_CLASS, CanInsertValuesWithIdenticalHashes) {
+		AssertCanInsertValues<ConstantHasher>(20);
+	}
+
+	TEST(TEST_CLASS, CanInsertValuesWithHashesDifferingOnlyInHighBits) {
+		AssertCanInsertValues<HighBitsHasher>(16);
+	}
+
+	TEST(TEST_CLASS, InsertDoesNotOverwriteExistingValue) {
+		// Arrange:
+		auto map = CreateMap(10);
+
+		// Act:
+		auto result = map.insert(std::make_pair(4u, std::string("overwritten")));
+
+		// Assert:
+		EXPECT_FALSE(result.second);
+		EXPECT_EQ("4", result.first->second);
+		AssertContents(map, 0, 10);
+	}
+
+	TEST(TEST_CLASS, CanInsertRange) {
+		// Arrange:
+		auto source = CreateMap(100);
+		MapType<> map;
+		map.insert(std::make_pair(50u, std::string("50")));
+
+		// Act:
+		map.insert(source.cbegin(), source.cend());
+
+		// Assert:
+		AssertContents(map, 0, 100);
+	}
+
+	// endregion
+
+	// region assign
+
+	namespace {
+		template<typename THasher>
+		void AssertCanAssignValues(uint32_t count) {
+			// Arrange:
+			auto map = CreateMap<THasher>(count);
+
+			// Act: replace all even values
+			for (auto i = 0u; i < count; i += 2)
+				EXPECT_TRUE(map.assign(std::make_pair(i, std::to_string(i * 2)))) << "key " << i;
+
+			// Assert:
+			EXPECT_EQ(count, map.size());
+			for (auto i = 0u; i < count; ++i)
+				EXPECT_EQ(std::to_string(0 == i % 2 ? i * 2 : i), map.find(i)->second) << "key " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CanAssignValues) {
+		AssertCanAssignValues<std::hash<uint32_t>>(1000);
+	}
+
+	TEST(TEST_CLASS, CanAssignValuesWithIdenticalHashes) {
+		AssertCanAssignValues<ConstantHasher>(20);
+	}
+
+	TEST(TEST_CLASS, AssignOfUnknownKeyHasNoEffect) {
+		// Arrange:
+		auto map = CreateMap(10);
+
+		// Act:
+		auto isAssigned = map.assign(std::make_pair(10u, std::string("10")));
+
+		// Assert:
+		EXPECT_FALSE(isAssigned);
+		AssertContents(map, 0, 10);
+	}
+
+	// endregion
+
+	// region erase
+
+	namespace {
+		template<typename THasher>
+		void AssertCanEraseValuesByKey(uint32_t count) {
+			// Arrange:
+			auto map = CreateMap<THasher>(count);
+
+			// Act: erase the first half of all values
+			for (auto i = 0u; i < count / 2; ++i)
+				EXPECT_EQ(1u, map.erase(i)) << "key " << i;
+
+			// Assert:
+			AssertContents(map, count / 2, count);
+		}
+
+		template<typename THasher>
+		void AssertCanEraseAllValuesByIterator(uint32_t count) {
+			// Arrange:
+			auto map = CreateMap<THasher>(count);
+
+			// Act: erase all values
+			auto numErased = 0u;
+			auto iter = map.begin();
+			while (map.end() != iter) {
+				iter = map.erase(iter);
+				++numErased;
+			}
+
+			// Assert:
+			EXPECT_EQ(count, numErased);
+			AssertContents(map, 0, 0);
+		}
+	}
+
+	TEST(TEST_CLASS, CanEraseValuesByKey) {
+		AssertCanEraseValuesByKey<std::hash<uint32_t>>(5000);
+	}
+
+	TEST(TEST_CLASS, CanEraseValuesWithIdenticalHashesByKey) {
+		AssertCanEraseValuesByKey<ConstantHasher>(20);
+	}
+
+	TEST(TEST_CLASS, CanEraseValuesWithHashesDifferingOnlyInHighBitsByKey) {
+		AssertCanEraseValuesByKey<HighBitsHasher>(16);
+	}
+
+	TEST(TEST_CLASS, EraseOfUnknownKeyHasNoEffect) {
+		// Arrange:
+		auto map = CreateMap(10);
+
+		// Act:
+		auto numErased = map.erase(10);
+
+		// Assert:
+		EXPECT_EQ(0u, numErased);
+		AssertContents(map, 0, 10);
+	}
+
+	TEST(TEST_CLASS, CanEraseAllValuesByIterator) {
+		AssertCanEraseAllValuesByIterator<std::hash<uint32_t>>(1000);
+	}
+
+	TEST(TEST_CLASS, CanEraseAllValuesWithIdenticalHashesByIterator) {
+		AssertCanEraseAllValuesByIterator<ConstantHasher>(20);
+	}
+
+	TEST(TEST_CLASS, CanClearMap) {
+		// Arrange:
+		auto map = CreateMap(100);
+
+		// Act:
+		map.clear();
+
+		// Assert:
+		AssertContents(map, 0, 0);
+	}
+
+	// endregion
+
+	// region iteration
+
+	TEST(TEST_CLASS, CannotAdvanceIteratorBeyondEnd) {
+		// Arrange:
+		auto map = CreateMap(1);
+		auto iter = map.cbegin();
+		++iter;
+
+		// Act + Assert:
+		EXPECT_THROW(++iter, catapult_out_of_range);
+		EXPECT_THROW(iter++, catapult_out_of_range);
+	}
+
+	TEST(TEST_CLASS, CannotDereferenceEndIterator) {
+		// Arrange:
+		auto map = CreateMap(1);
+		auto iter = map.cend();
+
+		// Act + Assert:
+		EXPECT_THROW(*iter, catapult_out_of_range);
+		EXPECT_THROW(iter->second, catapult_out_of_range);
+	}
+
+	TEST(TEST_CLASS, CanModifyValueThroughNonConstIterator) {
+		// Arrange:
+		auto map = CreateMap(10);
+
+		// Act:
+		map.find(4)->second = "modified";
+
+		// Assert:
+		EXPECT_EQ("modified", map.find(4)->second);
+		EXPECT_EQ(10u, map.size());
+	}
+
+	TEST(TEST_CLASS, IteratorRemainsValidAfterModificationOfMap) {
+		// Arrange:
+		auto map = CreateMap(100);
+		auto iter = map.cbegin();
+
+		// Act: remove all values
+		map.clear();
+
+		// Assert: the iterator still iterates over all original values
+		std::set<uint32_t> keys;
+		for (; map.cend() != iter; ++iter)
+			keys.insert(iter->first);
+
+		EXPECT_EQ(100u, keys.size());
+		EXPECT_TRUE(map.empty());
+	}
+
+	// endregion
+
+	// region snapshots
+
+	TEST(TEST_CLASS, CopyIsUnaffectedByModificationsOfSource) {
+		// Arrange:
+		auto map = CreateMap(100);
+		auto snapshot = map;
+
+		// Act:
+		for (auto i = 0u; i < 50; ++i)
+			map.erase(i);
+
+		for (auto i = 100u; i < 150; ++i)
+			map.insert(std::make_pair(i, std::to_string(i)));
+
+		// Assert:
+		AssertContents(snapshot, 0, 100);
+		AssertContents(map, 50, 150);
+	}
+
+	TEST(TEST_CLASS, SourceIsUnaffectedByModificationsOfCopy) {
+		// Arrange:
+		auto map = CreateMap(100);
+		auto copy = map;
+
+		// Act:
+		for (auto i = 0u; i < 50; ++i)
+			copy.erase(i);
+
+		// Assert:
+		AssertContents(map, 0, 100);
+		AssertContents(copy, 50, 100);
+	}
+
+	TEST(TEST_CLASS, AssignmentReplacesContentsWithSnapshot) {
+		// Arrange:
+		auto map = CreateMap(10);
+		auto other = CreateMap(100);
+
+		// Act:
+		map = other;
+		other.clear();
+
+		// Assert:
+		AssertContents(map, 0, 100);
+		AssertContents(other, 0, 0);
+	}
+
+	TEST(TEST_CLASS, ReadersObserveConsistentVersionsWhileWriterPublishes) {
+		// Arrange: each published version contains keys [0, i)
+		constexpr auto Num_Versions = 500u;
+		auto map = CreateMap(1);
+
+		// Act: concurrently snapshot and publish versions
+		std::vector<std::thread> readers;
+		std::atomic<bool> isWriterDone(false);
+		std::atomic<uint32_t> numInconsistentSnapshots(0);
+		for (auto i = 0u; i < 4; ++i) {
+			readers.emplace_back([&map, &isWriterDone, &numInconsistentSnapshots]() {
+				while (!isWriterDone) {
+					auto snapshot = map;
+					auto size = static_cast<uint32_t>(snapshot.size());
+					if (size != ToStlMap(snapshot).size() || snapshot.cend() == snapshot.find(size - 1))
+						++numInconsistentSnapshots;
+				}
+			});
+		}
+
+		for (auto i = 1u; i < Num_Versions; ++i) {
+			auto version = map;
+			version.insert(std::make_pair(i, std::to_string(i)));
+			map = version;
+		}
+
+		isWriterDone = true;
+		for (auto& reader : readers)
+			reader.join();
+
+		// Assert:
+		EXPECT_EQ(0u, numInconsistentSnapshots);
+		AssertContents(map, 0, Num_Versions);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,202 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+
+#include "tests/catapult/deltaset/test/BaseSetDeltaTests.h"
+#include "tests/catapult/deltaset/test/BaseSetTests.h"
+#include <atomic>
+#include <thread>
+
+namespace catapult { namespace deltaset {
+
+	namespace {
+		template<typename TMutabilityTraits>
+		using PersistentTraits = test::BaseSetTraits<
+			TMutabilityTraits,
+			test::PersistentMapSetTraits<test::SetElementType<TMutabilityTraits>>>;
+
+		using PersistentMutableTraits = PersistentTraits<test::MutableElementValueTraits>;
+		using PersistentMutablePointerTraits = PersistentTraits<test::MutableElementPointerTraits>;
+		using PersistentImmutableTraits = PersistentTraits<test::ImmutableElementValueTraits>;
+		using PersistentImmutablePointerTraits = PersistentTraits<test::ImmutablePointerValueTraits>;
+	}
+
+#define TEST_CLASS PersistentTests
+
+// persistent sets allow many attached deltas
+#undef DEFINE_BASE_SET_ATTACHED_DELTA_TESTS
+#define DEFINE_BASE_SET_ATTACHED_DELTA_TESTS(TEST_CLASS, TRAITS) \
+	TEST(TEST_CLASS, RebaseAllowsManyAttachedDeltas) { AssertRebaseAllowsManyAttachedDeltas<TRAITS>(); }
+
+	namespace {
+		template<typename TTraits>
+		void AssertRebaseAllowsManyAttachedDeltas() {
+			// Arrange:
+			auto pBaseSet = TTraits::CreateWithElements(3);
+			auto expectedElements = TTraits::CreateElements(3);
+
+			// Act:
+			auto pDelta1 = pBaseSet->rebase();
+			auto pDelta2 = pBaseSet->rebase();
+
+			// Assert:
+			TTraits::AssertContents(*pDelta1, expectedElements);
+			TTraits::AssertContents(*pDelta2, expectedElements);
+		}
+	}
+
+// base (mutable)
+DEFINE_MUTABLE_BASE_SET_TESTS_FOR(PersistentMutable);
+DEFINE_MUTABLE_BASE_SET_TESTS_FOR(PersistentMutablePointer);
+
+// base (immutable)
+DEFINE_IMMUTABLE_BASE_SET_TESTS_FOR(PersistentImmutable);
+DEFINE_IMMUTABLE_BASE_SET_TESTS_FOR(PersistentImmutablePointer);
+
+// delta (mutable)
+DEFINE_MUTABLE_BASE_SET_DELTA_TESTS_FOR(PersistentMutable);
+DEFINE_MUTABLE_BASE_SET_DELTA_TESTS_FOR(PersistentMutablePointer);
+
+// delta (immutable)
+DEFINE_IMMUTABLE_BASE_SET_DELTA_TESTS_FOR(PersistentImmutable);
+DEFINE_IMMUTABLE_BASE_SET_DELTA_TESTS_FOR(PersistentImmutablePointer);
+
+	// region multiversion
+
+	namespace {
+		using Traits = test::BaseTraits<PersistentImmutableTraits>;
+
+		auto CreateDeltaWithChanges(Traits::BaseSetTraits::Type& baseSet) {
+			auto pDelta = baseSet.rebase();
+			pDelta->emplace("MyTestElement", static_cast<unsigned int>(123));
+			pDelta->remove(Traits::CreateKey("TestElement", 0));
+			return pDelta;
+		}
+
+		auto CreateCommittedElements() {
+			return Traits::ElementVector{
+				Traits::CreateElement("TestElement", 1),
+				Traits::CreateElement("TestElement", 2),
+				Traits::CreateElement("MyTestElement", 123)
+			};
+		}
+	}
+
+	TEST(TEST_CLASS, SnapshotIsUnaffectedByCommit) {
+		// Arrange:
+		auto pBaseSet = Traits::CreateWithElements(3);
+		auto snapshot = pBaseSet->snapshot();
+		auto pDelta = CreateDeltaWithChanges(*pBaseSet);
+
+		// Act:
+		pBaseSet->commit();
+
+		// Assert:
+		EXPECT_EQ(3u, snapshot.size());
+		for (auto i = 0u; i < 3; ++i)
+			EXPECT_NE(snapshot.cend(), snapshot.find(Traits::CreateKey("TestElement", i))) << i;
+
+		Traits::AssertContents(*pBaseSet, CreateCommittedElements());
+	}
+
+	TEST(TEST_CLASS, DetachedDeltaIsUnaffectedByCommit) {
+		// Arrange:
+		auto pBaseSet = Traits::CreateWithElements(3);
+		auto pDetachedDelta = pBaseSet->rebaseDetached();
+		auto pDelta = CreateDeltaWithChanges(*pBaseSet);
+
+		// Act:
+		pBaseSet->commit();
+
+		// Assert:
+		Traits::AssertContents(*pDetachedDelta, Traits::CreateElements(3));
+		Traits::AssertContents(*pBaseSet, CreateCommittedElements());
+	}
+
+	TEST(TEST_CLASS, CommitOnlyRebasesMostRecentAttachedDelta) {
+		// Arrange:
+		auto pBaseSet = Traits::CreateWithElements(3);
+		auto pDelta1 = pBaseSet->rebase();
+		auto pDelta2 = CreateDeltaWithChanges(*pBaseSet);
+
+		// Act:
+		pBaseSet->commit();
+
+		// Assert: the older delta keeps reading its snapshot
+		Traits::AssertContents(*pDelta1, Traits::CreateElements(3));
+		Traits::AssertContents(*pDelta2, CreateCommittedElements());
+		Traits::AssertContents(*pBaseSet, CreateCommittedElements());
+		test::AssertDeltaSizes(*pBaseSet, *pDelta2, 3, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, IteratorIsUnaffectedByCommit) {
+		// Arrange:
+		auto pBaseSet = Traits::CreateWithElements(3);
+		auto view = MakeIterableView(*pBaseSet);
+		auto iter = view.begin();
+		auto pDelta = CreateDeltaWithChanges(*pBaseSet);
+
+		// Act:
+		pBaseSet->commit();
+
+		// Assert: the iterator iterates over the version that was current when it was created
+		auto numElements = 0u;
+		for (; view.end() != iter; ++iter)
+			++numElements;
+
+		EXPECT_EQ(3u, numElements);
+		Traits::AssertContents(*pBaseSet, CreateCommittedElements());
+	}
+
+	TEST(TEST_CLASS, ReadersAreNotBlockedByCommits) {
+		// Arrange:
+		constexpr auto Num_Commits = 200u;
+		auto pBaseSet = Traits::CreateWithElements(3);
+
+		// Act: continuously read while committing new elements
+		std::vector<std::thread> readers;
+		std::atomic<bool> isWriterDone(false);
+		std::atomic<uint32_t> numMissingElements(0);
+		for (auto i = 0u; i < 4; ++i) {
+			readers.emplace_back([&pBaseSet, &isWriterDone, &numMissingElements]() {
+				while (!isWriterDone) {
+					if (!pBaseSet->contains(Traits::CreateKey("TestElement", 1)))
+						++numMissingElements;
+				}
+			});
+		}
+
+		auto pDelta = pBaseSet->rebase();
+		for (auto i = 0u; i < Num_Commits; ++i) {
+			pDelta->emplace("MyTestElement", i);
+			pBaseSet->commit();
+		}
+
+		isWriterDone = true;
+		for (auto& reader : readers)
+			reader.join();
+
+		// Assert:
+		EXPECT_EQ(0u, numMissingElements);
+		EXPECT_EQ(3u + Num_Commits, pBaseSet->size());
+	}
+
+	// endregion
+}}
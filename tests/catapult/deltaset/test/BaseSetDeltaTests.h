@@ -315,6 +315,27 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region prefetch
+
+		static void AssertBaseSetDeltaPrefetchDoesNotChangeElements() {
+			// Arrange:
+			auto pDelta = CreateSetForBatchFindTests();
+			auto keys = std::vector<decltype(TTraits::CreateKey("TestElement", 0))>{
+				TTraits::CreateKey("TestElement", 0),
+				TTraits::CreateKey("TestElement", 3),
+				TTraits::CreateKey("TestElement", 7)
+			};
+
+			// Act:
+			pDelta->prefetch(keys);
+
+			// Assert:
+			AssertBatchFind<const typename decltype(pDelta)::DeltaType>(*pDelta);
+			AssertDeltaSizes(pDelta, 4, 2, 1, TTraits::IsElementMutable() ? 1 : 0);
+		}
+
+		// endregion
+
 		// region insert
 
 	private:
@@ -897,6 +918,8 @@ namespace catapult { namespace test {
 	MAKE_BASE_SET_DELTA_TEST(TEST_CLASS, TRAITS, BaseSetDeltaCanAccessAllElementsThroughFind) \
 	MAKE_BASE_SET_DELTA_TEST(TEST_CLASS, TRAITS, BaseSetDeltaCanAccessAllElementsThroughFindConst) \
 	\
+	MAKE_BASE_SET_DELTA_TEST(TEST_CLASS, TRAITS, BaseSetDeltaPrefetchDoesNotChangeElements) \
+	\
 	MAKE_BASE_SET_DELTA_TEST(TEST_CLASS, TRAITS, CanInsertElement) \
 	MAKE_BASE_SET_DELTA_TEST(TEST_CLASS, TRAITS, CanInsertWithSuppliedParameters) \
 	\
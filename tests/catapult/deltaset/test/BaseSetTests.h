@@ -211,6 +211,9 @@ namespace catapult { namespace test {
 #define MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, TEST_NAME) \
 	TEST(TEST_CLASS, TEST_NAME) { test::BaseSetTests<TRAITS>::Assert##TEST_NAME(); }
 
+#define DEFINE_BASE_SET_ATTACHED_DELTA_TESTS(TEST_CLASS, TRAITS) \
+	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, RebaseAllowsOnlyOneAttachedDeltaAtATime)
+
 #define DEFINE_BASE_SET_TESTS(TEST_CLASS, TRAITS) \
 	DEFINE_COMMON_BASE_SET_TESTS(TEST_CLASS, TRAITS) \
 	DEFINE_BASE_SET_ITERATION_TESTS(TEST_CLASS, TRAITS) \
@@ -219,7 +222,7 @@ namespace catapult { namespace test {
 	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, RemoveDoesNotChangeOriginalBaseSet) \
 	\
 	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, RebaseCreatesDeltaAroundSuppliedElements) \
-	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, RebaseAllowsOnlyOneAttachedDeltaAtATime) \
+	DEFINE_BASE_SET_ATTACHED_DELTA_TESTS(TEST_CLASS, TRAITS) \
 	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, RebaseDetachedCreatesDeltaAroundSuppliedElements) \
 	MAKE_BASE_SET_TEST(TEST_CLASS, TRAITS, RebaseDetachedAllowsManyDeltas) \
 	\
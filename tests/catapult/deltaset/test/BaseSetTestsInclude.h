@@ -25,6 +25,7 @@
 #include "catapult/deltaset/BaseSetDefaultTraits.h"
 #include "catapult/deltaset/BaseSetDelta.h"
 #include "catapult/deltaset/OrderedSet.h"
+#include "catapult/deltaset/PersistentHashMap.h"
 #include "catapult/utils/traits/StlTraits.h"
 #include "tests/test/other/TestElement.h"
 #include "tests/TestHarness.h"
@@ -50,6 +51,11 @@ namespace catapult { namespace test {
 		std::unordered_map<std::pair<std::string, unsigned int>, TElement, MapKeyHasher>,
 		TestElementToKeyConverter<TElement>>;
 
+	template<typename TElement>
+	using PersistentMapSetTraits = deltaset::MapStorageTraits<
+		deltaset::PersistentHashMap<std::pair<std::string, unsigned int>, TElement, MapKeyHasher>,
+		TestElementToKeyConverter<TElement>>;
+
 	// endregion
 
 	// region IsMutable / IsMap
@@ -76,6 +82,11 @@ namespace catapult { namespace test {
 		return utils::traits::is_map<T>::value;
 	}
 
+	template<typename TKey, typename TValue, typename THasher, typename TKeyEqual>
+	bool IsMap(const deltaset::PersistentHashMap<TKey, TValue, THasher, TKeyEqual>&) {
+		return true;
+	}
+
 	// endregion
 
 	// region ElementFactory
@@ -25,6 +25,9 @@
 #include "tests/test/nodeps/Functional.h"
 #include "tests/test/other/DisruptorTestUtils.h"
 #include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+#include <mutex>
+#include <set>
 
 namespace catapult { namespace disruptor {
 
@@ -432,6 +435,126 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region multiple producers
+
+	TEST(TEST_CLASS, CanProcessElementsFromMultipleProducers) {
+		// Arrange:
+		constexpr auto Num_Producers = 4u;
+		constexpr auto Num_Elements_Per_Producer = 50u;
+		std::vector<Heights> collectedHeights[2];
+		std::vector<Heights> inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{ CreateConsumer(collectedHeights[0]), CreateConsumer(collectedHeights[1]) },
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// Act: push elements with heights unique across all producers
+		std::vector<std::vector<DisruptorElementId>> elementIds(Num_Producers);
+		boost::thread_group threads;
+		for (auto i = 0u; i < Num_Producers; ++i) {
+			threads.create_thread([&dispatcher, &producerElementIds = elementIds[i], i]() {
+				for (auto j = 0u; j < Num_Elements_Per_Producer; ++j) {
+					auto range = test::CreateBlockEntityRange(1);
+					range.begin()->Height = Height(i * Num_Elements_Per_Producer + j + 1);
+					producerElementIds.push_back(dispatcher.processElement(ConsumerInput(std::move(range))));
+				}
+			});
+		}
+
+		threads.join_all();
+		WAIT_FOR_VALUE_EXPR(Num_Producers * Num_Elements_Per_Producer, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: all element ids were assigned exactly once
+		std::set<DisruptorElementId> uniqueElementIds;
+		for (const auto& producerElementIds : elementIds)
+			uniqueElementIds.insert(producerElementIds.cbegin(), producerElementIds.cend());
+
+		EXPECT_EQ(Num_Producers * Num_Elements_Per_Producer, dispatcher.numAddedElements());
+		ASSERT_EQ(Num_Producers * Num_Elements_Per_Producer, uniqueElementIds.size());
+		EXPECT_EQ(1u, *uniqueElementIds.cbegin());
+		EXPECT_EQ(Num_Producers * Num_Elements_Per_Producer, *uniqueElementIds.crbegin());
+
+		// - all consumers and the inspector processed elements in the same order
+		EXPECT_EQ(inspectedHeights, collectedHeights[0]);
+		EXPECT_EQ(inspectedHeights, collectedHeights[1]);
+
+		// - elements of each producer were processed in the order they were pushed
+		std::vector<Height> lastHeights(Num_Producers);
+		for (const auto& heights : inspectedHeights) {
+			auto producerId = (heights[0].unwrap() - 1) / Num_Elements_Per_Producer;
+			EXPECT_LT(lastHeights[producerId], heights[0]);
+			lastHeights[producerId] = heights[0];
+		}
+	}
+
+	// endregion
+
+	// region wait strategies
+
+#define WAIT_STRATEGY_BASED_TEST(TEST_NAME) \
+	template<ConsumerWaitStrategy WaitStrategy> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_BusySpin) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConsumerWaitStrategy::Busy_Spin>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_SpinThenYield) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConsumerWaitStrategy::Spin_Then_Yield>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Blocking) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConsumerWaitStrategy::Blocking>(); } \
+	template<ConsumerWaitStrategy WaitStrategy> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	namespace {
+		ConsumerDispatcherOptions CreateOptions(ConsumerWaitStrategy waitStrategy) {
+			auto options = Test_Dispatcher_Options;
+			options.WaitStrategy = waitStrategy;
+			return options;
+		}
+	}
+
+	WAIT_STRATEGY_BASED_TEST(IdleConsumersAreWokenByNewElements) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(6);
+		auto expectedHeights = GetExpectedHeights(ranges);
+		std::vector<Heights> collectedHeights[2];
+		std::vector<Heights> inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+
+		ConsumerDispatcher dispatcher(
+				CreateOptions(WaitStrategy),
+				{ CreateConsumer(collectedHeights[0]), CreateConsumer(collectedHeights[1]) },
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// Act: push elements in two batches and let all consumers go idle in between
+		for (auto i = 0u; i < ranges.size(); ++i) {
+			dispatcher.processElement(ConsumerInput(std::move(ranges[i])));
+			if (2 == i) {
+				WAIT_FOR_VALUE_EXPR(3u, inspectedHeights.size());
+				test::Pause();
+			}
+		}
+
+		WAIT_FOR_VALUE_EXPR(6u, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+		EXPECT_EQ(expectedHeights, collectedHeights[0]);
+		EXPECT_EQ(expectedHeights, collectedHeights[1]);
+		EXPECT_EQ(expectedHeights, inspectedHeights);
+	}
+
+	WAIT_STRATEGY_BASED_TEST(ShutdownStopsIdleConsumers) {
+		// Arrange:
+		ConsumerDispatcher dispatcher(CreateOptions(WaitStrategy), { CreateNoOpConsumer(), CreateNoOpConsumer() });
+		test::Pause();
+
+		// Act:
+		dispatcher.shutdown();
+
+		// Assert:
+		EXPECT_EQ(2u, dispatcher.size());
+		EXPECT_FALSE(dispatcher.isRunning());
+	}
+
+	// endregion
+
 	// region element marking
 
 	namespace {
@@ -507,6 +630,166 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region parallel stages
+
+	namespace {
+		constexpr auto Num_Parallel_Workers = 4u;
+
+		auto CreateSynchronizedConsumer(std::vector<Heights>& collector, std::mutex& mutex) {
+			return [&](auto& consumerInput) {
+				auto heights = BlockElementVectorToHeights(consumerInput.blocks());
+				std::lock_guard<std::mutex> guard(mutex);
+				collector.push_back(heights);
+				return ConsumerResult::Continue();
+			};
+		}
+
+		auto Sorted(std::vector<Heights>&& heightsVector) {
+			std::sort(heightsVector.begin(), heightsVector.end());
+			return std::move(heightsVector);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithStageWithoutWorkerThreads) {
+		// Arrange:
+		std::vector<DisruptorConsumerStage> stages{ { CreateNoOpConsumer(), 0 }, { CreateNoOpConsumer(), 1 } };
+
+		// Act + Assert:
+		EXPECT_THROW(ConsumerDispatcher(Test_Dispatcher_Options, stages, [](const auto&, const auto&) {}), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithParallelLastStage) {
+		// Arrange:
+		std::vector<DisruptorConsumerStage> stages{ { CreateNoOpConsumer(), 1 }, { CreateNoOpConsumer(), 2 } };
+
+		// Act + Assert:
+		EXPECT_THROW(ConsumerDispatcher(Test_Dispatcher_Options, stages, [](const auto&, const auto&) {}), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCreateDispatcherWithParallelStage) {
+		// Arrange:
+		std::vector<DisruptorConsumerStage> stages{ { CreateNoOpConsumer(), Num_Parallel_Workers }, { CreateNoOpConsumer(), 1 } };
+
+		// Act:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, stages, [](const auto&, const auto&) {});
+
+		// Assert: size is the number of stages, not the number of threads
+		EXPECT_EQ(Test_Dispatcher_Options.DispatcherName, dispatcher.name());
+		EXPECT_EQ(2u, dispatcher.size());
+		AssertHasProcessedNoElements(dispatcher);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithParallelStage) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(50);
+		auto expectedHeights = GetExpectedHeights(ranges);
+		std::mutex mutex;
+		std::vector<Heights> collectedHeights[2];
+		std::vector<Heights> inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+
+		// Act:
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{
+					{ CreateSynchronizedConsumer(collectedHeights[0], mutex), Num_Parallel_Workers },
+					{ CreateConsumer(collectedHeights[1]), 1 }
+				},
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// - push multiple elements
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(50u, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: parallel stage processed all elements (in any order)
+		EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+		EXPECT_EQ(Sorted(std::vector<Heights>(expectedHeights)), Sorted(std::move(collectedHeights[0])));
+
+		// - subsequent stage and inspector observed all elements in order
+		EXPECT_EQ(expectedHeights, collectedHeights[1]);
+		EXPECT_EQ(expectedHeights, inspectedHeights);
+		EXPECT_EQ(std::vector<CompletionStatus>(50, CompletionStatus::Normal), inspectedStatuses);
+	}
+
+	TEST(TEST_CLASS, MarkedElementsAreSkippedByParallelStage) {
+		// Arrange:
+		std::mutex mutex;
+		std::vector<Heights> collectedHeights;
+		std::vector<Heights> inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+		auto ranges = test::PrepareRanges(5);
+		auto height = 0u;
+		for (auto& range : ranges)
+			range.begin()->Height = Height(++height);
+
+		auto expectedHeights = test::Filter(GetExpectedHeights(ranges), [](const auto& heights) {
+			return 1 == heights[0].unwrap() % 2;
+		});
+
+		// Act:
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{
+					{ CreateSkipIfFirstBlockIsEvenConsumer(), 1 },
+					{ CreateSynchronizedConsumer(collectedHeights, mutex), Num_Parallel_Workers },
+					{ CreateNoOpConsumer(), 1 }
+				},
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// - push multiple elements
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+
+		// Assert:
+		EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+		EXPECT_EQ(expectedHeights, Sorted(std::move(collectedHeights)));
+
+		auto expectedStatuses = std::vector<CompletionStatus>(5, CompletionStatus::Normal);
+		expectedStatuses[1] = CompletionStatus::Aborted;
+		expectedStatuses[3] = CompletionStatus::Aborted;
+		EXPECT_EQ(expectedStatuses, inspectedStatuses);
+	}
+
+	TEST(TEST_CLASS, ParallelStageCanMarkElements) {
+		// Arrange:
+		std::vector<Heights> collectedHeights;
+		std::vector<Heights> inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+		auto ranges = test::PrepareRanges(5);
+		auto height = 0u;
+		for (auto& range : ranges)
+			range.begin()->Height = Height(++height);
+
+		auto expectedHeights = test::Filter(GetExpectedHeights(ranges), [](const auto& heights) {
+			return 1 == heights[0].unwrap() % 2;
+		});
+
+		// Act:
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{
+					{ CreateSkipIfFirstBlockIsEvenConsumer(), Num_Parallel_Workers },
+					{ CreateConsumer(collectedHeights), 1 }
+				},
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// - push multiple elements
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+
+		// Assert: subsequent stage only observed unmarked elements (in order)
+		EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+		EXPECT_EQ(expectedHeights, collectedHeights);
+
+		auto expectedStatuses = std::vector<CompletionStatus>(5, CompletionStatus::Normal);
+		expectedStatuses[1] = CompletionStatus::Aborted;
+		expectedStatuses[3] = CompletionStatus::Aborted;
+		EXPECT_EQ(expectedStatuses, inspectedStatuses);
+	}
+
+	// endregion
+
 	// region exception + space exhaution
 
 #ifdef __clang__
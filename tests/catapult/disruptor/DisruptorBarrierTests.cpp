@@ -19,7 +19,9 @@
 **/
 
 #include "catapult/disruptor/DisruptorBarrier.h"
+#include "tests/test/nodeps/Waits.h"
 #include "tests/TestHarness.h"
+#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -45,4 +47,77 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(100u, barrier.level());
 		EXPECT_EQ(2u, barrier.position());
 	}
+	TEST(TEST_CLASS, CanTryAdvanceBarrierAtCurrentPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1);
+
+		// Act:
+		auto isAdvanced = barrier.tryAdvance(1);
+
+		// Assert:
+		EXPECT_TRUE(isAdvanced);
+		EXPECT_EQ(2u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, CannotTryAdvanceBarrierAtOtherPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1);
+
+		// Act:
+		auto isAdvanced1 = barrier.tryAdvance(0);
+		auto isAdvanced2 = barrier.tryAdvance(2);
+
+		// Assert:
+		EXPECT_FALSE(isAdvanced1);
+		EXPECT_FALSE(isAdvanced2);
+		EXPECT_EQ(1u, barrier.position());
+	}
+
+	// region waitForAdvance
+
+	TEST(TEST_CLASS, WaitForAdvanceReturnsImmediatelyWhenBarrierIsPastPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 2);
+
+		// Act:
+		auto isAdvanced = barrier.waitForAdvance(1, std::chrono::milliseconds(60'000));
+
+		// Assert:
+		EXPECT_TRUE(isAdvanced);
+	}
+
+	TEST(TEST_CLASS, WaitForAdvanceReturnsFalseWhenTimeoutElapses) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 2);
+
+		// Act:
+		auto isAdvanced = barrier.waitForAdvance(2, std::chrono::milliseconds(5));
+
+		// Assert:
+		EXPECT_FALSE(isAdvanced);
+		EXPECT_EQ(2u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, WaitForAdvanceIsSignaledByAdvance) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 2);
+		std::atomic_bool isWaiting(false);
+		auto isAdvanced = false;
+
+		// Act: advance the barrier while another thread is blocked on it
+		std::thread waiter([&barrier, &isWaiting, &isAdvanced]() {
+			isWaiting = true;
+			isAdvanced = barrier.waitForAdvance(2, std::chrono::milliseconds(60'000));
+		});
+
+		WAIT_FOR(isWaiting);
+		barrier.advance();
+		waiter.join();
+
+		// Assert:
+		EXPECT_TRUE(isAdvanced);
+		EXPECT_EQ(3u, barrier.position());
+	}
+
+	// endregion
 }}
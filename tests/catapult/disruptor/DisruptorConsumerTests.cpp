@@ -191,4 +191,40 @@ namespace catapult { namespace disruptor {
 			++i;
 		}
 	}
+	TEST(TEST_CLASS, StagesFromConsumers_CanMapZeroConsumers) {
+		// Act:
+		auto stages = DisruptorConsumerStagesFromConsumers({});
+
+		// Assert:
+		EXPECT_TRUE(stages.empty());
+	}
+
+	TEST(TEST_CLASS, StagesFromConsumers_CanMapMultipleConsumers) {
+		// Arrange:
+		constexpr auto Num_Consumers = 4u;
+		std::vector<size_t> consumerCallCounts(Num_Consumers);
+		std::vector<DisruptorConsumer> consumers;
+		for (auto i = 0u; i < Num_Consumers; ++i) {
+			consumers.push_back([&consumerCallCounts, i](const auto&) {
+				++consumerCallCounts[i];
+				return ConsumerResult::Continue();
+			});
+		}
+
+		// Act:
+		auto stages = DisruptorConsumerStagesFromConsumers(consumers);
+
+		// Assert: each stage wraps the corresponding consumer and has a single worker thread
+		ASSERT_EQ(Num_Consumers, stages.size());
+
+		auto i = 0u;
+		ConsumerInput input;
+		for (const auto& stage : stages) {
+			stage.Consumer(input);
+
+			EXPECT_EQ(1u, stage.NumWorkerThreads) << "stage " << i;
+			EXPECT_EQ(1u, consumerCallCounts[i]) << "stage " << i;
+			++i;
+		}
+	}
 }}
@@ -199,4 +199,77 @@ namespace catapult { namespace disruptor {
 				EXPECT_TRUE(disruptor.isSkipped(i));
 		}
 	}
+	// region publish
+
+	namespace {
+		DisruptorElementId PublishBlock(Disruptor& disruptor, PositionType position) {
+			auto pBlock = test::GenerateEmptyRandomBlock();
+			pBlock->Height = Height(position + 1);
+			return disruptor.publish(position, ConsumerInput(model::BlockRange::FromEntity(std::move(pBlock))), [](auto, auto) {});
+		}
+	}
+
+	TEST(TEST_CLASS, NoElementsArePublishedInitially) {
+		// Arrange:
+		Disruptor disruptor(16);
+
+		// Act + Assert:
+		for (auto i = 0u; i < 32; ++i)
+			EXPECT_FALSE(disruptor.isPublished(i)) << "position " << i;
+	}
+
+	TEST(TEST_CLASS, AddPublishesElement) {
+		// Arrange:
+		Disruptor disruptor(16);
+
+		// Act:
+		PushBlock(disruptor, test::GenerateEmptyRandomBlock());
+
+		// Assert:
+		EXPECT_TRUE(disruptor.isPublished(0));
+		EXPECT_FALSE(disruptor.isPublished(1));
+		EXPECT_FALSE(disruptor.isPublished(16));
+	}
+
+	TEST(TEST_CLASS, CanPublishElementsOutOfOrder) {
+		// Arrange:
+		Disruptor disruptor(16);
+
+		// Act:
+		auto id3 = PublishBlock(disruptor, 2);
+		auto id1 = PublishBlock(disruptor, 0);
+
+		// Assert:
+		EXPECT_EQ(2u, disruptor.size());
+		EXPECT_EQ(2u, disruptor.added());
+		EXPECT_EQ(1u, id1);
+		EXPECT_EQ(3u, id3);
+
+		EXPECT_TRUE(disruptor.isPublished(0));
+		EXPECT_FALSE(disruptor.isPublished(1));
+		EXPECT_TRUE(disruptor.isPublished(2));
+
+		EXPECT_EQ(Height(1), disruptor.elementAt(0).input().blocks()[0].Block.Height);
+		EXPECT_EQ(Height(3), disruptor.elementAt(2).input().blocks()[0].Block.Height);
+	}
+
+	TEST(TEST_CLASS, PublishingElementInReusedSlotUnpublishesPreviousElement) {
+		// Arrange:
+		Disruptor disruptor(16);
+		PublishBlock(disruptor, 3);
+
+		// Act + Assert: the next element stored in the same slot is not published
+		EXPECT_TRUE(disruptor.isPublished(3));
+		EXPECT_FALSE(disruptor.isPublished(19));
+
+		// Act: publish the next element stored in the same slot
+		PublishBlock(disruptor, 19);
+
+		// Assert:
+		EXPECT_FALSE(disruptor.isPublished(3));
+		EXPECT_TRUE(disruptor.isPublished(19));
+		EXPECT_EQ(20u, disruptor.elementAt(19).id());
+	}
+
+	// endregion
 }}
@@ -0,0 +1,79 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/ParallelConsumerEntry.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS ParallelConsumerEntryTests
+
+	TEST(TEST_CLASS, CanCreateAnEntry) {
+		// Arrange:
+		ParallelConsumerEntry consumer(123, 10);
+
+		// Assert:
+		EXPECT_EQ(123u, consumer.level());
+		EXPECT_FALSE(consumer.isCompleted(0));
+	}
+
+	TEST(TEST_CLASS, CanClaimPositionsBeforeEndPosition) {
+		// Arrange:
+		ParallelConsumerEntry consumer(123, 10);
+
+		// Act:
+		std::vector<PositionType> positions;
+		PositionType position;
+		while (consumer.tryClaim(3, position))
+			positions.push_back(position);
+
+		// Assert:
+		EXPECT_EQ(std::vector<PositionType>({ 0, 1, 2 }), positions);
+	}
+
+	TEST(TEST_CLASS, CanClaimMorePositionsAfterEndPositionIncreases) {
+		// Arrange:
+		ParallelConsumerEntry consumer(123, 10);
+		PositionType position;
+		while (consumer.tryClaim(3, position))
+		{}
+
+		// Act:
+		auto isClaimed = consumer.tryClaim(5, position);
+
+		// Assert:
+		EXPECT_TRUE(isClaimed);
+		EXPECT_EQ(3u, position);
+	}
+
+	TEST(TEST_CLASS, CanCompletePositionsOutOfOrder) {
+		// Arrange:
+		ParallelConsumerEntry consumer(123, 10);
+
+		// Act:
+		consumer.complete(2);
+		consumer.complete(0);
+
+		// Assert:
+		EXPECT_TRUE(consumer.isCompleted(0));
+		EXPECT_FALSE(consumer.isCompleted(1));
+		EXPECT_TRUE(consumer.isCompleted(2));
+	}
+}}
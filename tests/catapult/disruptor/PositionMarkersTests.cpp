@@ -0,0 +1,63 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/PositionMarkers.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS PositionMarkersTests
+
+	TEST(TEST_CLASS, NoPositionsAreMarkedInitially) {
+		// Arrange:
+		PositionMarkers markers(5);
+
+		// Assert:
+		for (auto i = 0u; i < 10; ++i)
+			EXPECT_FALSE(markers.isMarked(i)) << "position " << i;
+	}
+
+	TEST(TEST_CLASS, CanMarkPositions) {
+		// Arrange:
+		PositionMarkers markers(5);
+
+		// Act:
+		markers.mark(1);
+		markers.mark(3);
+
+		// Assert:
+		for (auto i = 0u; i < 5; ++i)
+			EXPECT_EQ(1 == i % 2, markers.isMarked(i)) << "position " << i;
+	}
+
+	TEST(TEST_CLASS, MarkingPositionUnmarksPositionsSharingSameElement) {
+		// Arrange:
+		PositionMarkers markers(5);
+		markers.mark(2);
+
+		// Act:
+		markers.mark(7);
+
+		// Assert:
+		EXPECT_FALSE(markers.isMarked(2));
+		EXPECT_TRUE(markers.isMarked(7));
+		EXPECT_FALSE(markers.isMarked(12));
+	}
+}}
@@ -36,6 +36,7 @@ namespace catapult { namespace extensions {
 		EXPECT_TRUE(!!config.pValidator);
 		EXPECT_TRUE(!!config.pNotificationPublisher);
 		EXPECT_TRUE(!!config.ResolverContextFactory);
+		EXPECT_FALSE(!!config.PrefetchKeysExtractor);
 
 		// - notice that only observers and validators registered in CreateDefaultPluginManager are present
 		std::vector<std::string> expectedObserverNames{
@@ -62,4 +63,18 @@ namespace catapult { namespace extensions {
 		};
 		EXPECT_EQ(expectedValidatorNames, config.pValidator->names());
 	}
+
+	TEST(TEST_CLASS, CanCreateExecutionConfigurationWithPrefetchKeysExtractorWhenCacheDatabaseIsPreferred) {
+		// Arrange:
+		plugins::StorageConfiguration storageConfig;
+		storageConfig.PreferCacheDatabase = true;
+		plugins::PluginManager manager(model::BlockChainConfiguration::Uninitialized(), storageConfig);
+
+		// Act:
+		auto config = CreateExecutionConfiguration(manager);
+
+		// Assert:
+		EXPECT_TRUE(!!config.ResolverContextFactory);
+		EXPECT_TRUE(!!config.PrefetchKeysExtractor);
+	}
 }}
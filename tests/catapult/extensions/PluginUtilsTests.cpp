@@ -32,6 +32,11 @@ namespace catapult { namespace extensions {
 		auto nodeConfig = config::NodeConfiguration::Uninitialized();
 		nodeConfig.ShouldUseCacheDatabaseStorage = true;
 		nodeConfig.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromKilobytes(123);
+		nodeConfig.CacheDatabaseBlockCacheSize = utils::FileSize::FromMegabytes(31);
+		nodeConfig.CacheDatabaseWriteBufferBudget = utils::FileSize::FromMegabytes(19);
+		nodeConfig.MaxPatriciaTreeNodeCacheSize = 4321;
+		nodeConfig.PatriciaTreeNodeCachePinnedLevels = 3;
+		nodeConfig.PatriciaTreeRetainedRoots = 25;
 
 		auto userConfig = config::UserConfiguration::Uninitialized();
 		userConfig.DataDirectory = "foo_bar";
@@ -49,6 +54,11 @@ namespace catapult { namespace extensions {
 		EXPECT_TRUE(storageConfig.PreferCacheDatabase);
 		EXPECT_EQ("foo_bar/statedb", storageConfig.CacheDatabaseDirectory);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(123), storageConfig.MaxCacheDatabaseWriteBatchSize);
+		EXPECT_EQ(utils::FileSize::FromMegabytes(31), storageConfig.CacheDatabaseBlockCacheSize);
+		EXPECT_EQ(utils::FileSize::FromMegabytes(19), storageConfig.CacheDatabaseWriteBufferBudget);
+		EXPECT_EQ(4321u, storageConfig.MaxPatriciaTreeNodeCacheSize);
+		EXPECT_EQ(3u, storageConfig.PatriciaTreeNodeCachePinnedLevels);
+		EXPECT_EQ(25u, storageConfig.PatriciaTreeRetainedRoots);
 	}
 
 	TEST(TEST_CLASS, CanCreateStatelessValidator) {
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/handlers/TransactionHandlers.h"
+#include "catapult/api/ChainPackets.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
@@ -179,4 +180,168 @@ namespace catapult { namespace handlers {
 	DEFINE_PULL_HANDLER_REQUEST_RESPONSE_TESTS(TEST_CLASS, AssertPullResponseIsSetIfPacketIsValid)
 
 	// endregion
+
+	// region PullTransactionsSketchHandler
+
+	namespace {
+		constexpr auto Sketch_Packet_Type = ionet::PacketType::Pull_Transactions_Sketch;
+		constexpr auto Sketch_Cell_Size = sizeof(utils::ShortHashSketchCell);
+
+		class PullSketchTestContext {
+		public:
+			explicit PullSketchTestContext(const UtSketchRetrieverResult& result) : m_numCalls(0) {
+				RegisterPullTransactionsSketchHandler(m_handlers, [this, result](auto minFeeMultiplier, const auto& sketch) {
+					++m_numCalls;
+					m_minFeeMultiplier = minFeeMultiplier;
+					m_cells = sketch.cells();
+					return result;
+				});
+			}
+
+		public:
+			auto numCalls() const {
+				return m_numCalls;
+			}
+
+			auto minFeeMultiplier() const {
+				return m_minFeeMultiplier;
+			}
+
+			const auto& cells() const {
+				return m_cells;
+			}
+
+		public:
+			bool process(const ionet::Packet& packet, ionet::ServerPacketHandlerContext& context) {
+				return m_handlers.process(packet, context);
+			}
+
+		private:
+			ionet::ServerPacketHandlers m_handlers;
+			size_t m_numCalls;
+			BlockFeeMultiplier m_minFeeMultiplier;
+			std::vector<utils::ShortHashSketchCell> m_cells;
+		};
+
+		auto CreateSketchRequestPacket(uint32_t numCells) {
+			return test::CreateRandomPacket(sizeof(BlockFeeMultiplier) + numCells * Sketch_Cell_Size, Sketch_Packet_Type);
+		}
+
+		void AssertSketchRequestIsRejected(const ionet::Packet& packet) {
+			// Arrange:
+			PullSketchTestContext testContext(UtSketchRetrieverResult{});
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			auto isProcessed = testContext.process(packet, context);
+
+			// Assert:
+			EXPECT_EQ(Sketch_Packet_Type == packet.Type, isProcessed);
+			EXPECT_EQ(0u, testContext.numCalls());
+			EXPECT_FALSE(context.hasResponse());
+		}
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_TooSmallPacketIsRejected) {
+		// Arrange:
+		auto pPacket = test::CreateRandomPacket(sizeof(BlockFeeMultiplier) - 1, Sketch_Packet_Type);
+
+		// Act + Assert:
+		AssertSketchRequestIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_PacketWithWrongTypeIsRejected) {
+		// Arrange:
+		auto pPacket = CreateSketchRequestPacket(3);
+		pPacket->Type = ionet::PacketType::Pull_Transactions;
+
+		// Act + Assert:
+		AssertSketchRequestIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_PacketWithoutCellsIsRejected) {
+		// Arrange:
+		auto pPacket = CreateSketchRequestPacket(0);
+
+		// Act + Assert:
+		AssertSketchRequestIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_PacketWithPartialCellIsRejected) {
+		// Arrange:
+		auto pPacket = test::CreateRandomPacket(sizeof(BlockFeeMultiplier) + 3 * Sketch_Cell_Size + 1, Sketch_Packet_Type);
+
+		// Act + Assert:
+		AssertSketchRequestIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_PacketWithInvalidNumberOfCellsIsRejected) {
+		// Arrange:
+		auto pPacket = CreateSketchRequestPacket(utils::ShortHashSketch::Num_Hash_Functions + 1);
+
+		// Act + Assert:
+		AssertSketchRequestIsRejected(*pPacket);
+	}
+
+	namespace {
+		void AssertPullSketchResponseIsSet(uint32_t numResponseTransactions) {
+			// Arrange:
+			auto pPacket = CreateSketchRequestPacket(6);
+			PullResponseContext responseContext(numResponseTransactions);
+			PullSketchTestContext testContext(UtSketchRetrieverResult{ true, 123, responseContext.response() });
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			EXPECT_TRUE(testContext.process(*pPacket, context));
+
+			// Assert: the requested values were passed to the retriever
+			EXPECT_EQ(1u, testContext.numCalls());
+			EXPECT_EQ(reinterpret_cast<const BlockFeeMultiplier&>(*pPacket->Data()), testContext.minFeeMultiplier());
+			ASSERT_EQ(6u, testContext.cells().size());
+			EXPECT_EQ_MEMORY(pPacket->Data() + sizeof(BlockFeeMultiplier), testContext.cells().data(), 6 * Sketch_Cell_Size);
+
+			// - the response is prepended with the number of differences
+			ASSERT_TRUE(context.hasResponse());
+			auto payload = context.response();
+			auto expectedSize = sizeof(ionet::PacketHeader) + sizeof(uint32_t) + responseContext.responseSize();
+			test::AssertPacketHeader(payload, expectedSize, Sketch_Packet_Type);
+			ASSERT_EQ(1 + numResponseTransactions, payload.buffers().size());
+			EXPECT_EQ(123u, reinterpret_cast<const uint32_t&>(*payload.buffers()[0].pData));
+
+			for (auto i = 0u; i < numResponseTransactions; ++i) {
+				const auto& transaction = reinterpret_cast<const mocks::MockTransaction&>(*payload.buffers()[1 + i].pData);
+				EXPECT_EQ(*responseContext.response()[i], transaction) << "transaction at " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_ResponseIsSetWhenThereAreNoResponseTransactions) {
+		// Assert:
+		AssertPullSketchResponseIsSet(0);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_ResponseIsSetWhenThereAreResponseTransactions) {
+		// Assert:
+		AssertPullSketchResponseIsSet(3);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketch_ResponseIndicatesUndecodableSketch) {
+		// Arrange:
+		auto pPacket = CreateSketchRequestPacket(6);
+		PullSketchTestContext testContext(UtSketchRetrieverResult{ false, 123, UnconfirmedTransactions() });
+
+		// Act:
+		ionet::ServerPacketHandlerContext context({}, "");
+		EXPECT_TRUE(testContext.process(*pPacket, context));
+
+		// Assert:
+		EXPECT_EQ(1u, testContext.numCalls());
+		ASSERT_TRUE(context.hasResponse());
+		auto payload = context.response();
+		test::AssertPacketHeader(payload, sizeof(ionet::PacketHeader) + sizeof(uint32_t), Sketch_Packet_Type);
+		ASSERT_EQ(1u, payload.buffers().size());
+		EXPECT_EQ(api::Undecodable_Sketch_Num_Differences, reinterpret_cast<const uint32_t&>(*payload.buffers()[0].pData));
+	}
+
+	// endregion
 }}
@@ -257,6 +257,33 @@ namespace catapult { namespace io {
 		EXPECT_EQ(context.storage().pBlock, pBlock);
 	}
 
+	TEST(TEST_CLASS, LoadBlocksDelegatesToStorage) {
+		// Arrange:
+		class MockBlockStorage : public UnsupportedBlockStorage {
+		public:
+			mutable std::vector<std::tuple<Height, size_t, size_t>> Params;
+			std::shared_ptr<const model::Block> pBlock = test::GenerateEmptyRandomBlock();
+
+		public:
+			std::vector<std::shared_ptr<const model::Block>> loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const override {
+				Params.emplace_back(height, maxBlocks, maxBytes);
+				return { pBlock, pBlock };
+			}
+		};
+
+		TestContext<MockBlockStorage> context;
+
+		// Act:
+		auto blocks = context.aggregate().loadBlocks(Height(321), 7, 1234);
+
+		// Assert:
+		ASSERT_EQ(1u, context.storage().Params.size());
+		EXPECT_EQ(std::make_tuple(Height(321), 7u, 1234u), context.storage().Params[0]);
+		ASSERT_EQ(2u, blocks.size());
+		EXPECT_EQ(context.storage().pBlock, blocks[0]);
+		EXPECT_EQ(context.storage().pBlock, blocks[1]);
+	}
+
 	TEST(TEST_CLASS, LoadBlockElementDelegatesToStorage) {
 		// Arrange:
 		TestContext<MockBlockStorageBlockLoader> context;
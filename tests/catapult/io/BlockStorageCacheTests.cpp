@@ -58,6 +58,10 @@ namespace catapult { namespace io {
 				return m_cache.view().loadBlock(height);
 			}
 
+			std::vector<std::shared_ptr<const model::Block>> loadBlocks(Height height, size_t maxBlocks, size_t maxBytes) const override {
+				return m_cache.view().loadBlocks(height, maxBlocks, maxBytes);
+			}
+
 			std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override {
 				return m_cache.view().loadBlockElement(height);
 			}
@@ -330,6 +334,179 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region caching
+
+	namespace {
+		// blocks at heights greater than one (nemesis) have no transactions
+		constexpr uint64_t Cached_Block_Size = sizeof(model::BlockElement) + sizeof(model::Block);
+
+		void AssertStatistics(
+				const BlockStorageCache& cache,
+				size_t expectedNumCachedBlocks,
+				uint64_t expectedNumHits,
+				uint64_t expectedNumMisses) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(expectedNumCachedBlocks, statistics.NumCachedBlocks);
+			EXPECT_EQ(expectedNumCachedBlocks * Cached_Block_Size, statistics.CachedBlocksSize);
+			EXPECT_EQ(expectedNumHits, statistics.NumHits);
+			EXPECT_EQ(expectedNumMisses, statistics.NumMisses);
+		}
+
+		std::unique_ptr<BlockStorageCache> CreateBoundedCache(size_t maxCachedBlocks) {
+			auto maxCacheSize = utils::FileSize::FromBytes(maxCachedBlocks * Cached_Block_Size);
+			return std::make_unique<BlockStorageCache>(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), maxCacheSize);
+		}
+
+		model::BlockElement CreateBlockElementAtHeight(model::Block& block, Height height) {
+			block.Size = sizeof(model::Block);
+			block.Height = height;
+			return test::BlockToBlockElement(block);
+		}
+	}
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		auto pCache = CreateBoundedCache(5);
+
+		// Assert:
+		AssertStatistics(*pCache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, LoadBlockElementCachesElementLoadedFromStorage) {
+		// Arrange:
+		auto pCache = CreateBoundedCache(5);
+
+		// Act:
+		auto pBlockElement1 = pCache->view().loadBlockElement(Height(7));
+		auto pBlockElement2 = pCache->view().loadBlockElement(Height(7));
+
+		// Assert:
+		EXPECT_EQ(pBlockElement1, pBlockElement2);
+		EXPECT_EQ(Height(7), pBlockElement2->Block.Height);
+		AssertStatistics(*pCache, 1, 1, 1);
+	}
+
+	TEST(TEST_CLASS, LoadBlockSharesCacheWithLoadBlockElement) {
+		// Arrange:
+		auto pCache = CreateBoundedCache(5);
+
+		// Act:
+		auto pBlock = pCache->view().loadBlock(Height(7));
+		auto pBlockElement = pCache->view().loadBlockElement(Height(7));
+
+		// Assert:
+		EXPECT_EQ(&pBlockElement->Block, pBlock.get());
+		AssertStatistics(*pCache, 1, 1, 1);
+	}
+
+	TEST(TEST_CLASS, LoadEvictsLeastRecentlyUsedElementsWhenCacheIsFull) {
+		// Arrange:
+		auto pCache = CreateBoundedCache(3);
+		for (auto height : { 2u, 3u, 4u, 2u })
+			pCache->view().loadBlockElement(Height(height));
+
+		// Sanity:
+		AssertStatistics(*pCache, 3, 1, 3);
+
+		// Act: height 3 is least recently used and should be evicted
+		pCache->view().loadBlockElement(Height(5));
+
+		// Assert:
+		AssertStatistics(*pCache, 3, 1, 4);
+
+		for (auto height : { 2u, 4u, 5u })
+			pCache->view().loadBlockElement(Height(height));
+
+		AssertStatistics(*pCache, 3, 4, 4);
+
+		pCache->view().loadBlockElement(Height(3));
+		AssertStatistics(*pCache, 3, 4, 5);
+	}
+
+	TEST(TEST_CLASS, CacheWithZeroSizeRetainsMostRecentlyUsedElement) {
+		// Arrange:
+		auto pCache = CreateBoundedCache(0);
+
+		// Act:
+		for (auto height : { 2u, 3u, 3u })
+			pCache->view().loadBlockElement(Height(height));
+
+		// Assert:
+		AssertStatistics(*pCache, 1, 1, 2);
+	}
+
+	TEST(TEST_CLASS, SaveBlockPopulatesCache) {
+		// Arrange:
+		auto pCache = CreateBoundedCache(5);
+		model::Block block;
+		auto blockElement = CreateBlockElementAtHeight(block, Height(Delegation_Chain_Size + 1));
+
+		// Act:
+		pCache->modifier().saveBlock(blockElement);
+		auto pBlockElement = pCache->view().loadBlockElement(Height(Delegation_Chain_Size + 1));
+
+		// Assert: the cached element is a copy
+		EXPECT_NE(&blockElement.Block, &pBlockElement->Block);
+		EXPECT_EQ(block, pBlockElement->Block);
+		AssertStatistics(*pCache, 1, 1, 0);
+	}
+
+	TEST(TEST_CLASS, SaveBlocksPopulatesCacheWithAllElements) {
+		// Arrange:
+		auto pCache = CreateBoundedCache(5);
+		std::vector<model::Block> blocks(3);
+		std::vector<model::BlockElement> blockElements;
+		for (auto i = 0u; i < blocks.size(); ++i)
+			blockElements.push_back(CreateBlockElementAtHeight(blocks[i], Height(Delegation_Chain_Size + 1 + i)));
+
+		// Act:
+		pCache->modifier().saveBlocks(blockElements);
+		for (auto i = 0u; i < blocks.size(); ++i)
+			pCache->view().loadBlockElement(Height(Delegation_Chain_Size + 1 + i));
+
+		// Assert:
+		AssertStatistics(*pCache, 3, 3, 0);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterEvictsElementsAboveHeight) {
+		// Arrange:
+		auto pCache = CreateBoundedCache(5);
+		for (auto height : { 5u, 6u, 7u, 8u, 9u })
+			pCache->view().loadBlockElement(Height(height));
+
+		// Act:
+		pCache->modifier().dropBlocksAfter(Height(6));
+
+		// Assert:
+		AssertStatistics(*pCache, 2, 0, 5);
+
+		for (auto height : { 5u, 6u })
+			pCache->view().loadBlockElement(Height(height));
+
+		AssertStatistics(*pCache, 2, 2, 5);
+	}
+
+	TEST(TEST_CLASS, SaveBlockAfterDropBlocksAfterReplacesCachedElement) {
+		// Arrange:
+		auto pCache = CreateBoundedCache(5);
+		pCache->view().loadBlockElement(Height(7));
+		pCache->modifier().dropBlocksAfter(Height(6));
+
+		model::Block block;
+		auto blockElement = CreateBlockElementAtHeight(block, Height(7));
+		block.Timestamp = Timestamp(12345);
+
+		// Act:
+		pCache->modifier().saveBlock(blockElement);
+		auto pBlockElement = pCache->view().loadBlockElement(Height(7));
+
+		// Assert:
+		EXPECT_EQ(Timestamp(12345), pBlockElement->Block.Timestamp);
+		AssertStatistics(*pCache, 1, 1, 1);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
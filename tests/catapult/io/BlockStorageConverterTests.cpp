@@ -0,0 +1,117 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/BlockStorageConverter.h"
+#include "catapult/io/PackedFileBlockStorage.h"
+#include "tests/test/core/BlockStorageTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/mocks/MockMemoryBlockStorage.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS BlockStorageConverterTests
+
+	namespace {
+		void SeedBlocksWithStatements(BlockStorage& storage, Height startHeight, Height endHeight) {
+			for (auto height = startHeight; height <= endHeight; height = height + Height(1)) {
+				auto pBlock = test::GenerateBlockWithTransactionsAtHeight(height);
+				auto blockElement = test::CreateBlockElementForSaveTests(*pBlock);
+				if (0 == height.unwrap() % 2)
+					blockElement.OptionalStatement = test::GenerateRandomStatements({ 2, 1, 3 });
+
+				storage.saveBlock(blockElement);
+			}
+		}
+
+		void AssertEqualStorage(const BlockStorage& expectedStorage, const BlockStorage& storage) {
+			ASSERT_EQ(expectedStorage.chainHeight(), storage.chainHeight());
+
+			for (auto height = Height(1); height <= storage.chainHeight(); height = height + Height(1)) {
+				auto message = "at height " + std::to_string(height.unwrap());
+				// statements are compared as raw data below because not all storages attach them to loaded elements
+				auto expectedBlockElement = *expectedStorage.loadBlockElement(height);
+				expectedBlockElement.OptionalStatement.reset();
+				test::AssertEqual(expectedBlockElement, *storage.loadBlockElement(height));
+
+				auto expectedStatementPair = expectedStorage.loadBlockStatementData(height);
+				auto statementPair = storage.loadBlockStatementData(height);
+				EXPECT_EQ(expectedStatementPair.second, statementPair.second) << message;
+				EXPECT_EQ(expectedStatementPair.first, statementPair.first) << message;
+			}
+
+			auto numHashes = static_cast<size_t>(storage.chainHeight().unwrap());
+			auto expectedHashes = expectedStorage.loadHashesFrom(Height(1), numHashes);
+			auto hashes = storage.loadHashesFrom(Height(1), numHashes);
+			ASSERT_EQ(expectedHashes.size(), hashes.size());
+			EXPECT_TRUE(std::equal(expectedHashes.cbegin(), expectedHashes.cend(), hashes.cbegin()));
+		}
+	}
+
+	TEST(TEST_CLASS, ConvertCopiesAllBlocksAndStatements) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		mocks::MockMemoryBlockStorage source;
+		SeedBlocksWithStatements(source, Height(2), Height(10));
+		PackedFileBlockStorage destination(tempDir.name());
+
+		// Act:
+		auto numCopiedBlocks = ConvertBlockStorage(source, destination);
+
+		// Assert:
+		EXPECT_EQ(10u, numCopiedBlocks);
+		AssertEqualStorage(source, destination);
+	}
+
+	TEST(TEST_CLASS, ConvertResumesAfterLastDestinationBlock) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		mocks::MockMemoryBlockStorage source;
+		SeedBlocksWithStatements(source, Height(2), Height(10));
+		PackedFileBlockStorage destination(tempDir.name());
+		ConvertBlockStorage(source, destination);
+
+		SeedBlocksWithStatements(source, Height(11), Height(15));
+
+		// Act:
+		auto numCopiedBlocks = ConvertBlockStorage(source, destination);
+
+		// Assert:
+		EXPECT_EQ(5u, numCopiedBlocks);
+		AssertEqualStorage(source, destination);
+	}
+
+	TEST(TEST_CLASS, ConvertIsNoOpWhenDestinationIsUpToDate) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		mocks::MockMemoryBlockStorage source;
+		SeedBlocksWithStatements(source, Height(2), Height(10));
+		PackedFileBlockStorage destination(tempDir.name());
+		ConvertBlockStorage(source, destination);
+
+		// Act:
+		auto numCopiedBlocks = ConvertBlockStorage(source, destination);
+
+		// Assert:
+		EXPECT_EQ(0u, numCopiedBlocks);
+		AssertEqualStorage(source, destination);
+	}
+}}
@@ -0,0 +1,199 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/PackedFileBlockStorage.h"
+#include "catapult/io/BlockStorageConverter.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "tests/test/core/BlockStorageTests.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS PackedFileBlockStorageTests
+
+	namespace {
+		// use small segments so that tests span multiple segment files
+		constexpr auto Max_Segment_Size = utils::FileSize::FromKilobytes(16);
+
+		struct PackedTraits {
+			using Guard = test::TempDirectoryGuard;
+			using StorageType = PackedFileBlockStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination) {
+				return std::make_unique<StorageType>(destination, Max_Segment_Size);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				// convert the seeded file-based storage into a packed storage
+				test::PrepareStorage(destination);
+				auto pStorage = OpenStorage(destination);
+				ConvertBlockStorage(FileBlockStorage(destination), *pStorage);
+
+				if (Height() != height)
+					// abuse drop blocks to fake current height
+					pStorage->dropBlocksAfter(Height(height.unwrap() - 1));
+
+				return pStorage;
+			}
+		};
+
+		bool SegmentExists(const std::string& directory, const std::string& filename) {
+			return boost::filesystem::exists(boost::filesystem::path(directory) / filename);
+		}
+	}
+
+	// the seed only contains file-based storage, so the nemesis test is replaced by conversion tests below
+	DEFINE_BLOCK_STORAGE_TESTS_WITHOUT_SEED(PackedTraits)
+
+	// region empty / seed
+
+	TEST(TEST_CLASS, ChainHeightIsZeroWhenStorageIsEmpty) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+
+		// Act:
+		PackedFileBlockStorage storage(tempDir.name());
+
+		// Assert:
+		EXPECT_EQ(Height(0), storage.chainHeight());
+		EXPECT_TRUE(storage.loadHashesFrom(Height(1), 10).empty());
+		EXPECT_THROW(storage.loadBlock(Height(1)), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, StorageConvertedFromSeedContainsNemesisBlock) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto nemesisBlockElement = test::BlockToBlockElement(test::GetNemesisBlock());
+		nemesisBlockElement.GenerationHash = test::GetNemesisGenerationHash();
+
+		// Act:
+		auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+		auto pBlockElement = pStorage->loadBlockElement(Height(1));
+
+		// Assert:
+		EXPECT_EQ(Height(1), pStorage->chainHeight());
+		test::AssertEqual(nemesisBlockElement, *pBlockElement);
+		EXPECT_TRUE(model::VerifyBlockHeaderSignature(pBlockElement->Block));
+	}
+
+	// endregion
+
+	// region disk persistence
+
+	TEST(TEST_CLASS, CanReadSavedBlockAcrossDifferentStorageInstances) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(Height(2));
+		auto element = test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>());
+		{
+			auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element);
+		}
+
+		// Act:
+		PackedFileBlockStorage storage(tempDir.name());
+		auto pBlockElement = storage.loadBlockElement(Height(2));
+
+		// Assert:
+		EXPECT_EQ(Height(2), storage.chainHeight());
+		test::AssertEqual(element, *pBlockElement);
+	}
+
+	TEST(TEST_CLASS, CanSaveBlocksAcrossMultipleSegments) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		std::vector<model::BlockElement> elements;
+		for (auto i = 2u; i <= 30; ++i) {
+			blocks.push_back(test::GenerateBlockWithTransactionsAtHeight(Height(i)));
+			elements.push_back(test::CreateBlockElementForSaveTests(*blocks.back()));
+		}
+
+		// Act: save some blocks in one instance and the remaining blocks in another instance
+		{
+			auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+			for (auto i = 0u; i < 15; ++i)
+				pStorage->saveBlock(elements[i]);
+		}
+
+		auto pStorage = PackedTraits::OpenStorage(tempDir.name());
+		for (auto i = 15u; i < elements.size(); ++i)
+			pStorage->saveBlock(elements[i]);
+
+		// Assert:
+		EXPECT_TRUE(SegmentExists(tempDir.name(), "packed_00000.dat"));
+		EXPECT_TRUE(SegmentExists(tempDir.name(), "packed_00001.dat"));
+
+		EXPECT_EQ(Height(30), pStorage->chainHeight());
+		for (auto i = 0u; i < elements.size(); ++i)
+			test::AssertEqual(elements[i], *pStorage->loadBlockElement(Height(i + 2)));
+	}
+
+	// endregion
+
+	// region zero copy
+
+	TEST(TEST_CLASS, LoadedBlockIsNotModifiedWhenBlockAtSameHeightIsSaved) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(Height(2));
+		auto element = test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>());
+		pStorage->saveBlock(element);
+		auto pOriginalBlockElement = pStorage->loadBlockElement(Height(2));
+		auto pOriginalBlock = pStorage->loadBlock(Height(2));
+
+		// Act: replace the block
+		auto pNewBlock = test::GenerateBlockWithTransactionsAtHeight(Height(2));
+		auto newElement = test::BlockToBlockElement(*pNewBlock, test::GenerateRandomData<Hash256_Size>());
+		pStorage->dropBlocksAfter(Height(1));
+		pStorage->saveBlock(newElement);
+
+		// Assert: previously loaded block is unchanged but newly loaded block is the replacement
+		test::AssertEqual(element, *pOriginalBlockElement);
+		EXPECT_EQ(*pBlock, *pOriginalBlock);
+		test::AssertEqual(newElement, *pStorage->loadBlockElement(Height(2)));
+	}
+
+	TEST(TEST_CLASS, LoadedBlockOutlivesStorage) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(Height(2));
+		auto element = test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>());
+
+		std::shared_ptr<const model::BlockElement> pBlockElement;
+		{
+			auto pStorage = PackedTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element);
+
+			// Act:
+			pBlockElement = pStorage->loadBlockElement(Height(2));
+		}
+
+		// Assert:
+		test::AssertEqual(element, *pBlockElement);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,204 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/BufferChunkPool.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS BufferChunkPoolTests
+
+	TEST(TEST_CLASS, CanCreatePool) {
+		// Act:
+		BufferChunkPool pool(100, 3);
+
+		// Assert:
+		EXPECT_EQ(100u, pool.chunkSize());
+		EXPECT_EQ(0u, pool.numChunks());
+		EXPECT_EQ(0u, pool.numAllocations());
+	}
+
+	// region acquire
+
+	TEST(TEST_CLASS, CanAcquireChunk) {
+		// Arrange:
+		BufferChunkPool pool(100, 3);
+
+		// Act:
+		auto pChunk = pool.acquire(50);
+
+		// Assert:
+		ASSERT_TRUE(!!pChunk);
+		EXPECT_EQ(0u, pChunk->size());
+		EXPECT_EQ(100u, pChunk->capacity());
+
+		EXPECT_EQ(1u, pool.numChunks());
+		EXPECT_EQ(1u, pool.numAllocations());
+	}
+
+	TEST(TEST_CLASS, CanAcquireLargeBuffer) {
+		// Arrange:
+		BufferChunkPool pool(100, 3);
+
+		// Act:
+		auto pBuffer = pool.acquire(101);
+
+		// Assert: large buffers are not chunks
+		ASSERT_TRUE(!!pBuffer);
+		EXPECT_EQ(0u, pBuffer->size());
+		EXPECT_EQ(101u, pBuffer->capacity());
+
+		EXPECT_EQ(0u, pool.numChunks());
+		EXPECT_EQ(1u, pool.numAllocations());
+	}
+
+	TEST(TEST_CLASS, ReleasedLargeBufferIsReusedWhenLargeEnough) {
+		// Arrange:
+		BufferChunkPool pool(100, 3);
+		auto pBuffer1 = pool.acquire(200);
+		pBuffer1->resize(50);
+		const auto* pRawBuffer1 = pBuffer1.get();
+		pBuffer1.reset();
+
+		// Act:
+		auto pBuffer2 = pool.acquire(150);
+
+		// Assert: the buffer was cleared
+		EXPECT_EQ(pRawBuffer1, pBuffer2.get());
+		EXPECT_EQ(0u, pBuffer2->size());
+		EXPECT_EQ(200u, pBuffer2->capacity());
+
+		EXPECT_EQ(1u, pool.numAllocations());
+	}
+
+	TEST(TEST_CLASS, ReleasedLargeBufferIsNotReusedWhenTooSmall) {
+		// Arrange:
+		BufferChunkPool pool(100, 3);
+		pool.acquire(200);
+
+		// Act:
+		auto pBuffer2 = pool.acquire(250);
+
+		// Assert:
+		EXPECT_EQ(250u, pBuffer2->capacity());
+		EXPECT_EQ(2u, pool.numAllocations());
+	}
+
+	TEST(TEST_CLASS, ReferencedLargeBufferIsNotReused) {
+		// Arrange:
+		BufferChunkPool pool(100, 3);
+		auto pBuffer1 = pool.acquire(200);
+
+		// Act:
+		auto pBuffer2 = pool.acquire(200);
+
+		// Assert:
+		EXPECT_NE(pBuffer1.get(), pBuffer2.get());
+		EXPECT_EQ(2u, pool.numAllocations());
+	}
+
+	TEST(TEST_CLASS, LargeBufferIsNotReusedAfterReleaseLargeBuffer) {
+		// Arrange:
+		BufferChunkPool pool(100, 3);
+		pool.acquire(200);
+
+		// Act:
+		pool.releaseLargeBuffer();
+		pool.acquire(200);
+
+		// Assert:
+		EXPECT_EQ(2u, pool.numAllocations());
+	}
+
+	TEST(TEST_CLASS, ReleasedChunkIsReused) {
+		// Arrange:
+		BufferChunkPool pool(100, 3);
+		auto pChunk1 = pool.acquire(100);
+		pChunk1->resize(50);
+		const auto* pRawChunk1 = pChunk1.get();
+		pChunk1.reset();
+
+		// Act:
+		auto pChunk2 = pool.acquire(100);
+
+		// Assert: the chunk was cleared
+		EXPECT_EQ(pRawChunk1, pChunk2.get());
+		EXPECT_EQ(0u, pChunk2->size());
+
+		EXPECT_EQ(1u, pool.numChunks());
+		EXPECT_EQ(1u, pool.numAllocations());
+	}
+
+	TEST(TEST_CLASS, ReferencedChunkIsNotReused) {
+		// Arrange:
+		BufferChunkPool pool(100, 3);
+		auto pChunk1 = pool.acquire(100);
+
+		// Act:
+		auto pChunk2 = pool.acquire(100);
+
+		// Assert:
+		EXPECT_NE(pChunk1.get(), pChunk2.get());
+
+		EXPECT_EQ(2u, pool.numChunks());
+		EXPECT_EQ(2u, pool.numAllocations());
+	}
+
+	TEST(TEST_CLASS, ChunkIsNotReusedUntilAllReferencesAreReleased) {
+		// Arrange:
+		BufferChunkPool pool(100, 3);
+		auto pChunk1 = pool.acquire(100);
+		auto pChunk1Alias = std::shared_ptr<const uint8_t>(pChunk1, pChunk1->data());
+		const auto* pRawChunk1 = pChunk1.get();
+		pChunk1.reset();
+
+		// Act:
+		auto pChunk2 = pool.acquire(100);
+		pChunk1Alias.reset();
+		pChunk2.reset();
+		auto pChunk3 = pool.acquire(100);
+
+		// Assert: pChunk1 was only reused after its alias was released
+		EXPECT_EQ(pRawChunk1, pChunk3.get());
+
+		EXPECT_EQ(2u, pool.numChunks());
+		EXPECT_EQ(2u, pool.numAllocations());
+	}
+
+	TEST(TEST_CLASS, PoolRetainsAtMostMaxChunks) {
+		// Arrange:
+		BufferChunkPool pool(100, 3);
+
+		// Act:
+		std::vector<std::shared_ptr<ByteBuffer>> chunks;
+		for (auto i = 0u; i < 5; ++i)
+			chunks.push_back(pool.acquire(100));
+
+		chunks.clear();
+		for (auto i = 0u; i < 5; ++i)
+			chunks.push_back(pool.acquire(100));
+
+		// Assert: three chunks were reused and two additional chunks were allocated
+		EXPECT_EQ(3u, pool.numChunks());
+		EXPECT_EQ(7u, pool.numAllocations());
+	}
+
+	// endregion
+}}
@@ -30,6 +30,11 @@ namespace catapult { namespace ionet {
 		// Assert:
 		test::AssertParse("None", ConnectionSecurityMode::None, TryParseValue);
 		test::AssertParse("Signed", ConnectionSecurityMode::Signed, TryParseValue);
+		test::AssertParse("Signed_Session", ConnectionSecurityMode::Signed_Session, TryParseValue);
 		test::AssertParse("None,Signed", ConnectionSecurityMode::None | ConnectionSecurityMode::Signed, TryParseValue);
+		test::AssertParse(
+				"Signed,Signed_Session",
+				ConnectionSecurityMode::Signed | ConnectionSecurityMode::Signed_Session,
+				TryParseValue);
 	}
 }}
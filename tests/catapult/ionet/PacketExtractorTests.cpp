@@ -249,4 +249,52 @@ namespace catapult { namespace ionet {
 		// Assert:
 		ASSERT_EQ(20u, buffer.size());
 	}
+	// region data offset
+
+	TEST(TEST_CLASS, CanExtractPacketStartingAtDataOffset) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(30);
+		SetValueAtOffset(buffer, 7, 20);
+		size_t dataOffset = 7;
+
+		// Act + Assert:
+		auto extractor = PacketExtractor(buffer, dataOffset, Default_Max_Packet_Data_Size);
+		AssertExtractSuccess(extractor, buffer.cbegin() + 7, buffer.cbegin() + 27);
+		AssertExtractFailure(extractor, PacketExtractResult::Insufficient_Data);
+	}
+
+	TEST(TEST_CLASS, ConsumeAdvancesDataOffsetWithoutModifyingBuffer) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(30);
+		SetValueAtOffset(buffer, 7, 20);
+		auto bufferCopy = buffer;
+		size_t dataOffset = 7;
+
+		// Act:
+		auto extractor = PacketExtractor(buffer, dataOffset, Default_Max_Packet_Data_Size);
+		AssertExtractSuccess(extractor, buffer.cbegin() + 7, buffer.cbegin() + 27);
+		extractor.consume();
+
+		// Assert:
+		EXPECT_EQ(27u, dataOffset);
+		EXPECT_EQ(bufferCopy, buffer);
+	}
+
+	TEST(TEST_CLASS, ConsumeDoesNotAdvanceDataOffsetWhenNothingIsExtracted) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(30);
+		SetValueAtOffset(buffer, 7, 24);
+		size_t dataOffset = 7;
+
+		// Act:
+		auto extractor = PacketExtractor(buffer, dataOffset, Default_Max_Packet_Data_Size);
+		AssertExtractFailure(extractor, PacketExtractResult::Insufficient_Data);
+		extractor.consume();
+
+		// Assert:
+		EXPECT_EQ(7u, dataOffset);
+		EXPECT_EQ(30u, buffer.size());
+	}
+
+	// endregion
 }}
@@ -22,6 +22,7 @@
 #include "catapult/ionet/IoTypes.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/ionet/Packet.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
 #include "catapult/ionet/WorkingBuffer.h"
 #include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
@@ -120,6 +121,39 @@ namespace catapult { namespace ionet {
 		AssertWriteSuccess(payload, packetBytes);
 	}
 
+	namespace {
+		PacketPayload CreateMultiBufferPayload(const std::vector<uint64_t>& values, ByteBuffer& expectedBuffer) {
+			PacketPayloadBuilder builder(PacketType::Undefined);
+			for (auto value : values)
+				builder.appendValue(value);
+
+			auto payload = builder.build();
+
+			// append the serialized payload (header followed by all values) to the expected buffer
+			const auto* pHeaderBytes = reinterpret_cast<const uint8_t*>(&payload.header());
+			expectedBuffer.insert(expectedBuffer.end(), pHeaderBytes, pHeaderBytes + sizeof(PacketHeader));
+			for (auto value : values) {
+				const auto* pValueBytes = reinterpret_cast<const uint8_t*>(&value);
+				expectedBuffer.insert(expectedBuffer.end(), pValueBytes, pValueBytes + sizeof(uint64_t));
+			}
+
+			return payload;
+		}
+	}
+
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayload) {
+		// Arrange: set up payloads
+		ByteBuffer expectedBuffer;
+		auto payload = CreateMultiBufferPayload({ 0x1234'5678'9ABC'DEF0, 0x0BAD'F00D, 0xCAFE'BABE }, expectedBuffer);
+
+		// Sanity:
+		EXPECT_EQ(sizeof(PacketHeader) + 3 * sizeof(uint64_t), payload.header().Size);
+		EXPECT_EQ(3u, payload.buffers().size());
+
+		// Assert:
+		AssertWriteSuccess(payload, expectedBuffer);
+	}
+
 	TEST(TEST_CLASS, WriteFailsWhenSocketWriteFails) {
 		// Arrange: set up payloads
 		auto payload = CreateSmallWritePayload();
@@ -176,6 +210,45 @@ namespace catapult { namespace ionet {
 		test::AssertWriteCanWriteMultipleConsecutivePayloads([](const auto& pSocket) { return pSocket; });
 	}
 
+	TEST(TEST_CLASS, WriteCanWriteMultipleSimultaneousPayloadsWithoutInterleaving) {
+		// Assert:
+		test::AssertWriteCanWriteMultipleSimultaneousPayloadsWithoutInterleaving([](const auto& pSocket) { return pSocket; });
+	}
+
+	TEST(TEST_CLASS, WriteCanWriteManySimultaneousMultiBufferPayloadsInOrder) {
+		// Arrange: set up enough payloads so that more than one gathered write is required
+		constexpr auto Num_Payloads = 100u;
+		ByteBuffer expectedBuffer;
+		std::vector<PacketPayload> payloads;
+		for (auto i = 0u; i < Num_Payloads; ++i)
+			payloads.push_back(CreateMultiBufferPayload({ i, i * i, i * i * i }, expectedBuffer));
+
+		ByteBuffer receiveBuffer(expectedBuffer.size());
+		std::vector<std::pair<uint32_t, SocketOperationCode>> writeResults;
+
+		// Act: "server" - starts all async write operations at once
+		//      "client" - reads all payloads from the socket
+		auto pPool = test::CreateStartedIoServiceThreadPool();
+		test::SpawnPacketServerWork(pPool->service(), [&payloads, &writeResults](const auto& pServerSocket) {
+			for (auto i = 0u; i < Num_Payloads; ++i) {
+				pServerSocket->write(payloads[i], [i, &writeResults](auto code) {
+					writeResults.emplace_back(i, code);
+				});
+			}
+		});
+		test::AddClientReadBufferTask(pPool->service(), receiveBuffer);
+		pPool->join();
+
+		// Assert: all writes succeeded, callbacks were called in order and no data was reordered or interleaved
+		ASSERT_EQ(Num_Payloads, writeResults.size());
+		for (auto i = 0u; i < Num_Payloads; ++i) {
+			EXPECT_EQ(i, writeResults[i].first) << "result at " << i;
+			EXPECT_EQ(SocketOperationCode::Success, writeResults[i].second) << "result at " << i;
+		}
+
+		EXPECT_EQ(expectedBuffer, receiveBuffer);
+	}
+
 	TEST(TEST_CLASS, WriteFailsWhenPacketPayloadIsUnset) {
 		// Arrange:
 		auto payload = PacketPayload();
@@ -134,7 +134,8 @@ namespace catapult { namespace ionet {
 					: pMockPacketSocket(std::make_shared<MockPacketSocket>())
 					, KeyPair(test::GenerateKeyPair())
 					, RemoteKey(KeyPair.publicKey()) // use same public key so secure packets can be signed and verified
-					, pSecureSocket(Secure(pMockPacketSocket, securityMode, KeyPair, RemoteKey, maxPacketDataSize))
+					, SessionSecret(test::GenerateRandomData<Hash256_Size>())
+					, pSecureSocket(Secure(pMockPacketSocket, securityMode, KeyPair, RemoteKey, SessionSecret, maxPacketDataSize))
 			{}
 
 		public:
@@ -150,6 +151,7 @@ namespace catapult { namespace ionet {
 			std::shared_ptr<MockPacketSocket> pMockPacketSocket;
 			crypto::KeyPair KeyPair;
 			Key RemoteKey;
+			Hash256 SessionSecret;
 			std::shared_ptr<PacketSocket> pSecureSocket;
 		};
 
@@ -192,6 +194,9 @@ namespace catapult { namespace ionet {
 	template<ConnectionSecurityMode SecurityMode> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, SecurityModeNone##TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConnectionSecurityMode::None>(); } \
 	TEST(TEST_CLASS, SecurityModeSigned##TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConnectionSecurityMode::Signed>(); } \
+	TEST(TEST_CLASS, SecurityModeSignedSession##TEST_NAME) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConnectionSecurityMode::Signed_Session>(); \
+	} \
 	template<ConnectionSecurityMode SecurityMode> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	// region ConnectionSecurityMode - common
@@ -326,4 +331,52 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region ConnectionSecurityMode - Signed_Session
+
+	TEST(TEST_CLASS, SecurityModeSignedSession_DecoratesSocket) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Signed_Session);
+
+		// Act + Assert
+		EXPECT_NE(context.pMockPacketSocket, context.pSecureSocket);
+	}
+
+	TEST(TEST_CLASS, SecurityModeSignedSession_WritesSecurePackets) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Signed_Session);
+
+		// Act + Assert:
+		AssertNormalPacketWriteCode(context.normalIoView(), PacketType::Secure_Session, PacketType::Pull_Transactions);
+	}
+
+	TEST(TEST_CLASS, SecurityModeSignedSession_WritesSecureBufferedPackets) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Signed_Session);
+
+		// Act + Assert:
+		AssertNormalPacketWriteCode(context.bufferedIoView(), PacketType::Secure_Session, PacketType::Pull_Transactions);
+	}
+
+	TEST(TEST_CLASS, SecurityModeSignedSession_EnforcesMaxPacketDataSizeOnWrite) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Signed_Session, 99);
+
+		auto payload = PacketPayload(test::CreateRandomPacket(100, PacketType::Pull_Transactions));
+
+		// Act + Assert:
+		AssertMalformedDataWrite(context.normalIoView(), payload);
+	}
+
+	TEST(TEST_CLASS, SecurityModeSignedSession_EnforcesMaxPacketDataSizeOnBufferedWrite) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Signed_Session, 99);
+
+		auto payload = PacketPayload(test::CreateRandomPacket(100, PacketType::Pull_Transactions));
+
+		// Act + Assert:
+		AssertMalformedDataWrite(context.bufferedIoView(), payload);
+	}
+
+	// endregion
 }}
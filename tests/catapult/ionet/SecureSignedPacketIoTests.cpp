@@ -436,4 +436,258 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region session - DeriveSessionKeys
+
+	TEST(TEST_CLASS, DeriveSessionKeysProducesDifferentWriteAndReadKeys) {
+		// Arrange:
+		auto sessionSecret = test::GenerateRandomData<Hash256_Size>();
+		auto sourceKey = test::GenerateRandomData<Key_Size>();
+		auto remoteKey = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto sessionKeys = DeriveSessionKeys(sessionSecret, sourceKey, remoteKey);
+
+		// Assert:
+		EXPECT_NE(sessionKeys.WriteKey, sessionKeys.ReadKey);
+		EXPECT_NE(sessionSecret, sessionKeys.WriteKey);
+		EXPECT_NE(sessionSecret, sessionKeys.ReadKey);
+	}
+
+	TEST(TEST_CLASS, DeriveSessionKeysProducesMirroredKeysForRemote) {
+		// Arrange:
+		auto sessionSecret = test::GenerateRandomData<Hash256_Size>();
+		auto sourceKey = test::GenerateRandomData<Key_Size>();
+		auto remoteKey = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto sessionKeys = DeriveSessionKeys(sessionSecret, sourceKey, remoteKey);
+		auto remoteSessionKeys = DeriveSessionKeys(sessionSecret, remoteKey, sourceKey);
+
+		// Assert:
+		EXPECT_EQ(sessionKeys.WriteKey, remoteSessionKeys.ReadKey);
+		EXPECT_EQ(sessionKeys.ReadKey, remoteSessionKeys.WriteKey);
+	}
+
+	TEST(TEST_CLASS, DeriveSessionKeysDependsOnSessionSecret) {
+		// Arrange:
+		auto sourceKey = test::GenerateRandomData<Key_Size>();
+		auto remoteKey = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto sessionKeys1 = DeriveSessionKeys(test::GenerateRandomData<Hash256_Size>(), sourceKey, remoteKey);
+		auto sessionKeys2 = DeriveSessionKeys(test::GenerateRandomData<Hash256_Size>(), sourceKey, remoteKey);
+
+		// Assert:
+		EXPECT_NE(sessionKeys1.WriteKey, sessionKeys2.WriteKey);
+		EXPECT_NE(sessionKeys1.ReadKey, sessionKeys2.ReadKey);
+	}
+
+	// endregion
+
+	// region session - PacketIo / BatchPacketReader
+
+	namespace {
+		struct SessionTestContext {
+		public:
+			explicit SessionTestContext(uint32_t maxSignedPacketDataSize = std::numeric_limits<uint32_t>::max())
+					: pMockPacketIo(std::make_shared<mocks::MockPacketIo>())
+					, SessionKeys({ test::GenerateRandomData<Hash256_Size>(), test::GenerateRandomData<Hash256_Size>() })
+					, pSecureIo(CreateSecureSessionPacketIo(pMockPacketIo, SessionKeys, maxSignedPacketDataSize))
+					, pSecureBatchReader(CreateSecureSessionBatchPacketReader(pMockPacketIo, SessionKeys))
+			{}
+
+		public:
+			std::shared_ptr<mocks::MockPacketIo> pMockPacketIo;
+			ionet::SessionKeys SessionKeys;
+			std::shared_ptr<PacketIo> pSecureIo;
+			std::shared_ptr<BatchPacketReader> pSecureBatchReader;
+		};
+
+		Hash256 CalculateMac(const Hash256& key, const Packet& packet) {
+			Hash256 mac;
+			crypto::Sha3_256_Builder hashBuilder;
+			hashBuilder.update({ key, { reinterpret_cast<const uint8_t*>(&packet), packet.Size } });
+			hashBuilder.final(mac);
+			return mac;
+		}
+
+		// note: GetSecureSession* helpers assume a secure session packet
+
+		Hash256& GetSecureSessionMac(Packet& packet) {
+			return reinterpret_cast<Hash256&>(*(&packet + 1));
+		}
+
+		Packet& GetSecureSessionChildPacket(Packet& packet) {
+			auto& mac = GetSecureSessionMac(packet);
+			return reinterpret_cast<Packet&>(*(reinterpret_cast<uint8_t*>(&mac) + Hash256_Size));
+		}
+
+		std::shared_ptr<Packet> CreateSecureSessionPacket(const Hash256& key, uint32_t childPayloadSize) {
+			uint32_t payloadSize = sizeof(Hash256) + sizeof(PacketHeader) + childPayloadSize;
+			auto pPacket = test::CreateRandomPacket(payloadSize, PacketType::Secure_Session);
+
+			auto& mac = GetSecureSessionMac(*pPacket);
+			auto& childPacket = GetSecureSessionChildPacket(*pPacket);
+			childPacket.Size = sizeof(PacketHeader) + childPayloadSize;
+			childPacket.Type = PacketType::Push_Transactions;
+			mac = CalculateMac(key, childPacket);
+			return pPacket;
+		}
+
+		struct SessionPacketIoReadTraits {
+			static void Read(const SessionTestContext& context, const PacketIo::ReadCallback& callback) {
+				context.pSecureIo->read(callback);
+			}
+		};
+
+		struct SessionBatchPacketReaderReadTraits {
+			static void Read(const SessionTestContext& context, const PacketIo::ReadCallback& callback) {
+				context.pSecureBatchReader->readMultiple(callback);
+			}
+		};
+	}
+
+	TEST(TEST_CLASS, SessionWriteAuthenticatesPayloadWithMultipleBuffers) {
+		// Arrange:
+		SessionTestContext context;
+		context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{
+			test::CreateRandomEntityWithSize<>(126),
+			test::CreateRandomEntityWithSize<>(212)
+		};
+		auto payload = PacketPayloadFactory::FromEntities(PacketType::Push_Transactions, entities);
+
+		// Act:
+		SocketOperationCode writeCode;
+		context.pSecureIo->write(payload, [&writeCode](auto code) {
+			writeCode = code;
+		});
+
+		const auto& writtenPacket = context.pMockPacketIo->writtenPacketAt<Packet>(0);
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Success, writeCode);
+
+		ASSERT_EQ(sizeof(PacketHeader) + sizeof(Hash256) + sizeof(PacketHeader) + 126 + 212, writtenPacket.Size);
+		EXPECT_EQ(PacketType::Secure_Session, writtenPacket.Type);
+
+		const auto& mac = reinterpret_cast<const Hash256&>(*(&writtenPacket + 1));
+		const auto& childPacket = reinterpret_cast<const Packet&>(*(reinterpret_cast<const uint8_t*>(&mac) + Hash256_Size));
+		ASSERT_EQ(sizeof(PacketHeader) + 126 + 212, childPacket.Size);
+		EXPECT_EQ(PacketType::Push_Transactions, childPacket.Type);
+		EXPECT_EQ_MEMORY(entities[0].get(), childPacket.Data(), entities[0]->Size);
+		EXPECT_EQ_MEMORY(entities[1].get(), childPacket.Data() + 126, entities[1]->Size);
+
+		// - the mac is calculated with the write key
+		EXPECT_EQ(CalculateMac(context.SessionKeys.WriteKey, childPacket), mac);
+	}
+
+	TEST(TEST_CLASS, SessionWriteFailsWhenPacketPayloadExceedsMaxPacketDataSize) {
+		// Arrange:
+		SessionTestContext context(126 - 1);
+		context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{ test::CreateRandomEntityWithSize<>(126) };
+		auto payload = PacketPayloadFactory::FromEntities(PacketType::Push_Transactions, entities);
+
+		// Act:
+		SocketOperationCode writeCode;
+		context.pSecureIo->write(payload, [&writeCode](auto code) {
+			writeCode = code;
+		});
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Malformed_Data, writeCode);
+	}
+
+#define SESSION_READ_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SessionPacketIoReadTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_BatchReader) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<SessionBatchPacketReaderReadTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	namespace {
+		template<typename TReadTraits, typename TMutator>
+		void RunSessionReadTest(SocketOperationCode expectedReadCode, uint32_t childPayloadSize, TMutator mutator) {
+			// Arrange: create an authenticated packet
+			SessionTestContext context;
+			auto pPacket = CreateSecureSessionPacket(context.SessionKeys.ReadKey, childPayloadSize);
+
+			// - mutate the packet or its data
+			mutator(context, *pPacket);
+
+			// - queue the read
+			context.pMockPacketIo->queueRead(SocketOperationCode::Success, [pPacket](const auto*) { return pPacket; });
+
+			// Act:
+			ReadCallbackParams capture;
+			TReadTraits::Read(context, CreateReadCaptureCallback(capture));
+
+			// Assert:
+			EXPECT_EQ(expectedReadCode, capture.ReadCode);
+			EXPECT_EQ(SocketOperationCode::Success == expectedReadCode, capture.IsPacketValid);
+			if (!capture.IsPacketValid)
+				return;
+
+			const auto& readPacket = reinterpret_cast<const Packet&>(*capture.ReadPacketBytes.data());
+			ASSERT_EQ(sizeof(PacketHeader) + childPayloadSize, readPacket.Size);
+			EXPECT_EQ(PacketType::Push_Transactions, readPacket.Type);
+			EXPECT_EQ_MEMORY(GetSecureSessionChildPacket(*pPacket).Data(), readPacket.Data(), childPayloadSize);
+		}
+	}
+
+	SESSION_READ_TRAITS_BASED_TEST(SessionReadSucceedsWhenMacIsValid) {
+		// Assert:
+		RunSessionReadTest<TTraits>(SocketOperationCode::Success, 234, [](const auto&, const auto&) {});
+	}
+
+	SESSION_READ_TRAITS_BASED_TEST(SessionReadFailsWhenEnvelopePacketTypeIsWrong) {
+		// Assert: signed packets are not accepted by session readers
+		RunSessionReadTest<TTraits>(SocketOperationCode::Malformed_Data, 234, [](const auto&, auto& packet) {
+			packet.Type = PacketType::Secure_Signed;
+		});
+	}
+
+	SESSION_READ_TRAITS_BASED_TEST(SessionReadFailsWhenEnvelopePacketSizeIsInconsistentWithChildPacketSize) {
+		// Assert:
+		RunSessionReadTest<TTraits>(SocketOperationCode::Malformed_Data, 234, [](const auto&, auto& packet) {
+			--GetSecureSessionChildPacket(packet).Size;
+		});
+	}
+
+	SESSION_READ_TRAITS_BASED_TEST(SessionReadFailsWhenMacDoesNotVerify) {
+		// Assert:
+		RunSessionReadTest<TTraits>(SocketOperationCode::Security_Error, 234, [](const auto&, auto& packet) {
+			GetSecureSessionMac(packet)[Hash256_Size / 2] ^= 0xFF;
+		});
+	}
+
+	SESSION_READ_TRAITS_BASED_TEST(SessionReadFailsWhenChildPacketIsModified) {
+		// Assert:
+		RunSessionReadTest<TTraits>(SocketOperationCode::Security_Error, 234, [](const auto&, auto& packet) {
+			GetSecureSessionChildPacket(packet).Data()[100] ^= 0xFF;
+		});
+	}
+
+	SESSION_READ_TRAITS_BASED_TEST(SessionReadFailsWhenPacketIsAuthenticatedWithWriteKey) {
+		// Assert: a peer's own (reflected) packets are rejected
+		RunSessionReadTest<TTraits>(SocketOperationCode::Security_Error, 234, [](const auto& context, auto& packet) {
+			auto& childPacket = GetSecureSessionChildPacket(packet);
+			GetSecureSessionMac(packet) = CalculateMac(context.SessionKeys.WriteKey, childPacket);
+		});
+	}
+
+	TEST(TEST_CLASS, SessionCanRoundtripWriteAndRead) {
+		// Arrange: the writer should emulate the remote so keys match for write and read
+		SessionTestContext context;
+		context.SessionKeys.WriteKey = context.SessionKeys.ReadKey;
+		context.pSecureIo = CreateSecureSessionPacketIo(context.pMockPacketIo, context.SessionKeys, std::numeric_limits<uint32_t>::max());
+
+		// Act + Assert:
+		test::AssertCanRoundtripPackets(*context.pMockPacketIo, *context.pSecureIo);
+	}
+
+	// endregion
 }}
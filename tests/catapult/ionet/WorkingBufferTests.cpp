@@ -186,25 +186,87 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
-	// region memory management
+	// region share
 
-	namespace {
-		void AppendAndConsumeRandomData(WorkingBuffer& buffer, uint32_t multiple) {
-			// add a large packet to the buffer (notice that chunks cannot be larger than Default_Capacity because
-			// prepareAppend prepares a buffer of size Default_Capacity)
-			for (auto i = 0u; i < multiple; ++i)
-				AppendRandomData<Default_Capacity>(buffer);
+	TEST(TEST_CLASS, CanShareExtractedPacketWithoutCopying) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		AppendRandomData<100>(buffer);
+		SetPacketSize(buffer, 25);
+
+		auto extractor = buffer.preparePacketExtractor();
+		const Packet* pPacket;
+		extractor.tryExtractNextPacket(pPacket);
+
+		// Act:
+		auto pSharedPacket = buffer.share(*pPacket);
+
+		// Assert:
+		EXPECT_EQ(pPacket, pSharedPacket.get());
+	}
+
+	TEST(TEST_CLASS, CannotSharePacketNotBackedByWorkingBuffer) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		AppendRandomData<100>(buffer);
+		auto pPacket = CreateSharedPacket<Packet>(25);
+
+		// Act + Assert:
+		EXPECT_THROW(buffer.share(*pPacket), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, SharedPacketIsNotOverwrittenWhenAllDataIsConsumed) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		AppendRandomData<100>(buffer);
+		SetPacketSize(buffer, 100);
+		std::vector<uint8_t> packetData(buffer.begin(), buffer.end());
+		const auto* pOriginalData = buffer.data();
+
+		// - extract, share and consume the packet
+		auto extractor = buffer.preparePacketExtractor();
+		const Packet* pPacket;
+		extractor.tryExtractNextPacket(pPacket);
+		auto pSharedPacket = buffer.share(*pPacket);
+		extractor.consume();
+
+		// Act: append data
+		auto data = AppendRandomData<100>(buffer);
 
-			SetPacketSize(buffer, multiple * Default_Capacity);
+		// Assert: the shared chunk was not reused
+		auto pSharedPacketData = reinterpret_cast<const uint8_t*>(pSharedPacket.get());
+		EXPECT_NE(pOriginalData, buffer.data());
+		EXPECT_EQ_MEMORY(packetData.data(), pSharedPacketData, packetData.size());
+		AssertEqual(data, buffer);
+	}
 
-			// consume the data
+	TEST(TEST_CLASS, SharedChunkIsReusedWhenSharedPacketIsDestroyed) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		AppendRandomData<100>(buffer);
+		SetPacketSize(buffer, 100);
+		const auto* pOriginalData = buffer.data();
+
+		// - extract, share, consume and release the packet
+		{
 			auto extractor = buffer.preparePacketExtractor();
 			const Packet* pPacket;
 			extractor.tryExtractNextPacket(pPacket);
+			auto pSharedPacket = buffer.share(*pPacket);
 			extractor.consume();
 		}
+
+		// Act: append data
+		AppendRandomData<100>(buffer);
+
+		// Assert: the chunk was reused
+		EXPECT_EQ(pOriginalData, buffer.data());
 	}
 
+	// endregion
+
+	// region memory management
+
 	TEST(TEST_CLASS, BufferExpandsToFitIncreasingDataSizes) {
 		// Arrange: create a working buffer with sensitivity 5
 		auto buffer = CreateWorkingBuffer(5);
@@ -222,74 +284,177 @@ namespace catapult { namespace ionet {
 		AssertEqual(allData, buffer);
 	}
 
-	TEST(TEST_CLASS, BufferIsShrunkToReclaimMemoryInPresenceOfSmallerDataSizesWhenMemoryReclamationIsEnabled) {
-		// Arrange: create a working buffer with sensitivity 5
-		auto buffer = CreateWorkingBuffer(5);
-
-		// - append and consume a large packet (append is done in three chunks)
-		AppendAndConsumeRandomData(buffer, 3);
-		auto isShrinkWrapped = Default_Capacity * 3 == buffer.capacity();
-
-		// Sanity:
-		EXPECT_EQ(0u, buffer.size());
-		EXPECT_LE(Default_Capacity * 3, buffer.capacity());
-
-		// Act: append small data
+	TEST(TEST_CLASS, BufferAllocatesSingleChunkForRemainderOfLargePacketWhenPacketSizeIsKnown) {
+		// Arrange: start receiving a large packet
+		auto buffer = CreateWorkingBuffer();
 		std::vector<uint8_t> allData;
+		auto data = AppendRandomData<Default_Capacity>(buffer);
+		allData.insert(allData.end(), data.cbegin(), data.cend());
+		SetPacketSize(buffer, 3 * Default_Capacity);
+		std::memcpy(allData.data(), buffer.data(), sizeof(uint32_t));
+
+		// Act: receive the remainder of the packet
 		std::vector<size_t> capacities;
-		std::vector<size_t> capacityChangeIndexes;
-		for (auto i = 0u; i < 12; ++i) {
-			auto data = AppendRandomData<10>(buffer);
+		for (auto i = 0u; i < 2; ++i) {
+			data = AppendRandomData<Default_Capacity>(buffer);
 			allData.insert(allData.end(), data.cbegin(), data.cend());
-
-			if (capacities.empty() || buffer.capacity() != capacities.back()) {
-				capacities.push_back(buffer.capacity());
-				capacityChangeIndexes.push_back(i);
-			}
+			capacities.push_back(buffer.capacity());
 		}
 
-		// Assert: capacity should be reduced
-		EXPECT_EQ(120u, buffer.size());
-		EXPECT_GE(Default_Capacity * 3, buffer.capacity());
+		// Assert: the buffer was only resized once to fit the entire packet
+		EXPECT_EQ(3 * Default_Capacity, buffer.size());
+		EXPECT_EQ(std::vector<size_t>(2, 3 * Default_Capacity), capacities);
 		AssertEqual(allData, buffer);
+	}
+
+	TEST(TEST_CLASS, BufferReusesChunkWhenAllDataIsConsumed) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		AppendRandomData<100>(buffer);
+		SetPacketSize(buffer, 100);
+		const auto* pOriginalData = buffer.data();
 
-		// - capacity is only reduced at sensitivity intervals (15 samples should result in 3 reclamation attempts)
-		// -  0 => initial capacity
-		// -  1 => first attempt (2 + 3)  ; shrink-wraps large allocation (only if initial large allocation is not exact)
-		// -  6 => second attempt (7 + 3) ; reclaims memory based on history of small samples
-		// - 11 => third attempt (12 + 3) ; no reclamation because samples are same as in (2)
-		std::vector<size_t> expectedCapacityChangeIndexes{ 0, 1, 6 };
-		if (isShrinkWrapped)
-			expectedCapacityChangeIndexes.erase(expectedCapacityChangeIndexes.cbegin() + 1);
-
-		EXPECT_EQ(expectedCapacityChangeIndexes, capacityChangeIndexes);
-		EXPECT_EQ(expectedCapacityChangeIndexes.size(), capacities.size());
-		for (auto i = 0u; i < capacities.size() - 1; ++i)
-			EXPECT_LE(capacities[i + 1], capacities[i]) << "comparing capacities at " << i + 1 << " and " << i;
+		// - consume all data
+		auto extractor = buffer.preparePacketExtractor();
+		const Packet* pPacket;
+		extractor.tryExtractNextPacket(pPacket);
+		extractor.consume();
+
+		// Act:
+		auto data = AppendRandomData<10>(buffer);
+
+		// Assert: the same chunk was reused from its start
+		EXPECT_EQ(10u, buffer.size());
+		EXPECT_EQ(Default_Capacity, buffer.capacity());
+		EXPECT_EQ(pOriginalData, buffer.data());
+		AssertEqual(data, buffer);
 	}
 
-	TEST(TEST_CLASS, BufferIsNotShrunkToReclaimMemoryInPresenceOfSmallerDataSizesWhenMemoryReclamationIsDisabled) {
-		// Arrange: create a working buffer with memory reclamation disabled
-		auto buffer = CreateWorkingBuffer(0);
+	TEST(TEST_CLASS, BufferDoesNotCompactPartiallyConsumedData) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		AppendRandomData<100>(buffer);
+		SetPacketSize(buffer, 25);
+		const auto* pOriginalData = buffer.data();
 
-		// - append and consume a large packet
-		AppendAndConsumeRandomData(buffer, 3);
+		// Act:
+		auto extractor = buffer.preparePacketExtractor();
+		const Packet* pPacket;
+		extractor.tryExtractNextPacket(pPacket);
+		extractor.consume();
+
+		// Assert: the consumed data was skipped instead of moved
+		EXPECT_EQ(75u, buffer.size());
+		EXPECT_EQ(pOriginalData + 25, buffer.data());
+	}
+
+	TEST(TEST_CLASS, BufferReleasesLargeChunkWhenLargePacketIsConsumed) {
+		// Arrange: receive a large packet
+		auto buffer = CreateWorkingBuffer();
+		AppendRandomData<Default_Capacity>(buffer);
+		SetPacketSize(buffer, 3 * Default_Capacity);
+		for (auto i = 0u; i < 2; ++i)
+			AppendRandomData<Default_Capacity>(buffer);
+
+		// - consume it
+		auto extractor = buffer.preparePacketExtractor();
+		const Packet* pPacket;
+		extractor.tryExtractNextPacket(pPacket);
+		extractor.consume();
 
 		// Sanity:
 		EXPECT_EQ(0u, buffer.size());
-		EXPECT_LE(Default_Capacity * 3, buffer.capacity());
+		EXPECT_EQ(3 * Default_Capacity, buffer.capacity());
 
 		// Act: append small data
-		std::vector<uint8_t> allData;
-		for (auto i = 0u; i < 12; ++i) {
-			auto data = AppendRandomData<10>(buffer);
-			allData.insert(allData.end(), data.cbegin(), data.cend());
+		auto data = AppendRandomData<10>(buffer);
+
+		// Assert: the large chunk was released
+		EXPECT_EQ(10u, buffer.size());
+		EXPECT_EQ(Default_Capacity, buffer.capacity());
+		AssertEqual(data, buffer);
+	}
+
+	TEST(TEST_CLASS, BufferReusesLargeChunkForSubsequentLargePacket) {
+		// Arrange:
+		auto buffer = CreateWorkingBuffer();
+		std::vector<const uint8_t*> largeChunkDataPointers;
+		for (auto i = 0u; i < 2; ++i) {
+			// - receive a large packet
+			AppendRandomData<Default_Capacity>(buffer);
+			SetPacketSize(buffer, 3 * Default_Capacity);
+			for (auto j = 0u; j < 2; ++j)
+				AppendRandomData<Default_Capacity>(buffer);
+
+			largeChunkDataPointers.push_back(buffer.data());
+
+			// - consume it
+			auto extractor = buffer.preparePacketExtractor();
+			const Packet* pPacket;
+			extractor.tryExtractNextPacket(pPacket);
+			extractor.consume();
 		}
 
-		// Assert: capacity should not be reduced
-		EXPECT_EQ(120u, buffer.size());
-		EXPECT_LE(Default_Capacity * 3, buffer.capacity());
-		AssertEqual(allData, buffer);
+		// Assert: the large chunk was reused
+		EXPECT_EQ(largeChunkDataPointers[0], largeChunkDataPointers[1]);
+	}
+
+	namespace {
+		void ConsumePacket(WorkingBuffer& buffer) {
+			auto extractor = buffer.preparePacketExtractor();
+			const Packet* pPacket;
+			extractor.tryExtractNextPacket(pPacket);
+			extractor.consume();
+		}
+
+		template<typename TAssertCapacity>
+		void AssertLargeChunkReclamation(size_t sensitivity, TAssertCapacity assertCapacity) {
+			// Arrange: receive and consume a large packet
+			auto buffer = CreateWorkingBuffer(sensitivity);
+			AppendRandomData<Default_Capacity>(buffer);
+			SetPacketSize(buffer, 3 * Default_Capacity);
+			for (auto i = 0u; i < 2; ++i)
+				AppendRandomData<Default_Capacity>(buffer);
+
+			ConsumePacket(buffer);
+
+			// - receive a smaller large packet (reusing the large chunk) followed by small data and consume the packet
+			AppendRandomData<Default_Capacity>(buffer);
+			SetPacketSize(buffer, 2 * Default_Capacity);
+			AppendRandomData<Default_Capacity>(buffer);
+			AppendRandomData<100>(buffer);
+			ConsumePacket(buffer);
+
+			std::vector<uint8_t> allData(buffer.begin(), buffer.end());
+
+			// Sanity:
+			EXPECT_EQ(100u, buffer.size());
+			EXPECT_EQ(3 * Default_Capacity, buffer.capacity());
+
+			// Act: append small data
+			for (auto i = 0u; i < 12; ++i) {
+				auto data = AppendRandomData<10>(buffer);
+				allData.insert(allData.end(), data.cbegin(), data.cend());
+			}
+
+			// Assert:
+			EXPECT_EQ(220u, buffer.size());
+			assertCapacity(buffer.capacity());
+			AssertEqual(allData, buffer);
+		}
+	}
+
+	TEST(TEST_CLASS, LargeChunkIsReclaimedInPresenceOfSmallerDataSizesWhenMemoryReclamationIsEnabled) {
+		// Assert: capacity is reduced at the first sensitivity interval that only contains small samples
+		AssertLargeChunkReclamation(5, [](auto capacity) {
+			EXPECT_EQ(Default_Capacity, capacity);
+		});
+	}
+
+	TEST(TEST_CLASS, LargeChunkIsNotReclaimedInPresenceOfSmallerDataSizesWhenMemoryReclamationIsDisabled) {
+		AssertLargeChunkReclamation(0, [](auto capacity) {
+			EXPECT_EQ(3 * Default_Capacity, capacity);
+		});
 	}
 
 	// endregion
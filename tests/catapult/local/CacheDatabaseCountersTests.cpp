@@ -0,0 +1,88 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/local/CacheDatabaseCounters.h"
+#include "catapult/cache_db/RocksSharedResources.h"
+#include "catapult/utils/DiagnosticCounter.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace local {
+
+#define TEST_CLASS CacheDatabaseCountersTests
+
+	namespace {
+		using Counters = std::vector<utils::DiagnosticCounter>;
+
+		bool HasName(const utils::DiagnosticCounter& counter, const std::string& name) {
+			return name == counter.id().name();
+		}
+
+		bool HasCounter(const Counters& counters, const std::string& name) {
+			return std::any_of(counters.cbegin(), counters.cend(), [&name](const auto& counter) { return HasName(counter, name); });
+		}
+
+		auto CreateResources() {
+			return std::make_shared<cache::RocksSharedResources>(utils::FileSize::FromMegabytes(8), utils::FileSize::FromMegabytes(4));
+		}
+	}
+
+	TEST(TEST_CLASS, CanAddCacheDatabaseCounters) {
+		// Act:
+		Counters counters;
+		AddCacheDatabaseCounters(counters, CreateResources());
+
+		// Assert:
+		EXPECT_EQ(9u, counters.size());
+
+		for (const auto& name : {
+			"RDB BC USE", "RDB BC HIT", "RDB BC MISS", "RDB BF USEFUL",
+			"RDB MT USE", "RDB MT HIT", "RDB MT MISS",
+			"RDB READ MB", "RDB WRITE MB"
+		}) {
+			EXPECT_TRUE(HasCounter(counters, name)) << name;
+		}
+	}
+
+	TEST(TEST_CLASS, CountersHaveZeroValuesWhenResourcesAreUnused) {
+		// Arrange:
+		Counters counters;
+		AddCacheDatabaseCounters(counters, CreateResources());
+
+		// Act:
+		for (const auto& counter : counters) {
+			// Assert:
+			EXPECT_EQ(0u, counter.value()) << counter.id().name() << " has nonzero value";
+		}
+	}
+
+	TEST(TEST_CLASS, CountersKeepResourcesAlive) {
+		// Arrange:
+		Counters counters;
+		auto pResources = CreateResources();
+		AddCacheDatabaseCounters(counters, pResources);
+
+		// Act:
+		pResources.reset();
+
+		// Assert:
+		for (const auto& counter : counters)
+			EXPECT_EQ(0u, counter.value()) << counter.id().name();
+	}
+}}
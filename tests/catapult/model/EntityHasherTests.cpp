@@ -207,6 +207,45 @@ namespace catapult { namespace model {
 
 	// endregion
 
+	// region CalculateHashes (transactions)
+
+	TEST(TEST_CLASS, CalculateHashes_ReturnsEmptyHashesWhenThereAreNoTransactions) {
+		// Arrange:
+		auto registry = TransactionRegistry();
+		registry.registerPlugin(mocks::CreateMockTransactionPluginWithCustomBuffers(mocks::OffsetRange{ 5, 15 }, {}));
+
+		// Act:
+		auto hashes = CalculateHashes(registry, {});
+
+		// Assert:
+		EXPECT_TRUE(hashes.empty());
+	}
+
+	TEST(TEST_CLASS, CalculateHashes_ReturnsSameHashesAsCalculateHash) {
+		// Arrange: use a count that is not a multiple of any hash lane width
+		auto registry = TransactionRegistry();
+		registry.registerPlugin(mocks::CreateMockTransactionPluginWithCustomBuffers(mocks::OffsetRange{ 5, 15 }, {}));
+
+		std::vector<std::unique_ptr<Transaction>> transactionHolders;
+		std::vector<const Transaction*> transactions;
+		for (auto i = 0u; i < 11; ++i) {
+			transactionHolders.push_back(test::GenerateRandomTransaction());
+			transactions.push_back(transactionHolders.back().get());
+		}
+
+		// Act:
+		auto hashes = CalculateHashes(registry, transactions);
+
+		// Assert:
+		ASSERT_EQ(transactions.size(), hashes.size());
+		for (auto i = 0u; i < transactions.size(); ++i) {
+			auto expectedHash = CalculateHash(*transactions[i], mocks::ExtractBuffer({ 5, 15 }, transactions[i]));
+			EXPECT_EQ(expectedHash, hashes[i]) << "transaction at " << i;
+		}
+	}
+
+	// endregion
+
 	// region CalculateMerkleComponentHash (transaction)
 
 	TEST(TEST_CLASS, CalculateMerkleComponentHash_ReturnsTransactionHashWhenThereAreNoSupplementaryBuffers) {
@@ -200,4 +200,94 @@ namespace catapult { namespace net {
 	}
 
 	// endregion
+
+	// region TryCalculateSessionSecret
+
+	namespace {
+		struct SessionSecretContext {
+		public:
+			SessionSecretContext()
+					: ServerKeyPair(test::GenerateKeyPair())
+					, ClientKeyPair(test::GenerateKeyPair())
+					, ServerChallenge(test::GenerateRandomData<std::tuple_size<Challenge>::value>())
+					, ClientChallenge(test::GenerateRandomData<std::tuple_size<Challenge>::value>())
+			{}
+
+		public:
+			crypto::KeyPair ServerKeyPair;
+			crypto::KeyPair ClientKeyPair;
+			Challenge ServerChallenge;
+			Challenge ClientChallenge;
+		};
+
+		Hash256 CalculateSessionSecret(
+				const crypto::KeyPair& keyPair,
+				const Key& remotePublicKey,
+				const Challenge& serverChallenge,
+				const Challenge& clientChallenge) {
+			Hash256 sessionSecret;
+			EXPECT_TRUE(TryCalculateSessionSecret(keyPair, remotePublicKey, serverChallenge, clientChallenge, sessionSecret));
+			return sessionSecret;
+		}
+	}
+
+	TEST(TEST_CLASS, TryCalculateSessionSecretCalculatesSameSecretForBothPeers) {
+		// Arrange:
+		SessionSecretContext context;
+
+		// Act:
+		auto serverSecret = CalculateSessionSecret(
+				context.ServerKeyPair,
+				context.ClientKeyPair.publicKey(),
+				context.ServerChallenge,
+				context.ClientChallenge);
+		auto clientSecret = CalculateSessionSecret(
+				context.ClientKeyPair,
+				context.ServerKeyPair.publicKey(),
+				context.ServerChallenge,
+				context.ClientChallenge);
+
+		// Assert:
+		EXPECT_EQ(serverSecret, clientSecret);
+		EXPECT_NE(Hash256(), serverSecret);
+	}
+
+	TEST(TEST_CLASS, TryCalculateSessionSecretCalculatesDifferentSecretsForDifferentChallenges) {
+		// Arrange:
+		SessionSecretContext context;
+		const auto& keyPair = context.ServerKeyPair;
+		const auto& remoteKey = context.ClientKeyPair.publicKey();
+		auto otherChallenge = test::GenerateRandomData<std::tuple_size<Challenge>::value>();
+
+		// Act:
+		auto secret = CalculateSessionSecret(keyPair, remoteKey, context.ServerChallenge, context.ClientChallenge);
+		auto secretWithOtherServerChallenge = CalculateSessionSecret(keyPair, remoteKey, otherChallenge, context.ClientChallenge);
+		auto secretWithOtherClientChallenge = CalculateSessionSecret(keyPair, remoteKey, context.ServerChallenge, otherChallenge);
+		auto secretWithSwappedChallenges = CalculateSessionSecret(keyPair, remoteKey, context.ClientChallenge, context.ServerChallenge);
+
+		// Assert:
+		EXPECT_NE(secret, secretWithOtherServerChallenge);
+		EXPECT_NE(secret, secretWithOtherClientChallenge);
+		EXPECT_NE(secret, secretWithSwappedChallenges);
+	}
+
+	TEST(TEST_CLASS, TryCalculateSessionSecretFailsForInvalidRemotePublicKey) {
+		// Arrange: use the (small order) identity point as remote key
+		SessionSecretContext context;
+		Key identityKey{ { 1 } };
+
+		// Act:
+		Hash256 sessionSecret;
+		auto result = TryCalculateSessionSecret(
+				context.ServerKeyPair,
+				identityKey,
+				context.ServerChallenge,
+				context.ClientChallenge,
+				sessionSecret);
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+
+	// endregion
 }}
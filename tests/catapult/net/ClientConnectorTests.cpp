@@ -431,6 +431,38 @@ namespace catapult { namespace net {
 		});
 	}
 
+	TEST(TEST_CLASS, SecurityModeSignedSessionWritesSecurePackets) {
+		// Arrange:
+		ConnectionSettings settings;
+		settings.OutgoingSecurityMode = ionet::ConnectionSecurityMode::Signed_Session;
+		settings.IncomingSecurityModes = ionet::ConnectionSecurityMode::Signed | ionet::ConnectionSecurityMode::Signed_Session;
+
+		// Act:
+		RunSecurityModeTest(settings, false, [](const auto& state) {
+			// Assert:
+			EXPECT_EQ(PeerConnectCode::Accepted, state.AcceptConnectCode);
+			EXPECT_NE(state.pServerSocket, state.pAcceptedServerSocket);
+
+			AssertWrittenPacketType(state, ionet::PacketType::Secure_Session, ionet::PacketType::Chain_Info);
+		});
+	}
+
+	TEST(TEST_CLASS, SecurityModeSignedFallbackIsSupportedWhenSignedSessionIsAllowed) {
+		// Arrange: emulate a peer that does not support sessions
+		ConnectionSettings settings;
+		settings.OutgoingSecurityMode = ionet::ConnectionSecurityMode::Signed;
+		settings.IncomingSecurityModes = ionet::ConnectionSecurityMode::Signed | ionet::ConnectionSecurityMode::Signed_Session;
+
+		// Act:
+		RunSecurityModeTest(settings, false, [](const auto& state) {
+			// Assert:
+			EXPECT_EQ(PeerConnectCode::Accepted, state.AcceptConnectCode);
+			EXPECT_NE(state.pServerSocket, state.pAcceptedServerSocket);
+
+			AssertWrittenPacketType(state, ionet::PacketType::Secure_Signed, ionet::PacketType::Chain_Info);
+		});
+	}
+
 	TEST(TEST_CLASS, UnsupportedSecurityModeIsRejected) {
 		// Arrange:
 		ConnectionSettings settings;
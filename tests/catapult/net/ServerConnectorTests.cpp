@@ -22,6 +22,7 @@
 #include "catapult/crypto/KeyPair.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/ionet/PacketSocket.h"
+#include "catapult/ionet/SecurePacketSocketDecorator.h"
 #include "catapult/net/VerifyPeer.h"
 #include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/test/core/AddressTestUtils.h"
@@ -370,6 +371,7 @@ namespace catapult { namespace net {
 		struct SecurityModeTestState {
 			PeerConnectCode ConnectCode;
 			std::shared_ptr<ionet::PacketSocket> pServerSocket;
+			std::shared_ptr<ionet::PacketSocket> pSecuredServerSocket;
 			std::shared_ptr<ionet::PacketSocket> pConnectedClientSocket;
 		};
 
@@ -384,7 +386,15 @@ namespace catapult { namespace net {
 			SecurityModeTestState state;
 			test::SpawnPacketServerWork(acceptor, [&, pNumCallbacks](const auto& pSocket) {
 				state.pServerSocket = pSocket;
-				VerifyClient(pSocket, context.ServerKeyPair, settings.IncomingSecurityModes, [&, pNumCallbacks](auto, const auto&) {
+				VerifyClient(pSocket, context.ServerKeyPair, settings.IncomingSecurityModes, [&, pNumCallbacks](auto, const auto& peerInfo) {
+					// - secure the server socket in the same way as a client connector would
+					state.pSecuredServerSocket = ionet::Secure(
+							state.pServerSocket,
+							peerInfo.SecurityMode,
+							context.ServerKeyPair,
+							peerInfo.PublicKey,
+							peerInfo.SessionSecret,
+							settings.MaxPacketDataSize);
 					++*pNumCallbacks;
 
 					// - simulate an error by having the server close the socket
@@ -428,6 +438,32 @@ namespace catapult { namespace net {
 			// Assert:
 			EXPECT_EQ(expectedPacketType, readPacketType);
 		}
+
+		void AssertCanReadSecuredPacket(const SecurityModeTestState& state) {
+			// Arrange: write a regular packet
+			auto pPacket = test::CreateRandomPacket(100, ionet::PacketType::Chain_Info);
+
+			std::atomic_bool isPacketRead(false);
+			ionet::SocketOperationCode readCode;
+			std::vector<uint8_t> readPacketBuffer;
+			state.pConnectedClientSocket->write(ionet::PacketPayload(pPacket), [&](auto) { // secure-decorating write
+				state.pSecuredServerSocket->read([&](auto code, const auto* pReadPacket) { // secure-decorating read
+					readCode = code;
+					if (pReadPacket)
+						readPacketBuffer = test::CopyPacketToBuffer(*pReadPacket);
+
+					isPacketRead = true;
+				});
+			});
+
+			// - wait for the read to occur
+			WAIT_FOR(isPacketRead);
+
+			// Assert: the packet was authenticated by the server
+			ASSERT_EQ(ionet::SocketOperationCode::Success, readCode);
+			ASSERT_EQ(pPacket->Size, readPacketBuffer.size());
+			EXPECT_EQ_MEMORY(pPacket.get(), readPacketBuffer.data(), pPacket->Size);
+		}
 	}
 
 	TEST(TEST_CLASS, SecurityModeNoneDoesNotWriteSecurePackets) {
@@ -462,6 +498,50 @@ namespace catapult { namespace net {
 		});
 	}
 
+	TEST(TEST_CLASS, SecurityModeSignedSessionWritesSecurePackets) {
+		// Arrange:
+		ConnectionSettings settings;
+		settings.OutgoingSecurityMode = ionet::ConnectionSecurityMode::Signed_Session;
+		settings.IncomingSecurityModes = ionet::ConnectionSecurityMode::Signed | ionet::ConnectionSecurityMode::Signed_Session;
+
+		// Act:
+		RunSecurityModeTest(settings, false, [](const auto& state) {
+			// Assert:
+			EXPECT_EQ(PeerConnectCode::Accepted, state.ConnectCode);
+			EXPECT_TRUE(!!state.pConnectedClientSocket);
+
+			AssertWrittenPacketType(state, ionet::PacketType::Secure_Session, ionet::PacketType::Chain_Info);
+		});
+	}
+
+	TEST(TEST_CLASS, SecurityModeSignedCanRoundtripSecuredPackets) {
+		// Arrange:
+		ConnectionSettings settings;
+		settings.OutgoingSecurityMode = ionet::ConnectionSecurityMode::Signed;
+		settings.IncomingSecurityModes = ionet::ConnectionSecurityMode::Signed | ionet::ConnectionSecurityMode::Signed_Session;
+
+		// Act:
+		RunSecurityModeTest(settings, false, [](const auto& state) {
+			// Assert:
+			EXPECT_EQ(PeerConnectCode::Accepted, state.ConnectCode);
+			AssertCanReadSecuredPacket(state);
+		});
+	}
+
+	TEST(TEST_CLASS, SecurityModeSignedSessionCanRoundtripSecuredPackets) {
+		// Arrange:
+		ConnectionSettings settings;
+		settings.OutgoingSecurityMode = ionet::ConnectionSecurityMode::Signed_Session;
+		settings.IncomingSecurityModes = ionet::ConnectionSecurityMode::Signed | ionet::ConnectionSecurityMode::Signed_Session;
+
+		// Act:
+		RunSecurityModeTest(settings, false, [](const auto& state) {
+			// Assert: both peers derived matching session keys
+			EXPECT_EQ(PeerConnectCode::Accepted, state.ConnectCode);
+			AssertCanReadSecuredPacket(state);
+		});
+	}
+
 	TEST(TEST_CLASS, UnsupportedSecurityModeIsRejected) {
 		// Arrange:
 		ConnectionSettings settings;
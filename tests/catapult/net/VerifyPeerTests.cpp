@@ -492,9 +492,11 @@ namespace catapult { namespace net {
 	// region VerifyClient / VerifyServer Handshake
 
 	namespace {
+		template<typename TAssertSessionSecrets>
 		void AssertVerifyClientAndVerifyServerCanMutuallyValidate(
 				ionet::ConnectionSecurityMode securityMode,
-				ionet::ConnectionSecurityMode allowedSecurityModes) {
+				ionet::ConnectionSecurityMode allowedSecurityModes,
+				TAssertSessionSecrets assertSessionSecrets) {
 			// Arrange:
 			auto serverKeyPair = test::GenerateKeyPair();
 			auto clientKeyPair = test::GenerateKeyPair();
@@ -535,6 +537,20 @@ namespace catapult { namespace net {
 			EXPECT_EQ(VerifyResult::Success, clientResult);
 			EXPECT_EQ(serverKeyPair.publicKey(), verifiedServerPeerInfo.PublicKey);
 			EXPECT_EQ(securityMode, verifiedServerPeerInfo.SecurityMode);
+
+			assertSessionSecrets(verifiedClientPeerInfo.SessionSecret, verifiedServerPeerInfo.SessionSecret);
+		}
+
+		void AssertVerifyClientAndVerifyServerCanMutuallyValidate(
+				ionet::ConnectionSecurityMode securityMode,
+				ionet::ConnectionSecurityMode allowedSecurityModes) {
+			AssertVerifyClientAndVerifyServerCanMutuallyValidate(securityMode, allowedSecurityModes, [](
+					const auto& clientSessionSecret,
+					const auto& serverSessionSecret) {
+				// Assert: no session secret is established for non session modes
+				EXPECT_EQ(Hash256(), clientSessionSecret);
+				EXPECT_EQ(Hash256(), serverSessionSecret);
+			});
 		}
 	}
 
@@ -548,5 +564,20 @@ namespace catapult { namespace net {
 		AssertVerifyClientAndVerifyServerCanMutuallyValidate(ionet::ConnectionSecurityMode::Signed, Default_Allowed_Security_Mode_Mask);
 	}
 
+	TEST(TEST_CLASS, VerifyClientAndVerifyServerCanMutuallyValidate_Session) {
+		// Arrange:
+		auto securityMode = ionet::ConnectionSecurityMode::Signed_Session;
+		auto allowedSecurityModes = ionet::ConnectionSecurityMode::Signed | ionet::ConnectionSecurityMode::Signed_Session;
+
+		// Assert:
+		AssertVerifyClientAndVerifyServerCanMutuallyValidate(securityMode, allowedSecurityModes, [](
+				const auto& clientSessionSecret,
+				const auto& serverSessionSecret) {
+			// Assert: both peers established the same (nonzero) session secret
+			EXPECT_EQ(clientSessionSecret, serverSessionSecret);
+			EXPECT_NE(Hash256(), clientSessionSecret);
+		});
+	}
+
 	// endregion
 }}
@@ -21,10 +21,12 @@
 #include "catapult/plugins/PluginManager.h"
 #include "sdk/src/extensions/ConversionExtensions.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_db/RocksSharedResources.h"
 #include "catapult/model/Address.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockNotificationSubscriber.h"
 #include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/test/core/NotificationTestUtils.h"
 #include "tests/test/nodeps/NumericTestUtils.h"
 #include "tests/test/plugins/ValidatorTestUtils.h"
 #include "tests/TestHarness.h"
@@ -42,6 +44,12 @@ namespace catapult { namespace plugins {
 		// Assert:
 		EXPECT_FALSE(config.PreferCacheDatabase);
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
+		EXPECT_EQ(utils::FileSize(), config.MaxCacheDatabaseWriteBatchSize);
+		EXPECT_EQ(utils::FileSize(), config.CacheDatabaseBlockCacheSize);
+		EXPECT_EQ(utils::FileSize(), config.CacheDatabaseWriteBufferBudget);
+		EXPECT_EQ(0u, config.MaxPatriciaTreeNodeCacheSize);
+		EXPECT_EQ(0u, config.PatriciaTreeNodeCachePinnedLevels);
+		EXPECT_EQ(0u, config.PatriciaTreeRetainedRoots);
 	}
 
 	TEST(TEST_CLASS, CanCreateManager) {
@@ -58,6 +66,9 @@ namespace catapult { namespace plugins {
 		// Assert: compare BlockPruneInterval and CacheDatabaseDirectory as sentinel values because the manager copies the configs
 		EXPECT_EQ(15u, manager.config().BlockPruneInterval);
 		EXPECT_EQ("abc", manager.storageConfig().CacheDatabaseDirectory);
+
+		// - no shared database resources are created when cache database is not preferred
+		EXPECT_FALSE(!!manager.cacheDatabaseResources());
 	}
 
 	TEST(TEST_CLASS, CanCreateCacheConfiguration) {
@@ -66,18 +77,31 @@ namespace catapult { namespace plugins {
 		storageConfig.PreferCacheDatabase = true;
 		storageConfig.CacheDatabaseDirectory = "abc";
 		storageConfig.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromKilobytes(23);
+		storageConfig.CacheDatabaseBlockCacheSize = utils::FileSize::FromMegabytes(31);
+		storageConfig.MaxPatriciaTreeNodeCacheSize = 4321;
+		storageConfig.PatriciaTreeNodeCachePinnedLevels = 3;
+		storageConfig.PatriciaTreeRetainedRoots = 25;
+
+		// Act:
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), storageConfig);
+		auto pResources = manager.cacheDatabaseResources();
+
+		// Assert: shared database resources are created
+		ASSERT_TRUE(!!pResources);
+		EXPECT_EQ(utils::FileSize::FromMegabytes(31), pResources->blockCacheCapacity());
 
-		auto assertCacheConfiguration = [](const auto& cacheConfig, const auto& expectedDirectory) {
+		// - cache configuration is constructed appropriately and all caches share same database resources
+		auto assertCacheConfiguration = [&pResources](const auto& cacheConfig, const auto& expectedDirectory) {
 			EXPECT_TRUE(cacheConfig.ShouldUseCacheDatabase);
 			EXPECT_EQ(expectedDirectory, cacheConfig.CacheDatabaseDirectory);
 			EXPECT_EQ(utils::FileSize::FromKilobytes(23), cacheConfig.MaxCacheDatabaseWriteBatchSize);
 			EXPECT_FALSE(cacheConfig.ShouldStorePatriciaTrees);
+			EXPECT_EQ(pResources, cacheConfig.DatabaseResources);
+			EXPECT_EQ(4321u, cacheConfig.PatriciaTreeNodeCacheOptions.MaxSize);
+			EXPECT_EQ(3u, cacheConfig.PatriciaTreeNodeCacheOptions.NumPinnedLevels);
+			EXPECT_EQ(25u, cacheConfig.PatriciaTreeNumRetainedRoots);
 		};
 
-		// Act:
-		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), storageConfig);
-
-		// Assert: cache configuration is constructed appropriately
 		assertCacheConfiguration(manager.cacheConfig("foo"), "abc/foo");
 		assertCacheConfiguration(manager.cacheConfig("bar"), "abc/bar");
 	}
@@ -613,6 +637,88 @@ namespace catapult { namespace plugins {
 
 	// endregion
 
+	// region prefetch
+
+	namespace {
+		void AddPrefetchKeysExtractor(PluginManager& manager, uint8_t id, std::vector<uint8_t>& breadcrumbs) {
+			manager.addPrefetchKeysExtractor([id, &breadcrumbs](const auto& notification, const auto& resolvers, auto& keys) {
+				breadcrumbs.push_back(id);
+
+				// use resolvers to ensure they are forwarded
+				auto address = resolvers.resolve(UnresolvedAddress{ { { id } } });
+				keys.Addresses.insert(address);
+				keys.MosaicIds.insert(MosaicId(utils::to_underlying_type(notification.Type)));
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateDefaultPrefetchKeysExtractor) {
+		// Arrange:
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), StorageConfiguration());
+
+		// Act:
+		auto extractor = manager.createPrefetchKeysExtractor();
+		cache::PrefetchKeys keys;
+		extractor(test::CreateNotification(static_cast<model::NotificationType>(7)), model::ResolverContext(), keys);
+
+		// Assert:
+		EXPECT_TRUE(keys.empty());
+	}
+
+	TEST(TEST_CLASS, CanCreateCustomPrefetchKeysExtractorThatExecutesAllExtractors) {
+		// Arrange:
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), StorageConfiguration());
+		std::vector<uint8_t> breadcrumbs;
+		AddPrefetchKeysExtractor(manager, 3, breadcrumbs);
+		AddPrefetchKeysExtractor(manager, 9, breadcrumbs);
+		AddPrefetchKeysExtractor(manager, 4, breadcrumbs);
+
+		// Act:
+		auto extractor = manager.createPrefetchKeysExtractor();
+		cache::PrefetchKeys keys;
+		extractor(test::CreateNotification(static_cast<model::NotificationType>(7)), model::ResolverContext(), keys);
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint8_t>({ 3, 9, 4 }), breadcrumbs);
+		EXPECT_EQ(model::AddressSet({ Address{ { 3 } }, Address{ { 9 } }, Address{ { 4 } } }), keys.Addresses);
+		EXPECT_EQ(1u, keys.MosaicIds.size());
+		EXPECT_EQ(1u, keys.MosaicIds.count(MosaicId(7)));
+	}
+
+	TEST(TEST_CLASS, CanCreateCustomPrefetchKeysExtractorThatExecutesOnlyMatchingTypedExtractors) {
+		// Arrange:
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), StorageConfiguration());
+		std::vector<uint8_t> breadcrumbs;
+		manager.addPrefetchKeysExtractor<model::AccountPublicKeyNotification>([&breadcrumbs](
+				const auto& notification,
+				const auto&,
+				auto& keys) {
+			breadcrumbs.push_back(1);
+			keys.PublicKeys.insert(notification.PublicKey);
+		});
+		manager.addPrefetchKeysExtractor<model::AccountAddressNotification>([&breadcrumbs](
+				const auto& notification,
+				const auto& resolvers,
+				auto& keys) {
+			breadcrumbs.push_back(2);
+			keys.Addresses.insert(resolvers.resolve(notification.Address));
+		});
+
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto extractor = manager.createPrefetchKeysExtractor();
+		cache::PrefetchKeys keys;
+		extractor(model::AccountPublicKeyNotification(publicKey), model::ResolverContext(), keys);
+
+		// Assert: only the public key extractor was called
+		EXPECT_EQ(std::vector<uint8_t>({ 1 }), breadcrumbs);
+		EXPECT_EQ(utils::KeySet({ publicKey }), keys.PublicKeys);
+		EXPECT_TRUE(keys.Addresses.empty());
+	}
+
+	// endregion
+
 	// region notification publisher
 
 	namespace {
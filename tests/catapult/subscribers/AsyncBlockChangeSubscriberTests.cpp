@@ -0,0 +1,242 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/subscribers/AsyncBlockChangeSubscriber.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <atomic>
+
+namespace catapult { namespace subscribers {
+
+#define TEST_CLASS AsyncBlockChangeSubscriberTests
+
+	namespace {
+		Height DropMarker(Height height) {
+			return Height(~height.unwrap());
+		}
+
+		struct BlockChangeState {
+		public:
+			BlockChangeState() : IsBlocked(false), NumNotifications(0)
+			{}
+
+		public:
+			std::atomic_bool IsBlocked;
+			std::atomic<size_t> NumNotifications;
+			std::vector<std::shared_ptr<const model::BlockElement>> BlockElements;
+			std::vector<Height> NotifiedHeights; // drop heights are complemented
+		};
+
+		class MockBlockChangeSubscriber : public io::BlockChangeSubscriber {
+		public:
+			explicit MockBlockChangeSubscriber(BlockChangeState& state) : m_state(state)
+			{}
+
+		public:
+			void notifyBlock(const model::BlockElement& blockElement) override {
+				waitUnblocked();
+				m_state.BlockElements.push_back(CopyBlockElement(blockElement));
+				m_state.NotifiedHeights.push_back(blockElement.Block.Height);
+			}
+
+			void notifyDropBlocksAfter(Height height) override {
+				waitUnblocked();
+				m_state.NotifiedHeights.push_back(DropMarker(height));
+			}
+
+		private:
+			void waitUnblocked() {
+				++m_state.NumNotifications;
+				WAIT_FOR_VALUE(false, m_state.IsBlocked);
+			}
+
+		private:
+			BlockChangeState& m_state;
+		};
+
+		struct TestContext {
+		public:
+			explicit TestContext(size_t maxPendingEvents = 10)
+					: Subscriber(std::make_unique<MockBlockChangeSubscriber>(State), maxPendingEvents)
+			{}
+
+		public:
+			BlockChangeState State;
+			AsyncBlockChangeSubscriber Subscriber;
+		};
+
+		std::unique_ptr<model::Block> GenerateBlockAtHeight(Height height) {
+			return test::GenerateBlockWithTransactionsAtHeight(3, height.unwrap());
+		}
+
+		void NotifyBlocks(io::BlockChangeSubscriber& subscriber, std::initializer_list<Height::ValueType> heights) {
+			for (auto height : heights) {
+				auto pBlock = GenerateBlockAtHeight(Height(height));
+				subscriber.notifyBlock(test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>()));
+			}
+		}
+
+		void BlockAfterFirstNotification(TestContext& context) {
+			context.State.IsBlocked = true;
+			NotifyBlocks(context.Subscriber, { 1 });
+			WAIT_FOR_VALUE_EXPR(1u, context.State.NumNotifications.load());
+		}
+	}
+
+	// region CopyBlockElement
+
+	TEST(TEST_CLASS, CopyBlockElementCopiesBlockAndMetadata) {
+		// Arrange:
+		auto pBlock = GenerateBlockAtHeight(Height(7));
+		auto blockElement = test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>());
+		blockElement.GenerationHash = test::GenerateRandomData<Hash256_Size>();
+		blockElement.OptionalStatement = std::make_shared<model::BlockStatement>();
+
+		// Act:
+		auto pBlockElementCopy = CopyBlockElement(blockElement);
+
+		// Assert:
+		ASSERT_TRUE(!!pBlockElementCopy);
+		EXPECT_NE(&blockElement.Block, &pBlockElementCopy->Block);
+		test::AssertEqual(blockElement, *pBlockElementCopy);
+
+		// - transaction elements reference copied transactions
+		ASSERT_EQ(3u, pBlockElementCopy->Transactions.size());
+		auto iter = pBlockElementCopy->Block.Transactions().cbegin();
+		for (const auto& transactionElement : pBlockElementCopy->Transactions) {
+			EXPECT_EQ(&*iter, &transactionElement.Transaction);
+			++iter;
+		}
+	}
+
+	TEST(TEST_CLASS, CopyBlockElementIsIndependentOfOriginalBlock) {
+		// Arrange:
+		auto pBlock = GenerateBlockAtHeight(Height(7));
+		auto pBlockElementCopy = CopyBlockElement(test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>()));
+		auto pExpectedBlock = test::CopyBlock(*pBlock);
+
+		// Act:
+		test::FillWithRandomData({ reinterpret_cast<uint8_t*>(pBlock.get()), pBlock->Size });
+
+		// Assert:
+		ASSERT_EQ(pExpectedBlock->Size, pBlockElementCopy->Block.Size);
+		EXPECT_EQ_MEMORY(pExpectedBlock.get(), &pBlockElementCopy->Block, pExpectedBlock->Size);
+	}
+
+	// endregion
+
+	// region notifications
+
+	TEST(TEST_CLASS, NotificationsAreForwardedInOrder) {
+		// Arrange:
+		TestContext context;
+
+		// Act: flush after each notification so that nothing is coalesced
+		NotifyBlocks(context.Subscriber, { 1, 2 });
+		context.Subscriber.flush();
+		context.Subscriber.notifyDropBlocksAfter(Height(1));
+		context.Subscriber.flush();
+		NotifyBlocks(context.Subscriber, { 2 });
+		context.Subscriber.flush();
+
+		// Assert:
+		EXPECT_EQ(
+				std::vector<Height>({ Height(1), Height(2), DropMarker(Height(1)), Height(2) }),
+				context.State.NotifiedHeights);
+		EXPECT_EQ(4u, context.Subscriber.statistics().NumProcessedEvents);
+	}
+
+	TEST(TEST_CLASS, ForwardedBlockElementsAreCopies) {
+		// Arrange:
+		TestContext context;
+		auto pBlock = GenerateBlockAtHeight(Height(5));
+		auto blockElement = test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>());
+
+		// Act:
+		context.Subscriber.notifyBlock(blockElement);
+		context.Subscriber.flush();
+
+		// Assert:
+		ASSERT_EQ(1u, context.State.BlockElements.size());
+		test::AssertEqual(blockElement, *context.State.BlockElements[0]);
+	}
+
+	// endregion
+
+	// region coalescing
+
+	TEST(TEST_CLASS, DropSupersedesPendingBlocksAboveDropHeight) {
+		// Arrange:
+		TestContext context;
+		BlockAfterFirstNotification(context);
+		NotifyBlocks(context.Subscriber, { 2, 3, 4 });
+
+		// Act:
+		context.Subscriber.notifyDropBlocksAfter(Height(2));
+		NotifyBlocks(context.Subscriber, { 3 });
+		context.State.IsBlocked = false;
+		context.Subscriber.flush();
+
+		// Assert: drop is still forwarded because the subscriber might already have seen dropped blocks
+		EXPECT_EQ(
+				std::vector<Height>({ Height(1), Height(2), DropMarker(Height(2)), Height(3) }),
+				context.State.NotifiedHeights);
+
+		auto statistics = context.Subscriber.statistics();
+		EXPECT_EQ(3u, statistics.MaxPendingEvents);
+		EXPECT_EQ(2u, statistics.NumCoalescedEvents);
+	}
+
+	TEST(TEST_CLASS, ConsecutiveDropsAreMergedIntoLowestDrop) {
+		// Arrange:
+		TestContext context;
+		BlockAfterFirstNotification(context);
+
+		// Act:
+		context.Subscriber.notifyDropBlocksAfter(Height(5));
+		NotifyBlocks(context.Subscriber, { 6 });
+		context.Subscriber.notifyDropBlocksAfter(Height(3));
+		context.Subscriber.notifyDropBlocksAfter(Height(4));
+		context.State.IsBlocked = false;
+		context.Subscriber.flush();
+
+		// Assert:
+		EXPECT_EQ(std::vector<Height>({ Height(1), DropMarker(Height(3)) }), context.State.NotifiedHeights);
+		EXPECT_EQ(3u, context.Subscriber.statistics().NumCoalescedEvents);
+	}
+
+	TEST(TEST_CLASS, BlocksAreNotCoalesced) {
+		// Arrange:
+		TestContext context;
+		BlockAfterFirstNotification(context);
+
+		// Act:
+		NotifyBlocks(context.Subscriber, { 2, 3, 4 });
+		context.State.IsBlocked = false;
+		context.Subscriber.flush();
+
+		// Assert:
+		EXPECT_EQ(std::vector<Height>({ Height(1), Height(2), Height(3), Height(4) }), context.State.NotifiedHeights);
+		EXPECT_EQ(0u, context.Subscriber.statistics().NumCoalescedEvents);
+	}
+
+	// endregion
+}}
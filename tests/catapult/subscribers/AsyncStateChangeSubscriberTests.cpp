@@ -0,0 +1,285 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/subscribers/AsyncStateChangeSubscriber.h"
+#include "catapult/consumers/StateChangeInfo.h"
+#include "catapult/state/CatapultState.h"
+#include "catapult/subscribers/AggregateStateChangeSubscriber.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <atomic>
+#include <thread>
+
+namespace catapult { namespace subscribers {
+
+#define TEST_CLASS AsyncStateChangeSubscriberTests
+
+	namespace {
+		class MockCapturedStateChange : public CapturedStateChange {
+		public:
+			MockCapturedStateChange(Height height, bool isMergeable)
+					: Heights({ height })
+					, IsMergeable(isMergeable)
+			{}
+
+		public:
+			bool tryMerge(CapturedStateChange& laterChange) override {
+				auto& mockLaterChange = static_cast<MockCapturedStateChange&>(laterChange);
+				if (!IsMergeable || !mockLaterChange.IsMergeable)
+					return false;
+
+				Heights.insert(Heights.end(), mockLaterChange.Heights.cbegin(), mockLaterChange.Heights.cend());
+				return true;
+			}
+
+		public:
+			std::vector<Height> Heights;
+			bool IsMergeable;
+		};
+
+		struct StateChangeState {
+		public:
+			StateChangeState()
+					: IsBlocked(false)
+					, IsCaptureEnabled(true)
+					, IsMergeable(false)
+					, NumNotifications(0)
+			{}
+
+		public:
+			std::atomic_bool IsBlocked;
+			bool IsCaptureEnabled;
+			bool IsMergeable;
+			std::atomic<size_t> NumNotifications;
+
+			std::vector<std::thread::id> CaptureThreadIds;
+			std::vector<std::thread::id> NotificationThreadIds;
+			std::vector<model::ChainScore> ChainScores;
+			std::vector<std::vector<Height>> StateChangeHeights;
+		};
+
+		class MockCapturingStateChangeSubscriber : public CapturingStateChangeSubscriber {
+		public:
+			explicit MockCapturingStateChangeSubscriber(StateChangeState& state) : m_state(state)
+			{}
+
+		public:
+			void notifyScoreChange(const model::ChainScore& chainScore) override {
+				waitUnblocked();
+				m_state.ChainScores.push_back(chainScore);
+			}
+
+			std::unique_ptr<CapturedStateChange> captureStateChange(const consumers::StateChangeInfo& stateChangeInfo) override {
+				m_state.CaptureThreadIds.push_back(std::this_thread::get_id());
+				if (!m_state.IsCaptureEnabled)
+					return nullptr;
+
+				return std::make_unique<MockCapturedStateChange>(stateChangeInfo.Height, m_state.IsMergeable);
+			}
+
+			void notifyStateChange(CapturedStateChange& stateChange) override {
+				waitUnblocked();
+				m_state.StateChangeHeights.push_back(static_cast<MockCapturedStateChange&>(stateChange).Heights);
+			}
+
+		private:
+			void waitUnblocked() {
+				m_state.NotificationThreadIds.push_back(std::this_thread::get_id());
+				++m_state.NumNotifications;
+				WAIT_FOR_VALUE(false, m_state.IsBlocked);
+			}
+
+		private:
+			StateChangeState& m_state;
+		};
+
+		struct TestContext {
+		public:
+			TestContext()
+					: Subscriber(std::make_unique<MockCapturingStateChangeSubscriber>(State), 10)
+					, m_cache(test::CreateEmptyCatapultCache())
+			{}
+
+		public:
+			void notifyStateChange(Height height) {
+				auto cacheDelta = m_cache.createDelta();
+				model::ChainScore scoreDelta;
+				state::CatapultState catapultState;
+				Subscriber.notifyStateChange(consumers::StateChangeInfo(cacheDelta, scoreDelta, catapultState, height));
+			}
+
+			void blockAfterFirstNotification() {
+				State.IsBlocked = true;
+				Subscriber.notifyScoreChange(model::ChainScore(1));
+				WAIT_FOR_VALUE_EXPR(1u, State.NumNotifications.load());
+			}
+
+			void unblockAndFlush() {
+				State.IsBlocked = false;
+				Subscriber.flush();
+			}
+
+		public:
+			StateChangeState State;
+			AsyncStateChangeSubscriber Subscriber;
+
+		private:
+			cache::CatapultCache m_cache;
+		};
+
+		using HeightsVector = std::vector<std::vector<Height>>;
+	}
+
+	// region notifications
+
+	TEST(TEST_CLASS, NotifyScoreChangeIsForwarded) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.Subscriber.notifyScoreChange(model::ChainScore(123));
+		context.Subscriber.flush();
+
+		// Assert:
+		EXPECT_EQ(std::vector<model::ChainScore>({ model::ChainScore(123) }), context.State.ChainScores);
+		EXPECT_TRUE(context.State.StateChangeHeights.empty());
+	}
+
+	TEST(TEST_CLASS, NotifyStateChangeIsCapturedSynchronouslyAndForwardedAsynchronously) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.notifyStateChange(Height(246));
+		context.Subscriber.flush();
+
+		// Assert:
+		EXPECT_EQ(HeightsVector({ { Height(246) } }), context.State.StateChangeHeights);
+		EXPECT_TRUE(context.State.ChainScores.empty());
+
+		ASSERT_EQ(1u, context.State.CaptureThreadIds.size());
+		ASSERT_EQ(1u, context.State.NotificationThreadIds.size());
+		EXPECT_EQ(std::this_thread::get_id(), context.State.CaptureThreadIds[0]);
+		EXPECT_NE(std::this_thread::get_id(), context.State.NotificationThreadIds[0]);
+	}
+
+	TEST(TEST_CLASS, NotifyStateChangeFailsWhenNothingIsCaptured) {
+		// Arrange:
+		TestContext context;
+		context.State.IsCaptureEnabled = false;
+
+		// Act + Assert:
+		EXPECT_THROW(context.notifyStateChange(Height(246)), catapult_runtime_error);
+		EXPECT_EQ(0u, context.Subscriber.statistics().NumPendingEvents);
+	}
+
+	TEST(TEST_CLASS, NotificationsAreForwardedInOrder) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		for (auto i = 1u; i <= 3; ++i) {
+			context.Subscriber.notifyScoreChange(model::ChainScore(i));
+			context.notifyStateChange(Height(i));
+			context.Subscriber.flush();
+		}
+
+		// Assert:
+		EXPECT_EQ(
+				std::vector<model::ChainScore>({ model::ChainScore(1), model::ChainScore(2), model::ChainScore(3) }),
+				context.State.ChainScores);
+		EXPECT_EQ(HeightsVector({ { Height(1) }, { Height(2) }, { Height(3) } }), context.State.StateChangeHeights);
+		EXPECT_EQ(6u, context.Subscriber.statistics().NumProcessedEvents);
+	}
+
+	// endregion
+
+	// region coalescing
+
+	TEST(TEST_CLASS, PendingScoreChangesAreCollapsedIntoLatestScore) {
+		// Arrange:
+		TestContext context;
+		context.blockAfterFirstNotification();
+
+		// Act:
+		for (auto i = 2u; i <= 4; ++i) {
+			context.Subscriber.notifyScoreChange(model::ChainScore(i));
+			context.notifyStateChange(Height(i));
+		}
+
+		context.unblockAndFlush();
+
+		// Assert:
+		EXPECT_EQ(std::vector<model::ChainScore>({ model::ChainScore(1), model::ChainScore(4) }), context.State.ChainScores);
+		EXPECT_EQ(HeightsVector({ { Height(2) }, { Height(3) }, { Height(4) } }), context.State.StateChangeHeights);
+
+		auto statistics = context.Subscriber.statistics();
+		EXPECT_EQ(4u, statistics.MaxPendingEvents);
+		EXPECT_EQ(2u, statistics.NumCoalescedEvents);
+	}
+
+	TEST(TEST_CLASS, PendingStateChangesAreMergedWhenCapturedChangesSupportMerging) {
+		// Arrange:
+		TestContext context;
+		context.State.IsMergeable = true;
+		context.blockAfterFirstNotification();
+
+		// Act:
+		for (auto i = 2u; i <= 4; ++i) {
+			context.Subscriber.notifyScoreChange(model::ChainScore(i));
+			context.notifyStateChange(Height(i));
+		}
+
+		context.unblockAndFlush();
+
+		// Assert:
+		EXPECT_EQ(std::vector<model::ChainScore>({ model::ChainScore(1), model::ChainScore(4) }), context.State.ChainScores);
+		EXPECT_EQ(HeightsVector({ { Height(2), Height(3), Height(4) } }), context.State.StateChangeHeights);
+
+		auto statistics = context.Subscriber.statistics();
+		EXPECT_EQ(2u, statistics.MaxPendingEvents);
+		EXPECT_EQ(4u, statistics.NumCoalescedEvents);
+	}
+
+	// endregion
+
+	// region aggregate
+
+	TEST(TEST_CLASS, CanBeUsedByAggregateStateChangeSubscriber) {
+		// Arrange:
+		StateChangeState state;
+		{
+			std::vector<std::unique_ptr<StateChangeSubscriber>> subscribers;
+			subscribers.push_back(std::make_unique<AsyncStateChangeSubscriber>(
+					std::make_unique<MockCapturingStateChangeSubscriber>(state),
+					10));
+			AggregateStateChangeSubscriber<> aggregate(std::move(subscribers));
+
+			// Act: destroying the aggregate processes all pending notifications
+			aggregate.notifyScoreChange(model::ChainScore(11));
+		}
+
+		// Assert:
+		EXPECT_EQ(std::vector<model::ChainScore>({ model::ChainScore(11) }), state.ChainScores);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,281 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/subscribers/AsyncSubscriberQueue.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <atomic>
+
+namespace catapult { namespace subscribers {
+
+#define TEST_CLASS AsyncSubscriberQueueTests
+
+	namespace {
+		using EventQueue = AsyncSubscriberQueue<int>;
+
+		// handler that records all events and that can be blocked in order to simulate a lagging consumer
+		class GatedHandler {
+		public:
+			GatedHandler() : m_isBlocked(false), m_numStartedEvents(0)
+			{}
+
+		public:
+			const std::vector<int>& values() const {
+				return m_values;
+			}
+
+			size_t numStartedEvents() const {
+				return m_numStartedEvents;
+			}
+
+		public:
+			void block() {
+				m_isBlocked = true;
+			}
+
+			void unblock() {
+				m_isBlocked = false;
+			}
+
+			EventQueue::EventHandler handler() {
+				return [this](auto value) {
+					++m_numStartedEvents;
+					WAIT_FOR_VALUE(false, m_isBlocked);
+					if (0 > value)
+						CATAPULT_THROW_RUNTIME_ERROR("negative event");
+
+					m_values.push_back(value);
+				};
+			}
+
+		private:
+			std::atomic_bool m_isBlocked;
+			std::atomic<size_t> m_numStartedEvents;
+			std::vector<int> m_values;
+		};
+
+		// merges a new event into the last pending event when both are even
+		bool CoalesceEvenEvents(std::deque<int>& pendingEvents, int& event) {
+			if (0 != event % 2 || 0 != pendingEvents.back() % 2)
+				return false;
+
+			pendingEvents.back() = event;
+			return true;
+		}
+
+		bool NeverCoalesce(const std::deque<int>&, const int&) {
+			return false;
+		}
+
+		void AssertStatistics(
+				const AsyncSubscriberQueueStatistics& statistics,
+				size_t numPendingEvents,
+				size_t maxPendingEvents,
+				size_t numProcessedEvents,
+				size_t numCoalescedEvents) {
+			EXPECT_EQ(numPendingEvents, statistics.NumPendingEvents);
+			EXPECT_EQ(maxPendingEvents, statistics.MaxPendingEvents);
+			EXPECT_EQ(numProcessedEvents, statistics.NumProcessedEvents);
+			EXPECT_EQ(numCoalescedEvents, statistics.NumCoalescedEvents);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CannotCreateQueueWithoutCapacity) {
+		// Arrange:
+		GatedHandler handler;
+
+		// Act + Assert:
+		EXPECT_THROW(EventQueue(0, handler.handler(), NeverCoalesce), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCreateQueue) {
+		// Arrange:
+		GatedHandler handler;
+
+		// Act:
+		EventQueue queue(3, handler.handler(), NeverCoalesce);
+
+		// Assert:
+		AssertStatistics(queue.statistics(), 0, 0, 0, 0);
+		EXPECT_TRUE(handler.values().empty());
+	}
+
+	// endregion
+
+	// region push / flush
+
+	TEST(TEST_CLASS, PushedEventsAreProcessedInOrder) {
+		// Arrange:
+		GatedHandler handler;
+		EventQueue queue(10, handler.handler(), NeverCoalesce);
+
+		// Act:
+		for (auto value : { 4, 2, 7, 1 })
+			queue.push(std::move(value));
+
+		queue.flush();
+
+		// Assert:
+		EXPECT_EQ(std::vector<int>({ 4, 2, 7, 1 }), handler.values());
+		EXPECT_EQ(4u, queue.statistics().NumProcessedEvents);
+		EXPECT_EQ(0u, queue.statistics().NumPendingEvents);
+	}
+
+	TEST(TEST_CLASS, DestructionProcessesAllPendingEvents) {
+		// Arrange:
+		GatedHandler handler;
+		{
+			EventQueue queue(10, handler.handler(), NeverCoalesce);
+			handler.block();
+			for (auto value : { 4, 2, 7, 1 })
+				queue.push(std::move(value));
+
+			// Act:
+			handler.unblock();
+		}
+
+		// Assert:
+		EXPECT_EQ(std::vector<int>({ 4, 2, 7, 1 }), handler.values());
+	}
+
+	TEST(TEST_CLASS, HandlerExceptionDoesNotStopProcessing) {
+		// Arrange:
+		GatedHandler handler;
+		EventQueue queue(10, handler.handler(), NeverCoalesce);
+
+		// Act:
+		for (auto value : { 4, -2, 7 })
+			queue.push(std::move(value));
+
+		queue.flush();
+
+		// Assert:
+		EXPECT_EQ(std::vector<int>({ 4, 7 }), handler.values());
+		EXPECT_EQ(3u, queue.statistics().NumProcessedEvents);
+	}
+
+	// endregion
+
+	// region lagging handler
+
+	namespace {
+		void PushWhileHandlerIsBlocked(EventQueue& queue, GatedHandler& handler, const std::vector<int>& values) {
+			// - block the handler on the first event so that all other events are pending
+			handler.block();
+			queue.push(1);
+			WAIT_FOR_VALUE_EXPR(1u, handler.numStartedEvents());
+
+			for (auto value : values)
+				queue.push(std::move(value));
+		}
+	}
+
+	TEST(TEST_CLASS, PendingEventsAreCoalescedWhenHandlerLags) {
+		// Arrange:
+		GatedHandler handler;
+		EventQueue queue(10, handler.handler(), CoalesceEvenEvents);
+		PushWhileHandlerIsBlocked(queue, handler, { 3, 2, 4, 6, 5, 8 });
+
+		// Sanity:
+		AssertStatistics(queue.statistics(), 4, 4, 0, 2);
+
+		// Act:
+		handler.unblock();
+		queue.flush();
+
+		// Assert: 2 and 4 were replaced by 6
+		EXPECT_EQ(std::vector<int>({ 1, 3, 6, 5, 8 }), handler.values());
+		AssertStatistics(queue.statistics(), 0, 4, 5, 2);
+	}
+
+	TEST(TEST_CLASS, CoalescerIsNotCalledWhenNoEventsArePending) {
+		// Arrange:
+		GatedHandler handler;
+		auto numCoalescerCalls = 0u;
+		EventQueue queue(10, handler.handler(), [&numCoalescerCalls](auto& pendingEvents, auto& event) {
+			++numCoalescerCalls;
+			return CoalesceEvenEvents(pendingEvents, event);
+		});
+
+		// Act:
+		for (auto value : { 2, 4, 6 }) {
+			queue.push(std::move(value));
+			queue.flush();
+		}
+
+		// Assert:
+		EXPECT_EQ(0u, numCoalescerCalls);
+		EXPECT_EQ(std::vector<int>({ 2, 4, 6 }), handler.values());
+		AssertStatistics(queue.statistics(), 0, 1, 3, 0);
+	}
+
+	TEST(TEST_CLASS, CoalescerCanDropSupersededEvents) {
+		// Arrange: a zero event supersedes all pending events
+		GatedHandler handler;
+		EventQueue queue(10, handler.handler(), [](auto& pendingEvents, const auto& event) {
+			if (0 == event)
+				pendingEvents.clear();
+
+			return false;
+		});
+		PushWhileHandlerIsBlocked(queue, handler, { 3, 2, 0, 5 });
+
+		// Act:
+		handler.unblock();
+		queue.flush();
+
+		// Assert:
+		EXPECT_EQ(std::vector<int>({ 1, 0, 5 }), handler.values());
+		AssertStatistics(queue.statistics(), 0, 2, 3, 2);
+	}
+
+	TEST(TEST_CLASS, PushBlocksWhenQueueIsFull) {
+		// Arrange:
+		GatedHandler handler;
+		EventQueue queue(2, handler.handler(), NeverCoalesce);
+		PushWhileHandlerIsBlocked(queue, handler, { 3, 5 });
+
+		// Act: push another event from a different thread
+		std::atomic_bool isPushed(false);
+		std::thread pushThread([&queue, &isPushed]() {
+			queue.push(7);
+			isPushed = true;
+		});
+
+		test::Pause();
+
+		// Sanity:
+		EXPECT_FALSE(isPushed);
+		EXPECT_EQ(2u, queue.statistics().NumPendingEvents);
+
+		handler.unblock();
+		pushThread.join();
+		queue.flush();
+
+		// Assert:
+		EXPECT_TRUE(isPushed);
+		EXPECT_EQ(std::vector<int>({ 1, 3, 5, 7 }), handler.values());
+		AssertStatistics(queue.statistics(), 0, 2, 4, 0);
+	}
+
+	// endregion
+}}
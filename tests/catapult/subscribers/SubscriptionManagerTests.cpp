@@ -20,11 +20,14 @@
 
 #include "catapult/subscribers/SubscriptionManager.h"
 #include "catapult/config/LocalNodeConfiguration.h"
+#include "catapult/io/PackedFileBlockStorage.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/model/ChainScore.h"
 #include "tests/catapult/subscribers/test/UnsupportedSubscribers.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
+#include "tests/test/core/StorageTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace subscribers {
@@ -149,6 +152,25 @@ namespace catapult { namespace subscribers {
 		manager.fileStorage();
 	}
 
+	TEST(TEST_CLASS, CanCreateManagerWithPackedBlockStorage) {
+		// Arrange: seed the data directory with a nemesis block stored one file per block
+		test::TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+
+		auto config = CreateConfiguration();
+		const_cast<bool&>(config.Node.ShouldUsePackedBlockStorage) = true;
+		const_cast<std::string&>(config.User.DataDirectory) = tempDir.name();
+
+		// Act:
+		SubscriptionManager manager(config);
+		const auto& fileStorage = manager.fileStorage();
+
+		// Assert: the nemesis block was converted into the packed storage
+		EXPECT_TRUE(!!dynamic_cast<const io::PackedFileBlockStorage*>(&fileStorage));
+		EXPECT_EQ(Height(1), fileStorage.chainHeight());
+		EXPECT_EQ(Height(1), fileStorage.loadBlock(Height(1))->Height);
+	}
+
 	// endregion
 
 	// region single aggregate creation
@@ -329,6 +329,166 @@ namespace catapult { namespace thread {
 
 	// endregion
 
+	// region WorkStealingParallelFor
+
+	CONTAINER_TEST(WorkStealingCanProcessMultipleItemsConcurrently_ZeroItems) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType();
+
+		// Act:
+		std::atomic<size_t> counter(0);
+		WorkStealingParallelFor(context.pPool->service(), items, context.NumThreads, [&counter](auto, auto) {
+			++counter;
+			return true;
+		}).get();
+
+		// Assert: the item callback was not called
+		EXPECT_EQ(0u, counter);
+	}
+
+	CONTAINER_TEST(WorkStealingCanProcessMultipleItemsConcurrently_OneItem) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+		auto items = typename TTraits::ContainerType{ 7 };
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		std::vector<uint8_t> indexFlags(1, 0);
+		WorkStealingParallelFor(context.pPool->service(), items, context.NumThreads, CreateItemAggregate(sum, indexFlags)).get();
+
+		// Assert: the callback was only called once (since there is only one item)
+		EXPECT_EQ(7u, sum);
+		EXPECT_EQ(std::vector<uint8_t>(1, 1), indexFlags);
+	}
+
+	namespace {
+		template<typename TTraits>
+		void AssertWorkStealingCanProcessMultipleItemsConcurrently(int numItemsAdjustment) {
+			// Arrange:
+			BasicTestContext<typename TTraits::ContainerType> context(static_cast<size_t>(numItemsAdjustment));
+
+			// Act:
+			std::atomic<size_t> sum(0);
+			std::vector<uint8_t> indexFlags(context.NumItems, 0);
+			WorkStealingParallelFor(context.pPool->service(), context.Items, context.NumThreads, CreateItemAggregate(sum, indexFlags))
+					.get();
+
+			// Assert:
+			EXPECT_EQ(context.ItemsSum, sum);
+			EXPECT_EQ(std::vector<uint8_t>(context.NumItems, 1), indexFlags);
+		}
+	}
+
+	CONTAINER_TEST(WorkStealingCanProcessMultipleItemsConcurrently_MinusOne) {
+		// Assert:
+		AssertWorkStealingCanProcessMultipleItemsConcurrently<TTraits>(-1);
+	}
+
+	CONTAINER_TEST(WorkStealingCanProcessMultipleItemsConcurrently) {
+		// Assert:
+		AssertWorkStealingCanProcessMultipleItemsConcurrently<TTraits>(0);
+	}
+
+	CONTAINER_TEST(WorkStealingCanProcessMultipleItemsConcurrently_PlusOne) {
+		// Assert:
+		AssertWorkStealingCanProcessMultipleItemsConcurrently<TTraits>(1);
+	}
+
+	CONTAINER_TEST(WorkStealingCanShortCircuitProcessingOfAllItems) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act: stop processing after first item
+		std::atomic<size_t> counter(0);
+		WorkStealingParallelFor(context.pPool->service(), context.Items, context.NumThreads, [&counter](auto, auto) {
+			++counter;
+			return false;
+		}).get();
+
+		// Assert: each worker processed at most one item
+		EXPECT_LE(1u, counter);
+		EXPECT_GE(context.NumThreads, counter);
+	}
+
+	CONTAINER_TEST(WorkStealingCorrectIndexesAreAssociatedWithItems) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act: capture all values by their index (and modify them)
+		std::vector<uint32_t> capturedValues(context.NumItems, 0);
+		WorkStealingParallelFor(context.pPool->service(), context.Items, context.NumThreads, [&capturedValues](auto& value, auto index) {
+			// Sanity: fail if any index is too large
+			EXPECT_GT(capturedValues.size(), index) << "unexpected index " << index;
+			if (capturedValues.size() <= index)
+				return false;
+
+			capturedValues[index] = value;
+			value = value * value + 1;
+			return true;
+		}).get();
+
+		// Assert: values start at 1
+		auto i = 1u;
+		for (auto value : context.Items) {
+			EXPECT_EQ(i, capturedValues[i - 1]) << "i " << i;
+			EXPECT_EQ(i * i + 1u, value) << "item at " << i;
+			++i;
+		}
+	}
+
+	TEST(TEST_CLASS, WorkStealingIdleWorkersProcessItemsOfBusyWorker) {
+		// Arrange: the first worker initially owns the first NumItems / NumThreads items
+		BasicTestContext<std::vector<ItemType>> context;
+
+		// Act: block processing of the first item until all other items have been processed
+		//      (this would deadlock if other workers could not steal the items initially owned by the first worker)
+		std::atomic<size_t> counter(0);
+		WorkStealingParallelFor(context.pPool->service(), context.Items, context.NumThreads, [&counter, &context](auto, auto index) {
+			if (0 == index)
+				WAIT_FOR_VALUE_EXPR(context.NumItems - 1, counter.load());
+
+			++counter;
+			return true;
+		}).get();
+
+		// Assert:
+		EXPECT_EQ(context.NumItems, counter);
+	}
+
+	// endregion
+
+	// region ParallelFor (strategy)
+
+	namespace {
+		void AssertParallelForWithStrategyProcessesAllItems(ParallelForStrategy strategy) {
+			// Arrange:
+			BasicTestContext<std::vector<ItemType>> context;
+
+			// Act:
+			std::atomic<size_t> sum(0);
+			std::vector<uint8_t> indexFlags(context.NumItems, 0);
+			ParallelFor(context.pPool->service(), context.Items, context.NumThreads, strategy, CreateItemAggregate(sum, indexFlags))
+					.get();
+
+			// Assert:
+			EXPECT_EQ(context.ItemsSum, sum);
+			EXPECT_EQ(std::vector<uint8_t>(context.NumItems, 1), indexFlags);
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelForWithStrategyProcessesAllItems_StaticPartition) {
+		// Assert:
+		AssertParallelForWithStrategyProcessesAllItems(ParallelForStrategy::Static_Partition);
+	}
+
+	TEST(TEST_CLASS, ParallelForWithStrategyProcessesAllItems_WorkStealing) {
+		// Assert:
+		AssertParallelForWithStrategyProcessesAllItems(ParallelForStrategy::Work_Stealing);
+	}
+
+	// endregion
+
 	// region ParallelFor[Partition] distributed
 
 	namespace {
@@ -79,6 +79,23 @@ namespace catapult { namespace tree {
 		EXPECT_EQ(0u, dataSource.size());
 	}
 
+	TEST(TEST_CLASS, GetSharesSavedNode) {
+		// Arrange:
+		auto node = LeafTreeNode(TreeNodePath(0x64'6F'67'00), test::GenerateRandomData<Hash256_Size>());
+
+		MemoryDataSource dataSource;
+		dataSource.set(node);
+
+		// Act:
+		auto pNode1 = dataSource.get(node.hash());
+		auto pNode2 = dataSource.get(node.hash());
+
+		// Assert: saved nodes are immutable, so the same node is returned by all lookups
+		ASSERT_TRUE(!!pNode1);
+		EXPECT_EQ(node.hash(), pNode1->hash());
+		EXPECT_EQ(pNode1, pNode2);
+	}
+
 	// region perf
 
 	TEST(TEST_CLASS, SetDoesNotRecalculateHashWhenNotDirty) {
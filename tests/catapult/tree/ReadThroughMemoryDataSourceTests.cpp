@@ -149,6 +149,21 @@ namespace catapult { namespace tree {
 		EXPECT_EQ(0u, dataSource.size());
 	}
 
+	TEST(TEST_CLASS, GetSharesBackingDataSourceNode) {
+		// Arrange:
+		MemoryDataSource backingDataSource;
+		ReadThroughMemoryDataSource<MemoryDataSource> dataSource(backingDataSource);
+
+		auto node = LeafTreeNode(TreeNodePath(0x64'6F'67'00), test::GenerateRandomData<Hash256_Size>());
+		backingDataSource.set(node);
+
+		// Act:
+		auto pDataSourceNode = dataSource.get(node.hash());
+
+		// Assert: node is shared (not copied) from the backing data source
+		EXPECT_EQ(backingDataSource.get(node.hash()), pDataSourceNode);
+	}
+
 	// endregion
 }}
 
@@ -0,0 +1,329 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/StaleNodeFinder.h"
+#include "catapult/tree/BasePatriciaTree.h"
+#include "tests/catapult/tree/test/PassThroughEncoder.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS StaleNodeFinderTests
+
+	namespace {
+		// memory data source that remembers hashes of all nodes saved since last reset
+		class RecordingDataSource {
+		public:
+			std::shared_ptr<const TreeNode> get(const Hash256& hash) const {
+				return m_dataSource.get(hash);
+			}
+
+			void forEach(const consumer<const TreeNode&>& consumer) const {
+				m_dataSource.forEach(consumer);
+			}
+
+			void set(const LeafTreeNode& node) {
+				m_savedNodeHashes.insert(node.hash());
+				m_dataSource.set(node);
+			}
+
+			void set(const BranchTreeNode& node) {
+				m_savedNodeHashes.insert(node.hash());
+				m_dataSource.set(node);
+			}
+
+		public:
+			const utils::HashSet& savedNodeHashes() const {
+				return m_savedNodeHashes;
+			}
+
+			void resetSavedNodeHashes() {
+				m_savedNodeHashes.clear();
+			}
+
+		private:
+			MemoryDataSource m_dataSource;
+			utils::HashSet m_savedNodeHashes;
+		};
+
+		using RecordingBasePatriciaTree = BasePatriciaTree<test::PassThroughEncoder, RecordingDataSource>;
+		using Changes = std::vector<std::pair<uint32_t, std::string>>;
+
+		class TestContext {
+		public:
+			TestContext() : m_tree(m_dataSource)
+			{}
+
+		public:
+			Hash256 root() const {
+				return m_tree.root();
+			}
+
+			const RecordingDataSource& dataSource() const {
+				return m_dataSource;
+			}
+
+		public:
+			void commit(const Changes& changes, const std::vector<uint32_t>& removedKeys = {}) {
+				auto pDelta = m_tree.rebase();
+				for (const auto& pair : changes)
+					pDelta->set(pair.first, pair.second);
+
+				for (auto key : removedKeys)
+					pDelta->unset(key);
+
+				m_dataSource.resetSavedNodeHashes();
+				m_tree.commit();
+			}
+
+			void commitWithCheckpoint(const Changes& checkpointChanges, const Changes& changes) {
+				auto pDelta = m_tree.rebase();
+				for (const auto& pair : checkpointChanges)
+					pDelta->set(pair.first, pair.second);
+
+				pDelta->setCheckpoint();
+				for (const auto& pair : changes)
+					pDelta->set(pair.first, pair.second);
+
+				m_dataSource.resetSavedNodeHashes();
+				m_tree.commit();
+			}
+
+			utils::HashSet findStaleNodes(const Hash256& oldRootHash) const {
+				utils::HashSet staleHashes;
+				FindStaleNodes(m_dataSource, oldRootHash, root(), m_dataSource.savedNodeHashes(), [&staleHashes](const auto& node) {
+					// Sanity: each stale node is only reported once
+					EXPECT_TRUE(staleHashes.insert(node.hash()).second);
+				});
+
+				return staleHashes;
+			}
+
+			utils::HashSet findReachableNodes(const Hash256& rootHash) const {
+				utils::HashSet reachableHashes;
+				std::vector<Hash256> pendingHashes;
+				if (Hash256() != rootHash)
+					pendingHashes.push_back(rootHash);
+
+				while (!pendingHashes.empty()) {
+					auto hash = pendingHashes.back();
+					pendingHashes.pop_back();
+					reachableHashes.insert(hash);
+
+					auto pNode = m_dataSource.get(hash);
+					if (!pNode->isBranch())
+						continue;
+
+					const auto& branchNode = pNode->asBranchNode();
+					for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
+						if (branchNode.hasLink(i))
+							pendingHashes.push_back(branchNode.link(i));
+					}
+				}
+
+				return reachableHashes;
+			}
+
+		private:
+			RecordingDataSource m_dataSource;
+			RecordingBasePatriciaTree m_tree;
+		};
+
+		Changes CreateFourNodeChanges() {
+			return {
+				{ 0x64'6F'00'00, "verb" },
+				{ 0x64'6F'67'00, "puppy" },
+				{ 0x64'6F'67'65, "coin" },
+				{ 0x68'6F'72'73, "stallion" }
+			};
+		}
+
+		utils::HashSet Difference(const utils::HashSet& lhs, const utils::HashSet& rhs) {
+			utils::HashSet result;
+			for (const auto& hash : lhs) {
+				if (rhs.cend() == rhs.find(hash))
+					result.insert(hash);
+			}
+
+			return result;
+		}
+
+		void AssertNewTreeIsComplete(const TestContext& context, const utils::HashSet& staleHashes, const std::vector<uint32_t>& keys) {
+			// Arrange: copy all nodes except stale nodes into a new data source
+			MemoryDataSource dataSource;
+			context.dataSource().forEach([&staleHashes, &dataSource](const auto& node) {
+				if (staleHashes.cend() != staleHashes.find(node.hash()))
+					return;
+
+				if (node.isLeaf())
+					dataSource.set(node.asLeafNode());
+				else
+					dataSource.set(node.asBranchNode());
+			});
+
+			// Act:
+			BasePatriciaTree<test::PassThroughEncoder, MemoryDataSource> tree(dataSource, context.root());
+
+			// Assert: all values can still be proven
+			for (auto key : keys) {
+				std::vector<TreeNode> nodePath;
+				auto result = tree.lookup(key, nodePath);
+				EXPECT_TRUE(result.second) << key;
+			}
+		}
+	}
+
+	// region basic
+
+	TEST(TEST_CLASS, NoNodesAreStaleAfterFirstCommit) {
+		// Arrange:
+		TestContext context;
+		context.commit(CreateFourNodeChanges());
+
+		// Act:
+		auto staleHashes = context.findStaleNodes(Hash256());
+
+		// Assert:
+		EXPECT_TRUE(staleHashes.empty());
+	}
+
+	TEST(TEST_CLASS, NoNodesAreStaleWhenRootIsUnchanged) {
+		// Arrange:
+		TestContext context;
+		context.commit(CreateFourNodeChanges());
+		auto rootHash = context.root();
+
+		// - reset a value to its current value
+		context.commit({ { 0x64'6F'67'65, "coin" } });
+
+		// Act:
+		auto staleHashes = context.findStaleNodes(rootHash);
+
+		// Assert:
+		EXPECT_EQ(rootHash, context.root());
+		EXPECT_TRUE(staleHashes.empty());
+	}
+
+	TEST(TEST_CLASS, OldPathToChangedValueIsStale) {
+		// Arrange:
+		TestContext context;
+		context.commit(CreateFourNodeChanges());
+		auto oldRootHash = context.root();
+		auto oldReachableHashes = context.findReachableNodes(oldRootHash);
+
+		context.commit({ { 0x64'6F'67'65, "dog" } });
+
+		// Act:
+		auto staleHashes = context.findStaleNodes(oldRootHash);
+
+		// Assert: root -> (branch) -> branch -> leaf
+		EXPECT_EQ(4u, staleHashes.size());
+		EXPECT_EQ(Difference(oldReachableHashes, context.findReachableNodes(context.root())), staleHashes);
+		EXPECT_TRUE(staleHashes.cend() != staleHashes.find(oldRootHash));
+		AssertNewTreeIsComplete(context, staleHashes, { 0x64'6F'00'00, 0x64'6F'67'00, 0x64'6F'67'65, 0x68'6F'72'73 });
+	}
+
+	TEST(TEST_CLASS, AllOldNodesAreStaleWhenAllValuesAreRemoved) {
+		// Arrange:
+		TestContext context;
+		context.commit(CreateFourNodeChanges());
+		auto oldRootHash = context.root();
+		auto oldReachableHashes = context.findReachableNodes(oldRootHash);
+
+		context.commit({}, { 0x64'6F'00'00, 0x64'6F'67'00, 0x64'6F'67'65, 0x68'6F'72'73 });
+
+		// Act:
+		auto staleHashes = context.findStaleNodes(oldRootHash);
+
+		// Assert:
+		EXPECT_EQ(Hash256(), context.root());
+		EXPECT_EQ(oldReachableHashes, staleHashes);
+	}
+
+	TEST(TEST_CLASS, UnreachableCheckpointNodesAreStale) {
+		// Arrange:
+		TestContext context;
+		context.commit(CreateFourNodeChanges());
+		auto oldRootHash = context.root();
+		auto oldReachableHashes = context.findReachableNodes(oldRootHash);
+
+		// - the checkpoint saves nodes that are immediately replaced by the following change
+		context.commitWithCheckpoint({ { 0x64'6F'67'65, "dog" } }, { { 0x64'6F'67'65, "cat" } });
+		auto newReachableHashes = context.findReachableNodes(context.root());
+		auto checkpointHashes = Difference(context.dataSource().savedNodeHashes(), newReachableHashes);
+
+		// Act:
+		auto staleHashes = context.findStaleNodes(oldRootHash);
+
+		// Assert: old path nodes and checkpoint path nodes are stale
+		EXPECT_EQ(4u, checkpointHashes.size());
+		EXPECT_EQ(8u, staleHashes.size());
+		for (const auto& hash : Difference(oldReachableHashes, newReachableHashes))
+			EXPECT_TRUE(staleHashes.cend() != staleHashes.find(hash));
+
+		for (const auto& hash : checkpointHashes)
+			EXPECT_TRUE(staleHashes.cend() != staleHashes.find(hash));
+
+		AssertNewTreeIsComplete(context, staleHashes, { 0x64'6F'00'00, 0x64'6F'67'00, 0x64'6F'67'65, 0x68'6F'72'73 });
+	}
+
+	// endregion
+
+	// region random changes
+
+	TEST(TEST_CLASS, StaleNodesAreExactlyNodesNoLongerReachableAfterRandomChanges) {
+		// Arrange:
+		TestContext context;
+		std::vector<uint32_t> keys;
+		Changes changes;
+		for (auto i = 0u; i < 200; ++i) {
+			keys.push_back(static_cast<uint32_t>(test::Random()));
+			changes.emplace_back(keys.back(), std::to_string(i));
+		}
+
+		context.commit(changes);
+
+		for (auto round = 0u; round < 10; ++round) {
+			auto oldRootHash = context.root();
+			auto oldReachableHashes = context.findReachableNodes(oldRootHash);
+
+			// - modify some existing values and add some new ones
+			Changes roundChanges;
+			for (auto i = 0u; i < 10; ++i) {
+				roundChanges.emplace_back(keys[test::RandomByte() % keys.size()], "round " + std::to_string(round));
+				keys.push_back(static_cast<uint32_t>(test::Random()));
+				roundChanges.emplace_back(keys.back(), std::to_string(keys.size()));
+			}
+
+			context.commit(roundChanges);
+
+			// Act:
+			auto staleHashes = context.findStaleNodes(oldRootHash);
+
+			// Assert:
+			auto expectedStaleHashes = Difference(oldReachableHashes, context.findReachableNodes(context.root()));
+			EXPECT_EQ(expectedStaleHashes, staleHashes) << "round " << round;
+			AssertNewTreeIsComplete(context, staleHashes, keys);
+		}
+	}
+
+	// endregion
+}}
@@ -0,0 +1,284 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/TreeNodeCache.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace tree {
+
+#define TEST_CLASS TreeNodeCacheTests
+
+	namespace {
+		TreeNodeCacheOptions CreateOptions(size_t maxSize, size_t numPinnedLevels = 0, size_t numShards = 1) {
+			TreeNodeCacheOptions options;
+			options.MaxSize = maxSize;
+			options.NumPinnedLevels = numPinnedLevels;
+			options.NumShards = numShards;
+			return options;
+		}
+
+		std::shared_ptr<const TreeNode> CreateNode() {
+			return std::make_shared<const TreeNode>(LeafTreeNode(TreeNodePath(0x64'6F'67'00), test::GenerateRandomData<Hash256_Size>()));
+		}
+
+		void AssertStatistics(
+				const TreeNodeCache& cache,
+				size_t expectedNumCachedNodes,
+				size_t expectedNumPinnedNodes,
+				uint64_t expectedNumHits,
+				uint64_t expectedNumMisses) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(expectedNumCachedNodes, statistics.NumCachedNodes);
+			EXPECT_EQ(expectedNumPinnedNodes, statistics.NumPinnedNodes);
+			EXPECT_EQ(expectedNumHits, statistics.NumHits);
+			EXPECT_EQ(expectedNumMisses, statistics.NumMisses);
+		}
+	}
+
+	// region options
+
+	TEST(TEST_CLASS, DefaultOptionsDisableCache) {
+		// Act:
+		TreeNodeCacheOptions options;
+
+		// Assert:
+		EXPECT_EQ(0u, options.MaxSize);
+		EXPECT_EQ(0u, options.NumPinnedLevels);
+		EXPECT_EQ(16u, options.NumShards);
+		EXPECT_FALSE(options.isEnabled());
+	}
+
+	TEST(TEST_CLASS, OptionsWithMaxSizeOrPinnedLevelsEnableCache) {
+		// Act + Assert:
+		EXPECT_TRUE(CreateOptions(1, 0).isEnabled());
+		EXPECT_TRUE(CreateOptions(0, 1).isEnabled());
+		EXPECT_TRUE(CreateOptions(10, 3).isEnabled());
+	}
+
+	// endregion
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyCache) {
+		// Act:
+		TreeNodeCache cache(CreateOptions(10, 2, 4));
+
+		// Assert:
+		EXPECT_EQ(10u, cache.options().MaxSize);
+		EXPECT_EQ(2u, cache.options().NumPinnedLevels);
+		EXPECT_EQ(4u, cache.options().NumShards);
+		AssertStatistics(cache, 0, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CacheIsCreatedWithAtLeastOneShard) {
+		// Act:
+		TreeNodeCache cache(CreateOptions(10, 0, 0));
+
+		// Assert:
+		EXPECT_EQ(1u, cache.options().NumShards);
+	}
+
+	// endregion
+
+	// region find / add
+
+	TEST(TEST_CLASS, FindReturnsNullptrWhenNodeIsNotCached) {
+		// Arrange:
+		TreeNodeCache cache(CreateOptions(10));
+		cache.add(CreateNode());
+
+		// Act:
+		auto pNode = cache.find(test::GenerateRandomData<Hash256_Size>());
+
+		// Assert:
+		EXPECT_FALSE(!!pNode);
+		AssertStatistics(cache, 1, 0, 0, 1);
+	}
+
+	TEST(TEST_CLASS, FindReturnsSharedNodeWhenNodeIsCached) {
+		// Arrange:
+		TreeNodeCache cache(CreateOptions(10));
+		auto pNode = CreateNode();
+		cache.add(pNode);
+
+		// Act:
+		auto pCachedNode1 = cache.find(pNode->hash());
+		auto pCachedNode2 = cache.find(pNode->hash());
+
+		// Assert:
+		EXPECT_EQ(pNode, pCachedNode1);
+		EXPECT_EQ(pNode, pCachedNode2);
+		AssertStatistics(cache, 1, 0, 2, 0);
+	}
+
+	TEST(TEST_CLASS, AddReturnsPreviouslyCachedNodeWithSameHash) {
+		// Arrange:
+		TreeNodeCache cache(CreateOptions(10));
+		auto pNode = CreateNode();
+		cache.add(pNode);
+
+		// Act:
+		auto pCachedNode = cache.add(std::make_shared<const TreeNode>(pNode->copy()));
+
+		// Assert:
+		EXPECT_EQ(pNode, pCachedNode);
+		AssertStatistics(cache, 1, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, AddDoesNotCacheNodeWhenMaxSizeIsZero) {
+		// Arrange:
+		TreeNodeCache cache(CreateOptions(0, 2));
+		auto pNode = CreateNode();
+
+		// Act:
+		auto pCachedNode = cache.add(pNode);
+
+		// Assert:
+		EXPECT_EQ(pNode, pCachedNode);
+		EXPECT_FALSE(!!cache.find(pNode->hash()));
+		AssertStatistics(cache, 0, 0, 0, 1);
+	}
+
+	TEST(TEST_CLASS, AddEvictsLeastRecentlyUsedNodes) {
+		// Arrange:
+		TreeNodeCache cache(CreateOptions(2));
+		auto pNode1 = CreateNode();
+		auto pNode2 = CreateNode();
+		auto pNode3 = CreateNode();
+		cache.add(pNode1);
+		cache.add(pNode2);
+
+		// - use the first node so that the second node is least recently used
+		cache.find(pNode1->hash());
+
+		// Act:
+		cache.add(pNode3);
+
+		// Assert:
+		EXPECT_TRUE(!!cache.find(pNode1->hash()));
+		EXPECT_FALSE(!!cache.find(pNode2->hash()));
+		EXPECT_TRUE(!!cache.find(pNode3->hash()));
+		AssertStatistics(cache, 2, 0, 3, 1);
+	}
+
+	TEST(TEST_CLASS, SizeIsBoundedAcrossShards) {
+		// Arrange: four shards with at most two nodes each
+		TreeNodeCache cache(CreateOptions(8, 0, 4));
+
+		// Act:
+		for (auto i = 0u; i < 100; ++i)
+			cache.add(CreateNode());
+
+		// Assert:
+		EXPECT_GE(8u, cache.statistics().NumCachedNodes);
+	}
+
+	// endregion
+
+	// region pin
+
+	TEST(TEST_CLASS, PinnedNodesAreNotEvicted) {
+		// Arrange:
+		TreeNodeCache cache(CreateOptions(1));
+		auto pPinnedNode = CreateNode();
+		cache.pin({ pPinnedNode });
+
+		// Act:
+		for (auto i = 0u; i < 10; ++i)
+			cache.add(CreateNode());
+
+		// Assert:
+		EXPECT_EQ(pPinnedNode, cache.find(pPinnedNode->hash()));
+		AssertStatistics(cache, 2, 1, 1, 0);
+	}
+
+	TEST(TEST_CLASS, PinMovesCachedNodesToPinnedNodes) {
+		// Arrange:
+		TreeNodeCache cache(CreateOptions(10));
+		auto pNode1 = CreateNode();
+		auto pNode2 = CreateNode();
+		cache.add(pNode1);
+		cache.add(pNode2);
+
+		// Act:
+		cache.pin({ pNode1 });
+
+		// Assert: node is not counted twice
+		EXPECT_EQ(pNode1, cache.find(pNode1->hash()));
+		AssertStatistics(cache, 2, 1, 1, 0);
+	}
+
+	TEST(TEST_CLASS, PinDemotesPreviouslyPinnedNodes) {
+		// Arrange:
+		TreeNodeCache cache(CreateOptions(10));
+		auto pNode1 = CreateNode();
+		auto pNode2 = CreateNode();
+		auto pNode3 = CreateNode();
+		cache.pin({ pNode1, pNode2 });
+
+		// Act:
+		cache.pin({ pNode2, pNode3 });
+
+		// Assert: first node is still cached but no longer pinned
+		EXPECT_EQ(pNode1, cache.find(pNode1->hash()));
+		EXPECT_EQ(pNode2, cache.find(pNode2->hash()));
+		EXPECT_EQ(pNode3, cache.find(pNode3->hash()));
+		AssertStatistics(cache, 3, 2, 3, 0);
+	}
+
+	TEST(TEST_CLASS, PinnedNodesAreRetainedWhenMaxSizeIsZero) {
+		// Arrange:
+		TreeNodeCache cache(CreateOptions(0, 1));
+		auto pNode1 = CreateNode();
+		auto pNode2 = CreateNode();
+		cache.pin({ pNode1 });
+
+		// Act:
+		cache.pin({ pNode2 });
+
+		// Assert: demoted node is dropped because there is no room for unpinned nodes
+		EXPECT_FALSE(!!cache.find(pNode1->hash()));
+		EXPECT_EQ(pNode2, cache.find(pNode2->hash()));
+		AssertStatistics(cache, 1, 1, 1, 1);
+	}
+
+	// endregion
+
+	// region clear
+
+	TEST(TEST_CLASS, ClearRemovesAllNodes) {
+		// Arrange:
+		TreeNodeCache cache(CreateOptions(100, 0, 4));
+		cache.pin({ CreateNode(), CreateNode() });
+		for (auto i = 0u; i < 5; ++i)
+			cache.add(CreateNode());
+
+		// Sanity:
+		AssertStatistics(cache, 7, 2, 0, 0);
+
+		// Act:
+		cache.clear();
+
+		// Assert:
+		AssertStatistics(cache, 0, 0, 0, 0);
+	}
+
+	// endregion
+}}
@@ -1484,6 +1484,185 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region update
+
+	private:
+		using UpdateChanges = typename tree::PatriciaTree<PassThroughEncoder, DataSource>::Changes;
+
+		static std::vector<std::pair<uint32_t, std::string>> GenerateRandomPairs(size_t count) {
+			std::vector<std::pair<uint32_t, std::string>> pairs;
+			for (auto i = 0u; i < count; ++i)
+				pairs.emplace_back(static_cast<uint32_t>(test::Random()), std::to_string(i));
+
+			return pairs;
+		}
+
+		static void AssertUpdateIsEquivalentToIndividualChanges(
+				const std::vector<std::pair<uint32_t, std::string>>& seedPairs,
+				const std::vector<std::pair<uint32_t, std::string>>& setPairs,
+				const std::vector<uint32_t>& unsetKeys) {
+			// Arrange: apply all changes individually to one tree
+			TestContext expectedContext(tree::DataSourceVerbosity::Off);
+			TestContext context(tree::DataSourceVerbosity::Off);
+			for (const auto& pair : seedPairs) {
+				expectedContext.tree().set(pair.first, pair.second);
+				context.tree().set(pair.first, pair.second);
+			}
+
+			UpdateChanges changes;
+			for (const auto& pair : setPairs) {
+				expectedContext.tree().set(pair.first, pair.second);
+				changes.emplace_back(pair.first, &pair.second);
+			}
+
+			for (auto key : unsetKeys) {
+				expectedContext.tree().unset(key);
+				changes.emplace_back(key, nullptr);
+			}
+
+			// Act: apply all changes as a batch to the other tree
+			context.tree().update(changes);
+
+			// Assert:
+			EXPECT_EQ(expectedContext.tree().root(), context.tree().root());
+		}
+
+	public:
+		static void AssertUpdateWithoutChangesHasNoEffect() {
+			// Arrange:
+			TestContext context;
+			auto checker = CreateCheckerForCanCreatePuppyTreeWithRootExtensionNode(context.dataSource());
+			for (const auto& pair : GetPuppyTreeWithRootExtensionNodePairs())
+				context.tree().set(pair.first, pair.second);
+
+			// Act:
+			context.tree().update({});
+
+			// Assert:
+			EXPECT_EQ(checker.get("root"), context.tree().root());
+		}
+
+		static void AssertCanCreatePuppyTreeWithRootExtensionNode_Update() {
+			// Arrange:
+			size_t i = 0u;
+			auto pairs = GetPuppyTreeWithRootExtensionNodePairs();
+			Hash256 expectedHash;
+			{
+				TestContext context(tree::DataSourceVerbosity::Off);
+				expectedHash = CreateCheckerForCanCreatePuppyTreeWithRootExtensionNode(context.dataSource()).get("root");
+			}
+
+			for (; 0 == i || std::next_permutation(pairs.begin(), pairs.end());) {
+				TestContext context(tree::DataSourceVerbosity::Off);
+				UpdateChanges changes;
+				for (const auto& pair : pairs)
+					changes.emplace_back(pair.first, &pair.second);
+
+				// Act:
+				context.tree().update(changes);
+
+				// Assert:
+				EXPECT_EQ(expectedHash, context.tree().root()) << "permutation " << i;
+				++i;
+			};
+
+			// Sanity: 4!
+			EXPECT_EQ(24u, i);
+		}
+
+		static void AssertCanAddValuesToExistingTreeWithUpdate() {
+			// Arrange: add values that split existing leaves and branches
+			auto seedPairs = GetPuppyTreeWithRootExtensionNodePairs();
+			std::vector<std::pair<uint32_t, std::string>> setPairs{
+				{ 0x64'6F'00'01, "verbose" }, // splits leaf
+				{ 0x64'6F'67'66, "coins" }, // adds link to branch
+				{ 0x64'00'00'00, "dog" }, // splits extension branch
+				{ 0x68'6F'72'73, "pony" }, // updates leaf
+				{ 0x70'00'00'00, "cat" } // adds link to root branch
+			};
+
+			// Act + Assert:
+			AssertUpdateIsEquivalentToIndividualChanges(seedPairs, setPairs, {});
+		}
+
+		static void AssertCanRemoveValuesFromExistingTreeWithUpdate() {
+			// Arrange: remove an existing, a nonexistent and a collapsing value
+			auto seedPairs = GetPuppyTreeWithRootExtensionNodePairs();
+
+			// Act + Assert:
+			AssertUpdateIsEquivalentToIndividualChanges(seedPairs, {}, { 0x64'6F'67'65, 0x11'22'33'44, 0x64'6F'00'00 });
+		}
+
+		static void AssertUpdateAppliesOnlyLastChangeOfEachKey() {
+			// Arrange:
+			TestContext expectedContext;
+			expectedContext.tree().set(0x64'6F'00'00, "verb");
+			expectedContext.tree().set(0x68'6F'72'73, "stallion");
+
+			std::string values[] = { "puppy", "coin", "verb", "stallion", "dog" };
+			UpdateChanges changes{
+				{ 0x64'6F'67'00, &values[0] },
+				{ 0x64'6F'00'00, &values[1] },
+				{ 0x64'6F'67'00, nullptr },
+				{ 0x64'6F'00'00, &values[2] },
+				{ 0x68'6F'72'73, &values[3] },
+				{ 0x70'00'00'00, &values[4] },
+				{ 0x70'00'00'00, nullptr }
+			};
+
+			TestContext context;
+
+			// Act:
+			context.tree().update(changes);
+
+			// Assert:
+			EXPECT_EQ(expectedContext.tree().root(), context.tree().root());
+		}
+
+		static void AssertUpdateIsEquivalentToIndividualChangesForManyChanges() {
+			// Arrange: use enough changes to trigger parallel hashing
+			auto seedPairs = GenerateRandomPairs(2000);
+			auto setPairs = GenerateRandomPairs(1500);
+			for (auto i = 0u; i < 500; ++i)
+				setPairs.emplace_back(seedPairs[i * 2].first, "updated " + std::to_string(i));
+
+			std::vector<uint32_t> unsetKeys;
+			for (auto i = 0u; i < 500; ++i) {
+				unsetKeys.push_back(seedPairs[i * 2 + 1].first);
+				unsetKeys.push_back(static_cast<uint32_t>(test::Random()));
+			}
+
+			// Act + Assert:
+			AssertUpdateIsEquivalentToIndividualChanges(seedPairs, setPairs, unsetKeys);
+		}
+
+		static void AssertCanSaveTreeAfterUpdate() {
+			// Arrange:
+			auto pairs = GenerateRandomPairs(1500);
+			UpdateChanges changes;
+			for (const auto& pair : pairs)
+				changes.emplace_back(pair.first, &pair.second);
+
+			TestContext context(tree::DataSourceVerbosity::Off);
+			context.tree().update(changes);
+
+			// Act: save the tree and load it into a new tree
+			context.tree().saveAll();
+			tree::PatriciaTree<PassThroughEncoder, DataSource> tree(context.dataSource());
+			auto isLoaded = tree.tryLoad(context.tree().root());
+
+			// Assert:
+			EXPECT_TRUE(isLoaded);
+			for (auto i = 0u; i < 10; ++i) {
+				std::vector<tree::TreeNode> nodePath;
+				auto result = tree.lookup(pairs[i * 100].first, nodePath);
+				EXPECT_TRUE(result.second) << "pair at " << i * 100;
+				EXPECT_EQ(PassThroughEncoder::EncodeValue(pairs[i * 100].second), result.first) << "pair at " << i * 100;
+			}
+		}
+
+		// endregion
+
 		// region tryLoad
 
 	private:
@@ -1704,6 +1883,14 @@ namespace catapult { namespace test {
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanCreatePuppyTreeWithRootExtensionNode_AnyOrder) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanUndoPuppyTreeWithRootExtensionNode_AnyOrder) \
 	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, UpdateWithoutChangesHasNoEffect) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanCreatePuppyTreeWithRootExtensionNode_Update) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanAddValuesToExistingTreeWithUpdate) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanRemoveValuesFromExistingTreeWithUpdate) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, UpdateAppliesOnlyLastChangeOfEachKey) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, UpdateIsEquivalentToIndividualChangesForManyChanges) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanSaveTreeAfterUpdate) \
+	\
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundLatestRootHash) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundPreviousRootHash) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundNonRootHash) \
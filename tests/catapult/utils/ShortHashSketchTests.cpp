@@ -0,0 +1,317 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/ShortHashSketch.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS ShortHashSketchTests
+
+	namespace {
+		constexpr auto Num_Hash_Functions = ShortHashSketch::Num_Hash_Functions;
+
+		std::vector<ShortHash> GenerateUniqueShortHashes(size_t count) {
+			// use deterministic short hashes because decoding is probabilistic
+			std::vector<ShortHash> shortHashes;
+			for (auto i = 0u; i < count; ++i)
+				shortHashes.push_back(ShortHash(i * 2654435761u + 1));
+
+			return shortHashes;
+		}
+
+		ShortHashSketch CreateSketch(size_t numCells, const std::vector<ShortHash>& shortHashes) {
+			ShortHashSketch sketch(numCells);
+			for (const auto& shortHash : shortHashes)
+				sketch.insert(shortHash);
+
+			return sketch;
+		}
+
+		bool IsZero(const ShortHashSketchCell& cell) {
+			return 0 == cell.Count && ShortHash() == cell.KeySum && 0u == cell.ChecksumSum;
+		}
+
+		void AssertZero(const ShortHashSketch& sketch) {
+			for (auto i = 0u; i < sketch.size(); ++i)
+				EXPECT_TRUE(IsZero(sketch.cells()[i])) << "cell at " << i;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateSketchWithMultipleOfHashFunctionsCells) {
+		// Act:
+		ShortHashSketch sketch(Num_Hash_Functions * 7);
+
+		// Assert:
+		EXPECT_EQ(Num_Hash_Functions * 7, sketch.size());
+		AssertZero(sketch);
+	}
+
+	TEST(TEST_CLASS, CellCountIsRoundedUpToMultipleOfHashFunctions) {
+		// Act:
+		ShortHashSketch sketch0(0);
+		ShortHashSketch sketch1(Num_Hash_Functions * 7 + 1);
+
+		// Assert:
+		EXPECT_EQ(Num_Hash_Functions, sketch0.size());
+		EXPECT_EQ(Num_Hash_Functions * 8, sketch1.size());
+	}
+
+	TEST(TEST_CLASS, CanCreateSketchAroundCells) {
+		// Arrange:
+		auto seedSketch = CreateSketch(30, GenerateUniqueShortHashes(10));
+		auto cells = seedSketch.cells();
+
+		// Act:
+		ShortHashSketch sketch(std::move(cells));
+
+		// Assert:
+		ASSERT_EQ(30u, sketch.size());
+		EXPECT_EQ_MEMORY(seedSketch.cells().data(), sketch.cells().data(), 30 * sizeof(ShortHashSketchCell));
+	}
+
+	TEST(TEST_CLASS, CannotCreateSketchAroundInvalidNumberOfCells) {
+		// Act + Assert:
+		EXPECT_THROW(ShortHashSketch(std::vector<ShortHashSketchCell>()), catapult_invalid_argument);
+		EXPECT_THROW(ShortHashSketch(std::vector<ShortHashSketchCell>(Num_Hash_Functions + 1)), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region CalculateCellCount / IsValidCellCount
+
+	TEST(TEST_CLASS, CalculateCellCountReturnsValidCellCountsThatGrowWithDifference) {
+		// Arrange:
+		size_t previousNumCells = 0;
+		for (auto maxDifference : { 0u, 1u, 10u, 100u, 1000u, 10000u }) {
+			// Act:
+			auto numCells = ShortHashSketch::CalculateCellCount(maxDifference);
+
+			// Assert:
+			EXPECT_TRUE(ShortHashSketch::IsValidCellCount(numCells)) << maxDifference;
+			EXPECT_LT(maxDifference, numCells) << maxDifference;
+			EXPECT_LT(previousNumCells, numCells) << maxDifference;
+			previousNumCells = numCells;
+		}
+	}
+
+	TEST(TEST_CLASS, IsValidCellCountOnlyReturnsTrueForNonzeroMultiplesOfHashFunctions) {
+		// Assert:
+		EXPECT_FALSE(ShortHashSketch::IsValidCellCount(0));
+		EXPECT_FALSE(ShortHashSketch::IsValidCellCount(Num_Hash_Functions - 1));
+		EXPECT_FALSE(ShortHashSketch::IsValidCellCount(Num_Hash_Functions + 1));
+
+		EXPECT_TRUE(ShortHashSketch::IsValidCellCount(Num_Hash_Functions));
+		EXPECT_TRUE(ShortHashSketch::IsValidCellCount(Num_Hash_Functions * 100));
+	}
+
+	// endregion
+
+	// region insert / remove
+
+	TEST(TEST_CLASS, InsertUpdatesExactlyNumHashFunctionsCells) {
+		// Arrange:
+		ShortHashSketch sketch(300);
+
+		// Act:
+		sketch.insert(ShortHash(0x12345678));
+
+		// Assert:
+		auto numUpdatedCells = 0u;
+		for (const auto& cell : sketch.cells()) {
+			if (IsZero(cell))
+				continue;
+
+			++numUpdatedCells;
+			EXPECT_EQ(1, cell.Count);
+			EXPECT_EQ(ShortHash(0x12345678), cell.KeySum);
+		}
+
+		EXPECT_EQ(Num_Hash_Functions, numUpdatedCells);
+	}
+
+	TEST(TEST_CLASS, RemoveUndoesInsert) {
+		// Arrange:
+		auto shortHashes = GenerateUniqueShortHashes(50);
+		auto sketch = CreateSketch(90, shortHashes);
+
+		// Act:
+		for (const auto& shortHash : shortHashes)
+			sketch.remove(shortHash);
+
+		// Assert:
+		AssertZero(sketch);
+	}
+
+	TEST(TEST_CLASS, SketchIsIndependentOfInsertionOrder) {
+		// Arrange:
+		auto shortHashes = GenerateUniqueShortHashes(50);
+		auto reversedShortHashes = std::vector<ShortHash>(shortHashes.crbegin(), shortHashes.crend());
+
+		// Act:
+		auto sketch1 = CreateSketch(90, shortHashes);
+		auto sketch2 = CreateSketch(90, reversedShortHashes);
+
+		// Assert:
+		EXPECT_EQ_MEMORY(sketch1.cells().data(), sketch2.cells().data(), 90 * sizeof(ShortHashSketchCell));
+	}
+
+	TEST(TEST_CLASS, InsertDistinctInsertsEachShortHashOnce) {
+		// Arrange:
+		auto shortHashes = GenerateUniqueShortHashes(50);
+		auto shortHashesWithDuplicates = shortHashes;
+		shortHashesWithDuplicates.insert(shortHashesWithDuplicates.end(), shortHashes.crbegin(), shortHashes.crbegin() + 20);
+
+		ShortHashSketch sketch(90);
+
+		// Act:
+		sketch.insertDistinct(std::move(shortHashesWithDuplicates));
+
+		// Assert:
+		auto expectedSketch = CreateSketch(90, shortHashes);
+		EXPECT_EQ_MEMORY(expectedSketch.cells().data(), sketch.cells().data(), 90 * sizeof(ShortHashSketchCell));
+	}
+
+	// endregion
+
+	// region subtract
+
+	TEST(TEST_CLASS, CannotSubtractSketchesWithDifferentSizes) {
+		// Arrange:
+		ShortHashSketch sketch1(30);
+		ShortHashSketch sketch2(33);
+
+		// Act + Assert:
+		EXPECT_THROW(sketch1.subtract(sketch2), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, SubtractingEqualSketchesYieldsZeroSketch) {
+		// Arrange:
+		auto shortHashes = GenerateUniqueShortHashes(100);
+		auto sketch1 = CreateSketch(30, shortHashes);
+		auto sketch2 = CreateSketch(30, shortHashes);
+
+		// Act:
+		sketch1.subtract(sketch2);
+
+		// Assert:
+		AssertZero(sketch1);
+	}
+
+	// endregion
+
+	// region tryDecode
+
+	namespace {
+		struct DecodeResult {
+			bool IsDecoded;
+			ShortHashesSet InsertedShortHashes;
+			ShortHashesSet RemovedShortHashes;
+		};
+
+		DecodeResult Decode(const ShortHashSketch& sketch) {
+			DecodeResult result;
+			result.IsDecoded = sketch.tryDecode(result.InsertedShortHashes, result.RemovedShortHashes);
+			return result;
+		}
+
+		DecodeResult DecodeDifference(size_t numCommon, size_t numLocalOnly, size_t numRemoteOnly, ShortHashesSet& localOnly, ShortHashesSet& remoteOnly) {
+			auto shortHashes = GenerateUniqueShortHashes(numCommon + numLocalOnly + numRemoteOnly);
+			auto localShortHashes = std::vector<ShortHash>(shortHashes.cbegin(), shortHashes.cbegin() + static_cast<long>(numCommon + numLocalOnly));
+			auto remoteShortHashes = std::vector<ShortHash>(shortHashes.cbegin(), shortHashes.cbegin() + static_cast<long>(numCommon));
+			remoteShortHashes.insert(remoteShortHashes.end(), shortHashes.cbegin() + static_cast<long>(numCommon + numLocalOnly), shortHashes.cend());
+
+			localOnly = ShortHashesSet(localShortHashes.cbegin() + static_cast<long>(numCommon), localShortHashes.cend());
+			remoteOnly = ShortHashesSet(remoteShortHashes.cbegin() + static_cast<long>(numCommon), remoteShortHashes.cend());
+
+			auto numCells = ShortHashSketch::CalculateCellCount(numLocalOnly + numRemoteOnly);
+			auto sketch = CreateSketch(numCells, localShortHashes);
+			sketch.subtract(CreateSketch(numCells, remoteShortHashes));
+			return Decode(sketch);
+		}
+	}
+
+	TEST(TEST_CLASS, CanDecodeEmptySketch) {
+		// Act:
+		auto result = Decode(ShortHashSketch(30));
+
+		// Assert:
+		EXPECT_TRUE(result.IsDecoded);
+		EXPECT_TRUE(result.InsertedShortHashes.empty());
+		EXPECT_TRUE(result.RemovedShortHashes.empty());
+	}
+
+	TEST(TEST_CLASS, CanDecodeSketchWithInsertedAndRemovedShortHashes) {
+		// Arrange:
+		ShortHashSketch sketch(30);
+		sketch.insert(ShortHash(123));
+		sketch.insert(ShortHash(234));
+		sketch.remove(ShortHash(345));
+
+		// Act:
+		auto result = Decode(sketch);
+
+		// Assert:
+		EXPECT_TRUE(result.IsDecoded);
+		EXPECT_EQ(ShortHashesSet({ ShortHash(123), ShortHash(234) }), result.InsertedShortHashes);
+		EXPECT_EQ(ShortHashesSet({ ShortHash(345) }), result.RemovedShortHashes);
+	}
+
+	TEST(TEST_CLASS, DecodeDoesNotModifySketch) {
+		// Arrange:
+		auto sketch = CreateSketch(30, GenerateUniqueShortHashes(5));
+		auto originalCells = sketch.cells();
+
+		// Act:
+		Decode(sketch);
+
+		// Assert:
+		EXPECT_EQ_MEMORY(originalCells.data(), sketch.cells().data(), 30 * sizeof(ShortHashSketchCell));
+	}
+
+	TEST(TEST_CLASS, CanDecodeSmallDifferenceOfLargeSets) {
+		for (auto numDifferences : { 1u, 10u, 100u, 1000u }) {
+			// Act:
+			ShortHashesSet expectedLocalOnly;
+			ShortHashesSet expectedRemoteOnly;
+			auto result = DecodeDifference(10'000, numDifferences / 2 + 1, numDifferences / 2, expectedLocalOnly, expectedRemoteOnly);
+
+			// Assert:
+			EXPECT_TRUE(result.IsDecoded) << numDifferences;
+			EXPECT_EQ(expectedLocalOnly, result.InsertedShortHashes) << numDifferences;
+			EXPECT_EQ(expectedRemoteOnly, result.RemovedShortHashes) << numDifferences;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotDecodeSketchWithTooManyShortHashes) {
+		// Arrange:
+		auto sketch = CreateSketch(30, GenerateUniqueShortHashes(1000));
+
+		// Act:
+		auto result = Decode(sketch);
+
+		// Assert:
+		EXPECT_FALSE(result.IsDecoded);
+	}
+
+	// endregion
+}}
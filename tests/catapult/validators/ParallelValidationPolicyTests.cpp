@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/validators/ParallelValidationPolicy.h"
+#include "catapult/thread/ParallelFor.h"
 #include "tests/catapult/validators/test/ValidationPolicyTestUtils.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/BasicMultiThreadedState.h"
@@ -38,6 +39,12 @@ namespace catapult { namespace validators {
 					, m_isReleased(false)
 			{}
 
+			PoolValidationPolicyPair(const std::shared_ptr<thread::IoServiceThreadPool>& pPool, thread::ParallelForStrategy strategy)
+					: m_pPool(pPool)
+					, m_pValidationPolicy(CreateParallelValidationPolicy(m_pPool, strategy))
+					, m_isReleased(false)
+			{}
+
 			~PoolValidationPolicyPair() {
 				if (m_pPool)
 					stopAll();
@@ -474,6 +481,77 @@ namespace catapult { namespace validators {
 
 	// endregion
 
+	// region work stealing
+
+	namespace {
+		auto CreateWorkStealingPolicy() {
+			return PoolValidationPolicyPair(test::CreateStartedIoServiceThreadPool(), thread::ParallelForStrategy::Work_Stealing);
+		}
+	}
+
+	PARALLEL_POLICY_TEST(WorkStealingValidateInvokesValidateOnEachEntity) {
+		// Arrange:
+		auto counters = Counters();
+		auto funcs = CreateValidationFuncs({ ValidationResult::Success, ValidationResult::Neutral }, counters);
+		auto pPolicy = CreateWorkStealingPolicy();
+
+		// Act:
+		auto entityInfos = test::CreateEntityInfos(20);
+		auto result = TTraits::Validate(*pPolicy, entityInfos.toVector(), funcs).get();
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ 20, 20 }), counters.toVector());
+		EXPECT_EQ(ValidationResult::Neutral, TTraits::GetFirstResult(result));
+	}
+
+	PARALLEL_POLICY_TEST(WorkStealingIdleThreadsValidateEntitiesOfBusyThread) {
+		// Arrange: block validation of the first entity until all other entities have been validated
+		//          (this would deadlock if other threads could not steal the entities initially assigned to the first thread)
+		constexpr auto Num_Entities = 20u;
+		std::atomic<size_t> counter(0);
+		auto funcs = ValidationFunctions{
+			[&counter](const auto& entityInfo) {
+				if (0 == entityInfo.hash()[0])
+					WAIT_FOR_VALUE_EXPR(Num_Entities - 1, counter.load());
+
+				++counter;
+				return ValidationResult::Success;
+			}
+		};
+		auto pPolicy = CreateWorkStealingPolicy();
+
+		// Act:
+		auto entityInfos = test::CreateEntityInfos(Num_Entities);
+		auto result = TTraits::Validate(*pPolicy, entityInfos.toVector(), funcs).get();
+
+		// Assert:
+		EXPECT_EQ(Num_Entities, counter);
+		EXPECT_TRUE(TTraits::IsSuccess(result));
+	}
+
+	TEST(TEST_CLASS, WorkStealingFailureShortCircuitsSubsequentValidationsForSubsequentEntities_ShortCircuit) {
+		// Arrange:
+		auto counters = Counters();
+		std::atomic_bool wait(true);
+		auto funcs = CreateValidationFuncs(
+				{ ValidationResult::Success, ValidationResult::Failure, ValidationResult::Neutral },
+				counters,
+				wait);
+		auto pPolicy = CreateWorkStealingPolicy();
+
+		// Act:
+		auto entityInfos = test::CreateEntityInfos(5);
+		auto result = ShortCircuitTraits::Validate(*pPolicy, entityInfos.toVector(), funcs).get();
+
+		// Assert: notice that the first entity that fails validation short circuits validation of all subsequent entities
+		EXPECT_LE(1u, counters[0]);
+		EXPECT_EQ(1u, counters[1]);
+		EXPECT_EQ(0u, counters[2]);
+		EXPECT_EQ(ValidationResult::Failure, result);
+	}
+
+	// endregion
+
 	// region work distribution
 
 	namespace {
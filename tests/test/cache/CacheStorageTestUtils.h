@@ -102,6 +102,53 @@ namespace catapult { namespace test {
 		static void AssertCanLoadValueViaLoadInto() {
 			AssertCanLoadValue<LoadIntoTraits>();
 		}
+
+	public:
+		static void AssertCanPurgeValue() {
+			// Arrange:
+			typename TTraits::CacheType cache;
+			auto value = TTraits::CreateRandomValue();
+			{
+				auto delta = cache.createDelta();
+				TTraits::StorageType::LoadInto(value, *delta);
+				cache.commit();
+			}
+
+			// Act:
+			{
+				auto delta = cache.createDelta();
+				TTraits::StorageType::Purge(value, *delta);
+				cache.commit();
+			}
+
+			// Assert:
+			auto view = cache.createView();
+			EXPECT_EQ(0u, view->size());
+			EXPECT_FALSE(view->contains(value));
+		}
+
+		static void AssertPurgeIsNoOpWhenValueIsNotContained() {
+			// Arrange:
+			typename TTraits::CacheType cache;
+			auto value = TTraits::CreateRandomValue();
+			{
+				auto delta = cache.createDelta();
+				TTraits::StorageType::LoadInto(value, *delta);
+				cache.commit();
+			}
+
+			// Act:
+			{
+				auto delta = cache.createDelta();
+				TTraits::StorageType::Purge(TTraits::CreateRandomValue(), *delta);
+				cache.commit();
+			}
+
+			// Assert:
+			auto view = cache.createView();
+			EXPECT_EQ(1u, view->size());
+			EXPECT_TRUE(view->contains(value));
+		}
 	};
 
 #define MAKE_CONTAINS_ONLY_CACHE_STORAGE_TEST(TEST_CLASS, TRAITS, TEST_NAME) \
@@ -110,7 +157,9 @@ namespace catapult { namespace test {
 #define DEFINE_CONTAINS_ONLY_CACHE_STORAGE_TESTS(TEST_CLASS, TRAITS) \
 	MAKE_CONTAINS_ONLY_CACHE_STORAGE_TEST(TEST_CLASS, TRAITS, CanSaveValue) \
 	MAKE_CONTAINS_ONLY_CACHE_STORAGE_TEST(TEST_CLASS, TRAITS, CanLoadValueViaLoad) \
-	MAKE_CONTAINS_ONLY_CACHE_STORAGE_TEST(TEST_CLASS, TRAITS, CanLoadValueViaLoadInto)
+	MAKE_CONTAINS_ONLY_CACHE_STORAGE_TEST(TEST_CLASS, TRAITS, CanLoadValueViaLoadInto) \
+	MAKE_CONTAINS_ONLY_CACHE_STORAGE_TEST(TEST_CLASS, TRAITS, CanPurgeValue) \
+	MAKE_CONTAINS_ONLY_CACHE_STORAGE_TEST(TEST_CLASS, TRAITS, PurgeIsNoOpWhenValueIsNotContained)
 
 	// endregion
 }}
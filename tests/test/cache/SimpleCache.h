@@ -20,6 +20,7 @@
 
 #pragma once
 #include "catapult/cache/CacheConfiguration.h"
+#include "catapult/cache/PrefetchKeys.h"
 #include "catapult/cache/ReadOnlySimpleCache.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
 #include "catapult/cache/SynchronizedCache.h"
@@ -181,8 +182,21 @@ namespace catapult { namespace test {
 			*m_pMerkleRoot = merkleRoot;
 		}
 
+	public:
+		/// Prefetches entries identified by \a keys.
+		/// \note This only records the number of prefetched addresses.
+		void prefetch(const cache::PrefetchKeys& keys) const {
+			m_numPrefetchedAddresses += keys.Addresses.size();
+		}
+
+		/// Gets the total number of prefetched addresses.
+		size_t numPrefetchedAddresses() const {
+			return m_numPrefetchedAddresses;
+		}
+
 	private:
 		std::unique_ptr<Hash256> m_pMerkleRoot;
+		mutable size_t m_numPrefetchedAddresses = 0;
 	};
 
 	// endregion
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/cache/CacheChangesStorage.h"
 #include "catapult/cache/CacheConfiguration.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
@@ -45,6 +46,32 @@ namespace catapult { namespace test {
 					std::string(TTraits::Base_Name) + "_summary");
 		}
 
+		static void AssertCanCreateCacheChangesStorageViaPluginForFullStorage() {
+			// Arrange:
+			typename TTraits::PluginType plugin{ cache::CacheConfiguration() };
+
+			// Act:
+			auto pChangesStorage = plugin.createChangesStorage();
+
+			// Assert:
+			ASSERT_TRUE(!!pChangesStorage);
+			EXPECT_EQ(TTraits::Base_Name, pChangesStorage->name());
+		}
+
+		static void AssertCannotCreateCacheChangesStorageViaPluginForSummaryStorage() {
+			// Arrange: use TempDirectoryGuard  to remove db directory without including rocksdb related includes
+			test::TempDirectoryGuard dbDirGuard;
+			auto patriciaTreeStorageMode = cache::PatriciaTreeStorageMode::Disabled;
+			cache::CacheConfiguration config(dbDirGuard.name(), utils::FileSize::FromMegabytes(5), patriciaTreeStorageMode);
+			typename TTraits::PluginType plugin(config);
+
+			// Act:
+			auto pChangesStorage = plugin.createChangesStorage();
+
+			// Assert:
+			EXPECT_FALSE(!!pChangesStorage);
+		}
+
 	private:
 		static void AssertCanCreateStorageViaPlugin(const cache::CacheConfiguration& config, const std::string& expectedStorageName) {
 			// Arrange:
@@ -66,5 +93,7 @@ namespace catapult { namespace test {
 
 #define DEFINE_SUMMARY_AWARE_CACHE_STORAGE_PLUGIN_TESTS(TRAITS) \
 	MAKE_SUMMARY_AWARE_CACHE_STORAGE_PLUGIN_TEST(TRAITS, CanCreateCacheStorageViaPluginForFullStorage) \
-	MAKE_SUMMARY_AWARE_CACHE_STORAGE_PLUGIN_TEST(TRAITS, CanCreateCacheStorageViaPluginForSummaryStorage)
+	MAKE_SUMMARY_AWARE_CACHE_STORAGE_PLUGIN_TEST(TRAITS, CanCreateCacheStorageViaPluginForSummaryStorage) \
+	MAKE_SUMMARY_AWARE_CACHE_STORAGE_PLUGIN_TEST(TRAITS, CanCreateCacheChangesStorageViaPluginForFullStorage) \
+	MAKE_SUMMARY_AWARE_CACHE_STORAGE_PLUGIN_TEST(TRAITS, CannotCreateCacheChangesStorageViaPluginForSummaryStorage)
 }}
@@ -318,6 +318,97 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region loadBlocks
+
+	private:
+		static void AssertNoBlocks(uint32_t numBlocks, uint32_t maxBlocks, Height requestHeight) {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(numBlocks);
+
+			// Act:
+			auto blocks = pStorage->loadBlocks(requestHeight, maxBlocks, std::numeric_limits<size_t>::max());
+
+			// Assert:
+			EXPECT_TRUE(blocks.empty());
+		}
+
+		static void AssertCanLoadBlocks(
+				size_t numBlocks,
+				size_t maxBlocks,
+				size_t maxBytes,
+				Height startHeight,
+				size_t expectedNumBlocks) {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(numBlocks);
+			AssertLoadedBlocks(*pStorage, maxBlocks, maxBytes, startHeight, expectedNumBlocks);
+		}
+
+		template<typename TStorage>
+		static void AssertLoadedBlocks(
+				const TStorage& storage,
+				size_t maxBlocks,
+				size_t maxBytes,
+				Height startHeight,
+				size_t expectedNumBlocks) {
+			// Act:
+			auto blocks = storage.loadBlocks(startHeight, maxBlocks, maxBytes);
+
+			// Assert:
+			ASSERT_EQ(expectedNumBlocks, blocks.size());
+			auto height = startHeight;
+			for (const auto& pBlock : blocks) {
+				auto pExpectedBlock = storage.loadBlock(height);
+				EXPECT_EQ(*pExpectedBlock, *pBlock) << "block at " << height;
+				height = height + Height(1);
+			}
+		}
+
+	public:
+		static void AssertLoadBlocks_LoadsZeroBlocksWhenRequestHeightIsZero() {
+			AssertNoBlocks(10, 1, Height(0));
+		}
+
+		static void AssertLoadBlocks_LoadsZeroBlocksWhenRequestHeightIsLargerThanLocalHeight() {
+			AssertNoBlocks(10, 1, Height(11));
+			AssertNoBlocks(10, 5, Height(23));
+		}
+
+		static void AssertLoadBlocks_LoadsZeroBlocksWhenMaxBlocksIsZero() {
+			AssertNoBlocks(10, 0, Height(5));
+		}
+
+		static void AssertLoadBlocks_CanLoadSingleBlock() {
+			AssertCanLoadBlocks(10, 1, std::numeric_limits<size_t>::max(), Height(5), 1);
+		}
+
+		static void AssertLoadBlocks_LoadsAtMostMaxBlocks() {
+			AssertCanLoadBlocks(10, 6, std::numeric_limits<size_t>::max(), Height(2), 6);
+		}
+
+		static void AssertLoadBlocks_LoadsAreBoundedByLastBlock() {
+			AssertCanLoadBlocks(10, 10, std::numeric_limits<size_t>::max(), Height(5), 6);
+		}
+
+		static void AssertLoadBlocks_LoadsAreBoundedByMaxBytes() {
+			// Arrange:
+			auto pStorage = PrepareStorageWithBlocks(10);
+
+			size_t threeBlocksSize = 0;
+			for (auto i = 0u; i < 3; ++i)
+				threeBlocksSize += pStorage->loadBlock(Height(4 + i))->Size;
+
+			// Assert:
+			AssertLoadedBlocks(*pStorage, 10, threeBlocksSize - 1, Height(4), 2);
+			AssertLoadedBlocks(*pStorage, 10, threeBlocksSize, Height(4), 3);
+			AssertLoadedBlocks(*pStorage, 10, threeBlocksSize + 1, Height(4), 3);
+		}
+
+		static void AssertLoadBlocks_AlwaysLoadsFirstBlock() {
+			AssertCanLoadBlocks(10, 10, 0, Height(4), 1);
+		}
+
+		// endregion
+
 		// region saveBlock - statements
 
 	private:
@@ -531,7 +622,7 @@ namespace catapult { namespace test {
 #define MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, TEST_NAME) \
 	TEST(TEST_CLASS, TEST_NAME) { test::BlockStorageTests<TRAITS_NAME>::Assert##TEST_NAME(); }
 
-#define DEFINE_BLOCK_STORAGE_TESTS(TRAITS_NAME) \
+#define DEFINE_BLOCK_STORAGE_TESTS_WITHOUT_SEED(TRAITS_NAME) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, SavingBlockWithHeightHigherThanChainHeightAltersChainHeight) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanLoadNewlySavedBlock) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanOverwriteBlockWithSameData) \
@@ -545,6 +636,15 @@ namespace catapult { namespace test {
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadHashesFrom_LoadsAreBoundedByLastBlock) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadHashesFrom_LoadsCanCrossIndexFileBoundary) \
 	\
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_LoadsZeroBlocksWhenRequestHeightIsZero) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_LoadsZeroBlocksWhenRequestHeightIsLargerThanLocalHeight) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_LoadsZeroBlocksWhenMaxBlocksIsZero) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_CanLoadSingleBlock) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_LoadsAtMostMaxBlocks) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_LoadsAreBoundedByLastBlock) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_LoadsAreBoundedByMaxBytes) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, LoadBlocks_AlwaysLoadsFirstBlock) \
+	\
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanSaveBlockWithoutStatements) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanSaveBlockWithOnlyTransactionStatements) \
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanSaveBlockWithOnlyAddressResolutions) \
@@ -557,12 +657,14 @@ namespace catapult { namespace test {
 	\
 	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, CanDropBlocksAfterHeight) \
 	\
-	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, StorageSeedInitiallyContainsNemesisBlock) \
-	\
 	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadAtHeightLessThanChainHeight) \
 	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadAtChainHeight) \
 	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CannotLoadAtHeightGreaterThanChainHeight) \
 	DEFINE_BLOCK_STORAGE_LOAD_TESTS(TRAITS_NAME, CanLoadMultipleSaved)
 
+#define DEFINE_BLOCK_STORAGE_TESTS(TRAITS_NAME) \
+	DEFINE_BLOCK_STORAGE_TESTS_WITHOUT_SEED(TRAITS_NAME) \
+	MAKE_BLOCK_STORAGE_TEST(TRAITS_NAME, StorageSeedInitiallyContainsNemesisBlock)
+
 // endregion
 }}
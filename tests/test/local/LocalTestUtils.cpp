@@ -62,11 +62,18 @@ namespace catapult { namespace test {
 
 			config.BlockDisruptorSize = 4 * 1024;
 			config.TransactionDisruptorSize = 16 * 1024;
+			config.NumTransactionHashCalculatorThreads = 1;
 
 			config.OutgoingSecurityMode = ionet::ConnectionSecurityMode::None;
 			config.IncomingSecurityModes = ionet::ConnectionSecurityMode::None;
 
 			config.MaxCacheDatabaseWriteBatchSize = utils::FileSize::FromMegabytes(5);
+			config.CacheDatabaseBlockCacheSize = utils::FileSize::FromMegabytes(256);
+			config.CacheDatabaseWriteBufferBudget = utils::FileSize::FromMegabytes(128);
+			config.MaxPatriciaTreeNodeCacheSize = 100'000;
+			config.PatriciaTreeNodeCachePinnedLevels = 3;
+			config.PatriciaTreeRetainedRoots = 100;
+			config.MaxBlockStorageCacheSize = utils::FileSize::FromMegabytes(50);
 			config.MaxTrackedNodes = 5'000;
 
 			config.Local.Host = "127.0.0.1";
@@ -224,6 +224,21 @@ namespace catapult { namespace test {
 
 	// endregion
 
+	// region prefetch
+
+	/// Extracts prefetch keys from \a notification using all extractors registered by the plugin described by \a TTraits.
+	template<typename TTraits>
+	cache::PrefetchKeys ExtractPrefetchKeys(const model::Notification& notification) {
+		cache::PrefetchKeys keys;
+		TTraits::RunTestAfterRegistration([&notification, &keys](const auto& manager) {
+			auto extractor = manager.createPrefetchKeysExtractor();
+			extractor(notification, model::ResolverContext(), keys);
+		});
+		return keys;
+	}
+
+	// endregion
+
 #define MAKE_PLUGIN_TEST(TEST_CLASS, TEST_TRAITS, TEST_NAME) \
 	TEST(TEST_CLASS, TEST_NAME) { test::Assert##TEST_NAME<TEST_TRAITS>(); }
 
@@ -35,6 +35,19 @@ namespace catapult { namespace tools { namespace benchmark {
 			bool IsVerified = false;
 		};
 
+		struct BenchmarkBatch {
+			BenchmarkEntry* pEntries;
+			size_t NumEntries;
+		};
+
+		std::vector<BenchmarkBatch> CreateBatches(std::vector<BenchmarkEntry>& entries, size_t batchSize) {
+			std::vector<BenchmarkBatch> batches;
+			for (auto i = 0u; i < entries.size(); i += batchSize)
+				batches.push_back({ &entries[i], std::min<size_t>(batchSize, entries.size() - i) });
+
+			return batches;
+		}
+
 		class BenchmarkTool : public Tool {
 		public:
 			std::string name() const override {
@@ -54,6 +67,9 @@ namespace catapult { namespace tools { namespace benchmark {
 				optionsBuilder("data size,s",
 						OptionsValue<uint32_t>(m_dataSize)->default_value(148),
 						"the size of the data to generate");
+				optionsBuilder("batch size,b",
+						OptionsValue<uint32_t>(m_batchSize)->default_value(64),
+						"the number of signatures verified together in a batch");
 			}
 
 			int run(const Options&) override {
@@ -64,7 +80,8 @@ namespace catapult { namespace tools { namespace benchmark {
 						<< "num threads (" << m_numThreads
 						<< "), num partitions (" << m_numPartitions
 						<< "), ops / partition (" << m_opsPerPartition
-						<< "), data size (" << m_dataSize << ")";
+						<< "), data size (" << m_dataSize
+						<< "), batch size (" << m_batchSize << ")";
 
 				auto keyPair = GenerateRandomKeyPair();
 				auto entries = std::vector<BenchmarkEntry>(m_numPartitions * m_opsPerPartition);
@@ -87,6 +104,22 @@ namespace catapult { namespace tools { namespace benchmark {
 						CATAPULT_LOG(warning) << "could not verify data!";
 				});
 
+				auto batches = CreateBatches(entries, std::max<uint32_t>(1, m_batchSize));
+				RunParallel("Verify (batch)", *pPool, batches, entries.size(), [&keyPair](auto& batch) {
+					std::vector<crypto::SignatureInput> signatureInputs;
+					for (auto i = 0u; i < batch.NumEntries; ++i) {
+						const auto& entry = batch.pEntries[i];
+						signatureInputs.push_back({ keyPair.publicKey(), entry.Data, entry.Signature });
+					}
+
+					std::vector<bool> results;
+					if (!crypto::VerifyMulti(signatureInputs.data(), signatureInputs.size(), results))
+						CATAPULT_LOG(warning) << "could not verify data batch!";
+
+					for (auto i = 0u; i < batch.NumEntries; ++i)
+						batch.pEntries[i].IsVerified = results[i];
+				});
+
 				return 0;
 			}
 
@@ -97,16 +130,26 @@ namespace catapult { namespace tools { namespace benchmark {
 					thread::IoServiceThreadPool& pool,
 					std::vector<BenchmarkEntry>& entries,
 					TAction action) const {
+				return RunParallel(testName, pool, entries, entries.size(), action);
+			}
+
+			template<typename TItem, typename TAction>
+			uint64_t RunParallel(
+					const char* testName,
+					thread::IoServiceThreadPool& pool,
+					std::vector<TItem>& items,
+					size_t numOperations,
+					TAction action) const {
 				utils::StackLogger logger(testName, utils::LogLevel::Info);
 				utils::StackTimer stopwatch;
-				thread::ParallelFor(pool.service(), entries, m_numPartitions, [action](auto& entry, auto) {
-					action(entry);
+				thread::ParallelFor(pool.service(), items, m_numPartitions, [action](auto& item, auto) {
+					action(item);
 					return true;
 				}).get();
 
 				auto elapsedMillis = stopwatch.millis();
-				auto elapsedMicrosPerOp = elapsedMillis * 1000u / entries.size();
-				auto opsPerSecond = 0 == elapsedMillis ? 0 : entries.size() * 1000u / elapsedMillis;
+				auto elapsedMicrosPerOp = elapsedMillis * 1000u / numOperations;
+				auto opsPerSecond = 0 == elapsedMillis ? 0 : numOperations * 1000u / elapsedMillis;
 				CATAPULT_LOG(info)
 						<< (0 == opsPerSecond ? "???" : std::to_string(opsPerSecond)) << " ops/s "
 						<< "(elapsed time " << elapsedMillis << "ms, " << elapsedMicrosPerOp << "us/op)";
@@ -118,6 +161,7 @@ namespace catapult { namespace tools { namespace benchmark {
 			uint32_t m_numPartitions;
 			uint32_t m_opsPerPartition;
 			uint32_t m_dataSize;
+			uint32_t m_batchSize;
 		};
 	}
 }}}
@@ -0,0 +1,80 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolMain.h"
+#include "catapult/io/BlockStorageConverter.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/io/PackedFileBlockStorage.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/StackLogger.h"
+#include <iostream>
+
+namespace catapult { namespace tools { namespace blockconvert {
+
+	namespace {
+		class BlockConvertTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Block Storage Converter";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("source,s",
+						OptionsValue<std::string>(m_sourceDirectory)->required(),
+						"directory containing blocks stored one file per block");
+				optionsBuilder("destination,d",
+						OptionsValue<std::string>(m_destinationDirectory),
+						"directory that will contain packed blocks (defaults to the source directory)");
+				optionsBuilder("segmentSize",
+						OptionsValue<uint32_t>(m_maxSegmentSizeMegabytes)->default_value(1024),
+						"maximum size of a packed segment file in megabytes");
+			}
+
+			int run(const Options&) override {
+				if (m_destinationDirectory.empty())
+					m_destinationDirectory = m_sourceDirectory;
+
+				io::FileBlockStorage source(m_sourceDirectory);
+				io::PackedFileBlockStorage destination(m_destinationDirectory, utils::FileSize::FromMegabytes(m_maxSegmentSizeMegabytes));
+				std::cout << "converting blocks from " << m_sourceDirectory << " (height " << source.chainHeight() << ") to "
+						<< m_destinationDirectory << " (height " << destination.chainHeight() << ")" << std::endl;
+
+				uint64_t numConvertedBlocks;
+				{
+					utils::StackLogger stackLogger("converting blocks", utils::LogLevel::Info);
+					numConvertedBlocks = io::ConvertBlockStorage(source, destination);
+				}
+
+				std::cout << "converted " << numConvertedBlocks << " blocks, packed chain height is " << destination.chainHeight() << std::endl;
+				return 0;
+			}
+
+		private:
+			std::string m_sourceDirectory;
+			std::string m_destinationDirectory;
+			uint32_t m_maxSegmentSizeMegabytes;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::blockconvert::BlockConvertTool tool;
+	return catapult::tools::ToolMain(argc, argv, tool);
+}